@@ -18,6 +18,7 @@
 
 #include "../common/global_define.h"
 #include "../common/rulesys.h"
+#include "../common/eqemu_config.h"
 
 #include <ctype.h>
 #include <iomanip>
@@ -120,6 +121,31 @@ bool Database::Connect(
 	}
 }
 
+void Database::ConnectReadReplicas(
+	const std::vector<DatabaseReplicaConfig> &replicas,
+	ReplicaReads mode,
+	uint32 max_lag_seconds,
+	const std::string &connection_label
+)
+{
+	if (replicas.empty()) {
+		return;
+	}
+
+	for (const auto &r: replicas) {
+		AddReadReplica(r.Host, r.Username, r.Password, r.DB, r.Port);
+	}
+
+	if (!HasReadReplicas()) {
+		LogError("Connection [{}] no read replicas available, all reads stay on the primary", connection_label);
+		return;
+	}
+
+	SetReplicaMaxLag(max_lag_seconds);
+	SetReplicaReads(mode);
+	CheckReadReplicas();
+}
+
 uint32 Database::CheckLogin(
 	const std::string& name,
 	const std::string& password,
@@ -1693,6 +1719,9 @@ void Database::ClearInvSnapshots(bool from_now)
 		delete_time -= RuleI(Character, InvSnapshotHistoryD) * 86400;
 	}
 
+	// deltas that outlive their base are rewritten as full snapshots first
+	InventorySnapshotsRepository::RebaseInventorySnapshots(*this, delete_time);
+
 	InventorySnapshotsRepository::DeleteWhere(
 		*this,
 		fmt::format(
@@ -37,6 +37,7 @@
 
 class MySQLRequestResult;
 class Client;
+struct DatabaseReplicaConfig;
 
 namespace EQ {
 	class InventoryProfile;
@@ -96,6 +97,14 @@ public:
 	);
 	~Database();
 
+	// connects the configured read replicas and routes reads to them (see DBcore::ReplicaReads)
+	void ConnectReadReplicas(
+		const std::vector<DatabaseReplicaConfig> &replicas,
+		ReplicaReads mode,
+		uint32 max_lag_seconds,
+		const std::string &connection_label = "default"
+	);
+
 	/* Character Creation */
 	bool DeleteCharacter(const std::string& name);
 	bool MoveCharacterToZone(const std::string& name, uint32 zone_id);
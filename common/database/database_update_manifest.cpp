@@ -6746,6 +6746,30 @@ CREATE TABLE `player_event_aa_purchase` (
 COLLATE='latin1_swedish_ci'
 ENGINE=InnoDB
 ;
+)"
+	},
+	ManifestEntry{
+		.version = 9302,
+		.description = "2024_11_02_player_event_logs_binary_event_data.sql",
+		.check = "SHOW COLUMNS FROM `player_event_logs` LIKE 'event_data_binary'",
+		.condition = "empty",
+		.match = "",
+		.sql = R"(
+ALTER TABLE `player_event_logs`
+	ADD COLUMN `event_data_binary` MEDIUMBLOB NULL DEFAULT NULL AFTER `event_data`;
+)"
+	},
+	ManifestEntry{
+		.version = 9303,
+		.description = "2024_11_03_inventory_snapshots_deltas.sql",
+		.check = "SHOW COLUMNS FROM `inventory_snapshots` LIKE 'base_time_index'",
+		.condition = "empty",
+		.match = "",
+		.sql = R"(
+ALTER TABLE `inventory_snapshots`
+	ADD COLUMN `removed` TINYINT(1) UNSIGNED NOT NULL DEFAULT '0' AFTER `guid`,
+	ADD COLUMN `base_time_index` INT(11) UNSIGNED NOT NULL DEFAULT '0' AFTER `removed`,
+	ADD INDEX `charid_time_index` (`charid`, `time_index`);
 )"
 	}
 // -- template; copy/paste this when you need to create a new entry
@@ -8,7 +8,10 @@
 
 #include "dbcore.h"
 #include "mysql_stmt.h"
+#include "query_profiler.h"
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <iostream>
 #include <mysqld_error.h>
@@ -33,6 +36,162 @@
 #define DEBUG_MYSQL_QUERIES 0
 #endif
 
+// the read session (see DBcore::ReadSession) active on this thread
+static thread_local DBcore *t_read_session_db = nullptr;
+static thread_local uint64  t_read_session_id = 0;
+
+static bool ContainsNoCase(const char *query, uint32 querylen, std::string_view needle)
+{
+	auto end = query + querylen;
+	auto it  = std::search(
+		query, end, needle.begin(), needle.end(), [](char a, char b) {
+			return std::tolower(static_cast<unsigned char>(a)) == b;
+		}
+	);
+
+	return it != end;
+}
+
+// plain SELECTs that do not lock, depend on session state or write anything
+static bool IsReplicaSafeRead(const char *query, uint32 querylen)
+{
+	uint32 i = 0;
+	while (i < querylen && (isspace(static_cast<unsigned char>(query[i])) || query[i] == '(')) {
+		++i;
+	}
+
+	if (querylen - i < 6 || strncasecmp(query + i, "select", 6) != 0) {
+		return false;
+	}
+
+	static const std::string_view unsafe[] = {
+		"for update",
+		"share mode",
+		"for share",
+		"last_insert_id",
+		"found_rows",
+		"row_count",
+		"get_lock",
+		"release_lock",
+		"is_free_lock",
+		"is_used_lock",
+		"@",
+		" into ",
+	};
+
+	for (const auto &u: unsafe) {
+		if (ContainsNoCase(query, querylen, u)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool IsIdentifierChar(char c)
+{
+	return isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' || c == '.';
+}
+
+// reads scoped to one character, every table the query names is a character_ table owned by that character
+// parcels and corpses are written by other characters' sessions so they always read from the primary
+// anything that does not parse as plain FROM / JOIN table references (subqueries, comma joins) is not scoped
+static bool IsSessionScopedRead(const char *query, uint32 querylen)
+{
+	static const std::string_view shared[] = {
+		"character_parcels",
+		"character_corpse",
+	};
+
+	const std::string_view q(query, querylen);
+
+	auto is_keyword_at = [&](size_t i, std::string_view keyword) {
+		return i + keyword.size() < q.size() &&
+			(i == 0 || !IsIdentifierChar(q[i - 1])) &&
+			strncasecmp(q.data() + i, keyword.data(), keyword.size()) == 0 &&
+			isspace(static_cast<unsigned char>(q[i + keyword.size()]));
+	};
+
+	auto skip_space = [&](size_t i) {
+		while (i < q.size() && isspace(static_cast<unsigned char>(q[i]))) {
+			++i;
+		}
+		return i;
+	};
+
+	uint32 tables = 0;
+	for (size_t i = 0; i < q.size(); ++i) {
+		if (!is_keyword_at(i, "from") && !is_keyword_at(i, "join")) {
+			continue;
+		}
+
+		size_t start = skip_space(i + 4);
+		if (start < q.size() && q[start] == '`') {
+			++start;
+		}
+
+		size_t end = start;
+		while (end < q.size() && IsIdentifierChar(q[end])) {
+			++end;
+		}
+
+		auto table = q.substr(start, end - start);
+		if (auto dot = table.rfind('.'); dot != std::string_view::npos) {
+			table.remove_prefix(dot + 1);
+		}
+
+		if (table.size() < 10 || strncasecmp(table.data(), "character_", 10) != 0) {
+			return false;
+		}
+
+		for (const auto &s: shared) {
+			if (table.size() >= s.size() && strncasecmp(table.data(), s.data(), s.size()) == 0) {
+				return false;
+			}
+		}
+
+		// a comma after the table or its alias names another table
+		size_t next = end < q.size() && q[end] == '`' ? end + 1 : end;
+		for (int token = 0; token < 3; ++token) {
+			next = skip_space(next);
+			if (next >= q.size() || q[next] == ',') {
+				break;
+			}
+
+			while (next < q.size() && IsIdentifierChar(q[next])) {
+				++next;
+			}
+		}
+
+		if (next < q.size() && q[next] == ',') {
+			return false;
+		}
+
+		++tables;
+		i = end;
+	}
+
+	return tables > 0;
+}
+
+// bytes held by a buffered result, only walked while the query profiler is enabled
+static uint64 GetResultBytes(MYSQL_RES *res)
+{
+	uint64       bytes  = 0;
+	const uint32 fields = mysql_num_fields(res);
+
+	while (mysql_fetch_row(res)) {
+		const unsigned long *lengths = mysql_fetch_lengths(res);
+		for (uint32 i = 0; i < fields; ++i) {
+			bytes += lengths[i];
+		}
+	}
+
+	mysql_data_seek(res, 0);
+
+	return bytes;
+}
+
 DBcore::DBcore()
 {
 	mysql      = mysql_init(nullptr);
@@ -49,6 +208,8 @@ DBcore::DBcore()
 
 DBcore::~DBcore()
 {
+	ClearPreparedStmts();
+
 	/**
 	 * This prevents us from doing a double free in multi-tenancy setups where we
 	 * are re-using the default database connection pointer when we dont have an
@@ -67,6 +228,8 @@ DBcore::~DBcore()
 // Sends the MySQL server a keepalive
 void DBcore::ping()
 {
+	CheckReadReplicas();
+
 	if (!m_mutex->trylock()) {
 		// well, if's it's locked, someone's using it. If someone's using it, it doesnt need a keepalive
 		return;
@@ -90,6 +253,28 @@ bool DBcore::DoesTableExist(const std::string& table_name)
 
 MySQLRequestResult DBcore::QueryDatabase(const char *query, uint32 querylen, bool retryOnFailureOnce)
 {
+	if (!m_replicas.empty()) {
+		const bool replica_read = IsReplicaSafeRead(query, querylen) &&
+			(m_replica_reads != ReplicaReads::Sessions || IsSessionScopedRead(query, querylen));
+
+		if (replica_read) {
+			if (auto replica = GetReadReplica()) {
+				auto r = replica->db->QueryDatabase(query, querylen, retryOnFailureOnce);
+
+				// query errors are returned as is, only a lost replica falls back to the primary
+				if (r.Success() || replica->db->GetStatus() == Connected) {
+					return r;
+				}
+
+				replica->healthy = false;
+				LogMySQLError("Read replica [{}] connection lost, reads fall back to the primary", replica->label);
+			}
+		}
+		else if (!IsReplicaSafeRead(query, querylen)) {
+			MarkWrite(query, querylen);
+		}
+	}
+
 	BenchTimer timer;
 	timer.reset();
 
@@ -152,6 +337,16 @@ MySQLRequestResult DBcore::QueryDatabase(const char *query, uint32 querylen, boo
 		rowCount = (uint32) mysql_num_rows(res);
 	}
 
+	auto profiler = QueryProfiler::Instance();
+	if (profiler->IsEnabled()) {
+		profiler->Record(
+			std::string_view(query, querylen),
+			timer.elapsedMicroseconds(),
+			res ? rowCount : mysql_affected_rows(mysql),
+			querylen + (res ? GetResultBytes(res) : 0)
+		);
+	}
+
 	MySQLRequestResult requestResult(
 		res,
 		(uint32) mysql_affected_rows(mysql),
@@ -184,19 +379,111 @@ MySQLRequestResult DBcore::QueryDatabase(const char *query, uint32 querylen, boo
 	return requestResult;
 }
 
+bool DBcore::QueryDatabaseStream(const std::string &query, const RowVisitor &visitor, bool retryOnFailureOnce)
+{
+	if (!m_replicas.empty() && !IsReplicaSafeRead(query.c_str(), query.length())) {
+		MarkWrite(query.c_str(), query.length());
+	}
+
+	BenchTimer timer;
+	timer.reset();
+
+	LockMutex lock(m_mutex);
+
+	if (pStatus != Connected) {
+		Open();
+	}
+
+	if (mysql_real_query(mysql, query.c_str(), query.length()) != 0) {
+		unsigned int error_number = mysql_errno(mysql);
+
+		if (error_number == CR_SERVER_LOST || error_number == CR_SERVER_GONE_ERROR) {
+			pStatus = Error;
+
+			// nothing has been visited yet so the query can be safely re-issued
+			if (retryOnFailureOnce) {
+				LogInfo("Database Error: Lost connection, attempting to recover");
+				return QueryDatabaseStream(query, visitor, false);
+			}
+		}
+
+		LogMySQLError("MySQL Error ({}) [{}] Query [{}]", error_number, mysql_error(mysql), query);
+
+		return false;
+	}
+
+	// the unbuffered result must always be drained and freed, even if the visitor throws
+	std::unique_ptr<MYSQL_RES, decltype(&mysql_free_result)> res(mysql_use_result(mysql), &mysql_free_result);
+	if (!res) {
+		if (mysql_errno(mysql) > 0) {
+			LogMySQLError("MySQL Error ({}) [{}] Query [{}]", mysql_errno(mysql), mysql_error(mysql), query);
+			return false;
+		}
+
+		return true; // statement produced no result set
+	}
+
+	const uint32 column_count = mysql_num_fields(res.get());
+	uint32       row_count    = 0;
+	bool         stopped      = false;
+
+	const bool profile = QueryProfiler::Instance()->IsEnabled();
+	uint64     bytes   = query.length();
+
+	while (MYSQL_ROW row = mysql_fetch_row(res.get())) {
+		++row_count;
+
+		if (profile) {
+			const unsigned long *lengths = mysql_fetch_lengths(res.get());
+			for (uint32 i = 0; i < column_count; ++i) {
+				bytes += lengths[i];
+			}
+		}
+
+		if (!visitor(row, column_count)) {
+			stopped = true;
+			break;
+		}
+	}
+
+	// mysql_fetch_row returns null on both the end of the result set and errors
+	if (!stopped && mysql_errno(mysql) > 0) {
+		LogMySQLError("MySQL Error ({}) [{}] Query [{}]", mysql_errno(mysql), mysql_error(mysql), query);
+		return false;
+	}
+
+	if (profile) {
+		QueryProfiler::Instance()->Record(query, timer.elapsedMicroseconds(), row_count, bytes);
+	}
+
+	LogMySQLQuery(
+		"{0} -- ({1} row{2} streamed) ({3}s)",
+		query,
+		row_count,
+		row_count == 1 ? "" : "s",
+		std::to_string(timer.elapsed())
+	);
+
+	return true;
+}
+
 void DBcore::TransactionBegin()
 {
+	// reads inside a transaction must see its own writes, keep them on the primary
+	m_in_transaction = true;
 	QueryDatabase("START TRANSACTION");
 }
 
 void DBcore::TransactionCommit()
 {
 	QueryDatabase("COMMIT");
+	m_in_transaction = false;
 }
 
 void DBcore::TransactionRollback()
 {
 	QueryDatabase("ROLLBACK");
+	m_in_transaction = false;
 }
 
 uint32 DBcore::DoEscapeString(char *tobuf, const char *frombuf, uint32 fromlen)
@@ -243,6 +530,7 @@ bool DBcore::Open(uint32 *errnum, char *errbuf)
 		return true;
 	}
 	if (GetStatus() == Error) {
+		m_stmt_cache.clear();
 		mysql_close(mysql);
 		mysql_init(mysql);        // Initialize structure again
 	}
@@ -302,6 +590,8 @@ std::string DBcore::Escape(const std::string& s)
 
 void DBcore::SetMutex(Mutex *mutex)
 {
+	// cached statements hold the old mutex for their deleter
+	ClearPreparedStmts();
 	safe_delete(m_mutex);
 
 	DBcore::m_mutex = mutex;
@@ -312,6 +602,10 @@ void DBcore::SetMutex(Mutex *mutex)
 // this was built and maintained for database migrations only
 MySQLRequestResult DBcore::QueryDatabaseMulti(const std::string &query)
 {
+	if (!m_replicas.empty()) {
+		MarkWrite(query.c_str(), query.length());
+	}
+
 	SetMultiStatementsOn();
 
 	BenchTimer timer;
@@ -438,7 +732,252 @@ MySQLRequestResult DBcore::QueryDatabaseMulti(const std::string &query)
 	return r;
 }
 
+// prepared statements always run on the primary, callers execute right after preparing or fetching them
+// so a write statement is recorded here as the session's write
 mysql::PreparedStmt DBcore::Prepare(std::string query)
 {
+	if (!m_replicas.empty() && !IsReplicaSafeRead(query.c_str(), query.length())) {
+		MarkWrite(query.c_str(), query.length());
+	}
+
 	return mysql::PreparedStmt(*mysql, std::move(query), m_mutex);
 }
+
+mysql::PreparedStmt& DBcore::GetPreparedStmt(const std::string& query)
+{
+	if (!m_replicas.empty() && !IsReplicaSafeRead(query.c_str(), query.length())) {
+		MarkWrite(query.c_str(), query.length());
+	}
+
+	LockMutex lock(m_mutex);
+
+	if (pStatus != Connected) {
+		m_stmt_cache.clear();
+		Open();
+	}
+
+	auto it = m_stmt_cache.find(query);
+	if (it == m_stmt_cache.end()) {
+		auto stmt = std::make_unique<mysql::PreparedStmt>(*mysql, query, m_mutex);
+		it = m_stmt_cache.emplace(query, std::move(stmt)).first;
+	}
+
+	return *it->second;
+}
+
+void DBcore::ClearPreparedStmt(const std::string& query)
+{
+	LockMutex lock(m_mutex);
+	m_stmt_cache.erase(query);
+}
+
+void DBcore::ClearPreparedStmts()
+{
+	LockMutex lock(m_mutex);
+	m_stmt_cache.clear();
+}
+
+bool DBcore::AddReadReplica(
+	const std::string &host,
+	const std::string &user,
+	const std::string &password,
+	const std::string &database,
+	uint32 port
+)
+{
+	auto r = std::make_unique<ReadReplica>();
+	r->db    = std::make_unique<DBcore>();
+	r->label = fmt::format("{}:{}", host, port);
+
+	uint32 error_number = 0;
+	char   error_buffer[MYSQL_ERRMSG_SIZE];
+
+	if (!r->db->Open(
+		host.c_str(),
+		user.c_str(),
+		password.c_str(),
+		database.c_str(),
+		port,
+		&error_number,
+		error_buffer
+	)) {
+		LogError("Failed to connect to read replica [{}] Error [{}]", r->label, error_buffer);
+		return false;
+	}
+
+	LogInfo("Connected to read replica [{}] [{}]", r->label, database);
+
+	m_replicas.emplace_back(std::move(r));
+
+	return true;
+}
+
+DBcore::ReadReplica *DBcore::GetReadReplica()
+{
+	if (m_replica_reads == ReplicaReads::Off || m_in_transaction) {
+		return nullptr;
+	}
+
+	const bool in_session = t_read_session_db == this;
+	if (m_replica_reads == ReplicaReads::Sessions && !in_session) {
+		return nullptr;
+	}
+
+	// a replica lagging less than the time since the session's last write has that write
+	// character writes made outside any session (saves from timers, world) count for every session
+	uint32 since_write = UINT32_MAX;
+	if (in_session) {
+		since_write = std::min(GetSecondsSinceSessionWrite(t_read_session_id), GetSecondsSince(m_unscoped_write));
+	}
+
+	const uint32 start = m_replica_cursor++;
+	for (uint32 i = 0; i < m_replicas.size(); ++i) {
+		auto &r = m_replicas[(start + i) % m_replicas.size()];
+		if (!r->healthy) {
+			continue;
+		}
+
+		// replication lag is reported in whole seconds
+		const uint32 lag = r->lag;
+		if (lag <= m_replica_max_lag && (since_write == UINT32_MAX || since_write > lag + 1)) {
+			return r.get();
+		}
+	}
+
+	return nullptr;
+}
+
+void DBcore::CheckReadReplicas()
+{
+	for (auto &r: m_replicas) {
+		auto results = r->db->QueryDatabase(r->status_query, false);
+
+		// SHOW REPLICA STATUS is MySQL 8.0.22+ / MariaDB 10.5.1+
+		if (!results.Success() && results.ErrorNumber() == ER_PARSE_ERROR && r->status_query != "SHOW SLAVE STATUS") {
+			r->status_query = "SHOW SLAVE STATUS";
+			results = r->db->QueryDatabase(r->status_query, false);
+		}
+
+		bool   healthy = results.Success();
+		uint32 lag     = 0;
+
+		// no replication configured, a standalone copy is always current
+		if (healthy && results.RowCount() > 0) {
+			int column = -1;
+			for (int i = 0; i < (int) results.ColumnCount(); ++i) {
+				const auto name = results.FieldName(i);
+				if (name == "Seconds_Behind_Source" || name == "Seconds_Behind_Master") {
+					column = i;
+					break;
+				}
+			}
+
+			auto row = results.begin();
+			if (column >= 0) {
+				// NULL when the replication threads are stopped
+				healthy = row[column] != nullptr;
+				lag     = healthy ? Strings::ToUnsignedInt(row[column]) : 0;
+			}
+		}
+
+		const bool usable = healthy && lag <= m_replica_max_lag;
+		if (usable != (r->healthy && r->lag <= m_replica_max_lag)) {
+			if (usable) {
+				LogInfo("Read replica [{}] is back in rotation lag [{}s]", r->label, lag);
+			}
+			else {
+				LogWarning(
+					"Read replica [{}] taken out of rotation healthy [{}] lag [{}s] max lag [{}s]",
+					r->label,
+					healthy,
+					lag,
+					m_replica_max_lag
+				);
+			}
+		}
+
+		r->lag     = lag;
+		r->healthy = healthy;
+	}
+
+	// sessions that have not written in a while are safe to forget
+	if (m_replica_reads == ReplicaReads::Sessions) {
+		std::lock_guard<std::mutex> lock(m_session_mutex);
+
+		const auto expire = std::chrono::steady_clock::now() - std::chrono::minutes(10);
+		for (auto it = m_session_writes.begin(); it != m_session_writes.end();) {
+			it = it->second < expire ? m_session_writes.erase(it) : std::next(it);
+		}
+	}
+}
+
+void DBcore::MarkSessionWrite(uint64 session_id)
+{
+	std::lock_guard<std::mutex> lock(m_session_mutex);
+	m_session_writes[session_id] = std::chrono::steady_clock::now();
+}
+
+void DBcore::EndSession(uint64 session_id)
+{
+	std::lock_guard<std::mutex> lock(m_session_mutex);
+	m_session_writes.erase(session_id);
+}
+
+void DBcore::MarkWrite(const char *query, uint32 querylen)
+{
+	if (m_replica_reads != ReplicaReads::Sessions) {
+		return;
+	}
+
+	if (t_read_session_db == this) {
+		MarkSessionWrite(t_read_session_id);
+	}
+	else if (ContainsNoCase(query, querylen, "character_")) {
+		m_unscoped_write = std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+}
+
+uint32 DBcore::GetSecondsSince(const std::atomic<int64> &ticks)
+{
+	if (ticks == 0) {
+		return UINT32_MAX;
+	}
+
+	const auto at = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(ticks.load()));
+
+	return static_cast<uint32>(
+		std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - at).count()
+	);
+}
+
+uint32 DBcore::GetSecondsSinceSessionWrite(uint64 session_id)
+{
+	std::lock_guard<std::mutex> lock(m_session_mutex);
+
+	auto it = m_session_writes.find(session_id);
+	if (it == m_session_writes.end()) {
+		return UINT32_MAX;
+	}
+
+	return static_cast<uint32>(
+		std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - it->second).count()
+	);
+}
+
+DBcore::ReadSession::ReadSession(DBcore &db, uint64 session_id)
+	: m_prev_db(t_read_session_db), m_prev_session_id(t_read_session_id)
+{
+	t_read_session_db = &db;
+	t_read_session_id = session_id;
+
+	if (db.m_replica_reads == ReplicaReads::Sessions) {
+		std::lock_guard<std::mutex> lock(db.m_session_mutex);
+		db.m_session_writes.try_emplace(session_id, std::chrono::steady_clock::now());
+	}
+}
+
+DBcore::ReadSession::~ReadSession()
+{
+	t_read_session_db = m_prev_db;
+	t_read_session_id = m_prev_session_id;
+}
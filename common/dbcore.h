@@ -12,7 +12,13 @@
 
 #include <mysql.h>
 #include <string.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #define CR_SERVER_GONE_ERROR    2006
 #define CR_SERVER_LOST          2013
@@ -31,6 +37,12 @@ public:
 	MySQLRequestResult QueryDatabase(const char *query, uint32 querylen, bool retryOnFailureOnce = true);
 	MySQLRequestResult QueryDatabase(const std::string& query, bool retryOnFailureOnce = true);
 	MySQLRequestResult QueryDatabaseMulti(const std::string &query);
+
+	// visits rows as they arrive from the server (mysql_use_result) instead of buffering the
+	// whole result set client side first; return false from the visitor to stop early
+	// the connection is locked until the result is drained, the visitor must not query this connection
+	using RowVisitor = std::function<bool(MYSQL_ROW row, uint32 column_count)>;
+	bool QueryDatabaseStream(const std::string &query, const RowVisitor &visitor, bool retryOnFailureOnce = true);
 	void TransactionBegin();
 	void TransactionCommit();
 	void TransactionRollback();
@@ -55,6 +67,54 @@ public:
 	// throws std::runtime_error on failure
 	mysql::PreparedStmt Prepare(std::string query);
 
+	// returns a statement prepared once per connection and cached by query text
+	// cached statements are dropped when the connection is re-opened
+	// same threading restrictions as Prepare, throws std::runtime_error on failure
+	mysql::PreparedStmt& GetPreparedStmt(const std::string& query);
+	void ClearPreparedStmt(const std::string& query);
+	void ClearPreparedStmts();
+
+	// read replicas, non-transactional SELECTs issued through QueryDatabase can be served by a replica
+	// All      - every read (content)
+	// Sessions - only reads of character_ tables made inside a ReadSession whose session, or the unscoped
+	//            character writes (timers, world), have not written recently
+	// writes on every path (queries, streams, multi statements, prepared statements) are recorded against the session
+	// replicas lagging past the max lag, or with replication stopped, are skipped until they catch up
+	enum class ReplicaReads {
+		Off, All, Sessions
+	};
+
+	bool AddReadReplica(
+		const std::string &host,
+		const std::string &user,
+		const std::string &password,
+		const std::string &database,
+		uint32 port
+	);
+	void SetReplicaReads(ReplicaReads mode) { m_replica_reads = mode; }
+	void SetReplicaMaxLag(uint32 seconds) { m_replica_max_lag = seconds; }
+	bool HasReadReplicas() const { return !m_replicas.empty(); }
+	void CheckReadReplicas();
+	// a session starting (zone in) counts as having just written, it may have zoned from another process
+	void MarkSessionWrite(uint64 session_id);
+	void EndSession(uint64 session_id);
+
+	// scopes the reads and writes this thread makes on behalf of one session (character)
+	// reads go to a replica only once it has caught up with the session's last write
+	// a session not yet started counts as having just written
+	class ReadSession {
+	public:
+		ReadSession(DBcore &db, uint64 session_id);
+		~ReadSession();
+
+		ReadSession(const ReadSession &) = delete;
+		ReadSession &operator=(const ReadSession &) = delete;
+
+	private:
+		DBcore *m_prev_db;
+		uint64 m_prev_session_id;
+	};
+
 protected:
 	bool Open(
 		const char *iHost,
@@ -80,6 +140,31 @@ private:
 
 	std::string origin_host;
 
+	std::unordered_map<std::string, std::unique_ptr<mysql::PreparedStmt>> m_stmt_cache;
+
+	struct ReadReplica {
+		std::unique_ptr<DBcore> db;
+		std::string             label;
+		std::string             status_query = "SHOW REPLICA STATUS";
+		std::atomic<bool>       healthy{true};
+		std::atomic<uint32>     lag{0};
+	};
+
+	ReadReplica *GetReadReplica();
+	uint32 GetSecondsSinceSessionWrite(uint64 session_id);
+	void MarkWrite(const char *query, uint32 querylen);
+	static uint32 GetSecondsSince(const std::atomic<int64> &ticks);
+
+	std::vector<std::unique_ptr<ReadReplica>> m_replicas;
+	std::atomic<uint32>                       m_replica_cursor{0};
+	ReplicaReads                              m_replica_reads   = ReplicaReads::Off;
+	uint32                                    m_replica_max_lag = 5;
+	std::atomic<bool>                         m_in_transaction{false};
+
+	std::mutex                                                        m_session_mutex;
+	std::unordered_map<uint64, std::chrono::steady_clock::time_point> m_session_writes;
+	std::atomic<int64>                                                m_unscoped_write{0}; // steady_clock ticks
+
 	char   *pHost;
 	char   *pUser;
 	char   *pPassword;
@@ -139,6 +139,51 @@ void EQEmuConfig::parse_config()
 	ContentDbPort     = Strings::ToUnsignedInt(_root["server"]["content_database"].get("port", 0).asString());
 	ContentDbName     = _root["server"]["content_database"].get("db", "").asString();
 
+	/**
+	 * Read replicas - unset fields default to the primary they replicate
+	 */
+	auto parse_replicas = [](const Json::Value &replicas, const std::string &username, const std::string &password, const std::string &db, uint16 port) {
+		std::vector<DatabaseReplicaConfig> v;
+		for (const auto &r: replicas) {
+			DatabaseReplicaConfig c;
+			c.Host     = r.get("host", "").asString();
+			c.Username = r.get("username", username).asString();
+			c.Password = r.get("password", password).asString();
+			c.DB       = r.get("db", db).asString();
+			c.Port     = Strings::ToUnsignedInt(r.get("port", std::to_string(port)).asString());
+
+			if (!c.Host.empty()) {
+				v.emplace_back(c);
+			}
+		}
+
+		return v;
+	};
+
+	DatabaseReplicas = parse_replicas(
+		_root["server"]["database"]["replicas"],
+		DatabaseUsername,
+		DatabasePassword,
+		DatabaseDB,
+		DatabasePort
+	);
+
+	ContentDbReplicas = ContentDbHost.empty() ? parse_replicas(
+		_root["server"]["content_database"]["replicas"],
+		DatabaseUsername,
+		DatabasePassword,
+		DatabaseDB,
+		DatabasePort
+	) : parse_replicas(
+		_root["server"]["content_database"]["replicas"],
+		ContentDbUsername,
+		ContentDbPassword,
+		ContentDbName,
+		ContentDbPort
+	);
+
+	DatabaseReplicaMaxLag = Strings::ToUnsignedInt(_root["server"]["database"].get("replica_max_lag_seconds", "5").asString());
+
 	/**
 	 * QS
 	 */
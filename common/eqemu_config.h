@@ -22,6 +22,7 @@
 #include "linked_list.h"
 #include "path_manager.h"
 #include <fstream>
+#include <vector>
 #include <fmt/format.h>
 
 struct LoginConfig {
@@ -32,6 +33,14 @@ struct LoginConfig {
 	bool LoginLegacy;
 };
 
+struct DatabaseReplicaConfig {
+	std::string Host;
+	std::string Username;
+	std::string Password;
+	std::string DB;
+	uint16      Port;
+};
+
 class EQEmuConfig
 {
 	public:
@@ -76,6 +85,11 @@ class EQEmuConfig
 		std::string ContentDbName;
 		uint16      ContentDbPort;
 
+		// From <database/replicas> and <content_database/replicas>
+		std::vector<DatabaseReplicaConfig> DatabaseReplicas;
+		std::vector<DatabaseReplicaConfig> ContentDbReplicas;
+		uint32                             DatabaseReplicaMaxLag;
+
 		// From <qsdatabase> // QueryServ
 		std::string QSDatabaseHost;
 		std::string QSDatabaseUsername;
@@ -35,6 +35,13 @@
 
 std::ofstream process_log;
 
+namespace {
+	thread_local bool defer_logs = false;
+
+	// a main loop that stopped draining must not grow the queue forever
+	constexpr size_t MAX_DEFERRED_LOGS = 10000;
+}
+
 #include <filesystem>
 
 #ifdef _WINDOWS
@@ -438,16 +445,14 @@ void EQEmuLogSys::Out(
 	...
 )
 {
-	auto l = GetLogsEnabled(debug_level, log_category);
+	// queued unconditionally, log settings are only read on the main thread
+	if (!defer_logs) {
+		auto l = GetLogsEnabled(debug_level, log_category);
 
-	// bail out if nothing to log
-	if (!l.log_enabled) {
-		return;
-	}
-
-	std::string prefix;
-	if (RuleB(Logging, PrintFileFunctionAndLine)) {
-		prefix = fmt::format("[{0}::{1}:{2}] ", std::filesystem::path(file).filename().string(), func, line);
+		// bail out if nothing to log
+		if (!l.log_enabled) {
+			return;
+		}
 	}
 
 	// remove this when we remove all legacy logs
@@ -469,6 +474,37 @@ void EQEmuLogSys::Out(
 		va_end(args);
 	}
 
+	if (defer_logs) {
+		std::lock_guard<std::mutex> lock(m_deferred_logs_lock);
+		if (m_deferred_logs.size() < MAX_DEFERRED_LOGS) {
+			m_deferred_logs.push_back({debug_level, log_category, file, func, line, std::move(output_message)});
+		}
+
+		return;
+	}
+
+	Write(debug_level, log_category, file, func, line, output_message);
+}
+
+void EQEmuLogSys::Write(
+	Logs::DebugLevel debug_level,
+	uint16 log_category,
+	const char *file,
+	const char *func,
+	int line,
+	const std::string &output_message
+)
+{
+	auto l = GetLogsEnabled(debug_level, log_category);
+	if (!l.log_enabled) {
+		return;
+	}
+
+	std::string prefix;
+	if (RuleB(Logging, PrintFileFunctionAndLine)) {
+		prefix = fmt::format("[{0}::{1}:{2}] ", std::filesystem::path(file).filename().string(), func, line);
+	}
+
 	if (l.log_to_console_enabled) {
 		EQEmuLogSys::ProcessConsoleMessage(
 			log_category,
@@ -492,6 +528,28 @@ void EQEmuLogSys::Out(
 	}
 }
 
+void EQEmuLogSys::DeferLogsOnThisThread(bool defer)
+{
+	defer_logs = defer;
+}
+
+void EQEmuLogSys::ProcessDeferredLogs()
+{
+	std::vector<DeferredLog> logs;
+	{
+		std::lock_guard<std::mutex> lock(m_deferred_logs_lock);
+		if (m_deferred_logs.empty()) {
+			return;
+		}
+
+		logs.swap(m_deferred_logs);
+	}
+
+	for (const auto &e: logs) {
+		Write(e.debug_level, e.log_category, e.file, e.func, e.line, e.message);
+	}
+}
+
 /**
  * @param time_stamp
  */
@@ -802,6 +860,11 @@ EQEmuLogSys::LogEnabled EQEmuLogSys::GetLogsEnabled(const Logs::DebugLevel &debu
 
 bool EQEmuLogSys::IsLogEnabled(const Logs::DebugLevel &debug_level, const uint16 &log_category)
 {
+	// deferring threads never read the settings, ProcessDeferredLogs filters on the main thread
+	if (defer_logs) {
+		return true;
+	}
+
 	return GetLogsEnabled(debug_level, log_category).log_enabled;
 }
 
@@ -26,6 +26,9 @@
 #include <cstdio>
 #include <functional>
 #include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #ifdef utf16_to_utf8
@@ -303,6 +306,14 @@ public:
 		...
 	);
 
+	/**
+	 * Outputs and their hooks (gmsay, discord) are not thread safe. A background thread calls
+	 * DeferLogsOnThisThread once, its logs are then queued and written out by the main loop
+	 * calling ProcessDeferredLogs
+	 */
+	static void DeferLogsOnThisThread(bool defer = true);
+	void ProcessDeferredLogs();
+
 	/**
 	 * Used in file logs to prepend a timestamp entry for logs
 	 * @param time_stamp
@@ -426,6 +437,27 @@ private:
 	);
 	void ProcessLogWrite(uint16 log_category, const std::string &message);
 	void InjectTablesIfNotExist();
+
+	void Write(
+		Logs::DebugLevel debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const std::string &message
+	);
+
+	struct DeferredLog {
+		Logs::DebugLevel debug_level;
+		uint16           log_category;
+		const char       *file;
+		const char       *func;
+		int              line;
+		std::string      message;
+	};
+
+	std::mutex               m_deferred_logs_lock;
+	std::vector<DeferredLog> m_deferred_logs;
 };
 
 extern EQEmuLogSys LogSys;
@@ -0,0 +1,123 @@
+#include "player_event_codec.h"
+#include "../eqemu_logsys.h"
+
+namespace {
+	// calls f with a default constructed payload struct of the event type, false for events without one
+	template<typename F>
+	bool VisitEventType(int32 event_type_id, F &&f)
+	{
+		switch (event_type_id) {
+			case PlayerEvent::GM_COMMAND: f(PlayerEvent::GMCommandEvent{}); return true;
+			case PlayerEvent::ZONING: f(PlayerEvent::ZoningEvent{}); return true;
+			case PlayerEvent::AA_GAIN: f(PlayerEvent::AAGainedEvent{}); return true;
+			case PlayerEvent::AA_PURCHASE: f(PlayerEvent::AAPurchasedEvent{}); return true;
+			case PlayerEvent::FORAGE_SUCCESS: f(PlayerEvent::ForageSuccessEvent{}); return true;
+			case PlayerEvent::FISH_SUCCESS: f(PlayerEvent::FishSuccessEvent{}); return true;
+			case PlayerEvent::ITEM_DESTROY: f(PlayerEvent::DestroyItemEvent{}); return true;
+			case PlayerEvent::LEVEL_GAIN: f(PlayerEvent::LevelGainedEvent{}); return true;
+			case PlayerEvent::LEVEL_LOSS: f(PlayerEvent::LevelLostEvent{}); return true;
+			case PlayerEvent::LOOT_ITEM: f(PlayerEvent::LootItemEvent{}); return true;
+			case PlayerEvent::MERCHANT_PURCHASE: f(PlayerEvent::MerchantPurchaseEvent{}); return true;
+			case PlayerEvent::MERCHANT_SELL: f(PlayerEvent::MerchantSellEvent{}); return true;
+			case PlayerEvent::GROUNDSPAWN_PICKUP: f(PlayerEvent::GroundSpawnPickupEvent{}); return true;
+			case PlayerEvent::NPC_HANDIN: f(PlayerEvent::HandinEvent{}); return true;
+			case PlayerEvent::SKILL_UP: f(PlayerEvent::SkillUpEvent{}); return true;
+			case PlayerEvent::TASK_ACCEPT: f(PlayerEvent::TaskAcceptEvent{}); return true;
+			case PlayerEvent::TASK_UPDATE: f(PlayerEvent::TaskUpdateEvent{}); return true;
+			case PlayerEvent::TASK_COMPLETE: f(PlayerEvent::TaskCompleteEvent{}); return true;
+			case PlayerEvent::TRADE: f(PlayerEvent::TradeEvent{}); return true;
+			case PlayerEvent::SAY: f(PlayerEvent::SayEvent{}); return true;
+			case PlayerEvent::REZ_ACCEPTED: f(PlayerEvent::ResurrectAcceptEvent{}); return true;
+			case PlayerEvent::DEATH: f(PlayerEvent::DeathEvent{}); return true;
+			case PlayerEvent::COMBINE_FAILURE:
+			case PlayerEvent::COMBINE_SUCCESS: f(PlayerEvent::CombineEvent{}); return true;
+			case PlayerEvent::DROPPED_ITEM: f(PlayerEvent::DroppedItemEvent{}); return true;
+			case PlayerEvent::SPLIT_MONEY: f(PlayerEvent::SplitMoneyEvent{}); return true;
+			case PlayerEvent::TRADER_PURCHASE: f(PlayerEvent::TraderPurchaseEvent{}); return true;
+			case PlayerEvent::TRADER_SELL: f(PlayerEvent::TraderSellEvent{}); return true;
+			case PlayerEvent::DISCOVER_ITEM: f(PlayerEvent::DiscoverItemEvent{}); return true;
+			case PlayerEvent::POSSIBLE_HACK: f(PlayerEvent::PossibleHackEvent{}); return true;
+			case PlayerEvent::KILLED_NPC:
+			case PlayerEvent::KILLED_NAMED_NPC:
+			case PlayerEvent::KILLED_RAID_NPC: f(PlayerEvent::KilledNPCEvent{}); return true;
+			case PlayerEvent::ITEM_CREATION: f(PlayerEvent::ItemCreationEvent{}); return true;
+			case PlayerEvent::GUILD_TRIBUTE_DONATE_ITEM: f(PlayerEvent::GuildTributeDonateItem{}); return true;
+			case PlayerEvent::GUILD_TRIBUTE_DONATE_PLAT: f(PlayerEvent::GuildTributeDonatePlat{}); return true;
+			case PlayerEvent::PARCEL_SEND: f(PlayerEvent::ParcelSend{}); return true;
+			case PlayerEvent::PARCEL_RETRIEVE: f(PlayerEvent::ParcelRetrieve{}); return true;
+			case PlayerEvent::PARCEL_DELETE: f(PlayerEvent::ParcelDelete{}); return true;
+			case PlayerEvent::BARTER_TRANSACTION: f(PlayerEvent::BarterTransaction{}); return true;
+			case PlayerEvent::SPEECH: f(PlayerEvent::PlayerSpeech{}); return true;
+			case PlayerEvent::EVOLVE_ITEM: f(PlayerEvent::EvolveItem{}); return true;
+			default:
+				return false;
+		}
+	}
+}
+
+uint8 PlayerEventCodec::GetSchemaVersion(int32 event_type_id)
+{
+	// bump an event type here when its payload struct changes, ex: case PlayerEvent::TRADE: return 2;
+	switch (event_type_id) {
+		default:
+			return 1;
+	}
+}
+
+bool PlayerEventCodec::IsReadable(const PlayerEventLogsRepository::PlayerEventLogs &r)
+{
+	const auto &data = r.event_data_binary;
+	if (data.size() < HEADER_SIZE || static_cast<uint8>(data[0]) != MAGIC) {
+		LogPlayerEvents("Event [{}] has an invalid binary payload", r.id);
+		return false;
+	}
+
+	if (static_cast<uint8>(data[1]) != GetSchemaVersion(r.event_type_id)) {
+		LogPlayerEvents(
+			"Event [{}] type [{}] was encoded with schema version [{}], current is [{}]",
+			r.id,
+			r.event_type_id,
+			static_cast<int>(static_cast<uint8>(data[1])),
+			static_cast<int>(GetSchemaVersion(r.event_type_id))
+		);
+		return false;
+	}
+
+	return true;
+}
+
+std::string PlayerEventCodec::ToJson(const PlayerEventLogsRepository::PlayerEventLogs &r)
+{
+	if (r.event_data_binary.empty()) {
+		return r.event_data;
+	}
+
+	std::string json = "{}";
+	VisitEventType(
+		r.event_type_id, [&](auto e) {
+			if (Decode(r, e)) {
+				json = EncodeJson(e);
+			}
+		}
+	);
+
+	return json;
+}
+
+std::string PlayerEventCodec::ToBinary(const PlayerEventLogsRepository::PlayerEventLogs &r)
+{
+	if (!r.event_data_binary.empty()) {
+		return r.event_data_binary;
+	}
+
+	std::string binary;
+	VisitEventType(
+		r.event_type_id, [&](auto e) {
+			if (r.event_data != "{}" && Decode(r, e)) {
+				binary = EncodeBinary(r.event_type_id, e);
+			}
+		}
+	);
+
+	return binary;
+}
@@ -0,0 +1,89 @@
+#ifndef EQEMU_PLAYER_EVENT_CODEC_H
+#define EQEMU_PLAYER_EVENT_CODEC_H
+
+#include <sstream>
+#include <cereal/archives/binary.hpp>
+#include <cereal/archives/json.hpp>
+#include "../json/json_archive_single_line.h"
+#include "player_events.h"
+
+/**
+ * Compact binary encoding for player event payloads (Logging:PlayerEventsBinaryEncoding)
+ *
+ * Binary payloads are stored in player_event_logs.event_data_binary and event_data is left as {}.
+ * A payload is a two byte header (magic, schema version of the event type) followed by the event
+ * struct written through cereal's binary archive, so field order is the order in serialize()
+ *
+ * Bump the event type in GetSchemaVersion whenever its serialize() changes, payloads written
+ * against another version are refused instead of being read into the wrong fields
+ */
+namespace PlayerEventCodec {
+	constexpr uint8  MAGIC       = 0xEB;
+	constexpr size_t HEADER_SIZE = 2;
+
+	uint8 GetSchemaVersion(int32 event_type_id);
+
+	// validates the header of event_data_binary against the current schema version
+	bool IsReadable(const PlayerEventLogsRepository::PlayerEventLogs &r);
+
+	// event_data as JSON, decoding event_data_binary when it is set
+	std::string ToJson(const PlayerEventLogsRepository::PlayerEventLogs &r);
+
+	// event_data_binary for a row that is still JSON, empty when the event type has no payload
+	std::string ToBinary(const PlayerEventLogsRepository::PlayerEventLogs &r);
+
+	template<typename T>
+	std::string EncodeBinary(int32 event_type_id, T &e)
+	{
+		std::ostringstream ss(std::ios::binary);
+		ss.put(static_cast<char>(MAGIC));
+		ss.put(static_cast<char>(GetSchemaVersion(event_type_id)));
+		{
+			cereal::BinaryOutputArchive ar(ss);
+			e.serialize(ar);
+		}
+
+		return ss.str();
+	}
+
+	template<typename T>
+	std::string EncodeJson(T &e)
+	{
+		std::stringstream ss;
+		{
+			cereal::JSONOutputArchiveSingleLine ar(ss);
+			e.serialize(ar);
+		}
+
+		return ss.str();
+	}
+
+	// reads event_data_binary when it is set and event_data otherwise
+	template<typename T>
+	bool Decode(const PlayerEventLogsRepository::PlayerEventLogs &r, T &out)
+	{
+		try {
+			if (r.event_data_binary.empty()) {
+				std::stringstream        ss(r.event_data);
+				cereal::JSONInputArchive ar(ss);
+				out.serialize(ar);
+				return true;
+			}
+
+			if (!IsReadable(r)) {
+				return false;
+			}
+
+			std::istringstream ss(r.event_data_binary.substr(HEADER_SIZE), std::ios::binary);
+			cereal::BinaryInputArchive ar(ss);
+			out.serialize(ar);
+		}
+		catch (std::exception &) {
+			return false;
+		}
+
+		return true;
+	}
+}
+
+#endif //EQEMU_PLAYER_EVENT_CODEC_H
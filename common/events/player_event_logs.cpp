@@ -1,5 +1,7 @@
 #include "player_event_logs.h"
 #include <cereal/archives/json.hpp>
+#include <algorithm>
+#include <ctime>
 
 #include "../platform.h"
 #include "../rulesys.h"
@@ -11,13 +13,15 @@
 #include "../repositories/player_event_npc_handin_entries_repository.h"
 
 const uint32 PROCESS_RETENTION_TRUNCATION_TIMER_INTERVAL = 60 * 60 * 1000; // 1 hour
+const uint32 RETENTION_DELETE_CHUNK_SIZE                 = 50000; // rows per retention DELETE
+const int64  EVENT_LOG_PARTITION_DAYS_AHEAD              = 7; // daily partitions created ahead of time
 
 // general initialization routine
 void PlayerEventLogs::Init()
 {
 
-	m_process_batch_events_timer.SetTimer(RuleI(Logging, BatchPlayerEventProcessIntervalSeconds) * 1000);
-	m_process_retention_truncation_timer.SetTimer(PROCESS_RETENTION_TRUNCATION_TIMER_INTERVAL);
+	m_next_batch_flush          = std::chrono::steady_clock::now() + std::chrono::seconds(RuleI(Logging, BatchPlayerEventProcessIntervalSeconds));
+	m_next_retention_truncation = std::chrono::steady_clock::now() + std::chrono::milliseconds(PROCESS_RETENTION_TRUNCATION_TIMER_INTERVAL);
 
 	ValidateDatabaseConnection();
 
@@ -41,7 +45,10 @@ void PlayerEventLogs::Init()
 		if (e.id >= PlayerEvent::MAX) {
 			continue;
 		}
-		m_settings[e.id] = e;
+		{
+			std::lock_guard<std::mutex> lock(m_settings_lock);
+			m_settings[e.id] = e;
+		}
 		db.emplace_back(e.id);
 	}
 
@@ -87,9 +94,9 @@ void PlayerEventLogs::Init()
 	bool processing_in_world = !RuleB(Logging, PlayerEventsQSProcess) && IsWorld();
 	bool processing_in_qs    = RuleB(Logging, PlayerEventsQSProcess) && IsQueryServ();
 
-	// on initial boot process truncation
+	// on initial boot process truncation, picked up by the worker on its first pass
 	if (processing_in_world || processing_in_qs) {
-		ProcessRetentionTruncation();
+		m_next_retention_truncation = std::chrono::steady_clock::now();
 	}
 }
 
@@ -123,18 +130,28 @@ bool PlayerEventLogs::IsEventEnabled(PlayerEvent::EventType event)
 	return m_settings[event].event_enabled ? m_settings[event].event_enabled : false;
 }
 
+PlayerEventLogs::SettingsSnapshot PlayerEventLogs::GetSettingsSnapshot()
+{
+	std::lock_guard<std::mutex> lock(m_settings_lock);
+	return SettingsSnapshot(std::begin(m_settings), std::end(m_settings));
+}
+
 // this processes any current player events on the queue
-void PlayerEventLogs::ProcessBatchQueue()
+void PlayerEventLogs::ProcessBatchQueue(const SettingsSnapshot &settings)
 {
-	m_batch_queue_lock.lock();
-	if (m_record_batch_queue.empty()) {
-		m_batch_queue_lock.unlock();
+	// take the queue so producers only ever wait for the swap, not for the flush
+	std::vector<PlayerEventLogsRepository::PlayerEventLogs> queue;
+	{
+		std::lock_guard<std::mutex> lock(m_batch_queue_lock);
+		queue.swap(m_record_batch_queue);
+	}
+
+	if (queue.empty()) {
 		return;
 	}
 
-	static std::map<uint32, uint32> counter{};
-	counter.clear();
-	for (auto const &e: m_record_batch_queue) {
+	std::map<uint32, uint32> counter{};
+	for (auto const &e: queue) {
 		counter[e.event_type_id]++;
 	}
 
@@ -180,11 +197,11 @@ void PlayerEventLogs::ProcessBatchQueue()
 		}
 	}
 
-	// Helper to deserialize event data
-	auto Deserialize = [](const std::string &data, auto &out) {
-		std::stringstream        ss(data);
-		cereal::JSONInputArchive ar(ss);
-		out.serialize(ar);
+	// Helper to deserialize event data, JSON or binary
+	auto Deserialize = [](const PlayerEventLogsRepository::PlayerEventLogs &r, auto &out) {
+		if (!PlayerEventCodec::Decode(r, out)) {
+			LogError("Failed to decode event [{}] type [{}] for ETL", r.id, r.event_type_id);
+		}
 	};
 
 	// Helper to assign ETL table ID
@@ -203,7 +220,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::LOOT_ITEM,         [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::LootItemEvent                           in{};
 			PlayerEventLootItemsRepository::PlayerEventLootItems out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.charges      = in.charges;
 			out.corpse_name  = in.corpse_name;
@@ -226,7 +243,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::MERCHANT_SELL,     [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::MerchantSellEvent                             in{};
 			PlayerEventMerchantSellRepository::PlayerEventMerchantSell out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.npc_id                  = in.npc_id;
 			out.merchant_name           = in.merchant_name;
@@ -247,7 +264,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::MERCHANT_PURCHASE, [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::MerchantPurchaseEvent                                 in{};
 			PlayerEventMerchantPurchaseRepository::PlayerEventMerchantPurchase out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.npc_id                  = in.npc_id;
 			out.merchant_name           = in.merchant_name;
@@ -268,7 +285,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::NPC_HANDIN,        [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::HandinEvent                             in{};
 			PlayerEventNpcHandinRepository::PlayerEventNpcHandin out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.npc_id          = in.npc_id;
 			out.npc_name        = in.npc_name;
@@ -307,7 +324,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::TRADE,             [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::TradeEvent                      in{};
 			PlayerEventTradeRepository::PlayerEventTrade out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.char1_id       = in.character_1_id;
 			out.char2_id       = in.character_2_id;
@@ -347,7 +364,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::SPEECH,            [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::PlayerSpeech                      in{};
 			PlayerEventSpeechRepository::PlayerEventSpeech out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.from_char_id = in.from;
 			out.to_char_id   = in.to;
@@ -364,7 +381,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::KILLED_NPC,        [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::KilledNPCEvent                          in{};
 			PlayerEventKilledNpcRepository::PlayerEventKilledNpc out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.npc_id                        = in.npc_id;
 			out.npc_name                      = in.npc_name;
@@ -380,7 +397,7 @@ void PlayerEventLogs::ProcessBatchQueue()
 			PlayerEvent::EventType::AA_PURCHASE,       [&](PlayerEventLogsRepository::PlayerEventLogs &r) {
 			PlayerEvent::AAPurchasedEvent                          in{};
 			PlayerEventAaPurchaseRepository::PlayerEventAaPurchase out{};
-			Deserialize(r.event_data, in);
+			Deserialize(r, in);
 
 			out.aa_ability_id = in.aa_id;
 			out.cost          = in.aa_cost;
@@ -394,12 +411,13 @@ void PlayerEventLogs::ProcessBatchQueue()
 	};
 
 	// Process the batch queue
-	for (auto &r: m_record_batch_queue) {
-		if (m_settings[r.event_type_id].etl_enabled) {
+	for (auto &r: queue) {
+		if (settings[r.event_type_id].etl_enabled) {
 			auto it = event_processors.find(static_cast<PlayerEvent::EventType>(r.event_type_id));
 			if (it != event_processors.end()) {
 				it->second(r);  // Call the appropriate lambda
 				r.event_data = "{}"; // Clear event data
+				r.event_data_binary.clear();
 			}
 			else {
 				LogError("Non-Implemented ETL routing [{}]", r.event_type_id);
@@ -416,7 +434,19 @@ void PlayerEventLogs::ProcessBatchQueue()
 	};
 
 	// flush many
-	PlayerEventLogsRepository::InsertMany(*m_database, m_record_batch_queue);
+	// binary payloads need the binary protocol, the text path can't carry arbitrary bytes
+	bool has_binary = std::any_of(
+		queue.begin(), queue.end(), [](const auto &r) {
+			return !r.event_data_binary.empty();
+		}
+	);
+
+	if (has_binary) {
+		PlayerEventLogsRepository::InsertManyPrepared(*m_database, queue);
+	}
+	else {
+		PlayerEventLogsRepository::InsertMany(*m_database, queue);
+	}
 
 	// flush etl queues
 	flush_queue(PlayerEventLootItemsRepository::InsertMany, etl_queues.loot_items);
@@ -434,21 +464,24 @@ void PlayerEventLogs::ProcessBatchQueue()
 
 	LogPlayerEvents(
 		"Processing batch player event log queue of [{}] took [{}]",
-		m_record_batch_queue.size(),
+		queue.size(),
 		benchmark.elapsed()
 	);
-
-	// empty
-	m_record_batch_queue.clear();
-	m_batch_queue_lock.unlock();
 }
 
 // adds a player event to the queue
 void PlayerEventLogs::AddToQueue(PlayerEventLogsRepository::PlayerEventLogs &log)
 {
-	m_batch_queue_lock.lock();
-	m_record_batch_queue.emplace_back(log);
-	m_batch_queue_lock.unlock();
+	bool flush = false;
+	{
+		std::lock_guard<std::mutex> lock(m_batch_queue_lock);
+		m_record_batch_queue.emplace_back(log);
+		flush = m_record_batch_queue.size() >= static_cast<size_t>(RuleI(Logging, BatchPlayerEventProcessChunkSize));
+	}
+
+	if (flush) {
+		WakeWorker(true);
+	}
 }
 
 // fills common event data in the SendEvent function
@@ -577,68 +610,38 @@ std::string PlayerEventLogs::GetDiscordPayloadFromEvent(const PlayerEvent::Playe
 	switch (e.player_event_log.event_type_id) {
 		case PlayerEvent::AA_GAIN: {
 			PlayerEvent::AAGainedEvent n{};
-			std::stringstream          ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatAAGainedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::AA_PURCHASE: {
 			PlayerEvent::AAPurchasedEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatAAPurchasedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::COMBINE_FAILURE:
 		case PlayerEvent::COMBINE_SUCCESS: {
 			PlayerEvent::CombineEvent n{};
-			std::stringstream         ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatCombineEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DEATH: {
 			PlayerEvent::DeathEvent n{};
-			std::stringstream       ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatDeathEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DISCOVER_ITEM: {
 			PlayerEvent::DiscoverItemEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatDiscoverItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::DROPPED_ITEM: {
 			PlayerEvent::DroppedItemEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatDroppedItemEvent(e, n);
 			break;
 		}
@@ -651,245 +654,135 @@ std::string PlayerEventLogs::GetDiscordPayloadFromEvent(const PlayerEvent::Playe
 		}
 		case PlayerEvent::FISH_SUCCESS: {
 			PlayerEvent::FishSuccessEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatFishSuccessEvent(e, n);
 			break;
 		}
 		case PlayerEvent::FORAGE_SUCCESS: {
 			PlayerEvent::ForageSuccessEvent n{};
-			std::stringstream               ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatForageSuccessEvent(e, n);
 			break;
 		}
 		case PlayerEvent::ITEM_DESTROY: {
 			PlayerEvent::DestroyItemEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatDestroyItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LEVEL_GAIN: {
 			PlayerEvent::LevelGainedEvent n{};
-			std::stringstream             ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatLevelGainedEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LEVEL_LOSS: {
 			PlayerEvent::LevelLostEvent n{};
-			std::stringstream           ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatLevelLostEvent(e, n);
 			break;
 		}
 		case PlayerEvent::LOOT_ITEM: {
 			PlayerEvent::LootItemEvent n{};
-			std::stringstream          ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatLootItemEvent(e, n);
 			break;
 		}
 		case PlayerEvent::GROUNDSPAWN_PICKUP: {
 			PlayerEvent::GroundSpawnPickupEvent n{};
-			std::stringstream                   ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatGroundSpawnPickupEvent(e, n);
 			break;
 		}
 		case PlayerEvent::NPC_HANDIN: {
 			PlayerEvent::HandinEvent n{};
-			std::stringstream        ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatNPCHandinEvent(e, n);
 			break;
 		}
 		case PlayerEvent::SAY: {
 			PlayerEvent::SayEvent n{};
-			std::stringstream     ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatEventSay(e, n);
 			break;
 		}
 		case PlayerEvent::GM_COMMAND: {
 			PlayerEvent::GMCommandEvent n{};
-			std::stringstream           ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatGMCommand(e, n);
 			break;
 		}
 		case PlayerEvent::SKILL_UP: {
 			PlayerEvent::SkillUpEvent n{};
-			std::stringstream         ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatSkillUpEvent(e, n);
 			break;
 		}
 		case PlayerEvent::SPLIT_MONEY: {
 			PlayerEvent::SplitMoneyEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatSplitMoneyEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_ACCEPT: {
 			PlayerEvent::TaskAcceptEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTaskAcceptEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_COMPLETE: {
 			PlayerEvent::TaskCompleteEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTaskCompleteEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TASK_UPDATE: {
 			PlayerEvent::TaskUpdateEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTaskUpdateEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADE: {
 			PlayerEvent::TradeEvent n{};
-			std::stringstream       ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTradeEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADER_PURCHASE: {
 			PlayerEvent::TraderPurchaseEvent n{};
-			std::stringstream                ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTraderPurchaseEvent(e, n);
 			break;
 		}
 		case PlayerEvent::TRADER_SELL: {
 			PlayerEvent::TraderSellEvent n{};
-			std::stringstream            ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatTraderSellEvent(e, n);
 			break;
 		}
 		case PlayerEvent::REZ_ACCEPTED: {
 			PlayerEvent::ResurrectAcceptEvent n{};
-			std::stringstream                 ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 			payload = PlayerEventDiscordFormatter::FormatResurrectAcceptEvent(e, n);
 			break;
 		}
 		case PlayerEvent::MERCHANT_PURCHASE: {
 			PlayerEvent::MerchantPurchaseEvent n{};
-			std::stringstream                  ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 
 			payload = PlayerEventDiscordFormatter::FormatMerchantPurchaseEvent(e, n);
 			break;
 		}
 		case PlayerEvent::MERCHANT_SELL: {
 			PlayerEvent::MerchantSellEvent n{};
-			std::stringstream              ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 
 			payload = PlayerEventDiscordFormatter::FormatMerchantSellEvent(e, n);
 			break;
 		}
 		case PlayerEvent::ZONING: {
 			PlayerEvent::ZoningEvent n{};
-			std::stringstream        ss;
-			{
-				ss << e.player_event_log.event_data;
-				cereal::JSONInputArchive ar(ss);
-				n.serialize(ar);
-			}
+			PlayerEventCodec::Decode(e.player_event_log, n);
 
 			payload = PlayerEventDiscordFormatter::FormatZoningEvent(e, n);
 			break;
@@ -907,19 +800,67 @@ std::string PlayerEventLogs::GetDiscordPayloadFromEvent(const PlayerEvent::Playe
 }
 
 // general process function, used in world or QS depending on rule Logging:PlayerEventsQSProcess
+// called from the main loop, flushing and retention run on the background worker so the
+// caller never waits on the database
 void PlayerEventLogs::Process()
 {
-	if (m_process_batch_events_timer.Check() ||
-		m_record_batch_queue.size() >= RuleI(Logging, BatchPlayerEventProcessChunkSize)) {
-		ProcessBatchQueue();
+	if (!m_worker.joinable()) {
+		m_worker = std::jthread(
+			[this](std::stop_token stop) {
+				ProcessWorker(stop);
+			}
+		);
+	}
+
+	WakeWorker(false);
+
+	LogSys.ProcessDeferredLogs();
+}
+
+void PlayerEventLogs::WakeWorker(bool flush)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_worker_lock);
+		m_worker_wake = true;
+		m_worker_flush = m_worker_flush || flush;
 	}
 
-	if (m_process_retention_truncation_timer.Check()) {
-		ProcessRetentionTruncation();
+	m_worker_cv.notify_one();
+}
+
+void PlayerEventLogs::ProcessWorker(std::stop_token stop)
+{
+	// logs are written out by Process on the main thread
+	EQEmuLogSys::DeferLogsOnThisThread();
+
+	while (!stop.stop_requested()) {
+		bool flush = false;
+		{
+			std::unique_lock<std::mutex> lock(m_worker_lock);
+			if (!m_worker_cv.wait(lock, stop, [this] { return m_worker_wake; })) {
+				return;
+			}
+
+			flush          = m_worker_flush;
+			m_worker_wake  = false;
+			m_worker_flush = false;
+		}
+
+		const auto now = std::chrono::steady_clock::now();
+
+		if (flush || now >= m_next_batch_flush) {
+			m_next_batch_flush = now + std::chrono::seconds(RuleI(Logging, BatchPlayerEventProcessIntervalSeconds));
+			ProcessBatchQueue(GetSettingsSnapshot());
+		}
+
+		if (now >= m_next_retention_truncation) {
+			m_next_retention_truncation = now + std::chrono::milliseconds(PROCESS_RETENTION_TRUNCATION_TIMER_INTERVAL);
+			ProcessRetentionTruncation(GetSettingsSnapshot());
+		}
 	}
 }
 
-void PlayerEventLogs::ProcessRetentionTruncation()
+void PlayerEventLogs::ProcessRetentionTruncation(const SettingsSnapshot &settings)
 {
 	LogPlayerEventsDetail("Running truncation");
 
@@ -971,11 +912,14 @@ void PlayerEventLogs::ProcessRetentionTruncation()
 		}}
 	};
 
+	// when player_event_logs is partitioned, the longest retention is applied by dropping days
+	const int partition_retention_days = ProcessEventLogPartitions();
+
 	// Group event types by retention interval
 	std::unordered_map<int, std::vector<int>> retention_groups;
 	for (int                                  i = PlayerEvent::GM_COMMAND; i != PlayerEvent::MAX; i++) {
-		if (m_settings[i].retention_days > 0) {
-			retention_groups[m_settings[i].retention_days].push_back(i);
+		if (settings[i].retention_days > 0) {
+			retention_groups[settings[i].retention_days].push_back(i);
 		}
 	}
 
@@ -988,13 +932,13 @@ void PlayerEventLogs::ProcessRetentionTruncation()
 		// Handle ETL deletions for each event type in the group
 		uint32   total_deleted_count = 0;
 		for (int event_type_id: event_types) {
-			if (m_settings[event_type_id].etl_enabled) {
-				auto it = repository_deleters.find(static_cast<PlayerEvent::EventType>(m_settings[event_type_id].id));
+			if (settings[event_type_id].etl_enabled) {
+				auto it = repository_deleters.find(static_cast<PlayerEvent::EventType>(settings[event_type_id].id));
 				if (it != repository_deleters.end()) {
 					total_deleted_count += it->second(condition);
 				}
 				else {
-					LogError("Non-Implemented ETL Event Type [{}]", static_cast<uint32>(m_settings[event_type_id].id));
+					LogError("Non-Implemented ETL Event Type [{}]", static_cast<uint32>(settings[event_type_id].id));
 				}
 			}
 		}
@@ -1007,20 +951,33 @@ void PlayerEventLogs::ProcessRetentionTruncation()
 			);
 		}
 
-		// Batch deletion for player_event_logs
+		if (partition_retention_days > 0 && retention_days >= partition_retention_days) {
+			continue;
+		}
+
+		// Batch deletion for player_event_logs, chunked so a large backlog never holds locks for long
 		std::string event_type_ids = fmt::format(
 			"({})",
 			fmt::join(event_types, ", ")
 		);
 
-		uint32 deleted_count = PlayerEventLogsRepository::DeleteWhere(
-			*m_database,
-			fmt::format(
-				"event_type_id IN {} AND {}",
-				event_type_ids,
-				condition
-			)
-		);
+		uint32 deleted_count = 0;
+		while (true) {
+			uint32 deleted = PlayerEventLogsRepository::DeleteWhere(
+				*m_database,
+				fmt::format(
+					"event_type_id IN {} AND {} LIMIT {}",
+					event_type_ids,
+					condition,
+					RETENTION_DELETE_CHUNK_SIZE
+				)
+			);
+
+			deleted_count += deleted;
+			if (deleted < RETENTION_DELETE_CHUNK_SIZE) {
+				break;
+			}
+		}
 
 		if (deleted_count > 0) {
 			LogInfo(
@@ -1035,7 +992,10 @@ void PlayerEventLogs::ProcessRetentionTruncation()
 
 void PlayerEventLogs::ReloadSettings()
 {
-	for (auto &e: PlayerEventLogSettingsRepository::All(*m_database)) {
+	auto settings = PlayerEventLogSettingsRepository::All(*m_database);
+
+	std::lock_guard<std::mutex> lock(m_settings_lock);
+	for (auto &e: settings) {
 		if (e.id >= PlayerEvent::MAX || e.id < 0) {
 			continue;
 		}
@@ -1242,3 +1202,192 @@ bool PlayerEventLogs::LoadDatabaseConnection()
 	SetDatabase(&player_event_database);
 	return true;
 }
+
+// TO_DAYS() of a day to its partition name, ex: p20241102
+std::string PlayerEventLogs::GetEventLogPartitionName(int64 to_days)
+{
+	// TO_DAYS('1970-01-01')
+	const int64 unix_epoch_days = 719528;
+
+	std::time_t t = static_cast<std::time_t>((to_days - unix_epoch_days) * 86400);
+	char        name[16];
+	std::strftime(name, sizeof(name), "p%Y%m%d", std::gmtime(&t));
+
+	return name;
+}
+
+std::vector<PlayerEventLogs::EventLogPartition> PlayerEventLogs::GetEventLogPartitions()
+{
+	std::vector<EventLogPartition> partitions;
+
+	auto results = m_database->QueryDatabase(
+		SQL(
+			SELECT PARTITION_NAME, PARTITION_DESCRIPTION
+			FROM information_schema.PARTITIONS
+			WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'player_event_logs' AND PARTITION_NAME IS NOT NULL
+			ORDER BY PARTITION_ORDINAL_POSITION
+		)
+	);
+
+	for (auto row: results) {
+		EventLogPartition p{};
+		p.name   = row[0] ? row[0] : "";
+		p.is_max = !row[1] || Strings::ToLower(row[1]) == "maxvalue";
+		p.less_than = p.is_max ? 0 : Strings::ToBigInt(row[1]);
+		partitions.emplace_back(p);
+	}
+
+	return partitions;
+}
+
+// keeps daily partitions created ahead of time and drops the days every event type is done with
+// returns the retention applied by dropping partitions, 0 when the table is not partitioned
+// or some event type is retained forever
+int PlayerEventLogs::ProcessEventLogPartitions()
+{
+	auto partitions = GetEventLogPartitions();
+	if (partitions.empty()) {
+		return 0;
+	}
+
+	auto results = m_database->QueryDatabase("SELECT TO_DAYS(CURDATE())");
+	if (!results.Success() || results.RowCount() == 0) {
+		return 0;
+	}
+
+	const int64 today = Strings::ToBigInt(results.begin()[0]);
+
+	int64 last_bound = 0;
+	bool  has_future = false;
+	for (auto &p: partitions) {
+		if (p.is_max) {
+			has_future = p.name == "p_future";
+			continue;
+		}
+
+		last_bound = std::max(last_bound, p.less_than);
+	}
+
+	if (last_bound == 0) {
+		last_bound = today;
+	}
+
+	// p_future is normally empty so splitting it is cheap
+	std::vector<std::string> add;
+	for (int64 bound = last_bound + 1; has_future && bound <= today + EVENT_LOG_PARTITION_DAYS_AHEAD + 1; bound++) {
+		add.emplace_back(
+			fmt::format(
+				"PARTITION {} VALUES LESS THAN ({})",
+				GetEventLogPartitionName(bound - 1),
+				bound
+			)
+		);
+	}
+
+	if (!add.empty()) {
+		add.emplace_back("PARTITION p_future VALUES LESS THAN MAXVALUE");
+
+		auto r = m_database->QueryDatabase(
+			fmt::format(
+				"ALTER TABLE player_event_logs REORGANIZE PARTITION p_future INTO ({})",
+				Strings::Implode(", ", add)
+			)
+		);
+
+		if (r.Success()) {
+			LogPlayerEvents("Added [{}] player_event_logs partitions", add.size() - 1);
+		}
+	}
+
+	int keep_days = 0;
+	for (int i = PlayerEvent::GM_COMMAND; i != PlayerEvent::MAX; i++) {
+		if (m_settings[i].retention_days <= 0) {
+			return 0;
+		}
+
+		keep_days = std::max(keep_days, m_settings[i].retention_days);
+	}
+
+	// every row a partition can hold is older than the longest retention
+	std::vector<std::string> drop;
+	for (auto &p: partitions) {
+		if (!p.is_max && p.less_than <= today - keep_days) {
+			drop.emplace_back(p.name);
+		}
+	}
+
+	if (!drop.empty()) {
+		auto r = m_database->QueryDatabase(
+			fmt::format(
+				"ALTER TABLE player_event_logs DROP PARTITION {}",
+				Strings::Implode(", ", drop)
+			)
+		);
+
+		if (r.Success()) {
+			LogInfo(
+				"Dropped player_event_logs partitions [{}] older than [{}] days",
+				Strings::Implode(", ", drop),
+				keep_days
+			);
+		}
+	}
+
+	return keep_days;
+}
+
+// one time conversion of player_event_logs to daily partitions on created_at (world etl:partition)
+// rebuilds the table, rows without created_at are moved to the start of time
+bool PlayerEventLogs::PartitionEventLogTable()
+{
+	if (!GetEventLogPartitions().empty()) {
+		LogInfo("Table [player_event_logs] is already partitioned");
+		return true;
+	}
+
+	auto results = m_database->QueryDatabase("SELECT TO_DAYS(CURDATE())");
+	if (!results.Success() || results.RowCount() == 0) {
+		return false;
+	}
+
+	const int64 today = Strings::ToBigInt(results.begin()[0]);
+
+	// everything before today lands in p_history, dropped once it is past retention
+	std::vector<std::string> partitions = {
+		fmt::format("PARTITION p_history VALUES LESS THAN ({})", today)
+	};
+
+	for (int64 bound = today + 1; bound <= today + EVENT_LOG_PARTITION_DAYS_AHEAD + 1; bound++) {
+		partitions.emplace_back(
+			fmt::format(
+				"PARTITION {} VALUES LESS THAN ({})",
+				GetEventLogPartitionName(bound - 1),
+				bound
+			)
+		);
+	}
+
+	partitions.emplace_back("PARTITION p_future VALUES LESS THAN MAXVALUE");
+
+	LogInfo("Partitioning [player_event_logs], this rebuilds the table and can take a while");
+
+	m_database->QueryDatabase("UPDATE player_event_logs SET created_at = FROM_UNIXTIME(0) WHERE created_at IS NULL");
+
+	results = m_database->QueryDatabase(
+		fmt::format(
+			"ALTER TABLE player_event_logs MODIFY created_at DATETIME NOT NULL, "
+			"DROP PRIMARY KEY, ADD PRIMARY KEY (id, created_at) "
+			"PARTITION BY RANGE (TO_DAYS(created_at)) ({})",
+			Strings::Implode(", ", partitions)
+		)
+	);
+
+	if (!results.Success()) {
+		LogError("Failed to partition [player_event_logs] [{}]", results.ErrorMessage());
+		return false;
+	}
+
+	LogInfo("Partitioned [player_event_logs] into [{}] partitions", partitions.size());
+
+	return true;
+}
@@ -2,11 +2,15 @@
 #define EQEMU_PLAYER_EVENT_LOGS_H
 
 #include <cereal/archives/json.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #include "../json/json_archive_single_line.h"
 #include "../servertalk.h"
 #include "../timer.h"
 #include "../eqemu_config.h"
+#include "player_event_codec.h"
 
 #include "../repositories/player_event_log_settings_repository.h"
 #include "../repositories/player_event_logs_repository.h"
@@ -37,6 +41,7 @@ public:
 	bool ValidateDatabaseConnection();
 	bool IsEventEnabled(PlayerEvent::EventType event);
 
+	// called from the main loop, wakes the background worker that flushes and truncates
 	void Process();
 
 	// batch queue
@@ -55,16 +60,19 @@ public:
 		FillPlayerEvent(p, n);
 		n.event_type_id = t;
 
-		std::stringstream ss;
-		{
-			cereal::JSONOutputArchiveSingleLine ar(ss);
-			e.serialize(ar);
-		}
-
 		n.event_type_name = PlayerEvent::EventName[t];
-		n.event_data      = Strings::Contains(ss.str(), "noop") ? "{}" : ss.str();
+		n.event_data      = "{}";
 		n.created_at      = std::time(nullptr);
 
+		if constexpr (!std::is_same_v<T, PlayerEvent::EmptyEvent>) {
+			if (RuleB(Logging, PlayerEventsBinaryEncoding)) {
+				n.event_data_binary = PlayerEventCodec::EncodeBinary(t, e);
+			}
+			else {
+				n.event_data = PlayerEventCodec::EncodeJson(e);
+			}
+		}
+
 		auto c = PlayerEvent::PlayerEventContainer{
 			.player_event = p,
 			.player_event_log = n
@@ -79,6 +87,9 @@ public:
 
 	static std::string GetDiscordPayloadFromEvent(const PlayerEvent::PlayerEventContainer &e);
 
+	// daily partitions on player_event_logs.created_at so retention drops days instead of deleting rows
+	bool PartitionEventLogTable();
+
 	struct EtlQueues {
 		std::vector<PlayerEventLootItemsRepository::PlayerEventLootItems>               loot_items;
 		std::vector<PlayerEventMerchantPurchaseRepository::PlayerEventMerchantPurchase> merchant_purchase;
@@ -104,6 +115,12 @@ private:
 	Database                                                 *m_database; // reference to database
 	PlayerEventLogSettingsRepository::PlayerEventLogSettings m_settings[PlayerEvent::EventType::MAX]{};
 
+	// only the main thread writes m_settings (under the lock) and reads it unlocked,
+	// the worker takes a copy under the lock before each batch or truncation
+	using SettingsSnapshot = std::vector<PlayerEventLogSettingsRepository::PlayerEventLogSettings>;
+	std::mutex       m_settings_lock{};
+	SettingsSnapshot GetSettingsSnapshot();
+
 	// batch queue is used to record events in batch
 	std::vector<PlayerEventLogsRepository::PlayerEventLogs> m_record_batch_queue{};
 	static void FillPlayerEvent(const PlayerEvent::PlayerEvent &p, PlayerEventLogsRepository::PlayerEventLogs &n);
@@ -112,18 +129,40 @@ private:
 
 	std::map<PlayerEvent::EventType, EtlSettings>  m_etl_settings{};
 
-	// timers
-	Timer m_process_batch_events_timer; // events processing timer
-	Timer m_process_retention_truncation_timer; // timer for truncating events based on retention settings
+	struct EventLogPartition {
+		std::string name;
+		int64       less_than; // TO_DAYS(created_at) bound
+		bool        is_max;
+	};
+
+	// next runs of the worker's periodic jobs
+	std::chrono::steady_clock::time_point m_next_batch_flush{};
+	std::chrono::steady_clock::time_point m_next_retention_truncation{};
 
 	// processing
 	std::mutex m_batch_queue_lock{};
-	void ProcessBatchQueue();
-	void ProcessRetentionTruncation();
+	void ProcessBatchQueue(const SettingsSnapshot &settings);
+	void ProcessRetentionTruncation(const SettingsSnapshot &settings);
 	void SetSettingsDefaults();
 
+	static std::string GetEventLogPartitionName(int64 to_days);
+	std::vector<EventLogPartition> GetEventLogPartitions();
+	int ProcessEventLogPartitions();
+
+	// background worker, flushes the queue and runs retention off the main loop
+	std::mutex                  m_worker_lock{};
+	std::condition_variable_any m_worker_cv{};
+	bool                        m_worker_wake  = false;
+	bool                        m_worker_flush = false;
+	void WakeWorker(bool flush);
+	void ProcessWorker(std::stop_token stop);
+
 public:
 	std::map<PlayerEvent::EventType, EtlSettings> &GetEtlSettings() { return m_etl_settings;}
+
+private:
+	// declared last so it is joined before the state it uses is destroyed
+	std::jthread m_worker;
 };
 
 extern PlayerEventLogs player_event_logs;
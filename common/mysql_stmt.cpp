@@ -1,6 +1,7 @@
 #include "mysql_stmt.h"
 #include "eqemu_logsys.h"
 #include "mutex.h"
+#include "query_profiler.h"
 #include "timer.h"
 #include <charconv>
 
@@ -197,6 +198,18 @@ StmtResult PreparedStmt::DoExecute()
 
 	StmtResult res(m_stmt.get(), m_results.size());
 
+	auto profiler = QueryProfiler::Instance();
+	if (profiler->IsEnabled())
+	{
+		// rows are fetched by the caller after this, so there is no byte count to report
+		profiler->Record(
+			m_query,
+			timer.elapsedMicroseconds(),
+			m_results.empty() ? res.RowsAffected() : res.RowCount(),
+			std::nullopt
+		);
+	}
+
 	if (m_results.empty())
 	{
 		LogMySQLQuery("{} -- ({} row(s) affected) ({:.6f}s)", m_query, res.RowsAffected(), timer.elapsed());
@@ -0,0 +1,462 @@
+#include "query_profiler.h"
+#include "eqemu_logsys.h"
+#include "json/json.h"
+#include "path_manager.h"
+#include "platform.h"
+#include "rulesys.h"
+#include "strings.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WINDOWS
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+	inline bool IsIdentifierChar(char c)
+	{
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+	}
+
+	inline bool IsDigit(char c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+	inline bool IsSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+	}
+
+	inline void TrimTrailingSpace(std::string &out)
+	{
+		while (!out.empty() && out.back() == ' ') {
+			out.pop_back();
+		}
+	}
+
+	// a literal directly following "?," (or "?+,") extends the list instead of adding another ?
+	void AppendPlaceholder(std::string &out)
+	{
+		size_t end = out.size();
+		while (end > 0 && out[end - 1] == ' ') {
+			--end;
+		}
+
+		if (end > 0 && out[end - 1] == ',') {
+			size_t list_end = end - 1;
+			while (list_end > 0 && out[list_end - 1] == ' ') {
+				--list_end;
+			}
+
+			if (list_end >= 2 && out.compare(list_end - 2, 2, "?+") == 0) {
+				out.resize(list_end);
+				return;
+			}
+
+			if (list_end >= 1 && out[list_end - 1] == '?') {
+				out.resize(list_end);
+				out.push_back('+');
+				return;
+			}
+		}
+
+		out.push_back('?');
+	}
+
+	// a sign is part of the literal only where an operand is expected, "a -1" keeps its operator
+	bool IsUnaryPosition(const std::string &out)
+	{
+		size_t end = out.size();
+		while (end > 0 && out[end - 1] == ' ') {
+			--end;
+		}
+
+		if (end == 0) {
+			return true;
+		}
+
+		const char last = out[end - 1];
+		if (last == '?' || (last == '+' && end >= 2 && out[end - 2] == '?')) {
+			return false;
+		}
+
+		if (!IsIdentifierChar(last)) {
+			return last != ')' && last != '`' && last != '.';
+		}
+
+		size_t begin = end;
+		while (begin > 0 && IsIdentifierChar(out[begin - 1])) {
+			--begin;
+		}
+
+		static const std::vector<std::string_view> keywords = {
+			"and", "between", "by", "case", "else", "in", "interval", "is", "like", "limit", "not", "offset",
+			"on", "or", "regexp", "return", "select", "set", "then", "values", "when", "where", "xor"
+		};
+
+		const auto word = std::string_view(out).substr(begin, end - begin);
+		return std::find(keywords.begin(), keywords.end(), word) != keywords.end();
+	}
+
+	size_t SkipQuoted(std::string_view q, size_t i)
+	{
+		const char quote = q[i++];
+		while (i < q.size()) {
+			if (q[i] == '\\') {
+				i += 2;
+				continue;
+			}
+
+			if (q[i] == quote) {
+				// doubled quotes are an escaped quote
+				if (i + 1 < q.size() && q[i + 1] == quote) {
+					i += 2;
+					continue;
+				}
+
+				return i + 1;
+			}
+
+			++i;
+		}
+
+		return q.size();
+	}
+
+	size_t SkipNumber(std::string_view q, size_t i)
+	{
+		if (q[i] == '-' || q[i] == '+') {
+			++i;
+		}
+
+		if (i + 1 < q.size() && q[i] == '0' && (q[i + 1] == 'x' || q[i + 1] == 'X')) {
+			i += 2;
+			while (i < q.size() && IsIdentifierChar(q[i])) {
+				++i;
+			}
+
+			return i;
+		}
+
+		while (i < q.size() && (IsDigit(q[i]) || q[i] == '.')) {
+			++i;
+		}
+
+		if (i < q.size() && (q[i] == 'e' || q[i] == 'E')) {
+			size_t j = i + 1;
+			if (j < q.size() && (q[j] == '-' || q[j] == '+')) {
+				++j;
+			}
+
+			if (j < q.size() && IsDigit(q[j])) {
+				i = j;
+				while (i < q.size() && IsDigit(q[i])) {
+					++i;
+				}
+			}
+		}
+
+		return i;
+	}
+}
+
+void QueryProfiler::Stats::Merge(const Stats &s)
+{
+	count += s.count;
+	total_us += s.total_us;
+	max_us = std::max(max_us, s.max_us);
+	rows += s.rows;
+	bytes += s.bytes;
+	bytes_count += s.bytes_count;
+}
+
+std::string QueryProfiler::Fingerprint(std::string_view q)
+{
+	std::string out;
+	out.reserve(std::min<size_t>(q.size(), 512));
+
+	// open parenthesis offsets and the last closed group at each depth, used to fold repeated row groups
+	std::vector<size_t>                    open;
+	std::vector<std::pair<size_t, size_t>> closed;
+
+	size_t i = 0;
+	while (i < q.size()) {
+		const char c = q[i];
+
+		if (IsSpace(c)) {
+			if (!out.empty() && out.back() != ' ') {
+				out.push_back(' ');
+			}
+
+			while (i < q.size() && IsSpace(q[i])) {
+				++i;
+			}
+			continue;
+		}
+
+		// comments
+		if (c == '/' && i + 1 < q.size() && q[i + 1] == '*') {
+			auto end = q.find("*/", i + 2);
+			i = end == std::string_view::npos ? q.size() : end + 2;
+			continue;
+		}
+
+		if (c == '#' || (c == '-' && i + 2 < q.size() && q[i + 1] == '-' && IsSpace(q[i + 2]))) {
+			auto end = q.find('\n', i);
+			i = end == std::string_view::npos ? q.size() : end + 1;
+			continue;
+		}
+
+		if (c == '\'' || c == '"') {
+			i = SkipQuoted(q, i);
+			AppendPlaceholder(out);
+			continue;
+		}
+
+		// quoted identifiers are kept as is
+		if (c == '`') {
+			auto end = q.find('`', i + 1);
+			end = end == std::string_view::npos ? q.size() : end + 1;
+			out.append(q.substr(i, end - i));
+			i = end;
+			continue;
+		}
+
+		const char prev = out.empty() ? ' ' : out.back();
+		const bool starts_number = IsDigit(c)
+			|| (c == '.' && i + 1 < q.size() && IsDigit(q[i + 1]))
+			|| ((c == '-' || c == '+') && i + 1 < q.size() && (IsDigit(q[i + 1]) || q[i + 1] == '.')
+				&& IsUnaryPosition(out));
+
+		if (starts_number && !IsIdentifierChar(prev) && prev != '.') {
+			i = SkipNumber(q, i);
+			AppendPlaceholder(out);
+			continue;
+		}
+
+		if (c == '(') {
+			// groups closed inside the previous sibling no longer neighbour anything
+			closed.resize(std::min(closed.size(), open.size() + 1));
+			open.push_back(out.size());
+		}
+		else if (c == ')' && !open.empty()) {
+			const size_t begin = open.back();
+			open.pop_back();
+			out.push_back(')');
+			++i;
+
+			const size_t depth = open.size();
+			closed.resize(depth + 1);
+
+			// "(...),(...)" with identical groups keeps the first one
+			auto &[prev_begin, prev_end] = closed[depth];
+			if (prev_end != 0 && prev_end <= begin) {
+				const size_t length = out.size() - begin;
+				size_t       sep    = prev_end;
+				if (sep < begin && out[sep] == ',') {
+					++sep;
+				}
+				if (sep < begin && out[sep] == ' ') {
+					++sep;
+				}
+
+				if (sep == begin && prev_end - prev_begin == length &&
+					out.compare(prev_begin, length, out, begin, length) == 0) {
+					out.resize(prev_end);
+					continue;
+				}
+			}
+
+			closed[depth] = {begin, out.size()};
+			continue;
+		}
+
+		out.push_back(static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c));
+		++i;
+	}
+
+	TrimTrailingSpace(out);
+
+	return out;
+}
+
+QueryProfiler::Shard *QueryProfiler::GetThreadShard()
+{
+	thread_local std::shared_ptr<Shard> shard;
+
+	if (!shard) {
+		shard = std::make_shared<Shard>();
+
+		std::lock_guard<std::mutex> lock(m_shards_mutex);
+		m_shards.push_back(shard);
+	}
+
+	return shard.get();
+}
+
+void QueryProfiler::Record(std::string_view query, uint64 elapsed_us, uint64 rows, std::optional<uint64> bytes)
+{
+	auto fingerprint = Fingerprint(query);
+	auto shard       = GetThreadShard();
+
+	// only contended while a snapshot is being merged
+	std::lock_guard<std::mutex> lock(shard->mutex);
+
+	auto &s = shard->stats[std::move(fingerprint)];
+	s.count++;
+	s.total_us += elapsed_us;
+	s.max_us = std::max(s.max_us, elapsed_us);
+	s.rows += rows;
+
+	if (bytes) {
+		s.bytes += *bytes;
+		s.bytes_count++;
+	}
+}
+
+std::vector<QueryProfiler::Entry> QueryProfiler::Snapshot(size_t limit) const
+{
+	std::unordered_map<std::string, Stats> merged;
+
+	{
+		std::lock_guard<std::mutex> lock(m_shards_mutex);
+		for (auto &shard: m_shards) {
+			std::lock_guard<std::mutex> shard_lock(shard->mutex);
+			for (auto &[fingerprint, stats]: shard->stats) {
+				merged[fingerprint].Merge(stats);
+			}
+		}
+	}
+
+	std::vector<Entry> entries;
+	entries.reserve(merged.size());
+	for (auto &[fingerprint, stats]: merged) {
+		entries.push_back(Entry{fingerprint, stats});
+	}
+
+	std::sort(
+		entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+			return a.stats.total_us > b.stats.total_us;
+		}
+	);
+
+	if (limit > 0 && entries.size() > limit) {
+		entries.resize(limit);
+	}
+
+	return entries;
+}
+
+void QueryProfiler::Reset()
+{
+	std::lock_guard<std::mutex> lock(m_shards_mutex);
+	for (auto &shard: m_shards) {
+		std::lock_guard<std::mutex> shard_lock(shard->mutex);
+		shard->stats.clear();
+	}
+}
+
+void QueryProfiler::LogSummary(size_t limit) const
+{
+	auto entries = Snapshot(limit);
+	if (entries.empty()) {
+		return;
+	}
+
+	LogInfo("Query profile top [{}] by total time", entries.size());
+
+	for (auto &e: entries) {
+		LogInfo(
+			"Calls [{}] total [{:.3f}s] avg [{:.3f}ms] max [{:.3f}ms] rows [{}] bytes [{}] query [{}]",
+			e.stats.count,
+			e.stats.total_us / 1000000.0,
+			e.stats.total_us / 1000.0 / std::max<uint64>(1, e.stats.count),
+			e.stats.max_us / 1000.0,
+			e.stats.rows,
+			e.stats.bytes,
+			e.fingerprint
+		);
+	}
+}
+
+bool QueryProfiler::WriteSnapshot(const std::string &file_name) const
+{
+	Json::Value root;
+	root["process"]    = Strings::ToLower(GetPlatformName());
+	root["pid"]        = static_cast<Json::Int64>(getpid());
+	root["updated_at"] = static_cast<Json::Int64>(std::time(nullptr));
+	root["queries"]    = Json::arrayValue;
+
+	for (auto &e: Snapshot()) {
+		Json::Value q;
+		q["fingerprint"] = e.fingerprint;
+		q["count"]       = static_cast<Json::UInt64>(e.stats.count);
+		q["total_us"]    = static_cast<Json::UInt64>(e.stats.total_us);
+		q["max_us"]      = static_cast<Json::UInt64>(e.stats.max_us);
+		q["rows"]        = static_cast<Json::UInt64>(e.stats.rows);
+		q["bytes"]       = static_cast<Json::UInt64>(e.stats.bytes);
+		q["bytes_count"] = static_cast<Json::UInt64>(e.stats.bytes_count);
+		root["queries"].append(q);
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(file_name).parent_path(), ec);
+
+	// write then rename so readers never see a partial file
+	const std::string tmp = file_name + ".tmp";
+	{
+		std::ofstream f(tmp, std::ios::trunc);
+		if (!f.good()) {
+			LogError("Failed to write query profile [{}]", tmp);
+			return false;
+		}
+
+		Json::StreamWriterBuilder builder;
+		builder["indentation"] = "";
+		f << Json::writeString(builder, root);
+	}
+
+	std::filesystem::rename(tmp, file_name, ec);
+	if (ec) {
+		LogError("Failed to write query profile [{}] [{}]", file_name, ec.message());
+		return false;
+	}
+
+	return true;
+}
+
+void QueryProfiler::Process()
+{
+	SetEnabled(RuleB(Logging, QueryProfiler));
+
+	const uint32 interval = RuleI(Logging, QueryProfilerSummaryIntervalS) * 1000;
+	if (!IsEnabled() || interval == 0) {
+		m_summary_timer.Disable();
+		return;
+	}
+
+	if (!m_summary_timer.Enabled() || m_summary_timer.GetDuration() != interval) {
+		m_summary_timer.Start(interval);
+		return;
+	}
+
+	if (!m_summary_timer.Check()) {
+		return;
+	}
+
+	LogSummary(RuleI(Logging, QueryProfilerSummaryLimit));
+	WriteSnapshot(
+		fmt::format(
+			"{}/query_profile/{}_{}.json",
+			path.GetLogPath(),
+			Strings::ToLower(GetPlatformName()),
+			getpid()
+		)
+	);
+}
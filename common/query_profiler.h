@@ -0,0 +1,89 @@
+#ifndef EQEMU_QUERY_PROFILER_H
+#define EQEMU_QUERY_PROFILER_H
+
+#include "types.h"
+#include "timer.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Aggregates database queries by fingerprint (the query with its literals stripped)
+ *
+ * DBcore records every query while the profiler is enabled (Logging:QueryProfiler).
+ * Counters are kept per thread so recording never contends with other connections,
+ * shards are only merged when a snapshot is taken
+ *
+ * Snapshots are logged and written to <logs>/query_profile/ every
+ * Logging:QueryProfilerSummaryIntervalS so the world CLI (database:query-profile)
+ * can report across every running process
+ */
+class QueryProfiler {
+public:
+	struct Stats {
+		uint64 count    = 0;
+		uint64 total_us = 0;
+		uint64 max_us   = 0;
+		uint64 rows     = 0;
+		uint64 bytes    = 0;
+
+		// calls that reported bytes, prepared statements fetch their rows after being recorded so they report none
+		uint64 bytes_count = 0;
+
+		void Merge(const Stats &s);
+	};
+
+	struct Entry {
+		std::string fingerprint;
+		Stats       stats;
+	};
+
+	static QueryProfiler *Instance()
+	{
+		static QueryProfiler instance;
+		return &instance;
+	}
+
+	// replaces string and numeric literals with ?, collapses value lists into ?+
+	// and repeated row groups into one, lower cases and squeezes whitespace
+	static std::string Fingerprint(std::string_view query);
+
+	bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+	void SetEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+	// bytes is what went over the wire (query and result set), nullopt keeps the call out of the byte totals
+	void Record(std::string_view query, uint64 elapsed_us, uint64 rows, std::optional<uint64> bytes);
+
+	// merged across threads, sorted by total time descending, limit 0 returns everything
+	std::vector<Entry> Snapshot(size_t limit = 0) const;
+	void Reset();
+
+	void LogSummary(size_t limit) const;
+	bool WriteSnapshot(const std::string &file_name) const;
+
+	// called from the process main loops, applies the rules and emits the periodic summary
+	void Process();
+
+private:
+	QueryProfiler() = default;
+
+	struct Shard {
+		std::mutex                             mutex;
+		std::unordered_map<std::string, Stats> stats;
+	};
+
+	Shard *GetThreadShard();
+
+	std::atomic<bool>                   m_enabled{false};
+	mutable std::mutex                  m_shards_mutex;
+	std::vector<std::shared_ptr<Shard>> m_shards;
+	Timer                               m_summary_timer;
+};
+
+#endif //EQEMU_QUERY_PROFILER_H
@@ -0,0 +1,157 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "read_only_mapped_file.h"
+#ifdef _WINDOWS
+#include <windows.h>
+#include <process.h>
+#else
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <system_error>
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+namespace EQ {
+
+	ReadOnlyMappedFile::ReadOnlyMappedFile()
+		: data_(nullptr), size_(0), copy_on_write_(false) {
+#ifdef _WINDOWS
+		mapping_ = nullptr;
+#endif
+	}
+
+	ReadOnlyMappedFile::~ReadOnlyMappedFile() {
+		Close();
+	}
+
+	bool ReadOnlyMappedFile::Open(const std::string &filename, bool copy_on_write) {
+		Close();
+
+#ifdef _WINDOWS
+		HANDLE file = CreateFile(filename.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			0,
+			nullptr);
+
+		if(file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER file_size;
+		if(!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		mapping_ = CreateFileMapping(file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if(!mapping_) {
+			return false;
+		}
+
+		data_ = reinterpret_cast<char*>(MapViewOfFile(mapping_, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0));
+		if(!data_) {
+			CloseHandle(mapping_);
+			mapping_ = nullptr;
+			return false;
+		}
+
+		size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+		int fd = open(filename.c_str(), O_RDONLY);
+		if(fd == -1) {
+			return false;
+		}
+
+		struct stat st;
+		if(fstat(fd, &st) == -1 || st.st_size == 0) {
+			close(fd);
+			return false;
+		}
+
+		void *memory = copy_on_write ?
+			mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) :
+			mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+		// the mapping keeps its own reference to the file
+		close(fd);
+
+		if(memory == MAP_FAILED) {
+			return false;
+		}
+
+		data_ = reinterpret_cast<char*>(memory);
+		size_ = static_cast<size_t>(st.st_size);
+#endif
+		copy_on_write_ = copy_on_write;
+		return true;
+	}
+
+	void ReadOnlyMappedFile::Close() {
+		if(!data_) {
+			return;
+		}
+
+#ifdef _WINDOWS
+		UnmapViewOfFile(data_);
+		CloseHandle(mapping_);
+		mapping_ = nullptr;
+#else
+		munmap(reinterpret_cast<void*>(data_), size_);
+#endif
+		data_ = nullptr;
+		size_ = 0;
+		copy_on_write_ = false;
+	}
+
+	bool ReadOnlyMappedFile::WriteAtomic(const std::string &filename, const void *data, size_t size) {
+		// one temp file per writer, zones baking the same file at once must not truncate each other's
+		std::string tmp_name = filename + "." + std::to_string(getpid()) + ".tmp";
+
+		FILE *f = fopen(tmp_name.c_str(), "wb");
+		if(!f) {
+			return false;
+		}
+
+		bool written = (fwrite(data, size, 1, f) == 1);
+		written = (fclose(f) == 0) && written;
+
+		std::error_code ec;
+		if(written) {
+			fs::rename(tmp_name, filename, ec);
+		}
+
+		if(!written || ec) {
+			fs::remove(tmp_name, ec);
+			return false;
+		}
+
+		return true;
+	}
+} // EQ
@@ -0,0 +1,75 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef _EQEMU_READONLYMAPPEDFILE_H_
+#define _EQEMU_READONLYMAPPEDFILE_H_
+
+#include <string>
+#include <cstddef>
+
+namespace EQ {
+
+	//! Read Only File Mapping
+	/*!
+		Maps an existing file into memory so every process that opens it shares the same
+		page cache pages. Copy on write mappings may be written to; touched pages become
+		private to the process while untouched pages stay shared. Non-copyable.
+	*/
+	class ReadOnlyMappedFile {
+	public:
+		ReadOnlyMappedFile();
+		~ReadOnlyMappedFile();
+
+		//! Open
+		/*!
+			Maps the whole file.
+		\param filename File to map.
+		\param copy_on_write Map pages writable and private on first write instead of read only.
+		\return true if the file was mapped.
+		*/
+		bool Open(const std::string &filename, bool copy_on_write = false);
+
+		//! Unmaps the file if one is mapped.
+		void Close();
+
+		inline const char *Data() const { return data_; }
+		inline char *MutableData() const { return copy_on_write_ ? data_ : nullptr; }
+		inline size_t Size() const { return size_; }
+		inline bool IsOpen() const { return data_ != nullptr; }
+
+		//! Write File
+		/*!
+			Writes a per process temp file next to its final name and renames it into place,
+			so processes mapping the old file never observe a partially written one.
+		*/
+		static bool WriteAtomic(const std::string &filename, const void *data, size_t size);
+
+	private:
+		ReadOnlyMappedFile(const ReadOnlyMappedFile&);
+		const ReadOnlyMappedFile& operator=(const ReadOnlyMappedFile&);
+
+		char   *data_;
+		size_t size_;
+		bool   copy_on_write_;
+#ifdef _WINDOWS
+		void   *mapping_;
+#endif
+	};
+} // EQ
+
+#endif
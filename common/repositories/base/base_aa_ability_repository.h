@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAaAbilityRepository {
@@ -543,6 +544,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AaAbility &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.category);
+		v.emplace_back(e.classes);
+		v.emplace_back(e.races);
+		v.emplace_back(e.drakkin_heritage);
+		v.emplace_back(e.deities);
+		v.emplace_back(e.status);
+		v.emplace_back(e.type);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.grant_only);
+		v.emplace_back(e.first_rank_id);
+		v.emplace_back(e.enabled);
+		v.emplace_back(e.reset_on_death);
+		v.emplace_back(e.auto_grant_enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AaAbility &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.category);
+		RepositoryStmt::Read(row, 3, e.classes);
+		RepositoryStmt::Read(row, 4, e.races);
+		RepositoryStmt::Read(row, 5, e.drakkin_heritage);
+		RepositoryStmt::Read(row, 6, e.deities);
+		RepositoryStmt::Read(row, 7, e.status);
+		RepositoryStmt::Read(row, 8, e.type);
+		RepositoryStmt::Read(row, 9, e.charges);
+		RepositoryStmt::Read(row, 10, e.grant_only);
+		RepositoryStmt::Read(row, 11, e.first_rank_id);
+		RepositoryStmt::Read(row, 12, e.enabled);
+		RepositoryStmt::Read(row, 13, e.reset_on_death);
+		RepositoryStmt::Read(row, 14, e.auto_grant_enabled);
+	}
+
+	static AaAbility FindOnePrepared(
+		Database& db,
+		int aa_ability_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAaAbilityRepository>(db, aa_ability_id);
+	}
+
+	static std::vector<AaAbility> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAaAbilityRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AaAbility &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAaAbilityRepository>(db, e, e.id);
+	}
+
+	static AaAbility InsertOnePrepared(
+		Database& db,
+		AaAbility e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAaAbilityRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AaAbility> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAaAbilityRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AaAbility> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAaAbilityRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_AA_ABILITY_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAaRankEffectsRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AaRankEffects &e
+	)
+	{
+		v.emplace_back(e.rank_id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.effect_id);
+		v.emplace_back(e.base1);
+		v.emplace_back(e.base2);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AaRankEffects &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.rank_id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.effect_id);
+		RepositoryStmt::Read(row, 3, e.base1);
+		RepositoryStmt::Read(row, 4, e.base2);
+	}
+
+	static AaRankEffects FindOnePrepared(
+		Database& db,
+		int aa_rank_effects_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAaRankEffectsRepository>(db, aa_rank_effects_id);
+	}
+
+	static std::vector<AaRankEffects> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAaRankEffectsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AaRankEffects &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAaRankEffectsRepository>(db, e, e.rank_id);
+	}
+
+	static AaRankEffects InsertOnePrepared(
+		Database& db,
+		AaRankEffects e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAaRankEffectsRepository>(db, e);
+		if (id) {
+			e.rank_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AaRankEffects> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAaRankEffectsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AaRankEffects> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAaRankEffectsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_AA_RANK_EFFECTS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAaRankPrereqsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AaRankPrereqs &e
+	)
+	{
+		v.emplace_back(e.rank_id);
+		v.emplace_back(e.aa_id);
+		v.emplace_back(e.points);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AaRankPrereqs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.rank_id);
+		RepositoryStmt::Read(row, 1, e.aa_id);
+		RepositoryStmt::Read(row, 2, e.points);
+	}
+
+	static AaRankPrereqs FindOnePrepared(
+		Database& db,
+		int aa_rank_prereqs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAaRankPrereqsRepository>(db, aa_rank_prereqs_id);
+	}
+
+	static std::vector<AaRankPrereqs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAaRankPrereqsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AaRankPrereqs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAaRankPrereqsRepository>(db, e, e.rank_id);
+	}
+
+	static AaRankPrereqs InsertOnePrepared(
+		Database& db,
+		AaRankPrereqs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAaRankPrereqsRepository>(db, e);
+		if (id) {
+			e.rank_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AaRankPrereqs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAaRankPrereqsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AaRankPrereqs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAaRankPrereqsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_AA_RANK_PREREQS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAaRanksRepository {
@@ -519,6 +520,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AaRanks &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.upper_hotkey_sid);
+		v.emplace_back(e.lower_hotkey_sid);
+		v.emplace_back(e.title_sid);
+		v.emplace_back(e.desc_sid);
+		v.emplace_back(e.cost);
+		v.emplace_back(e.level_req);
+		v.emplace_back(e.spell);
+		v.emplace_back(e.spell_type);
+		v.emplace_back(e.recast_time);
+		v.emplace_back(e.expansion);
+		v.emplace_back(e.prev_id);
+		v.emplace_back(e.next_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AaRanks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.upper_hotkey_sid);
+		RepositoryStmt::Read(row, 2, e.lower_hotkey_sid);
+		RepositoryStmt::Read(row, 3, e.title_sid);
+		RepositoryStmt::Read(row, 4, e.desc_sid);
+		RepositoryStmt::Read(row, 5, e.cost);
+		RepositoryStmt::Read(row, 6, e.level_req);
+		RepositoryStmt::Read(row, 7, e.spell);
+		RepositoryStmt::Read(row, 8, e.spell_type);
+		RepositoryStmt::Read(row, 9, e.recast_time);
+		RepositoryStmt::Read(row, 10, e.expansion);
+		RepositoryStmt::Read(row, 11, e.prev_id);
+		RepositoryStmt::Read(row, 12, e.next_id);
+	}
+
+	static AaRanks FindOnePrepared(
+		Database& db,
+		int aa_ranks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAaRanksRepository>(db, aa_ranks_id);
+	}
+
+	static std::vector<AaRanks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAaRanksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AaRanks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAaRanksRepository>(db, e, e.id);
+	}
+
+	static AaRanks InsertOnePrepared(
+		Database& db,
+		AaRanks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAaRanksRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AaRanks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAaRanksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AaRanks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAaRanksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_AA_RANKS_REPOSITORY_H
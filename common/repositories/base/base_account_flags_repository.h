@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAccountFlagsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AccountFlags &e
+	)
+	{
+		v.emplace_back(e.p_accid);
+		v.emplace_back(std::string_view(e.p_flag));
+		v.emplace_back(std::string_view(e.p_value));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AccountFlags &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.p_accid);
+		RepositoryStmt::Read(row, 1, e.p_flag);
+		RepositoryStmt::Read(row, 2, e.p_value);
+	}
+
+	static AccountFlags FindOnePrepared(
+		Database& db,
+		int account_flags_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAccountFlagsRepository>(db, account_flags_id);
+	}
+
+	static std::vector<AccountFlags> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAccountFlagsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AccountFlags &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAccountFlagsRepository>(db, e, e.p_accid);
+	}
+
+	static AccountFlags InsertOnePrepared(
+		Database& db,
+		AccountFlags e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAccountFlagsRepository>(db, e);
+		if (id) {
+			e.p_accid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AccountFlags> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAccountFlagsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AccountFlags> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAccountFlagsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ACCOUNT_FLAGS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAccountIpRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AccountIp &e
+	)
+	{
+		v.emplace_back(e.accid);
+		v.emplace_back(std::string_view(e.ip));
+		v.emplace_back(e.count);
+		v.emplace_back(RepositoryStmt::DateTime(e.lastused));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AccountIp &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.accid);
+		RepositoryStmt::Read(row, 1, e.ip);
+		RepositoryStmt::Read(row, 2, e.count);
+		RepositoryStmt::Read(row, 3, e.lastused);
+	}
+
+	static AccountIp FindOnePrepared(
+		Database& db,
+		int account_ip_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAccountIpRepository>(db, account_ip_id);
+	}
+
+	static std::vector<AccountIp> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAccountIpRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AccountIp &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAccountIpRepository>(db, e, e.accid);
+	}
+
+	static AccountIp InsertOnePrepared(
+		Database& db,
+		AccountIp e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAccountIpRepository>(db, e);
+		if (id) {
+			e.accid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AccountIp> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAccountIpRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AccountIp> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAccountIpRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ACCOUNT_IP_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAccountRepository {
@@ -662,6 +663,127 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Account &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.charname));
+		v.emplace_back(std::string_view(e.auto_login_charname));
+		v.emplace_back(e.sharedplat);
+		v.emplace_back(std::string_view(e.password));
+		v.emplace_back(e.status);
+		v.emplace_back(std::string_view(e.ls_id));
+		v.emplace_back(e.lsaccount_id);
+		v.emplace_back(e.gmspeed);
+		v.emplace_back(e.invulnerable);
+		v.emplace_back(e.flymode);
+		v.emplace_back(e.ignore_tells);
+		v.emplace_back(e.revoked);
+		v.emplace_back(e.karma);
+		v.emplace_back(std::string_view(e.minilogin_ip));
+		v.emplace_back(e.hideme);
+		v.emplace_back(e.rulesflag);
+		v.emplace_back(RepositoryStmt::DateTime(e.suspendeduntil));
+		v.emplace_back(e.time_creation);
+		v.emplace_back(std::string_view(e.ban_reason));
+		v.emplace_back(std::string_view(e.suspend_reason));
+		v.emplace_back(std::string_view(e.crc_eqgame));
+		v.emplace_back(std::string_view(e.crc_skillcaps));
+		v.emplace_back(std::string_view(e.crc_basedata));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Account &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.charname);
+		RepositoryStmt::Read(row, 3, e.auto_login_charname);
+		RepositoryStmt::Read(row, 4, e.sharedplat);
+		RepositoryStmt::Read(row, 5, e.password);
+		RepositoryStmt::Read(row, 6, e.status);
+		RepositoryStmt::Read(row, 7, e.ls_id);
+		RepositoryStmt::Read(row, 8, e.lsaccount_id);
+		RepositoryStmt::Read(row, 9, e.gmspeed);
+		RepositoryStmt::Read(row, 10, e.invulnerable);
+		RepositoryStmt::Read(row, 11, e.flymode);
+		RepositoryStmt::Read(row, 12, e.ignore_tells);
+		RepositoryStmt::Read(row, 13, e.revoked);
+		RepositoryStmt::Read(row, 14, e.karma);
+		RepositoryStmt::Read(row, 15, e.minilogin_ip);
+		RepositoryStmt::Read(row, 16, e.hideme);
+		RepositoryStmt::Read(row, 17, e.rulesflag);
+		RepositoryStmt::Read(row, 18, e.suspendeduntil);
+		RepositoryStmt::Read(row, 19, e.time_creation);
+		RepositoryStmt::Read(row, 20, e.ban_reason);
+		RepositoryStmt::Read(row, 21, e.suspend_reason);
+		RepositoryStmt::Read(row, 22, e.crc_eqgame);
+		RepositoryStmt::Read(row, 23, e.crc_skillcaps);
+		RepositoryStmt::Read(row, 24, e.crc_basedata);
+	}
+
+	static Account FindOnePrepared(
+		Database& db,
+		int account_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAccountRepository>(db, account_id);
+	}
+
+	static std::vector<Account> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAccountRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Account &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAccountRepository>(db, e, e.id);
+	}
+
+	static Account InsertOnePrepared(
+		Database& db,
+		Account e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAccountRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Account> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAccountRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Account> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAccountRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ACCOUNT_REPOSITORY_H
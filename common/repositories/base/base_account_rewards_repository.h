@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAccountRewardsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AccountRewards &e
+	)
+	{
+		v.emplace_back(e.account_id);
+		v.emplace_back(e.reward_id);
+		v.emplace_back(e.amount);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AccountRewards &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.account_id);
+		RepositoryStmt::Read(row, 1, e.reward_id);
+		RepositoryStmt::Read(row, 2, e.amount);
+	}
+
+	static AccountRewards FindOnePrepared(
+		Database& db,
+		int account_rewards_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAccountRewardsRepository>(db, account_rewards_id);
+	}
+
+	static std::vector<AccountRewards> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAccountRewardsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AccountRewards &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAccountRewardsRepository>(db, e, e.account_id);
+	}
+
+	static AccountRewards InsertOnePrepared(
+		Database& db,
+		AccountRewards e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAccountRewardsRepository>(db, e);
+		if (id) {
+			e.account_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AccountRewards> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAccountRewardsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AccountRewards> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAccountRewardsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ACCOUNT_REWARDS_REPOSITORY_H
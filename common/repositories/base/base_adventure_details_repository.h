@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureDetailsRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureDetails &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.adventure_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.count);
+		v.emplace_back(e.assassinate_count);
+		v.emplace_back(e.status);
+		v.emplace_back(e.time_created);
+		v.emplace_back(e.time_zoned);
+		v.emplace_back(e.time_completed);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureDetails &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.adventure_id);
+		RepositoryStmt::Read(row, 2, e.instance_id);
+		RepositoryStmt::Read(row, 3, e.count);
+		RepositoryStmt::Read(row, 4, e.assassinate_count);
+		RepositoryStmt::Read(row, 5, e.status);
+		RepositoryStmt::Read(row, 6, e.time_created);
+		RepositoryStmt::Read(row, 7, e.time_zoned);
+		RepositoryStmt::Read(row, 8, e.time_completed);
+	}
+
+	static AdventureDetails FindOnePrepared(
+		Database& db,
+		int adventure_details_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureDetailsRepository>(db, adventure_details_id);
+	}
+
+	static std::vector<AdventureDetails> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureDetailsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureDetails &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureDetailsRepository>(db, e, e.id);
+	}
+
+	static AdventureDetails InsertOnePrepared(
+		Database& db,
+		AdventureDetails e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureDetailsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureDetails> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureDetailsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureDetails> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureDetailsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_DETAILS_REPOSITORY_H
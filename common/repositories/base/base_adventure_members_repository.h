@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureMembersRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureMembers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.charid);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.charid);
+	}
+
+	static AdventureMembers FindOnePrepared(
+		Database& db,
+		int adventure_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureMembersRepository>(db, adventure_members_id);
+	}
+
+	static std::vector<AdventureMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureMembersRepository>(db, e, e.charid);
+	}
+
+	static AdventureMembers InsertOnePrepared(
+		Database& db,
+		AdventureMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureMembersRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_MEMBERS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureStatsRepository {
@@ -495,6 +496,99 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureStats &e
+	)
+	{
+		v.emplace_back(e.player_id);
+		v.emplace_back(e.guk_wins);
+		v.emplace_back(e.mir_wins);
+		v.emplace_back(e.mmc_wins);
+		v.emplace_back(e.ruj_wins);
+		v.emplace_back(e.tak_wins);
+		v.emplace_back(e.guk_losses);
+		v.emplace_back(e.mir_losses);
+		v.emplace_back(e.mmc_losses);
+		v.emplace_back(e.ruj_losses);
+		v.emplace_back(e.tak_losses);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureStats &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.player_id);
+		RepositoryStmt::Read(row, 1, e.guk_wins);
+		RepositoryStmt::Read(row, 2, e.mir_wins);
+		RepositoryStmt::Read(row, 3, e.mmc_wins);
+		RepositoryStmt::Read(row, 4, e.ruj_wins);
+		RepositoryStmt::Read(row, 5, e.tak_wins);
+		RepositoryStmt::Read(row, 6, e.guk_losses);
+		RepositoryStmt::Read(row, 7, e.mir_losses);
+		RepositoryStmt::Read(row, 8, e.mmc_losses);
+		RepositoryStmt::Read(row, 9, e.ruj_losses);
+		RepositoryStmt::Read(row, 10, e.tak_losses);
+	}
+
+	static AdventureStats FindOnePrepared(
+		Database& db,
+		int adventure_stats_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureStatsRepository>(db, adventure_stats_id);
+	}
+
+	static std::vector<AdventureStats> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureStatsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureStats &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureStatsRepository>(db, e, e.player_id);
+	}
+
+	static AdventureStats InsertOnePrepared(
+		Database& db,
+		AdventureStats e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureStatsRepository>(db, e);
+		if (id) {
+			e.player_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureStats> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureStatsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureStats> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureStatsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_STATS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureTemplateEntryFlavorRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureTemplateEntryFlavor &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.text));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureTemplateEntryFlavor &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.text);
+	}
+
+	static AdventureTemplateEntryFlavor FindOnePrepared(
+		Database& db,
+		int adventure_template_entry_flavor_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureTemplateEntryFlavorRepository>(db, adventure_template_entry_flavor_id);
+	}
+
+	static std::vector<AdventureTemplateEntryFlavor> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureTemplateEntryFlavorRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureTemplateEntryFlavor &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureTemplateEntryFlavorRepository>(db, e, e.id);
+	}
+
+	static AdventureTemplateEntryFlavor InsertOnePrepared(
+		Database& db,
+		AdventureTemplateEntryFlavor e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureTemplateEntryFlavorRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplateEntryFlavor> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureTemplateEntryFlavorRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplateEntryFlavor> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureTemplateEntryFlavorRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_TEMPLATE_ENTRY_FLAVOR_REPOSITORY_H
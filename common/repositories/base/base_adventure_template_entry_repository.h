@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureTemplateEntryRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureTemplateEntry &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.template_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureTemplateEntry &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.template_id);
+	}
+
+	static AdventureTemplateEntry FindOnePrepared(
+		Database& db,
+		int adventure_template_entry_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureTemplateEntryRepository>(db, adventure_template_entry_id);
+	}
+
+	static std::vector<AdventureTemplateEntry> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureTemplateEntryRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureTemplateEntry &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureTemplateEntryRepository>(db, e, e.id);
+	}
+
+	static AdventureTemplateEntry InsertOnePrepared(
+		Database& db,
+		AdventureTemplateEntry e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureTemplateEntryRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplateEntry> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureTemplateEntryRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplateEntry> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureTemplateEntryRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_TEMPLATE_ENTRY_REPOSITORY_H
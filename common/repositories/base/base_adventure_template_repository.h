@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAdventureTemplateRepository {
@@ -756,6 +757,143 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AdventureTemplate &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.zone_version);
+		v.emplace_back(e.is_hard);
+		v.emplace_back(e.is_raid);
+		v.emplace_back(e.min_level);
+		v.emplace_back(e.max_level);
+		v.emplace_back(e.type);
+		v.emplace_back(e.type_data);
+		v.emplace_back(e.type_count);
+		v.emplace_back(e.assa_x);
+		v.emplace_back(e.assa_y);
+		v.emplace_back(e.assa_z);
+		v.emplace_back(e.assa_h);
+		v.emplace_back(std::string_view(e.text));
+		v.emplace_back(e.duration);
+		v.emplace_back(e.zone_in_time);
+		v.emplace_back(e.win_points);
+		v.emplace_back(e.lose_points);
+		v.emplace_back(e.theme);
+		v.emplace_back(e.zone_in_zone_id);
+		v.emplace_back(e.zone_in_x);
+		v.emplace_back(e.zone_in_y);
+		v.emplace_back(e.zone_in_object_id);
+		v.emplace_back(e.dest_x);
+		v.emplace_back(e.dest_y);
+		v.emplace_back(e.dest_z);
+		v.emplace_back(e.dest_h);
+		v.emplace_back(e.graveyard_zone_id);
+		v.emplace_back(e.graveyard_x);
+		v.emplace_back(e.graveyard_y);
+		v.emplace_back(e.graveyard_z);
+		v.emplace_back(std::string_view(e.graveyard_radius));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AdventureTemplate &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.zone_version);
+		RepositoryStmt::Read(row, 3, e.is_hard);
+		RepositoryStmt::Read(row, 4, e.is_raid);
+		RepositoryStmt::Read(row, 5, e.min_level);
+		RepositoryStmt::Read(row, 6, e.max_level);
+		RepositoryStmt::Read(row, 7, e.type);
+		RepositoryStmt::Read(row, 8, e.type_data);
+		RepositoryStmt::Read(row, 9, e.type_count);
+		RepositoryStmt::Read(row, 10, e.assa_x);
+		RepositoryStmt::Read(row, 11, e.assa_y);
+		RepositoryStmt::Read(row, 12, e.assa_z);
+		RepositoryStmt::Read(row, 13, e.assa_h);
+		RepositoryStmt::Read(row, 14, e.text);
+		RepositoryStmt::Read(row, 15, e.duration);
+		RepositoryStmt::Read(row, 16, e.zone_in_time);
+		RepositoryStmt::Read(row, 17, e.win_points);
+		RepositoryStmt::Read(row, 18, e.lose_points);
+		RepositoryStmt::Read(row, 19, e.theme);
+		RepositoryStmt::Read(row, 20, e.zone_in_zone_id);
+		RepositoryStmt::Read(row, 21, e.zone_in_x);
+		RepositoryStmt::Read(row, 22, e.zone_in_y);
+		RepositoryStmt::Read(row, 23, e.zone_in_object_id);
+		RepositoryStmt::Read(row, 24, e.dest_x);
+		RepositoryStmt::Read(row, 25, e.dest_y);
+		RepositoryStmt::Read(row, 26, e.dest_z);
+		RepositoryStmt::Read(row, 27, e.dest_h);
+		RepositoryStmt::Read(row, 28, e.graveyard_zone_id);
+		RepositoryStmt::Read(row, 29, e.graveyard_x);
+		RepositoryStmt::Read(row, 30, e.graveyard_y);
+		RepositoryStmt::Read(row, 31, e.graveyard_z);
+		RepositoryStmt::Read(row, 32, e.graveyard_radius);
+	}
+
+	static AdventureTemplate FindOnePrepared(
+		Database& db,
+		int adventure_template_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAdventureTemplateRepository>(db, adventure_template_id);
+	}
+
+	static std::vector<AdventureTemplate> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAdventureTemplateRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AdventureTemplate &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAdventureTemplateRepository>(db, e, e.id);
+	}
+
+	static AdventureTemplate InsertOnePrepared(
+		Database& db,
+		AdventureTemplate e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAdventureTemplateRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplate> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAdventureTemplateRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AdventureTemplate> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAdventureTemplateRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ADVENTURE_TEMPLATE_REPOSITORY_H
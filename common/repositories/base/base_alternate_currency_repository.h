@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAlternateCurrencyRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const AlternateCurrency &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		AlternateCurrency &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.item_id);
+	}
+
+	static AlternateCurrency FindOnePrepared(
+		Database& db,
+		int alternate_currency_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAlternateCurrencyRepository>(db, alternate_currency_id);
+	}
+
+	static std::vector<AlternateCurrency> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAlternateCurrencyRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const AlternateCurrency &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAlternateCurrencyRepository>(db, e, e.id);
+	}
+
+	static AlternateCurrency InsertOnePrepared(
+		Database& db,
+		AlternateCurrency e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAlternateCurrencyRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<AlternateCurrency> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAlternateCurrencyRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<AlternateCurrency> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAlternateCurrencyRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ALTERNATE_CURRENCY_REPOSITORY_H
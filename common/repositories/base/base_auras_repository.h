@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseAurasRepository {
@@ -495,6 +496,99 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Auras &e
+	)
+	{
+		v.emplace_back(e.type);
+		v.emplace_back(e.npc_type);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.distance);
+		v.emplace_back(e.aura_type);
+		v.emplace_back(e.spawn_type);
+		v.emplace_back(e.movement);
+		v.emplace_back(e.duration);
+		v.emplace_back(e.icon);
+		v.emplace_back(e.cast_time);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Auras &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.type);
+		RepositoryStmt::Read(row, 1, e.npc_type);
+		RepositoryStmt::Read(row, 2, e.name);
+		RepositoryStmt::Read(row, 3, e.spell_id);
+		RepositoryStmt::Read(row, 4, e.distance);
+		RepositoryStmt::Read(row, 5, e.aura_type);
+		RepositoryStmt::Read(row, 6, e.spawn_type);
+		RepositoryStmt::Read(row, 7, e.movement);
+		RepositoryStmt::Read(row, 8, e.duration);
+		RepositoryStmt::Read(row, 9, e.icon);
+		RepositoryStmt::Read(row, 10, e.cast_time);
+	}
+
+	static Auras FindOnePrepared(
+		Database& db,
+		int auras_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseAurasRepository>(db, auras_id);
+	}
+
+	static std::vector<Auras> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseAurasRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Auras &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseAurasRepository>(db, e, e.type);
+	}
+
+	static Auras InsertOnePrepared(
+		Database& db,
+		Auras e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseAurasRepository>(db, e);
+		if (id) {
+			e.type = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Auras> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseAurasRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Auras> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseAurasRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_AURAS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBaseDataRepository {
@@ -483,6 +484,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BaseData &e
+	)
+	{
+		v.emplace_back(e.level);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.end);
+		v.emplace_back(e.hp_regen);
+		v.emplace_back(e.end_regen);
+		v.emplace_back(e.hp_fac);
+		v.emplace_back(e.mana_fac);
+		v.emplace_back(e.end_fac);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BaseData &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.level);
+		RepositoryStmt::Read(row, 1, e.class_);
+		RepositoryStmt::Read(row, 2, e.hp);
+		RepositoryStmt::Read(row, 3, e.mana);
+		RepositoryStmt::Read(row, 4, e.end);
+		RepositoryStmt::Read(row, 5, e.hp_regen);
+		RepositoryStmt::Read(row, 6, e.end_regen);
+		RepositoryStmt::Read(row, 7, e.hp_fac);
+		RepositoryStmt::Read(row, 8, e.mana_fac);
+		RepositoryStmt::Read(row, 9, e.end_fac);
+	}
+
+	static BaseData FindOnePrepared(
+		Database& db,
+		int base_data_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBaseDataRepository>(db, base_data_id);
+	}
+
+	static std::vector<BaseData> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBaseDataRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BaseData &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBaseDataRepository>(db, e, e.level);
+	}
+
+	static BaseData InsertOnePrepared(
+		Database& db,
+		BaseData e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBaseDataRepository>(db, e);
+		if (id) {
+			e.level = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BaseData> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBaseDataRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BaseData> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBaseDataRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BASE_DATA_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBlockedSpellsRepository {
@@ -554,6 +555,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BlockedSpells &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.spellid);
+		v.emplace_back(e.type);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.x_diff);
+		v.emplace_back(e.y_diff);
+		v.emplace_back(e.z_diff);
+		v.emplace_back(std::string_view(e.message));
+		v.emplace_back(std::string_view(e.description));
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BlockedSpells &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.spellid);
+		RepositoryStmt::Read(row, 2, e.type);
+		RepositoryStmt::Read(row, 3, e.zoneid);
+		RepositoryStmt::Read(row, 4, e.x);
+		RepositoryStmt::Read(row, 5, e.y);
+		RepositoryStmt::Read(row, 6, e.z);
+		RepositoryStmt::Read(row, 7, e.x_diff);
+		RepositoryStmt::Read(row, 8, e.y_diff);
+		RepositoryStmt::Read(row, 9, e.z_diff);
+		RepositoryStmt::Read(row, 10, e.message);
+		RepositoryStmt::Read(row, 11, e.description);
+		RepositoryStmt::Read(row, 12, e.min_expansion);
+		RepositoryStmt::Read(row, 13, e.max_expansion);
+		RepositoryStmt::Read(row, 14, e.content_flags);
+		RepositoryStmt::Read(row, 15, e.content_flags_disabled);
+	}
+
+	static BlockedSpells FindOnePrepared(
+		Database& db,
+		int blocked_spells_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBlockedSpellsRepository>(db, blocked_spells_id);
+	}
+
+	static std::vector<BlockedSpells> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBlockedSpellsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BlockedSpells &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBlockedSpellsRepository>(db, e, e.id);
+	}
+
+	static BlockedSpells InsertOnePrepared(
+		Database& db,
+		BlockedSpells e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBlockedSpellsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BlockedSpells> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBlockedSpellsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BlockedSpells> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBlockedSpellsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BLOCKED_SPELLS_REPOSITORY_H
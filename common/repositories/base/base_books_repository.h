@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBooksRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Books &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.txtfile));
+		v.emplace_back(e.language);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Books &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.txtfile);
+		RepositoryStmt::Read(row, 3, e.language);
+	}
+
+	static Books FindOnePrepared(
+		Database& db,
+		int books_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBooksRepository>(db, books_id);
+	}
+
+	static std::vector<Books> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBooksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Books &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBooksRepository>(db, e, e.id);
+	}
+
+	static Books InsertOnePrepared(
+		Database& db,
+		Books e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBooksRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Books> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBooksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Books> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBooksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOOKS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotBlockedBuffsRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotBlockedBuffs &e
+	)
+	{
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.blocked);
+		v.emplace_back(e.blocked_pet);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotBlockedBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.bot_id);
+		RepositoryStmt::Read(row, 1, e.spell_id);
+		RepositoryStmt::Read(row, 2, e.blocked);
+		RepositoryStmt::Read(row, 3, e.blocked_pet);
+	}
+
+	static BotBlockedBuffs FindOnePrepared(
+		Database& db,
+		int bot_blocked_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotBlockedBuffsRepository>(db, bot_blocked_buffs_id);
+	}
+
+	static std::vector<BotBlockedBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotBlockedBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotBlockedBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotBlockedBuffsRepository>(db, e, e.bot_id);
+	}
+
+	static BotBlockedBuffs InsertOnePrepared(
+		Database& db,
+		BotBlockedBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotBlockedBuffsRepository>(db, e);
+		if (id) {
+			e.bot_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotBlockedBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotBlockedBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotBlockedBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotBlockedBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_BLOCKED_BUFFS_REPOSITORY_H
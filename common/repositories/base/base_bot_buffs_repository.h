@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotBuffsRepository {
@@ -602,6 +603,117 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotBuffs &e
+	)
+	{
+		v.emplace_back(e.buffs_index);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.caster_level);
+		v.emplace_back(e.duration_formula);
+		v.emplace_back(e.tics_remaining);
+		v.emplace_back(e.poison_counters);
+		v.emplace_back(e.disease_counters);
+		v.emplace_back(e.curse_counters);
+		v.emplace_back(e.corruption_counters);
+		v.emplace_back(e.numhits);
+		v.emplace_back(e.melee_rune);
+		v.emplace_back(e.magic_rune);
+		v.emplace_back(e.dot_rune);
+		v.emplace_back(e.persistent);
+		v.emplace_back(e.caston_x);
+		v.emplace_back(e.caston_y);
+		v.emplace_back(e.caston_z);
+		v.emplace_back(e.extra_di_chance);
+		v.emplace_back(e.instrument_mod);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.buffs_index);
+		RepositoryStmt::Read(row, 1, e.bot_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.caster_level);
+		RepositoryStmt::Read(row, 4, e.duration_formula);
+		RepositoryStmt::Read(row, 5, e.tics_remaining);
+		RepositoryStmt::Read(row, 6, e.poison_counters);
+		RepositoryStmt::Read(row, 7, e.disease_counters);
+		RepositoryStmt::Read(row, 8, e.curse_counters);
+		RepositoryStmt::Read(row, 9, e.corruption_counters);
+		RepositoryStmt::Read(row, 10, e.numhits);
+		RepositoryStmt::Read(row, 11, e.melee_rune);
+		RepositoryStmt::Read(row, 12, e.magic_rune);
+		RepositoryStmt::Read(row, 13, e.dot_rune);
+		RepositoryStmt::Read(row, 14, e.persistent);
+		RepositoryStmt::Read(row, 15, e.caston_x);
+		RepositoryStmt::Read(row, 16, e.caston_y);
+		RepositoryStmt::Read(row, 17, e.caston_z);
+		RepositoryStmt::Read(row, 18, e.extra_di_chance);
+		RepositoryStmt::Read(row, 19, e.instrument_mod);
+	}
+
+	static BotBuffs FindOnePrepared(
+		Database& db,
+		int bot_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotBuffsRepository>(db, bot_buffs_id);
+	}
+
+	static std::vector<BotBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotBuffsRepository>(db, e, e.buffs_index);
+	}
+
+	static BotBuffs InsertOnePrepared(
+		Database& db,
+		BotBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotBuffsRepository>(db, e);
+		if (id) {
+			e.buffs_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_BUFFS_REPOSITORY_H
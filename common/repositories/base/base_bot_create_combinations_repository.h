@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotCreateCombinationsRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotCreateCombinations &e
+	)
+	{
+		v.emplace_back(e.race);
+		v.emplace_back(e.classes);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotCreateCombinations &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.race);
+		RepositoryStmt::Read(row, 1, e.classes);
+	}
+
+	static BotCreateCombinations FindOnePrepared(
+		Database& db,
+		int bot_create_combinations_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotCreateCombinationsRepository>(db, bot_create_combinations_id);
+	}
+
+	static std::vector<BotCreateCombinations> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotCreateCombinationsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotCreateCombinations &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotCreateCombinationsRepository>(db, e, e.race);
+	}
+
+	static BotCreateCombinations InsertOnePrepared(
+		Database& db,
+		BotCreateCombinations e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotCreateCombinationsRepository>(db, e);
+		if (id) {
+			e.race = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotCreateCombinations> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotCreateCombinationsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotCreateCombinations> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotCreateCombinationsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_CREATE_COMBINATIONS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotDataRepository {
@@ -914,6 +915,167 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotData &e
+	)
+	{
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.owner_id);
+		v.emplace_back(e.spells_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.last_name));
+		v.emplace_back(std::string_view(e.title));
+		v.emplace_back(std::string_view(e.suffix));
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.race);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.level);
+		v.emplace_back(e.deity);
+		v.emplace_back(e.creation_day);
+		v.emplace_back(e.last_spawn);
+		v.emplace_back(e.time_spawned);
+		v.emplace_back(e.size);
+		v.emplace_back(e.face);
+		v.emplace_back(e.hair_color);
+		v.emplace_back(e.hair_style);
+		v.emplace_back(e.beard);
+		v.emplace_back(e.beard_color);
+		v.emplace_back(e.eye_color_1);
+		v.emplace_back(e.eye_color_2);
+		v.emplace_back(e.drakkin_heritage);
+		v.emplace_back(e.drakkin_tattoo);
+		v.emplace_back(e.drakkin_details);
+		v.emplace_back(e.ac);
+		v.emplace_back(e.atk);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.str);
+		v.emplace_back(e.sta);
+		v.emplace_back(e.cha);
+		v.emplace_back(e.dex);
+		v.emplace_back(e.int_);
+		v.emplace_back(e.agi);
+		v.emplace_back(e.wis);
+		v.emplace_back(e.extra_haste);
+		v.emplace_back(e.fire);
+		v.emplace_back(e.cold);
+		v.emplace_back(e.magic);
+		v.emplace_back(e.poison);
+		v.emplace_back(e.disease);
+		v.emplace_back(e.corruption);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotData &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.bot_id);
+		RepositoryStmt::Read(row, 1, e.owner_id);
+		RepositoryStmt::Read(row, 2, e.spells_id);
+		RepositoryStmt::Read(row, 3, e.name);
+		RepositoryStmt::Read(row, 4, e.last_name);
+		RepositoryStmt::Read(row, 5, e.title);
+		RepositoryStmt::Read(row, 6, e.suffix);
+		RepositoryStmt::Read(row, 7, e.zone_id);
+		RepositoryStmt::Read(row, 8, e.gender);
+		RepositoryStmt::Read(row, 9, e.race);
+		RepositoryStmt::Read(row, 10, e.class_);
+		RepositoryStmt::Read(row, 11, e.level);
+		RepositoryStmt::Read(row, 12, e.deity);
+		RepositoryStmt::Read(row, 13, e.creation_day);
+		RepositoryStmt::Read(row, 14, e.last_spawn);
+		RepositoryStmt::Read(row, 15, e.time_spawned);
+		RepositoryStmt::Read(row, 16, e.size);
+		RepositoryStmt::Read(row, 17, e.face);
+		RepositoryStmt::Read(row, 18, e.hair_color);
+		RepositoryStmt::Read(row, 19, e.hair_style);
+		RepositoryStmt::Read(row, 20, e.beard);
+		RepositoryStmt::Read(row, 21, e.beard_color);
+		RepositoryStmt::Read(row, 22, e.eye_color_1);
+		RepositoryStmt::Read(row, 23, e.eye_color_2);
+		RepositoryStmt::Read(row, 24, e.drakkin_heritage);
+		RepositoryStmt::Read(row, 25, e.drakkin_tattoo);
+		RepositoryStmt::Read(row, 26, e.drakkin_details);
+		RepositoryStmt::Read(row, 27, e.ac);
+		RepositoryStmt::Read(row, 28, e.atk);
+		RepositoryStmt::Read(row, 29, e.hp);
+		RepositoryStmt::Read(row, 30, e.mana);
+		RepositoryStmt::Read(row, 31, e.str);
+		RepositoryStmt::Read(row, 32, e.sta);
+		RepositoryStmt::Read(row, 33, e.cha);
+		RepositoryStmt::Read(row, 34, e.dex);
+		RepositoryStmt::Read(row, 35, e.int_);
+		RepositoryStmt::Read(row, 36, e.agi);
+		RepositoryStmt::Read(row, 37, e.wis);
+		RepositoryStmt::Read(row, 38, e.extra_haste);
+		RepositoryStmt::Read(row, 39, e.fire);
+		RepositoryStmt::Read(row, 40, e.cold);
+		RepositoryStmt::Read(row, 41, e.magic);
+		RepositoryStmt::Read(row, 42, e.poison);
+		RepositoryStmt::Read(row, 43, e.disease);
+		RepositoryStmt::Read(row, 44, e.corruption);
+	}
+
+	static BotData FindOnePrepared(
+		Database& db,
+		int bot_data_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotDataRepository>(db, bot_data_id);
+	}
+
+	static std::vector<BotData> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotDataRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotData &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotDataRepository>(db, e, e.bot_id);
+	}
+
+	static BotData InsertOnePrepared(
+		Database& db,
+		BotData e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotDataRepository>(db, e);
+		if (id) {
+			e.bot_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotData> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotDataRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotData> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotDataRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_DATA_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotHealRotationMembersRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotHealRotationMembers &e
+	)
+	{
+		v.emplace_back(e.member_index);
+		v.emplace_back(e.heal_rotation_index);
+		v.emplace_back(e.bot_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotHealRotationMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.member_index);
+		RepositoryStmt::Read(row, 1, e.heal_rotation_index);
+		RepositoryStmt::Read(row, 2, e.bot_id);
+	}
+
+	static BotHealRotationMembers FindOnePrepared(
+		Database& db,
+		int bot_heal_rotation_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotHealRotationMembersRepository>(db, bot_heal_rotation_members_id);
+	}
+
+	static std::vector<BotHealRotationMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotHealRotationMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotHealRotationMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotHealRotationMembersRepository>(db, e, e.member_index);
+	}
+
+	static BotHealRotationMembers InsertOnePrepared(
+		Database& db,
+		BotHealRotationMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotHealRotationMembersRepository>(db, e);
+		if (id) {
+			e.member_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotationMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotHealRotationMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotationMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotHealRotationMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_HEAL_ROTATION_MEMBERS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotHealRotationTargetsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotHealRotationTargets &e
+	)
+	{
+		v.emplace_back(e.target_index);
+		v.emplace_back(e.heal_rotation_index);
+		v.emplace_back(std::string_view(e.target_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotHealRotationTargets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.target_index);
+		RepositoryStmt::Read(row, 1, e.heal_rotation_index);
+		RepositoryStmt::Read(row, 2, e.target_name);
+	}
+
+	static BotHealRotationTargets FindOnePrepared(
+		Database& db,
+		int bot_heal_rotation_targets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotHealRotationTargetsRepository>(db, bot_heal_rotation_targets_id);
+	}
+
+	static std::vector<BotHealRotationTargets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotHealRotationTargetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotHealRotationTargets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotHealRotationTargetsRepository>(db, e, e.target_index);
+	}
+
+	static BotHealRotationTargets InsertOnePrepared(
+		Database& db,
+		BotHealRotationTargets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotHealRotationTargetsRepository>(db, e);
+		if (id) {
+			e.target_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotationTargets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotHealRotationTargetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotationTargets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotHealRotationTargetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_HEAL_ROTATION_TARGETS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotHealRotationsRepository {
@@ -524,6 +525,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotHealRotations &e
+	)
+	{
+		v.emplace_back(e.heal_rotation_index);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.interval_);
+		v.emplace_back(e.fast_heals);
+		v.emplace_back(e.adaptive_targeting);
+		v.emplace_back(e.casting_override);
+		v.emplace_back(e.safe_hp_base);
+		v.emplace_back(e.safe_hp_cloth);
+		v.emplace_back(e.safe_hp_leather);
+		v.emplace_back(e.safe_hp_chain);
+		v.emplace_back(e.safe_hp_plate);
+		v.emplace_back(e.critical_hp_base);
+		v.emplace_back(e.critical_hp_cloth);
+		v.emplace_back(e.critical_hp_leather);
+		v.emplace_back(e.critical_hp_chain);
+		v.emplace_back(e.critical_hp_plate);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotHealRotations &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.heal_rotation_index);
+		RepositoryStmt::Read(row, 1, e.bot_id);
+		RepositoryStmt::Read(row, 2, e.interval_);
+		RepositoryStmt::Read(row, 3, e.fast_heals);
+		RepositoryStmt::Read(row, 4, e.adaptive_targeting);
+		RepositoryStmt::Read(row, 5, e.casting_override);
+		RepositoryStmt::Read(row, 6, e.safe_hp_base);
+		RepositoryStmt::Read(row, 7, e.safe_hp_cloth);
+		RepositoryStmt::Read(row, 8, e.safe_hp_leather);
+		RepositoryStmt::Read(row, 9, e.safe_hp_chain);
+		RepositoryStmt::Read(row, 10, e.safe_hp_plate);
+		RepositoryStmt::Read(row, 11, e.critical_hp_base);
+		RepositoryStmt::Read(row, 12, e.critical_hp_cloth);
+		RepositoryStmt::Read(row, 13, e.critical_hp_leather);
+		RepositoryStmt::Read(row, 14, e.critical_hp_chain);
+		RepositoryStmt::Read(row, 15, e.critical_hp_plate);
+	}
+
+	static BotHealRotations FindOnePrepared(
+		Database& db,
+		int bot_heal_rotations_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotHealRotationsRepository>(db, bot_heal_rotations_id);
+	}
+
+	static std::vector<BotHealRotations> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotHealRotationsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotHealRotations &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotHealRotationsRepository>(db, e, e.heal_rotation_index);
+	}
+
+	static BotHealRotations InsertOnePrepared(
+		Database& db,
+		BotHealRotations e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotHealRotationsRepository>(db, e);
+		if (id) {
+			e.heal_rotation_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotations> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotHealRotationsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotHealRotations> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotHealRotationsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_HEAL_ROTATIONS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotInspectMessagesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotInspectMessages &e
+	)
+	{
+		v.emplace_back(e.bot_id);
+		v.emplace_back(std::string_view(e.inspect_message));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotInspectMessages &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.bot_id);
+		RepositoryStmt::Read(row, 1, e.inspect_message);
+	}
+
+	static BotInspectMessages FindOnePrepared(
+		Database& db,
+		int bot_inspect_messages_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotInspectMessagesRepository>(db, bot_inspect_messages_id);
+	}
+
+	static std::vector<BotInspectMessages> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotInspectMessagesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotInspectMessages &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotInspectMessagesRepository>(db, e, e.bot_id);
+	}
+
+	static BotInspectMessages InsertOnePrepared(
+		Database& db,
+		BotInspectMessages e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotInspectMessagesRepository>(db, e);
+		if (id) {
+			e.bot_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotInspectMessages> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotInspectMessagesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotInspectMessages> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotInspectMessagesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_INSPECT_MESSAGES_REPOSITORY_H
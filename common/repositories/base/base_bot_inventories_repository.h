@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotInventoriesRepository {
@@ -566,6 +567,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotInventories &e
+	)
+	{
+		v.emplace_back(e.inventories_index);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.inst_charges);
+		v.emplace_back(e.inst_color);
+		v.emplace_back(e.inst_no_drop);
+		v.emplace_back(std::string_view(e.inst_custom_data));
+		v.emplace_back(e.ornament_icon);
+		v.emplace_back(e.ornament_id_file);
+		v.emplace_back(e.ornament_hero_model);
+		v.emplace_back(e.augment_1);
+		v.emplace_back(e.augment_2);
+		v.emplace_back(e.augment_3);
+		v.emplace_back(e.augment_4);
+		v.emplace_back(e.augment_5);
+		v.emplace_back(e.augment_6);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotInventories &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.inventories_index);
+		RepositoryStmt::Read(row, 1, e.bot_id);
+		RepositoryStmt::Read(row, 2, e.slot_id);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.inst_charges);
+		RepositoryStmt::Read(row, 5, e.inst_color);
+		RepositoryStmt::Read(row, 6, e.inst_no_drop);
+		RepositoryStmt::Read(row, 7, e.inst_custom_data);
+		RepositoryStmt::Read(row, 8, e.ornament_icon);
+		RepositoryStmt::Read(row, 9, e.ornament_id_file);
+		RepositoryStmt::Read(row, 10, e.ornament_hero_model);
+		RepositoryStmt::Read(row, 11, e.augment_1);
+		RepositoryStmt::Read(row, 12, e.augment_2);
+		RepositoryStmt::Read(row, 13, e.augment_3);
+		RepositoryStmt::Read(row, 14, e.augment_4);
+		RepositoryStmt::Read(row, 15, e.augment_5);
+		RepositoryStmt::Read(row, 16, e.augment_6);
+	}
+
+	static BotInventories FindOnePrepared(
+		Database& db,
+		int bot_inventories_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotInventoriesRepository>(db, bot_inventories_id);
+	}
+
+	static std::vector<BotInventories> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotInventoriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotInventories &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotInventoriesRepository>(db, e, e.inventories_index);
+	}
+
+	static BotInventories InsertOnePrepared(
+		Database& db,
+		BotInventories e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotInventoriesRepository>(db, e);
+		if (id) {
+			e.inventories_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotInventories> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotInventoriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotInventories> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotInventoriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_INVENTORIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotOwnerOptionsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotOwnerOptions &e
+	)
+	{
+		v.emplace_back(e.owner_id);
+		v.emplace_back(e.option_type);
+		v.emplace_back(e.option_value);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotOwnerOptions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.owner_id);
+		RepositoryStmt::Read(row, 1, e.option_type);
+		RepositoryStmt::Read(row, 2, e.option_value);
+	}
+
+	static BotOwnerOptions FindOnePrepared(
+		Database& db,
+		int bot_owner_options_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotOwnerOptionsRepository>(db, bot_owner_options_id);
+	}
+
+	static std::vector<BotOwnerOptions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotOwnerOptionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotOwnerOptions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotOwnerOptionsRepository>(db, e, e.owner_id);
+	}
+
+	static BotOwnerOptions InsertOnePrepared(
+		Database& db,
+		BotOwnerOptions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotOwnerOptionsRepository>(db, e);
+		if (id) {
+			e.owner_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotOwnerOptions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotOwnerOptionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotOwnerOptions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotOwnerOptionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_OWNER_OPTIONS_REPOSITORY_H
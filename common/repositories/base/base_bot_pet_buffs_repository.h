@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotPetBuffsRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotPetBuffs &e
+	)
+	{
+		v.emplace_back(e.pet_buffs_index);
+		v.emplace_back(e.pets_index);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.caster_level);
+		v.emplace_back(e.duration);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotPetBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.pet_buffs_index);
+		RepositoryStmt::Read(row, 1, e.pets_index);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.caster_level);
+		RepositoryStmt::Read(row, 4, e.duration);
+	}
+
+	static BotPetBuffs FindOnePrepared(
+		Database& db,
+		int bot_pet_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotPetBuffsRepository>(db, bot_pet_buffs_id);
+	}
+
+	static std::vector<BotPetBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotPetBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotPetBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotPetBuffsRepository>(db, e, e.pet_buffs_index);
+	}
+
+	static BotPetBuffs InsertOnePrepared(
+		Database& db,
+		BotPetBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotPetBuffsRepository>(db, e);
+		if (id) {
+			e.pet_buffs_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotPetBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotPetBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotPetBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotPetBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_PET_BUFFS_REPOSITORY_H
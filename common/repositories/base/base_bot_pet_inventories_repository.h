@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotPetInventoriesRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotPetInventories &e
+	)
+	{
+		v.emplace_back(e.pet_inventories_index);
+		v.emplace_back(e.pets_index);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotPetInventories &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.pet_inventories_index);
+		RepositoryStmt::Read(row, 1, e.pets_index);
+		RepositoryStmt::Read(row, 2, e.item_id);
+	}
+
+	static BotPetInventories FindOnePrepared(
+		Database& db,
+		int bot_pet_inventories_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotPetInventoriesRepository>(db, bot_pet_inventories_id);
+	}
+
+	static std::vector<BotPetInventories> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotPetInventoriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotPetInventories &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotPetInventoriesRepository>(db, e, e.pet_inventories_index);
+	}
+
+	static BotPetInventories InsertOnePrepared(
+		Database& db,
+		BotPetInventories e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotPetInventoriesRepository>(db, e);
+		if (id) {
+			e.pet_inventories_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotPetInventories> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotPetInventoriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotPetInventories> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotPetInventoriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_PET_INVENTORIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotPetsRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotPets &e
+	)
+	{
+		v.emplace_back(e.pets_index);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.mana);
+		v.emplace_back(e.hp);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotPets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.pets_index);
+		RepositoryStmt::Read(row, 1, e.spell_id);
+		RepositoryStmt::Read(row, 2, e.bot_id);
+		RepositoryStmt::Read(row, 3, e.name);
+		RepositoryStmt::Read(row, 4, e.mana);
+		RepositoryStmt::Read(row, 5, e.hp);
+	}
+
+	static BotPets FindOnePrepared(
+		Database& db,
+		int bot_pets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotPetsRepository>(db, bot_pets_id);
+	}
+
+	static std::vector<BotPets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotPetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotPets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotPetsRepository>(db, e, e.pets_index);
+	}
+
+	static BotPets InsertOnePrepared(
+		Database& db,
+		BotPets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotPetsRepository>(db, e);
+		if (id) {
+			e.pets_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotPets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotPetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotPets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotPetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_PETS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotSettingsRepository {
@@ -459,6 +460,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotSettings &e
+	)
+	{
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.stance);
+		v.emplace_back(e.setting_id);
+		v.emplace_back(e.setting_type);
+		v.emplace_back(e.value);
+		v.emplace_back(std::string_view(e.category_name));
+		v.emplace_back(std::string_view(e.setting_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotSettings &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.character_id);
+		RepositoryStmt::Read(row, 1, e.bot_id);
+		RepositoryStmt::Read(row, 2, e.stance);
+		RepositoryStmt::Read(row, 3, e.setting_id);
+		RepositoryStmt::Read(row, 4, e.setting_type);
+		RepositoryStmt::Read(row, 5, e.value);
+		RepositoryStmt::Read(row, 6, e.category_name);
+		RepositoryStmt::Read(row, 7, e.setting_name);
+	}
+
+	static BotSettings FindOnePrepared(
+		Database& db,
+		int bot_settings_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotSettingsRepository>(db, bot_settings_id);
+	}
+
+	static std::vector<BotSettings> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotSettingsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotSettings &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotSettingsRepository>(db, e, e.character_id);
+	}
+
+	static BotSettings InsertOnePrepared(
+		Database& db,
+		BotSettings e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotSettingsRepository>(db, e);
+		if (id) {
+			e.character_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotSettings> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotSettingsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotSettings> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotSettingsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_SETTINGS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotSpellCastingChancesRepository {
@@ -602,6 +603,117 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotSpellCastingChances &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.spell_type_index);
+		v.emplace_back(e.class_id);
+		v.emplace_back(e.stance_index);
+		v.emplace_back(e.nHSND_value);
+		v.emplace_back(e.pH_value);
+		v.emplace_back(e.pS_value);
+		v.emplace_back(e.pHS_value);
+		v.emplace_back(e.pN_value);
+		v.emplace_back(e.pHN_value);
+		v.emplace_back(e.pSN_value);
+		v.emplace_back(e.pHSN_value);
+		v.emplace_back(e.pD_value);
+		v.emplace_back(e.pHD_value);
+		v.emplace_back(e.pSD_value);
+		v.emplace_back(e.pHSD_value);
+		v.emplace_back(e.pND_value);
+		v.emplace_back(e.pHND_value);
+		v.emplace_back(e.pSND_value);
+		v.emplace_back(e.pHSND_value);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotSpellCastingChances &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.spell_type_index);
+		RepositoryStmt::Read(row, 2, e.class_id);
+		RepositoryStmt::Read(row, 3, e.stance_index);
+		RepositoryStmt::Read(row, 4, e.nHSND_value);
+		RepositoryStmt::Read(row, 5, e.pH_value);
+		RepositoryStmt::Read(row, 6, e.pS_value);
+		RepositoryStmt::Read(row, 7, e.pHS_value);
+		RepositoryStmt::Read(row, 8, e.pN_value);
+		RepositoryStmt::Read(row, 9, e.pHN_value);
+		RepositoryStmt::Read(row, 10, e.pSN_value);
+		RepositoryStmt::Read(row, 11, e.pHSN_value);
+		RepositoryStmt::Read(row, 12, e.pD_value);
+		RepositoryStmt::Read(row, 13, e.pHD_value);
+		RepositoryStmt::Read(row, 14, e.pSD_value);
+		RepositoryStmt::Read(row, 15, e.pHSD_value);
+		RepositoryStmt::Read(row, 16, e.pND_value);
+		RepositoryStmt::Read(row, 17, e.pHND_value);
+		RepositoryStmt::Read(row, 18, e.pSND_value);
+		RepositoryStmt::Read(row, 19, e.pHSND_value);
+	}
+
+	static BotSpellCastingChances FindOnePrepared(
+		Database& db,
+		int bot_spell_casting_chances_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotSpellCastingChancesRepository>(db, bot_spell_casting_chances_id);
+	}
+
+	static std::vector<BotSpellCastingChances> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotSpellCastingChancesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotSpellCastingChances &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotSpellCastingChancesRepository>(db, e, e.id);
+	}
+
+	static BotSpellCastingChances InsertOnePrepared(
+		Database& db,
+		BotSpellCastingChances e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotSpellCastingChancesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotSpellCastingChances> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotSpellCastingChancesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotSpellCastingChances> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotSpellCastingChancesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_SPELL_CASTING_CHANCES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotSpellSettingsRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotSpellSettings &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.priority);
+		v.emplace_back(e.min_hp);
+		v.emplace_back(e.max_hp);
+		v.emplace_back(e.is_enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotSpellSettings &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.bot_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.priority);
+		RepositoryStmt::Read(row, 4, e.min_hp);
+		RepositoryStmt::Read(row, 5, e.max_hp);
+		RepositoryStmt::Read(row, 6, e.is_enabled);
+	}
+
+	static BotSpellSettings FindOnePrepared(
+		Database& db,
+		int bot_spell_settings_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotSpellSettingsRepository>(db, bot_spell_settings_id);
+	}
+
+	static std::vector<BotSpellSettings> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotSpellSettingsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotSpellSettings &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotSpellSettingsRepository>(db, e, e.id);
+	}
+
+	static BotSpellSettings InsertOnePrepared(
+		Database& db,
+		BotSpellSettings e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotSpellSettingsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotSpellSettings> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotSpellSettingsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotSpellSettings> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotSpellSettingsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_SPELL_SETTINGS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotSpellsEntriesRepository {
@@ -542,6 +543,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotSpellsEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_spells_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.manacost);
+		v.emplace_back(e.recast_delay);
+		v.emplace_back(e.priority);
+		v.emplace_back(e.resist_adjust);
+		v.emplace_back(e.min_hp);
+		v.emplace_back(e.max_hp);
+		v.emplace_back(std::string_view(e.bucket_name));
+		v.emplace_back(std::string_view(e.bucket_value));
+		v.emplace_back(e.bucket_comparison);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotSpellsEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_spells_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.type);
+		RepositoryStmt::Read(row, 4, e.minlevel);
+		RepositoryStmt::Read(row, 5, e.maxlevel);
+		RepositoryStmt::Read(row, 6, e.manacost);
+		RepositoryStmt::Read(row, 7, e.recast_delay);
+		RepositoryStmt::Read(row, 8, e.priority);
+		RepositoryStmt::Read(row, 9, e.resist_adjust);
+		RepositoryStmt::Read(row, 10, e.min_hp);
+		RepositoryStmt::Read(row, 11, e.max_hp);
+		RepositoryStmt::Read(row, 12, e.bucket_name);
+		RepositoryStmt::Read(row, 13, e.bucket_value);
+		RepositoryStmt::Read(row, 14, e.bucket_comparison);
+	}
+
+	static BotSpellsEntries FindOnePrepared(
+		Database& db,
+		int bot_spells_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotSpellsEntriesRepository>(db, bot_spells_entries_id);
+	}
+
+	static std::vector<BotSpellsEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotSpellsEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotSpellsEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotSpellsEntriesRepository>(db, e, e.id);
+	}
+
+	static BotSpellsEntries InsertOnePrepared(
+		Database& db,
+		BotSpellsEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotSpellsEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotSpellsEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotSpellsEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotSpellsEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotSpellsEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_SPELLS_ENTRIES_REPOSITORY_H
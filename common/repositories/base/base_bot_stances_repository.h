@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotStancesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotStances &e
+	)
+	{
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.stance_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotStances &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.bot_id);
+		RepositoryStmt::Read(row, 1, e.stance_id);
+	}
+
+	static BotStances FindOnePrepared(
+		Database& db,
+		int bot_stances_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotStancesRepository>(db, bot_stances_id);
+	}
+
+	static std::vector<BotStances> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotStancesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotStances &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotStancesRepository>(db, e, e.bot_id);
+	}
+
+	static BotStances InsertOnePrepared(
+		Database& db,
+		BotStances e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotStancesRepository>(db, e);
+		if (id) {
+			e.bot_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotStances> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotStancesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotStances> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotStancesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_STANCES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotStartingItemsRepository {
@@ -566,6 +567,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotStartingItems &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.races);
+		v.emplace_back(e.classes);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.item_charges);
+		v.emplace_back(e.augment_one);
+		v.emplace_back(e.augment_two);
+		v.emplace_back(e.augment_three);
+		v.emplace_back(e.augment_four);
+		v.emplace_back(e.augment_five);
+		v.emplace_back(e.augment_six);
+		v.emplace_back(e.min_status);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotStartingItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.races);
+		RepositoryStmt::Read(row, 2, e.classes);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.item_charges);
+		RepositoryStmt::Read(row, 5, e.augment_one);
+		RepositoryStmt::Read(row, 6, e.augment_two);
+		RepositoryStmt::Read(row, 7, e.augment_three);
+		RepositoryStmt::Read(row, 8, e.augment_four);
+		RepositoryStmt::Read(row, 9, e.augment_five);
+		RepositoryStmt::Read(row, 10, e.augment_six);
+		RepositoryStmt::Read(row, 11, e.min_status);
+		RepositoryStmt::Read(row, 12, e.slot_id);
+		RepositoryStmt::Read(row, 13, e.min_expansion);
+		RepositoryStmt::Read(row, 14, e.max_expansion);
+		RepositoryStmt::Read(row, 15, e.content_flags);
+		RepositoryStmt::Read(row, 16, e.content_flags_disabled);
+	}
+
+	static BotStartingItems FindOnePrepared(
+		Database& db,
+		int bot_starting_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotStartingItemsRepository>(db, bot_starting_items_id);
+	}
+
+	static std::vector<BotStartingItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotStartingItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotStartingItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotStartingItemsRepository>(db, e, e.id);
+	}
+
+	static BotStartingItems InsertOnePrepared(
+		Database& db,
+		BotStartingItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotStartingItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotStartingItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotStartingItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotStartingItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotStartingItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_STARTING_ITEMS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBotTimersRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BotTimers &e
+	)
+	{
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.timer_id);
+		v.emplace_back(e.timer_value);
+		v.emplace_back(e.recast_time);
+		v.emplace_back(e.is_spell);
+		v.emplace_back(e.is_disc);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.is_item);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BotTimers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.bot_id);
+		RepositoryStmt::Read(row, 1, e.timer_id);
+		RepositoryStmt::Read(row, 2, e.timer_value);
+		RepositoryStmt::Read(row, 3, e.recast_time);
+		RepositoryStmt::Read(row, 4, e.is_spell);
+		RepositoryStmt::Read(row, 5, e.is_disc);
+		RepositoryStmt::Read(row, 6, e.spell_id);
+		RepositoryStmt::Read(row, 7, e.is_item);
+		RepositoryStmt::Read(row, 8, e.item_id);
+	}
+
+	static BotTimers FindOnePrepared(
+		Database& db,
+		int bot_timers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBotTimersRepository>(db, bot_timers_id);
+	}
+
+	static std::vector<BotTimers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBotTimersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BotTimers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBotTimersRepository>(db, e, e.bot_id);
+	}
+
+	static BotTimers InsertOnePrepared(
+		Database& db,
+		BotTimers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBotTimersRepository>(db, e);
+		if (id) {
+			e.bot_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BotTimers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBotTimersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BotTimers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBotTimersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BOT_TIMERS_REPOSITORY_H
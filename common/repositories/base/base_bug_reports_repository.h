@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBugReportsRepository {
@@ -746,6 +747,141 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BugReports &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.client_version_id);
+		v.emplace_back(std::string_view(e.client_version_name));
+		v.emplace_back(e.account_id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(std::string_view(e.character_name));
+		v.emplace_back(e.reporter_spoof);
+		v.emplace_back(e.category_id);
+		v.emplace_back(std::string_view(e.category_name));
+		v.emplace_back(std::string_view(e.reporter_name));
+		v.emplace_back(std::string_view(e.ui_path));
+		v.emplace_back(e.pos_x);
+		v.emplace_back(e.pos_y);
+		v.emplace_back(e.pos_z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.time_played);
+		v.emplace_back(e.target_id);
+		v.emplace_back(std::string_view(e.target_name));
+		v.emplace_back(e.optional_info_mask);
+		v.emplace_back(e._can_duplicate);
+		v.emplace_back(e._crash_bug);
+		v.emplace_back(e._target_info);
+		v.emplace_back(e._character_flags);
+		v.emplace_back(e._unknown_value);
+		v.emplace_back(std::string_view(e.bug_report));
+		v.emplace_back(std::string_view(e.system_info));
+		v.emplace_back(RepositoryStmt::DateTime(e.report_datetime));
+		v.emplace_back(e.bug_status);
+		v.emplace_back(RepositoryStmt::DateTime(e.last_review));
+		v.emplace_back(std::string_view(e.last_reviewer));
+		v.emplace_back(std::string_view(e.reviewer_notes));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BugReports &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.client_version_id);
+		RepositoryStmt::Read(row, 3, e.client_version_name);
+		RepositoryStmt::Read(row, 4, e.account_id);
+		RepositoryStmt::Read(row, 5, e.character_id);
+		RepositoryStmt::Read(row, 6, e.character_name);
+		RepositoryStmt::Read(row, 7, e.reporter_spoof);
+		RepositoryStmt::Read(row, 8, e.category_id);
+		RepositoryStmt::Read(row, 9, e.category_name);
+		RepositoryStmt::Read(row, 10, e.reporter_name);
+		RepositoryStmt::Read(row, 11, e.ui_path);
+		RepositoryStmt::Read(row, 12, e.pos_x);
+		RepositoryStmt::Read(row, 13, e.pos_y);
+		RepositoryStmt::Read(row, 14, e.pos_z);
+		RepositoryStmt::Read(row, 15, e.heading);
+		RepositoryStmt::Read(row, 16, e.time_played);
+		RepositoryStmt::Read(row, 17, e.target_id);
+		RepositoryStmt::Read(row, 18, e.target_name);
+		RepositoryStmt::Read(row, 19, e.optional_info_mask);
+		RepositoryStmt::Read(row, 20, e._can_duplicate);
+		RepositoryStmt::Read(row, 21, e._crash_bug);
+		RepositoryStmt::Read(row, 22, e._target_info);
+		RepositoryStmt::Read(row, 23, e._character_flags);
+		RepositoryStmt::Read(row, 24, e._unknown_value);
+		RepositoryStmt::Read(row, 25, e.bug_report);
+		RepositoryStmt::Read(row, 26, e.system_info);
+		RepositoryStmt::Read(row, 27, e.report_datetime);
+		RepositoryStmt::Read(row, 28, e.bug_status);
+		RepositoryStmt::Read(row, 29, e.last_review);
+		RepositoryStmt::Read(row, 30, e.last_reviewer);
+		RepositoryStmt::Read(row, 31, e.reviewer_notes);
+	}
+
+	static BugReports FindOnePrepared(
+		Database& db,
+		int bug_reports_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBugReportsRepository>(db, bug_reports_id);
+	}
+
+	static std::vector<BugReports> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBugReportsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BugReports &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBugReportsRepository>(db, e, e.id);
+	}
+
+	static BugReports InsertOnePrepared(
+		Database& db,
+		BugReports e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBugReportsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BugReports> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBugReportsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BugReports> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBugReportsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BUG_REPORTS_REPOSITORY_H
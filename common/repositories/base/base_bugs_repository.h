@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBugsRepository {
@@ -518,6 +519,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Bugs &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.ui));
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(std::string_view(e.type));
+		v.emplace_back(e.flag);
+		v.emplace_back(std::string_view(e.target));
+		v.emplace_back(std::string_view(e.bug));
+		v.emplace_back(std::string_view(e.date));
+		v.emplace_back(e.status);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Bugs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.name);
+		RepositoryStmt::Read(row, 3, e.ui);
+		RepositoryStmt::Read(row, 4, e.x);
+		RepositoryStmt::Read(row, 5, e.y);
+		RepositoryStmt::Read(row, 6, e.z);
+		RepositoryStmt::Read(row, 7, e.type);
+		RepositoryStmt::Read(row, 8, e.flag);
+		RepositoryStmt::Read(row, 9, e.target);
+		RepositoryStmt::Read(row, 10, e.bug);
+		RepositoryStmt::Read(row, 11, e.date);
+		RepositoryStmt::Read(row, 12, e.status);
+	}
+
+	static Bugs FindOnePrepared(
+		Database& db,
+		int bugs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBugsRepository>(db, bugs_id);
+	}
+
+	static std::vector<Bugs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBugsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Bugs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBugsRepository>(db, e, e.id);
+	}
+
+	static Bugs InsertOnePrepared(
+		Database& db,
+		Bugs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBugsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Bugs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBugsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Bugs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBugsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BUGS_REPOSITORY_H
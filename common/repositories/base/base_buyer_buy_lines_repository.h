@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBuyerBuyLinesRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BuyerBuyLines &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.buyer_id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.buy_slot_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.item_qty);
+		v.emplace_back(e.item_price);
+		v.emplace_back(e.item_icon);
+		v.emplace_back(std::string_view(e.item_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BuyerBuyLines &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.buyer_id);
+		RepositoryStmt::Read(row, 2, e.char_id);
+		RepositoryStmt::Read(row, 3, e.buy_slot_id);
+		RepositoryStmt::Read(row, 4, e.item_id);
+		RepositoryStmt::Read(row, 5, e.item_qty);
+		RepositoryStmt::Read(row, 6, e.item_price);
+		RepositoryStmt::Read(row, 7, e.item_icon);
+		RepositoryStmt::Read(row, 8, e.item_name);
+	}
+
+	static BuyerBuyLines FindOnePrepared(
+		Database& db,
+		int buyer_buy_lines_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBuyerBuyLinesRepository>(db, buyer_buy_lines_id);
+	}
+
+	static std::vector<BuyerBuyLines> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBuyerBuyLinesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BuyerBuyLines &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBuyerBuyLinesRepository>(db, e, e.id);
+	}
+
+	static BuyerBuyLines InsertOnePrepared(
+		Database& db,
+		BuyerBuyLines e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBuyerBuyLinesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BuyerBuyLines> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBuyerBuyLinesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BuyerBuyLines> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBuyerBuyLinesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BUYER_BUY_LINES_REPOSITORY_H
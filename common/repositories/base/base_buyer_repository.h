@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBuyerRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Buyer &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.char_entity_id);
+		v.emplace_back(std::string_view(e.char_name));
+		v.emplace_back(e.char_zone_id);
+		v.emplace_back(e.char_zone_instance_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.transaction_date));
+		v.emplace_back(std::string_view(e.welcome_message));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Buyer &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.char_id);
+		RepositoryStmt::Read(row, 2, e.char_entity_id);
+		RepositoryStmt::Read(row, 3, e.char_name);
+		RepositoryStmt::Read(row, 4, e.char_zone_id);
+		RepositoryStmt::Read(row, 5, e.char_zone_instance_id);
+		RepositoryStmt::Read(row, 6, e.transaction_date);
+		RepositoryStmt::Read(row, 7, e.welcome_message);
+	}
+
+	static Buyer FindOnePrepared(
+		Database& db,
+		int buyer_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBuyerRepository>(db, buyer_id);
+	}
+
+	static std::vector<Buyer> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBuyerRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Buyer &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBuyerRepository>(db, e, e.id);
+	}
+
+	static Buyer InsertOnePrepared(
+		Database& db,
+		Buyer e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBuyerRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Buyer> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBuyerRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Buyer> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBuyerRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BUYER_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseBuyerTradeItemsRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const BuyerTradeItems &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.buyer_buy_lines_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.item_qty);
+		v.emplace_back(e.item_icon);
+		v.emplace_back(std::string_view(e.item_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		BuyerTradeItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.buyer_buy_lines_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.item_qty);
+		RepositoryStmt::Read(row, 4, e.item_icon);
+		RepositoryStmt::Read(row, 5, e.item_name);
+	}
+
+	static BuyerTradeItems FindOnePrepared(
+		Database& db,
+		int buyer_trade_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseBuyerTradeItemsRepository>(db, buyer_trade_items_id);
+	}
+
+	static std::vector<BuyerTradeItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseBuyerTradeItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const BuyerTradeItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseBuyerTradeItemsRepository>(db, e, e.id);
+	}
+
+	static BuyerTradeItems InsertOnePrepared(
+		Database& db,
+		BuyerTradeItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseBuyerTradeItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<BuyerTradeItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseBuyerTradeItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<BuyerTradeItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseBuyerTradeItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_BUYER_TRADE_ITEMS_REPOSITORY_H
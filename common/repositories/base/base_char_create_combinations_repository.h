@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharCreateCombinationsRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharCreateCombinations &e
+	)
+	{
+		v.emplace_back(e.allocation_id);
+		v.emplace_back(e.race);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.deity);
+		v.emplace_back(e.start_zone);
+		v.emplace_back(e.expansions_req);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharCreateCombinations &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.allocation_id);
+		RepositoryStmt::Read(row, 1, e.race);
+		RepositoryStmt::Read(row, 2, e.class_);
+		RepositoryStmt::Read(row, 3, e.deity);
+		RepositoryStmt::Read(row, 4, e.start_zone);
+		RepositoryStmt::Read(row, 5, e.expansions_req);
+	}
+
+	static CharCreateCombinations FindOnePrepared(
+		Database& db,
+		int char_create_combinations_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharCreateCombinationsRepository>(db, char_create_combinations_id);
+	}
+
+	static std::vector<CharCreateCombinations> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharCreateCombinationsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharCreateCombinations &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharCreateCombinationsRepository>(db, e, e.race);
+	}
+
+	static CharCreateCombinations InsertOnePrepared(
+		Database& db,
+		CharCreateCombinations e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharCreateCombinationsRepository>(db, e);
+		if (id) {
+			e.race = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharCreateCombinations> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharCreateCombinationsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharCreateCombinations> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharCreateCombinationsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHAR_CREATE_COMBINATIONS_REPOSITORY_H
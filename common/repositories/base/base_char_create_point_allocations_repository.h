@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharCreatePointAllocationsRepository {
@@ -543,6 +544,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharCreatePointAllocations &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.base_str);
+		v.emplace_back(e.base_sta);
+		v.emplace_back(e.base_dex);
+		v.emplace_back(e.base_agi);
+		v.emplace_back(e.base_int);
+		v.emplace_back(e.base_wis);
+		v.emplace_back(e.base_cha);
+		v.emplace_back(e.alloc_str);
+		v.emplace_back(e.alloc_sta);
+		v.emplace_back(e.alloc_dex);
+		v.emplace_back(e.alloc_agi);
+		v.emplace_back(e.alloc_int);
+		v.emplace_back(e.alloc_wis);
+		v.emplace_back(e.alloc_cha);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharCreatePointAllocations &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.base_str);
+		RepositoryStmt::Read(row, 2, e.base_sta);
+		RepositoryStmt::Read(row, 3, e.base_dex);
+		RepositoryStmt::Read(row, 4, e.base_agi);
+		RepositoryStmt::Read(row, 5, e.base_int);
+		RepositoryStmt::Read(row, 6, e.base_wis);
+		RepositoryStmt::Read(row, 7, e.base_cha);
+		RepositoryStmt::Read(row, 8, e.alloc_str);
+		RepositoryStmt::Read(row, 9, e.alloc_sta);
+		RepositoryStmt::Read(row, 10, e.alloc_dex);
+		RepositoryStmt::Read(row, 11, e.alloc_agi);
+		RepositoryStmt::Read(row, 12, e.alloc_int);
+		RepositoryStmt::Read(row, 13, e.alloc_wis);
+		RepositoryStmt::Read(row, 14, e.alloc_cha);
+	}
+
+	static CharCreatePointAllocations FindOnePrepared(
+		Database& db,
+		int char_create_point_allocations_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharCreatePointAllocationsRepository>(db, char_create_point_allocations_id);
+	}
+
+	static std::vector<CharCreatePointAllocations> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharCreatePointAllocationsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharCreatePointAllocations &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharCreatePointAllocationsRepository>(db, e, e.id);
+	}
+
+	static CharCreatePointAllocations InsertOnePrepared(
+		Database& db,
+		CharCreatePointAllocations e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharCreatePointAllocationsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharCreatePointAllocations> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharCreatePointAllocationsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharCreatePointAllocations> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharCreatePointAllocationsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHAR_CREATE_POINT_ALLOCATIONS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharRecipeListRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharRecipeList &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.recipe_id);
+		v.emplace_back(e.madecount);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharRecipeList &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.recipe_id);
+		RepositoryStmt::Read(row, 2, e.madecount);
+	}
+
+	static CharRecipeList FindOnePrepared(
+		Database& db,
+		int char_recipe_list_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharRecipeListRepository>(db, char_recipe_list_id);
+	}
+
+	static std::vector<CharRecipeList> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharRecipeListRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharRecipeList &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharRecipeListRepository>(db, e, e.char_id);
+	}
+
+	static CharRecipeList InsertOnePrepared(
+		Database& db,
+		CharRecipeList e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharRecipeListRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharRecipeList> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharRecipeListRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharRecipeList> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharRecipeListRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHAR_RECIPE_LIST_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterActivitiesRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterActivities &e
+	)
+	{
+		v.emplace_back(e.charid);
+		v.emplace_back(e.taskid);
+		v.emplace_back(e.activityid);
+		v.emplace_back(e.donecount);
+		v.emplace_back(e.completed);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterActivities &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charid);
+		RepositoryStmt::Read(row, 1, e.taskid);
+		RepositoryStmt::Read(row, 2, e.activityid);
+		RepositoryStmt::Read(row, 3, e.donecount);
+		RepositoryStmt::Read(row, 4, e.completed);
+	}
+
+	static CharacterActivities FindOnePrepared(
+		Database& db,
+		int character_activities_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterActivitiesRepository>(db, character_activities_id);
+	}
+
+	static std::vector<CharacterActivities> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterActivitiesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterActivities &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterActivitiesRepository>(db, e, e.charid);
+	}
+
+	static CharacterActivities InsertOnePrepared(
+		Database& db,
+		CharacterActivities e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterActivitiesRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterActivities> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterActivitiesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterActivities> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterActivitiesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_ACTIVITIES_REPOSITORY_H
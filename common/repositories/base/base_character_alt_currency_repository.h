@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterAltCurrencyRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterAltCurrency &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.currency_id);
+		v.emplace_back(e.amount);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterAltCurrency &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.currency_id);
+		RepositoryStmt::Read(row, 2, e.amount);
+	}
+
+	static CharacterAltCurrency FindOnePrepared(
+		Database& db,
+		int character_alt_currency_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterAltCurrencyRepository>(db, character_alt_currency_id);
+	}
+
+	static std::vector<CharacterAltCurrency> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterAltCurrencyRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterAltCurrency &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterAltCurrencyRepository>(db, e, e.char_id);
+	}
+
+	static CharacterAltCurrency InsertOnePrepared(
+		Database& db,
+		CharacterAltCurrency e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterAltCurrencyRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterAltCurrency> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterAltCurrencyRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterAltCurrency> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterAltCurrencyRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_ALT_CURRENCY_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterAlternateAbilitiesRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterAlternateAbilities &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.aa_id);
+		v.emplace_back(e.aa_value);
+		v.emplace_back(e.charges);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterAlternateAbilities &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.aa_id);
+		RepositoryStmt::Read(row, 2, e.aa_value);
+		RepositoryStmt::Read(row, 3, e.charges);
+	}
+
+	static CharacterAlternateAbilities FindOnePrepared(
+		Database& db,
+		int character_alternate_abilities_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterAlternateAbilitiesRepository>(db, character_alternate_abilities_id);
+	}
+
+	static std::vector<CharacterAlternateAbilities> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterAlternateAbilitiesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterAlternateAbilities &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterAlternateAbilitiesRepository>(db, e, e.id);
+	}
+
+	static CharacterAlternateAbilities InsertOnePrepared(
+		Database& db,
+		CharacterAlternateAbilities e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterAlternateAbilitiesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterAlternateAbilities> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterAlternateAbilitiesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterAlternateAbilities> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterAlternateAbilitiesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_ALTERNATE_ABILITIES_REPOSITORY_H
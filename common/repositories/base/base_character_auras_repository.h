@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterAurasRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterAuras &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.spell_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterAuras &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+	}
+
+	static CharacterAuras FindOnePrepared(
+		Database& db,
+		int character_auras_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterAurasRepository>(db, character_auras_id);
+	}
+
+	static std::vector<CharacterAuras> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterAurasRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterAuras &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterAurasRepository>(db, e, e.id);
+	}
+
+	static CharacterAuras InsertOnePrepared(
+		Database& db,
+		CharacterAuras e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterAurasRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterAuras> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterAurasRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterAuras> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterAurasRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_AURAS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterBandolierRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterBandolier &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.bandolier_id);
+		v.emplace_back(e.bandolier_slot);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.icon);
+		v.emplace_back(std::string_view(e.bandolier_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterBandolier &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.bandolier_id);
+		RepositoryStmt::Read(row, 2, e.bandolier_slot);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.icon);
+		RepositoryStmt::Read(row, 5, e.bandolier_name);
+	}
+
+	static CharacterBandolier FindOnePrepared(
+		Database& db,
+		int character_bandolier_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterBandolierRepository>(db, character_bandolier_id);
+	}
+
+	static std::vector<CharacterBandolier> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterBandolierRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterBandolier &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterBandolierRepository>(db, e, e.id);
+	}
+
+	static CharacterBandolier InsertOnePrepared(
+		Database& db,
+		CharacterBandolier e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterBandolierRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterBandolier> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterBandolierRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterBandolier> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterBandolierRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_BANDOLIER_REPOSITORY_H
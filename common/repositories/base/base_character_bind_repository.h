@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterBindRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterBind &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterBind &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.zone_id);
+		RepositoryStmt::Read(row, 3, e.instance_id);
+		RepositoryStmt::Read(row, 4, e.x);
+		RepositoryStmt::Read(row, 5, e.y);
+		RepositoryStmt::Read(row, 6, e.z);
+		RepositoryStmt::Read(row, 7, e.heading);
+	}
+
+	static CharacterBind FindOnePrepared(
+		Database& db,
+		int character_bind_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterBindRepository>(db, character_bind_id);
+	}
+
+	static std::vector<CharacterBind> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterBindRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterBind &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterBindRepository>(db, e, e.id);
+	}
+
+	static CharacterBind InsertOnePrepared(
+		Database& db,
+		CharacterBind e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterBindRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterBind> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterBindRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterBind> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterBindRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_BIND_REPOSITORY_H
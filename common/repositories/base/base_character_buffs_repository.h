@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterBuffsRepository {
@@ -567,6 +568,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterBuffs &e
+	)
+	{
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.caster_level);
+		v.emplace_back(std::string_view(e.caster_name));
+		v.emplace_back(e.ticsremaining);
+		v.emplace_back(e.counters);
+		v.emplace_back(e.numhits);
+		v.emplace_back(e.melee_rune);
+		v.emplace_back(e.magic_rune);
+		v.emplace_back(e.persistent);
+		v.emplace_back(e.dot_rune);
+		v.emplace_back(e.caston_x);
+		v.emplace_back(e.caston_y);
+		v.emplace_back(e.caston_z);
+		v.emplace_back(e.ExtraDIChance);
+		v.emplace_back(e.instrument_mod);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.character_id);
+		RepositoryStmt::Read(row, 1, e.slot_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.caster_level);
+		RepositoryStmt::Read(row, 4, e.caster_name);
+		RepositoryStmt::Read(row, 5, e.ticsremaining);
+		RepositoryStmt::Read(row, 6, e.counters);
+		RepositoryStmt::Read(row, 7, e.numhits);
+		RepositoryStmt::Read(row, 8, e.melee_rune);
+		RepositoryStmt::Read(row, 9, e.magic_rune);
+		RepositoryStmt::Read(row, 10, e.persistent);
+		RepositoryStmt::Read(row, 11, e.dot_rune);
+		RepositoryStmt::Read(row, 12, e.caston_x);
+		RepositoryStmt::Read(row, 13, e.caston_y);
+		RepositoryStmt::Read(row, 14, e.caston_z);
+		RepositoryStmt::Read(row, 15, e.ExtraDIChance);
+		RepositoryStmt::Read(row, 16, e.instrument_mod);
+	}
+
+	static CharacterBuffs FindOnePrepared(
+		Database& db,
+		int character_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterBuffsRepository>(db, character_buffs_id);
+	}
+
+	static std::vector<CharacterBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterBuffsRepository>(db, e, e.character_id);
+	}
+
+	static CharacterBuffs InsertOnePrepared(
+		Database& db,
+		CharacterBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterBuffsRepository>(db, e);
+		if (id) {
+			e.character_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_BUFFS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterCorpseItemsRepository {
@@ -543,6 +544,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterCorpseItems &e
+	)
+	{
+		v.emplace_back(e.corpse_id);
+		v.emplace_back(e.equip_slot);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.aug_1);
+		v.emplace_back(e.aug_2);
+		v.emplace_back(e.aug_3);
+		v.emplace_back(e.aug_4);
+		v.emplace_back(e.aug_5);
+		v.emplace_back(e.aug_6);
+		v.emplace_back(e.attuned);
+		v.emplace_back(std::string_view(e.custom_data));
+		v.emplace_back(e.ornamenticon);
+		v.emplace_back(e.ornamentidfile);
+		v.emplace_back(e.ornament_hero_model);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterCorpseItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.corpse_id);
+		RepositoryStmt::Read(row, 1, e.equip_slot);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.charges);
+		RepositoryStmt::Read(row, 4, e.aug_1);
+		RepositoryStmt::Read(row, 5, e.aug_2);
+		RepositoryStmt::Read(row, 6, e.aug_3);
+		RepositoryStmt::Read(row, 7, e.aug_4);
+		RepositoryStmt::Read(row, 8, e.aug_5);
+		RepositoryStmt::Read(row, 9, e.aug_6);
+		RepositoryStmt::Read(row, 10, e.attuned);
+		RepositoryStmt::Read(row, 11, e.custom_data);
+		RepositoryStmt::Read(row, 12, e.ornamenticon);
+		RepositoryStmt::Read(row, 13, e.ornamentidfile);
+		RepositoryStmt::Read(row, 14, e.ornament_hero_model);
+	}
+
+	static CharacterCorpseItems FindOnePrepared(
+		Database& db,
+		int character_corpse_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterCorpseItemsRepository>(db, character_corpse_items_id);
+	}
+
+	static std::vector<CharacterCorpseItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterCorpseItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterCorpseItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterCorpseItemsRepository>(db, e, e.corpse_id);
+	}
+
+	static CharacterCorpseItems InsertOnePrepared(
+		Database& db,
+		CharacterCorpseItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterCorpseItemsRepository>(db, e);
+		if (id) {
+			e.corpse_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterCorpseItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterCorpseItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterCorpseItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterCorpseItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_CORPSE_ITEMS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterCorpsesRepository {
@@ -974,6 +975,179 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterCorpses &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.charid);
+		v.emplace_back(std::string_view(e.charname));
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(RepositoryStmt::DateTime(e.time_of_death));
+		v.emplace_back(e.guild_consent_id);
+		v.emplace_back(e.is_rezzed);
+		v.emplace_back(e.is_buried);
+		v.emplace_back(e.was_at_graveyard);
+		v.emplace_back(e.is_locked);
+		v.emplace_back(e.exp);
+		v.emplace_back(e.size);
+		v.emplace_back(e.level);
+		v.emplace_back(e.race);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.deity);
+		v.emplace_back(e.texture);
+		v.emplace_back(e.helm_texture);
+		v.emplace_back(e.copper);
+		v.emplace_back(e.silver);
+		v.emplace_back(e.gold);
+		v.emplace_back(e.platinum);
+		v.emplace_back(e.hair_color);
+		v.emplace_back(e.beard_color);
+		v.emplace_back(e.eye_color_1);
+		v.emplace_back(e.eye_color_2);
+		v.emplace_back(e.hair_style);
+		v.emplace_back(e.face);
+		v.emplace_back(e.beard);
+		v.emplace_back(e.drakkin_heritage);
+		v.emplace_back(e.drakkin_tattoo);
+		v.emplace_back(e.drakkin_details);
+		v.emplace_back(e.wc_1);
+		v.emplace_back(e.wc_2);
+		v.emplace_back(e.wc_3);
+		v.emplace_back(e.wc_4);
+		v.emplace_back(e.wc_5);
+		v.emplace_back(e.wc_6);
+		v.emplace_back(e.wc_7);
+		v.emplace_back(e.wc_8);
+		v.emplace_back(e.wc_9);
+		v.emplace_back(e.rez_time);
+		v.emplace_back(e.gm_exp);
+		v.emplace_back(e.killed_by);
+		v.emplace_back(e.rezzable);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterCorpses &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.charid);
+		RepositoryStmt::Read(row, 2, e.charname);
+		RepositoryStmt::Read(row, 3, e.zone_id);
+		RepositoryStmt::Read(row, 4, e.instance_id);
+		RepositoryStmt::Read(row, 5, e.x);
+		RepositoryStmt::Read(row, 6, e.y);
+		RepositoryStmt::Read(row, 7, e.z);
+		RepositoryStmt::Read(row, 8, e.heading);
+		RepositoryStmt::Read(row, 9, e.time_of_death);
+		RepositoryStmt::Read(row, 10, e.guild_consent_id);
+		RepositoryStmt::Read(row, 11, e.is_rezzed);
+		RepositoryStmt::Read(row, 12, e.is_buried);
+		RepositoryStmt::Read(row, 13, e.was_at_graveyard);
+		RepositoryStmt::Read(row, 14, e.is_locked);
+		RepositoryStmt::Read(row, 15, e.exp);
+		RepositoryStmt::Read(row, 16, e.size);
+		RepositoryStmt::Read(row, 17, e.level);
+		RepositoryStmt::Read(row, 18, e.race);
+		RepositoryStmt::Read(row, 19, e.gender);
+		RepositoryStmt::Read(row, 20, e.class_);
+		RepositoryStmt::Read(row, 21, e.deity);
+		RepositoryStmt::Read(row, 22, e.texture);
+		RepositoryStmt::Read(row, 23, e.helm_texture);
+		RepositoryStmt::Read(row, 24, e.copper);
+		RepositoryStmt::Read(row, 25, e.silver);
+		RepositoryStmt::Read(row, 26, e.gold);
+		RepositoryStmt::Read(row, 27, e.platinum);
+		RepositoryStmt::Read(row, 28, e.hair_color);
+		RepositoryStmt::Read(row, 29, e.beard_color);
+		RepositoryStmt::Read(row, 30, e.eye_color_1);
+		RepositoryStmt::Read(row, 31, e.eye_color_2);
+		RepositoryStmt::Read(row, 32, e.hair_style);
+		RepositoryStmt::Read(row, 33, e.face);
+		RepositoryStmt::Read(row, 34, e.beard);
+		RepositoryStmt::Read(row, 35, e.drakkin_heritage);
+		RepositoryStmt::Read(row, 36, e.drakkin_tattoo);
+		RepositoryStmt::Read(row, 37, e.drakkin_details);
+		RepositoryStmt::Read(row, 38, e.wc_1);
+		RepositoryStmt::Read(row, 39, e.wc_2);
+		RepositoryStmt::Read(row, 40, e.wc_3);
+		RepositoryStmt::Read(row, 41, e.wc_4);
+		RepositoryStmt::Read(row, 42, e.wc_5);
+		RepositoryStmt::Read(row, 43, e.wc_6);
+		RepositoryStmt::Read(row, 44, e.wc_7);
+		RepositoryStmt::Read(row, 45, e.wc_8);
+		RepositoryStmt::Read(row, 46, e.wc_9);
+		RepositoryStmt::Read(row, 47, e.rez_time);
+		RepositoryStmt::Read(row, 48, e.gm_exp);
+		RepositoryStmt::Read(row, 49, e.killed_by);
+		RepositoryStmt::Read(row, 50, e.rezzable);
+	}
+
+	static CharacterCorpses FindOnePrepared(
+		Database& db,
+		int character_corpses_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterCorpsesRepository>(db, character_corpses_id);
+	}
+
+	static std::vector<CharacterCorpses> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterCorpsesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterCorpses &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterCorpsesRepository>(db, e, e.id);
+	}
+
+	static CharacterCorpses InsertOnePrepared(
+		Database& db,
+		CharacterCorpses e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterCorpsesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterCorpses> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterCorpsesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterCorpses> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterCorpsesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_CORPSES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterCurrencyRepository {
@@ -567,6 +568,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterCurrency &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.platinum);
+		v.emplace_back(e.gold);
+		v.emplace_back(e.silver);
+		v.emplace_back(e.copper);
+		v.emplace_back(e.platinum_bank);
+		v.emplace_back(e.gold_bank);
+		v.emplace_back(e.silver_bank);
+		v.emplace_back(e.copper_bank);
+		v.emplace_back(e.platinum_cursor);
+		v.emplace_back(e.gold_cursor);
+		v.emplace_back(e.silver_cursor);
+		v.emplace_back(e.copper_cursor);
+		v.emplace_back(e.radiant_crystals);
+		v.emplace_back(e.career_radiant_crystals);
+		v.emplace_back(e.ebon_crystals);
+		v.emplace_back(e.career_ebon_crystals);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterCurrency &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.platinum);
+		RepositoryStmt::Read(row, 2, e.gold);
+		RepositoryStmt::Read(row, 3, e.silver);
+		RepositoryStmt::Read(row, 4, e.copper);
+		RepositoryStmt::Read(row, 5, e.platinum_bank);
+		RepositoryStmt::Read(row, 6, e.gold_bank);
+		RepositoryStmt::Read(row, 7, e.silver_bank);
+		RepositoryStmt::Read(row, 8, e.copper_bank);
+		RepositoryStmt::Read(row, 9, e.platinum_cursor);
+		RepositoryStmt::Read(row, 10, e.gold_cursor);
+		RepositoryStmt::Read(row, 11, e.silver_cursor);
+		RepositoryStmt::Read(row, 12, e.copper_cursor);
+		RepositoryStmt::Read(row, 13, e.radiant_crystals);
+		RepositoryStmt::Read(row, 14, e.career_radiant_crystals);
+		RepositoryStmt::Read(row, 15, e.ebon_crystals);
+		RepositoryStmt::Read(row, 16, e.career_ebon_crystals);
+	}
+
+	static CharacterCurrency FindOnePrepared(
+		Database& db,
+		int character_currency_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterCurrencyRepository>(db, character_currency_id);
+	}
+
+	static std::vector<CharacterCurrency> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterCurrencyRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterCurrency &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterCurrencyRepository>(db, e, e.id);
+	}
+
+	static CharacterCurrency InsertOnePrepared(
+		Database& db,
+		CharacterCurrency e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterCurrencyRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterCurrency> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterCurrencyRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterCurrency> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterCurrencyRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_CURRENCY_REPOSITORY_H
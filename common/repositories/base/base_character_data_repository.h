@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterDataRepository {
@@ -1610,6 +1611,285 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterData &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.account_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.last_name));
+		v.emplace_back(std::string_view(e.title));
+		v.emplace_back(std::string_view(e.suffix));
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.zone_instance);
+		v.emplace_back(e.y);
+		v.emplace_back(e.x);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.race);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.level);
+		v.emplace_back(e.deity);
+		v.emplace_back(e.birthday);
+		v.emplace_back(e.last_login);
+		v.emplace_back(e.time_played);
+		v.emplace_back(e.level2);
+		v.emplace_back(e.anon);
+		v.emplace_back(e.gm);
+		v.emplace_back(e.face);
+		v.emplace_back(e.hair_color);
+		v.emplace_back(e.hair_style);
+		v.emplace_back(e.beard);
+		v.emplace_back(e.beard_color);
+		v.emplace_back(e.eye_color_1);
+		v.emplace_back(e.eye_color_2);
+		v.emplace_back(e.drakkin_heritage);
+		v.emplace_back(e.drakkin_tattoo);
+		v.emplace_back(e.drakkin_details);
+		v.emplace_back(e.ability_time_seconds);
+		v.emplace_back(e.ability_number);
+		v.emplace_back(e.ability_time_minutes);
+		v.emplace_back(e.ability_time_hours);
+		v.emplace_back(e.exp);
+		v.emplace_back(e.exp_enabled);
+		v.emplace_back(e.aa_points_spent);
+		v.emplace_back(e.aa_exp);
+		v.emplace_back(e.aa_points);
+		v.emplace_back(e.group_leadership_exp);
+		v.emplace_back(e.raid_leadership_exp);
+		v.emplace_back(e.group_leadership_points);
+		v.emplace_back(e.raid_leadership_points);
+		v.emplace_back(e.points);
+		v.emplace_back(e.cur_hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.endurance);
+		v.emplace_back(e.intoxication);
+		v.emplace_back(e.str);
+		v.emplace_back(e.sta);
+		v.emplace_back(e.cha);
+		v.emplace_back(e.dex);
+		v.emplace_back(e.int_);
+		v.emplace_back(e.agi);
+		v.emplace_back(e.wis);
+		v.emplace_back(e.extra_haste);
+		v.emplace_back(e.zone_change_count);
+		v.emplace_back(e.toxicity);
+		v.emplace_back(e.hunger_level);
+		v.emplace_back(e.thirst_level);
+		v.emplace_back(e.ability_up);
+		v.emplace_back(e.ldon_points_guk);
+		v.emplace_back(e.ldon_points_mir);
+		v.emplace_back(e.ldon_points_mmc);
+		v.emplace_back(e.ldon_points_ruj);
+		v.emplace_back(e.ldon_points_tak);
+		v.emplace_back(e.ldon_points_available);
+		v.emplace_back(e.tribute_time_remaining);
+		v.emplace_back(e.career_tribute_points);
+		v.emplace_back(e.tribute_points);
+		v.emplace_back(e.tribute_active);
+		v.emplace_back(e.pvp_status);
+		v.emplace_back(e.pvp_kills);
+		v.emplace_back(e.pvp_deaths);
+		v.emplace_back(e.pvp_current_points);
+		v.emplace_back(e.pvp_career_points);
+		v.emplace_back(e.pvp_best_kill_streak);
+		v.emplace_back(e.pvp_worst_death_streak);
+		v.emplace_back(e.pvp_current_kill_streak);
+		v.emplace_back(e.pvp2);
+		v.emplace_back(e.pvp_type);
+		v.emplace_back(e.show_helm);
+		v.emplace_back(e.group_auto_consent);
+		v.emplace_back(e.raid_auto_consent);
+		v.emplace_back(e.guild_auto_consent);
+		v.emplace_back(e.leadership_exp_on);
+		v.emplace_back(e.RestTimer);
+		v.emplace_back(e.air_remaining);
+		v.emplace_back(e.autosplit_enabled);
+		v.emplace_back(e.lfp);
+		v.emplace_back(e.lfg);
+		v.emplace_back(std::string_view(e.mailkey));
+		v.emplace_back(e.xtargets);
+		v.emplace_back(e.firstlogon);
+		v.emplace_back(e.e_aa_effects);
+		v.emplace_back(e.e_percent_to_aa);
+		v.emplace_back(e.e_expended_aa_spent);
+		v.emplace_back(e.aa_points_spent_old);
+		v.emplace_back(e.aa_points_old);
+		v.emplace_back(e.e_last_invsnapshot);
+		v.emplace_back(RepositoryStmt::DateTime(e.deleted_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterData &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.account_id);
+		RepositoryStmt::Read(row, 2, e.name);
+		RepositoryStmt::Read(row, 3, e.last_name);
+		RepositoryStmt::Read(row, 4, e.title);
+		RepositoryStmt::Read(row, 5, e.suffix);
+		RepositoryStmt::Read(row, 6, e.zone_id);
+		RepositoryStmt::Read(row, 7, e.zone_instance);
+		RepositoryStmt::Read(row, 8, e.y);
+		RepositoryStmt::Read(row, 9, e.x);
+		RepositoryStmt::Read(row, 10, e.z);
+		RepositoryStmt::Read(row, 11, e.heading);
+		RepositoryStmt::Read(row, 12, e.gender);
+		RepositoryStmt::Read(row, 13, e.race);
+		RepositoryStmt::Read(row, 14, e.class_);
+		RepositoryStmt::Read(row, 15, e.level);
+		RepositoryStmt::Read(row, 16, e.deity);
+		RepositoryStmt::Read(row, 17, e.birthday);
+		RepositoryStmt::Read(row, 18, e.last_login);
+		RepositoryStmt::Read(row, 19, e.time_played);
+		RepositoryStmt::Read(row, 20, e.level2);
+		RepositoryStmt::Read(row, 21, e.anon);
+		RepositoryStmt::Read(row, 22, e.gm);
+		RepositoryStmt::Read(row, 23, e.face);
+		RepositoryStmt::Read(row, 24, e.hair_color);
+		RepositoryStmt::Read(row, 25, e.hair_style);
+		RepositoryStmt::Read(row, 26, e.beard);
+		RepositoryStmt::Read(row, 27, e.beard_color);
+		RepositoryStmt::Read(row, 28, e.eye_color_1);
+		RepositoryStmt::Read(row, 29, e.eye_color_2);
+		RepositoryStmt::Read(row, 30, e.drakkin_heritage);
+		RepositoryStmt::Read(row, 31, e.drakkin_tattoo);
+		RepositoryStmt::Read(row, 32, e.drakkin_details);
+		RepositoryStmt::Read(row, 33, e.ability_time_seconds);
+		RepositoryStmt::Read(row, 34, e.ability_number);
+		RepositoryStmt::Read(row, 35, e.ability_time_minutes);
+		RepositoryStmt::Read(row, 36, e.ability_time_hours);
+		RepositoryStmt::Read(row, 37, e.exp);
+		RepositoryStmt::Read(row, 38, e.exp_enabled);
+		RepositoryStmt::Read(row, 39, e.aa_points_spent);
+		RepositoryStmt::Read(row, 40, e.aa_exp);
+		RepositoryStmt::Read(row, 41, e.aa_points);
+		RepositoryStmt::Read(row, 42, e.group_leadership_exp);
+		RepositoryStmt::Read(row, 43, e.raid_leadership_exp);
+		RepositoryStmt::Read(row, 44, e.group_leadership_points);
+		RepositoryStmt::Read(row, 45, e.raid_leadership_points);
+		RepositoryStmt::Read(row, 46, e.points);
+		RepositoryStmt::Read(row, 47, e.cur_hp);
+		RepositoryStmt::Read(row, 48, e.mana);
+		RepositoryStmt::Read(row, 49, e.endurance);
+		RepositoryStmt::Read(row, 50, e.intoxication);
+		RepositoryStmt::Read(row, 51, e.str);
+		RepositoryStmt::Read(row, 52, e.sta);
+		RepositoryStmt::Read(row, 53, e.cha);
+		RepositoryStmt::Read(row, 54, e.dex);
+		RepositoryStmt::Read(row, 55, e.int_);
+		RepositoryStmt::Read(row, 56, e.agi);
+		RepositoryStmt::Read(row, 57, e.wis);
+		RepositoryStmt::Read(row, 58, e.extra_haste);
+		RepositoryStmt::Read(row, 59, e.zone_change_count);
+		RepositoryStmt::Read(row, 60, e.toxicity);
+		RepositoryStmt::Read(row, 61, e.hunger_level);
+		RepositoryStmt::Read(row, 62, e.thirst_level);
+		RepositoryStmt::Read(row, 63, e.ability_up);
+		RepositoryStmt::Read(row, 64, e.ldon_points_guk);
+		RepositoryStmt::Read(row, 65, e.ldon_points_mir);
+		RepositoryStmt::Read(row, 66, e.ldon_points_mmc);
+		RepositoryStmt::Read(row, 67, e.ldon_points_ruj);
+		RepositoryStmt::Read(row, 68, e.ldon_points_tak);
+		RepositoryStmt::Read(row, 69, e.ldon_points_available);
+		RepositoryStmt::Read(row, 70, e.tribute_time_remaining);
+		RepositoryStmt::Read(row, 71, e.career_tribute_points);
+		RepositoryStmt::Read(row, 72, e.tribute_points);
+		RepositoryStmt::Read(row, 73, e.tribute_active);
+		RepositoryStmt::Read(row, 74, e.pvp_status);
+		RepositoryStmt::Read(row, 75, e.pvp_kills);
+		RepositoryStmt::Read(row, 76, e.pvp_deaths);
+		RepositoryStmt::Read(row, 77, e.pvp_current_points);
+		RepositoryStmt::Read(row, 78, e.pvp_career_points);
+		RepositoryStmt::Read(row, 79, e.pvp_best_kill_streak);
+		RepositoryStmt::Read(row, 80, e.pvp_worst_death_streak);
+		RepositoryStmt::Read(row, 81, e.pvp_current_kill_streak);
+		RepositoryStmt::Read(row, 82, e.pvp2);
+		RepositoryStmt::Read(row, 83, e.pvp_type);
+		RepositoryStmt::Read(row, 84, e.show_helm);
+		RepositoryStmt::Read(row, 85, e.group_auto_consent);
+		RepositoryStmt::Read(row, 86, e.raid_auto_consent);
+		RepositoryStmt::Read(row, 87, e.guild_auto_consent);
+		RepositoryStmt::Read(row, 88, e.leadership_exp_on);
+		RepositoryStmt::Read(row, 89, e.RestTimer);
+		RepositoryStmt::Read(row, 90, e.air_remaining);
+		RepositoryStmt::Read(row, 91, e.autosplit_enabled);
+		RepositoryStmt::Read(row, 92, e.lfp);
+		RepositoryStmt::Read(row, 93, e.lfg);
+		RepositoryStmt::Read(row, 94, e.mailkey);
+		RepositoryStmt::Read(row, 95, e.xtargets);
+		RepositoryStmt::Read(row, 96, e.firstlogon);
+		RepositoryStmt::Read(row, 97, e.e_aa_effects);
+		RepositoryStmt::Read(row, 98, e.e_percent_to_aa);
+		RepositoryStmt::Read(row, 99, e.e_expended_aa_spent);
+		RepositoryStmt::Read(row, 100, e.aa_points_spent_old);
+		RepositoryStmt::Read(row, 101, e.aa_points_old);
+		RepositoryStmt::Read(row, 102, e.e_last_invsnapshot);
+		RepositoryStmt::Read(row, 103, e.deleted_at);
+	}
+
+	static CharacterData FindOnePrepared(
+		Database& db,
+		int character_data_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterDataRepository>(db, character_data_id);
+	}
+
+	static std::vector<CharacterData> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterDataRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterData &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterDataRepository>(db, e, e.id);
+	}
+
+	static CharacterData InsertOnePrepared(
+		Database& db,
+		CharacterData e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterDataRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterData> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterDataRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterData> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterDataRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_DATA_REPOSITORY_H
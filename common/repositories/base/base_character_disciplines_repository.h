@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterDisciplinesRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterDisciplines &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.disc_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterDisciplines &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot_id);
+		RepositoryStmt::Read(row, 2, e.disc_id);
+	}
+
+	static CharacterDisciplines FindOnePrepared(
+		Database& db,
+		int character_disciplines_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterDisciplinesRepository>(db, character_disciplines_id);
+	}
+
+	static std::vector<CharacterDisciplines> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterDisciplinesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterDisciplines &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterDisciplinesRepository>(db, e, e.id);
+	}
+
+	static CharacterDisciplines InsertOnePrepared(
+		Database& db,
+		CharacterDisciplines e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterDisciplinesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterDisciplines> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterDisciplinesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterDisciplines> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterDisciplinesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_DISCIPLINES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterEvolvingItemsRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterEvolvingItems &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.activated);
+		v.emplace_back(e.equipped);
+		v.emplace_back(e.current_amount);
+		v.emplace_back(e.progression);
+		v.emplace_back(e.final_item_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.deleted_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterEvolvingItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.activated);
+		RepositoryStmt::Read(row, 4, e.equipped);
+		RepositoryStmt::Read(row, 5, e.current_amount);
+		RepositoryStmt::Read(row, 6, e.progression);
+		RepositoryStmt::Read(row, 7, e.final_item_id);
+		RepositoryStmt::Read(row, 8, e.deleted_at);
+	}
+
+	static CharacterEvolvingItems FindOnePrepared(
+		Database& db,
+		int character_evolving_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterEvolvingItemsRepository>(db, character_evolving_items_id);
+	}
+
+	static std::vector<CharacterEvolvingItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterEvolvingItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterEvolvingItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterEvolvingItemsRepository>(db, e, e.id);
+	}
+
+	static CharacterEvolvingItems InsertOnePrepared(
+		Database& db,
+		CharacterEvolvingItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterEvolvingItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterEvolvingItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterEvolvingItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterEvolvingItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterEvolvingItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_EVOLVING_ITEMS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterExpModifiersRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterExpModifiers &e
+	)
+	{
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.instance_version);
+		v.emplace_back(e.aa_modifier);
+		v.emplace_back(e.exp_modifier);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterExpModifiers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.character_id);
+		RepositoryStmt::Read(row, 1, e.zone_id);
+		RepositoryStmt::Read(row, 2, e.instance_version);
+		RepositoryStmt::Read(row, 3, e.aa_modifier);
+		RepositoryStmt::Read(row, 4, e.exp_modifier);
+	}
+
+	static CharacterExpModifiers FindOnePrepared(
+		Database& db,
+		int character_exp_modifiers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterExpModifiersRepository>(db, character_exp_modifiers_id);
+	}
+
+	static std::vector<CharacterExpModifiers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterExpModifiersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterExpModifiers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterExpModifiersRepository>(db, e, e.character_id);
+	}
+
+	static CharacterExpModifiers InsertOnePrepared(
+		Database& db,
+		CharacterExpModifiers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterExpModifiersRepository>(db, e);
+		if (id) {
+			e.character_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterExpModifiers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterExpModifiersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterExpModifiers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterExpModifiersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_EXP_MODIFIERS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterExpeditionLockoutsRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterExpeditionLockouts &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(std::string_view(e.expedition_name));
+		v.emplace_back(std::string_view(e.event_name));
+		v.emplace_back(RepositoryStmt::DateTime(e.expire_time));
+		v.emplace_back(e.duration);
+		v.emplace_back(std::string_view(e.from_expedition_uuid));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterExpeditionLockouts &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.expedition_name);
+		RepositoryStmt::Read(row, 3, e.event_name);
+		RepositoryStmt::Read(row, 4, e.expire_time);
+		RepositoryStmt::Read(row, 5, e.duration);
+		RepositoryStmt::Read(row, 6, e.from_expedition_uuid);
+	}
+
+	static CharacterExpeditionLockouts FindOnePrepared(
+		Database& db,
+		int character_expedition_lockouts_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterExpeditionLockoutsRepository>(db, character_expedition_lockouts_id);
+	}
+
+	static std::vector<CharacterExpeditionLockouts> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterExpeditionLockoutsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterExpeditionLockouts &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterExpeditionLockoutsRepository>(db, e, e.id);
+	}
+
+	static CharacterExpeditionLockouts InsertOnePrepared(
+		Database& db,
+		CharacterExpeditionLockouts e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterExpeditionLockoutsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterExpeditionLockouts> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterExpeditionLockoutsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterExpeditionLockouts> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterExpeditionLockoutsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_EXPEDITION_LOCKOUTS_REPOSITORY_H
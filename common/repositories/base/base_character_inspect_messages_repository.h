@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterInspectMessagesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterInspectMessages &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.inspect_message));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterInspectMessages &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.inspect_message);
+	}
+
+	static CharacterInspectMessages FindOnePrepared(
+		Database& db,
+		int character_inspect_messages_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterInspectMessagesRepository>(db, character_inspect_messages_id);
+	}
+
+	static std::vector<CharacterInspectMessages> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterInspectMessagesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterInspectMessages &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterInspectMessagesRepository>(db, e, e.id);
+	}
+
+	static CharacterInspectMessages InsertOnePrepared(
+		Database& db,
+		CharacterInspectMessages e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterInspectMessagesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterInspectMessages> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterInspectMessagesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterInspectMessages> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterInspectMessagesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_INSPECT_MESSAGES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterInstanceSafereturnsRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterInstanceSafereturns &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.instance_zone_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.safe_zone_id);
+		v.emplace_back(e.safe_x);
+		v.emplace_back(e.safe_y);
+		v.emplace_back(e.safe_z);
+		v.emplace_back(e.safe_heading);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterInstanceSafereturns &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.instance_zone_id);
+		RepositoryStmt::Read(row, 3, e.instance_id);
+		RepositoryStmt::Read(row, 4, e.safe_zone_id);
+		RepositoryStmt::Read(row, 5, e.safe_x);
+		RepositoryStmt::Read(row, 6, e.safe_y);
+		RepositoryStmt::Read(row, 7, e.safe_z);
+		RepositoryStmt::Read(row, 8, e.safe_heading);
+	}
+
+	static CharacterInstanceSafereturns FindOnePrepared(
+		Database& db,
+		int character_instance_safereturns_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterInstanceSafereturnsRepository>(db, character_instance_safereturns_id);
+	}
+
+	static std::vector<CharacterInstanceSafereturns> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterInstanceSafereturnsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterInstanceSafereturns &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterInstanceSafereturnsRepository>(db, e, e.id);
+	}
+
+	static CharacterInstanceSafereturns InsertOnePrepared(
+		Database& db,
+		CharacterInstanceSafereturns e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterInstanceSafereturnsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterInstanceSafereturns> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterInstanceSafereturnsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterInstanceSafereturns> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterInstanceSafereturnsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_INSTANCE_SAFERETURNS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterItemRecastRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterItemRecast &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.recast_type);
+		v.emplace_back(e.timestamp);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterItemRecast &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.recast_type);
+		RepositoryStmt::Read(row, 2, e.timestamp);
+	}
+
+	static CharacterItemRecast FindOnePrepared(
+		Database& db,
+		int character_item_recast_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterItemRecastRepository>(db, character_item_recast_id);
+	}
+
+	static std::vector<CharacterItemRecast> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterItemRecastRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterItemRecast &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterItemRecastRepository>(db, e, e.id);
+	}
+
+	static CharacterItemRecast InsertOnePrepared(
+		Database& db,
+		CharacterItemRecast e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterItemRecastRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterItemRecast> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterItemRecastRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterItemRecast> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterItemRecastRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_ITEM_RECAST_REPOSITORY_H
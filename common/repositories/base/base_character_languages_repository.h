@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterLanguagesRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterLanguages &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.lang_id);
+		v.emplace_back(e.value);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterLanguages &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.lang_id);
+		RepositoryStmt::Read(row, 2, e.value);
+	}
+
+	static CharacterLanguages FindOnePrepared(
+		Database& db,
+		int character_languages_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterLanguagesRepository>(db, character_languages_id);
+	}
+
+	static std::vector<CharacterLanguages> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterLanguagesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterLanguages &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterLanguagesRepository>(db, e, e.id);
+	}
+
+	static CharacterLanguages InsertOnePrepared(
+		Database& db,
+		CharacterLanguages e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterLanguagesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterLanguages> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterLanguagesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterLanguages> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterLanguagesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_LANGUAGES_REPOSITORY_H
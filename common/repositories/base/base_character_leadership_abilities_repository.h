@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterLeadershipAbilitiesRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterLeadershipAbilities &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.rank_);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterLeadershipAbilities &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.rank_);
+	}
+
+	static CharacterLeadershipAbilities FindOnePrepared(
+		Database& db,
+		int character_leadership_abilities_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterLeadershipAbilitiesRepository>(db, character_leadership_abilities_id);
+	}
+
+	static std::vector<CharacterLeadershipAbilities> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterLeadershipAbilitiesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterLeadershipAbilities &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterLeadershipAbilitiesRepository>(db, e, e.id);
+	}
+
+	static CharacterLeadershipAbilities InsertOnePrepared(
+		Database& db,
+		CharacterLeadershipAbilities e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterLeadershipAbilitiesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterLeadershipAbilities> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterLeadershipAbilitiesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterLeadershipAbilities> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterLeadershipAbilitiesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_LEADERSHIP_ABILITIES_REPOSITORY_H
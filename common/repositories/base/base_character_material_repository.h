@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterMaterialRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterMaterial &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.blue);
+		v.emplace_back(e.green);
+		v.emplace_back(e.red);
+		v.emplace_back(e.use_tint);
+		v.emplace_back(e.color);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterMaterial &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.blue);
+		RepositoryStmt::Read(row, 3, e.green);
+		RepositoryStmt::Read(row, 4, e.red);
+		RepositoryStmt::Read(row, 5, e.use_tint);
+		RepositoryStmt::Read(row, 6, e.color);
+	}
+
+	static CharacterMaterial FindOnePrepared(
+		Database& db,
+		int character_material_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterMaterialRepository>(db, character_material_id);
+	}
+
+	static std::vector<CharacterMaterial> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterMaterialRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterMaterial &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterMaterialRepository>(db, e, e.id);
+	}
+
+	static CharacterMaterial InsertOnePrepared(
+		Database& db,
+		CharacterMaterial e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterMaterialRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterMaterial> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterMaterialRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterMaterial> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterMaterialRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_MATERIAL_REPOSITORY_H
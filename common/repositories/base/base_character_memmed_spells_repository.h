@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterMemmedSpellsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterMemmedSpells &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.spell_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterMemmedSpells &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+	}
+
+	static CharacterMemmedSpells FindOnePrepared(
+		Database& db,
+		int character_memmed_spells_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterMemmedSpellsRepository>(db, character_memmed_spells_id);
+	}
+
+	static std::vector<CharacterMemmedSpells> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterMemmedSpellsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterMemmedSpells &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterMemmedSpellsRepository>(db, e, e.id);
+	}
+
+	static CharacterMemmedSpells InsertOnePrepared(
+		Database& db,
+		CharacterMemmedSpells e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterMemmedSpellsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterMemmedSpells> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterMemmedSpellsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterMemmedSpells> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterMemmedSpellsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_MEMMED_SPELLS_REPOSITORY_H
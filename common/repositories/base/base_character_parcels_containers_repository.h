@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterParcelsContainersRepository {
@@ -494,6 +495,99 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterParcelsContainers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.parcels_id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.aug_slot_1);
+		v.emplace_back(e.aug_slot_2);
+		v.emplace_back(e.aug_slot_3);
+		v.emplace_back(e.aug_slot_4);
+		v.emplace_back(e.aug_slot_5);
+		v.emplace_back(e.aug_slot_6);
+		v.emplace_back(e.quantity);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterParcelsContainers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.parcels_id);
+		RepositoryStmt::Read(row, 2, e.slot_id);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.aug_slot_1);
+		RepositoryStmt::Read(row, 5, e.aug_slot_2);
+		RepositoryStmt::Read(row, 6, e.aug_slot_3);
+		RepositoryStmt::Read(row, 7, e.aug_slot_4);
+		RepositoryStmt::Read(row, 8, e.aug_slot_5);
+		RepositoryStmt::Read(row, 9, e.aug_slot_6);
+		RepositoryStmt::Read(row, 10, e.quantity);
+	}
+
+	static CharacterParcelsContainers FindOnePrepared(
+		Database& db,
+		int character_parcels_containers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterParcelsContainersRepository>(db, character_parcels_containers_id);
+	}
+
+	static std::vector<CharacterParcelsContainers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterParcelsContainersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterParcelsContainers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterParcelsContainersRepository>(db, e, e.id);
+	}
+
+	static CharacterParcelsContainers InsertOnePrepared(
+		Database& db,
+		CharacterParcelsContainers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterParcelsContainersRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterParcelsContainers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterParcelsContainersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterParcelsContainers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterParcelsContainersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PARCELS_CONTAINERS_REPOSITORY_H
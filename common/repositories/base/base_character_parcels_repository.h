@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterParcelsRepository {
@@ -530,6 +531,105 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterParcels &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.aug_slot_1);
+		v.emplace_back(e.aug_slot_2);
+		v.emplace_back(e.aug_slot_3);
+		v.emplace_back(e.aug_slot_4);
+		v.emplace_back(e.aug_slot_5);
+		v.emplace_back(e.aug_slot_6);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.quantity);
+		v.emplace_back(std::string_view(e.from_name));
+		v.emplace_back(std::string_view(e.note));
+		v.emplace_back(RepositoryStmt::DateTime(e.sent_date));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterParcels &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.char_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.aug_slot_1);
+		RepositoryStmt::Read(row, 4, e.aug_slot_2);
+		RepositoryStmt::Read(row, 5, e.aug_slot_3);
+		RepositoryStmt::Read(row, 6, e.aug_slot_4);
+		RepositoryStmt::Read(row, 7, e.aug_slot_5);
+		RepositoryStmt::Read(row, 8, e.aug_slot_6);
+		RepositoryStmt::Read(row, 9, e.slot_id);
+		RepositoryStmt::Read(row, 10, e.quantity);
+		RepositoryStmt::Read(row, 11, e.from_name);
+		RepositoryStmt::Read(row, 12, e.note);
+		RepositoryStmt::Read(row, 13, e.sent_date);
+	}
+
+	static CharacterParcels FindOnePrepared(
+		Database& db,
+		int character_parcels_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterParcelsRepository>(db, character_parcels_id);
+	}
+
+	static std::vector<CharacterParcels> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterParcelsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterParcels &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterParcelsRepository>(db, e, e.id);
+	}
+
+	static CharacterParcels InsertOnePrepared(
+		Database& db,
+		CharacterParcels e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterParcelsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterParcels> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterParcelsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterParcels> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterParcelsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PARCELS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPeqzoneFlagsRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPeqzoneFlags &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zone_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPeqzoneFlags &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone_id);
+	}
+
+	static CharacterPeqzoneFlags FindOnePrepared(
+		Database& db,
+		int character_peqzone_flags_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPeqzoneFlagsRepository>(db, character_peqzone_flags_id);
+	}
+
+	static std::vector<CharacterPeqzoneFlags> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPeqzoneFlagsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPeqzoneFlags &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPeqzoneFlagsRepository>(db, e, e.id);
+	}
+
+	static CharacterPeqzoneFlags InsertOnePrepared(
+		Database& db,
+		CharacterPeqzoneFlags e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPeqzoneFlagsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPeqzoneFlags> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPeqzoneFlagsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPeqzoneFlags> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPeqzoneFlagsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PEQZONE_FLAGS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPetBuffsRepository {
@@ -495,6 +496,99 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPetBuffs &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.pet);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.caster_level);
+		v.emplace_back(std::string_view(e.castername));
+		v.emplace_back(e.ticsremaining);
+		v.emplace_back(e.counters);
+		v.emplace_back(e.numhits);
+		v.emplace_back(e.rune);
+		v.emplace_back(e.instrument_mod);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPetBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.pet);
+		RepositoryStmt::Read(row, 2, e.slot);
+		RepositoryStmt::Read(row, 3, e.spell_id);
+		RepositoryStmt::Read(row, 4, e.caster_level);
+		RepositoryStmt::Read(row, 5, e.castername);
+		RepositoryStmt::Read(row, 6, e.ticsremaining);
+		RepositoryStmt::Read(row, 7, e.counters);
+		RepositoryStmt::Read(row, 8, e.numhits);
+		RepositoryStmt::Read(row, 9, e.rune);
+		RepositoryStmt::Read(row, 10, e.instrument_mod);
+	}
+
+	static CharacterPetBuffs FindOnePrepared(
+		Database& db,
+		int character_pet_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPetBuffsRepository>(db, character_pet_buffs_id);
+	}
+
+	static std::vector<CharacterPetBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPetBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPetBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPetBuffsRepository>(db, e, e.char_id);
+	}
+
+	static CharacterPetBuffs InsertOnePrepared(
+		Database& db,
+		CharacterPetBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPetBuffsRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPetBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPetBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PET_BUFFS_REPOSITORY_H
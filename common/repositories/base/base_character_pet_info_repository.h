@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPetInfoRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPetInfo &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.pet);
+		v.emplace_back(std::string_view(e.petname));
+		v.emplace_back(e.petpower);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.size);
+		v.emplace_back(e.taunting);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPetInfo &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.pet);
+		RepositoryStmt::Read(row, 2, e.petname);
+		RepositoryStmt::Read(row, 3, e.petpower);
+		RepositoryStmt::Read(row, 4, e.spell_id);
+		RepositoryStmt::Read(row, 5, e.hp);
+		RepositoryStmt::Read(row, 6, e.mana);
+		RepositoryStmt::Read(row, 7, e.size);
+		RepositoryStmt::Read(row, 8, e.taunting);
+	}
+
+	static CharacterPetInfo FindOnePrepared(
+		Database& db,
+		int character_pet_info_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPetInfoRepository>(db, character_pet_info_id);
+	}
+
+	static std::vector<CharacterPetInfo> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPetInfoRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPetInfo &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPetInfoRepository>(db, e, e.char_id);
+	}
+
+	static CharacterPetInfo InsertOnePrepared(
+		Database& db,
+		CharacterPetInfo e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPetInfoRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetInfo> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPetInfoRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetInfo> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPetInfoRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PET_INFO_REPOSITORY_H
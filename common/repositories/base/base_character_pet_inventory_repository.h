@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPetInventoryRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPetInventory &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.pet);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPetInventory &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.pet);
+		RepositoryStmt::Read(row, 2, e.slot);
+		RepositoryStmt::Read(row, 3, e.item_id);
+	}
+
+	static CharacterPetInventory FindOnePrepared(
+		Database& db,
+		int character_pet_inventory_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPetInventoryRepository>(db, character_pet_inventory_id);
+	}
+
+	static std::vector<CharacterPetInventory> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPetInventoryRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPetInventory &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPetInventoryRepository>(db, e, e.char_id);
+	}
+
+	static CharacterPetInventory InsertOnePrepared(
+		Database& db,
+		CharacterPetInventory e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPetInventoryRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetInventory> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPetInventoryRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetInventory> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPetInventoryRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PET_INVENTORY_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPetNameRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPetName &e
+	)
+	{
+		v.emplace_back(e.character_id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPetName &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.character_id);
+		RepositoryStmt::Read(row, 1, e.name);
+	}
+
+	static CharacterPetName FindOnePrepared(
+		Database& db,
+		int character_pet_name_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPetNameRepository>(db, character_pet_name_id);
+	}
+
+	static std::vector<CharacterPetName> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPetNameRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPetName &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPetNameRepository>(db, e, e.character_id);
+	}
+
+	static CharacterPetName InsertOnePrepared(
+		Database& db,
+		CharacterPetName e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPetNameRepository>(db, e);
+		if (id) {
+			e.character_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetName> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPetNameRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPetName> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPetNameRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_PET_NAME_REPOSITORY_H
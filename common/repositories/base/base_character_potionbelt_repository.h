@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterPotionbeltRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterPotionbelt &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.potion_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.icon);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterPotionbelt &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.potion_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.icon);
+	}
+
+	static CharacterPotionbelt FindOnePrepared(
+		Database& db,
+		int character_potionbelt_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterPotionbeltRepository>(db, character_potionbelt_id);
+	}
+
+	static std::vector<CharacterPotionbelt> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterPotionbeltRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterPotionbelt &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterPotionbeltRepository>(db, e, e.id);
+	}
+
+	static CharacterPotionbelt InsertOnePrepared(
+		Database& db,
+		CharacterPotionbelt e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterPotionbeltRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterPotionbelt> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterPotionbeltRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterPotionbelt> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterPotionbeltRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_POTIONBELT_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterSkillsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterSkills &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.skill_id);
+		v.emplace_back(e.value);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterSkills &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.skill_id);
+		RepositoryStmt::Read(row, 2, e.value);
+	}
+
+	static CharacterSkills FindOnePrepared(
+		Database& db,
+		int character_skills_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterSkillsRepository>(db, character_skills_id);
+	}
+
+	static std::vector<CharacterSkills> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterSkillsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterSkills &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterSkillsRepository>(db, e, e.id);
+	}
+
+	static CharacterSkills InsertOnePrepared(
+		Database& db,
+		CharacterSkills e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterSkillsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterSkills> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterSkillsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterSkills> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterSkillsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_SKILLS_REPOSITORY_H
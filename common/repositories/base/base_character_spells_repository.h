@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterSpellsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterSpells &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.spell_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterSpells &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.slot_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+	}
+
+	static CharacterSpells FindOnePrepared(
+		Database& db,
+		int character_spells_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterSpellsRepository>(db, character_spells_id);
+	}
+
+	static std::vector<CharacterSpells> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterSpellsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterSpells &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterSpellsRepository>(db, e, e.id);
+	}
+
+	static CharacterSpells InsertOnePrepared(
+		Database& db,
+		CharacterSpells e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterSpellsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterSpells> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterSpellsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterSpells> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterSpellsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_SPELLS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterStatsRecordRepository {
@@ -1251,6 +1252,225 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterStatsRecord &e
+	)
+	{
+		v.emplace_back(e.character_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.status);
+		v.emplace_back(e.level);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.race);
+		v.emplace_back(e.aa_points);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.endurance);
+		v.emplace_back(e.ac);
+		v.emplace_back(e.strength);
+		v.emplace_back(e.stamina);
+		v.emplace_back(e.dexterity);
+		v.emplace_back(e.agility);
+		v.emplace_back(e.intelligence);
+		v.emplace_back(e.wisdom);
+		v.emplace_back(e.charisma);
+		v.emplace_back(e.magic_resist);
+		v.emplace_back(e.fire_resist);
+		v.emplace_back(e.cold_resist);
+		v.emplace_back(e.poison_resist);
+		v.emplace_back(e.disease_resist);
+		v.emplace_back(e.corruption_resist);
+		v.emplace_back(e.heroic_strength);
+		v.emplace_back(e.heroic_stamina);
+		v.emplace_back(e.heroic_dexterity);
+		v.emplace_back(e.heroic_agility);
+		v.emplace_back(e.heroic_intelligence);
+		v.emplace_back(e.heroic_wisdom);
+		v.emplace_back(e.heroic_charisma);
+		v.emplace_back(e.heroic_magic_resist);
+		v.emplace_back(e.heroic_fire_resist);
+		v.emplace_back(e.heroic_cold_resist);
+		v.emplace_back(e.heroic_poison_resist);
+		v.emplace_back(e.heroic_disease_resist);
+		v.emplace_back(e.heroic_corruption_resist);
+		v.emplace_back(e.haste);
+		v.emplace_back(e.accuracy);
+		v.emplace_back(e.attack);
+		v.emplace_back(e.avoidance);
+		v.emplace_back(e.clairvoyance);
+		v.emplace_back(e.combat_effects);
+		v.emplace_back(e.damage_shield_mitigation);
+		v.emplace_back(e.damage_shield);
+		v.emplace_back(e.dot_shielding);
+		v.emplace_back(e.hp_regen);
+		v.emplace_back(e.mana_regen);
+		v.emplace_back(e.endurance_regen);
+		v.emplace_back(e.shielding);
+		v.emplace_back(e.spell_damage);
+		v.emplace_back(e.spell_shielding);
+		v.emplace_back(e.strikethrough);
+		v.emplace_back(e.stun_resist);
+		v.emplace_back(e.backstab);
+		v.emplace_back(e.wind);
+		v.emplace_back(e.brass);
+		v.emplace_back(e.string);
+		v.emplace_back(e.percussion);
+		v.emplace_back(e.singing);
+		v.emplace_back(e.baking);
+		v.emplace_back(e.alchemy);
+		v.emplace_back(e.tailoring);
+		v.emplace_back(e.blacksmithing);
+		v.emplace_back(e.fletching);
+		v.emplace_back(e.brewing);
+		v.emplace_back(e.jewelry);
+		v.emplace_back(e.pottery);
+		v.emplace_back(e.research);
+		v.emplace_back(e.alcohol);
+		v.emplace_back(e.fishing);
+		v.emplace_back(e.tinkering);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+		v.emplace_back(RepositoryStmt::DateTime(e.updated_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterStatsRecord &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.character_id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.status);
+		RepositoryStmt::Read(row, 3, e.level);
+		RepositoryStmt::Read(row, 4, e.class_);
+		RepositoryStmt::Read(row, 5, e.race);
+		RepositoryStmt::Read(row, 6, e.aa_points);
+		RepositoryStmt::Read(row, 7, e.hp);
+		RepositoryStmt::Read(row, 8, e.mana);
+		RepositoryStmt::Read(row, 9, e.endurance);
+		RepositoryStmt::Read(row, 10, e.ac);
+		RepositoryStmt::Read(row, 11, e.strength);
+		RepositoryStmt::Read(row, 12, e.stamina);
+		RepositoryStmt::Read(row, 13, e.dexterity);
+		RepositoryStmt::Read(row, 14, e.agility);
+		RepositoryStmt::Read(row, 15, e.intelligence);
+		RepositoryStmt::Read(row, 16, e.wisdom);
+		RepositoryStmt::Read(row, 17, e.charisma);
+		RepositoryStmt::Read(row, 18, e.magic_resist);
+		RepositoryStmt::Read(row, 19, e.fire_resist);
+		RepositoryStmt::Read(row, 20, e.cold_resist);
+		RepositoryStmt::Read(row, 21, e.poison_resist);
+		RepositoryStmt::Read(row, 22, e.disease_resist);
+		RepositoryStmt::Read(row, 23, e.corruption_resist);
+		RepositoryStmt::Read(row, 24, e.heroic_strength);
+		RepositoryStmt::Read(row, 25, e.heroic_stamina);
+		RepositoryStmt::Read(row, 26, e.heroic_dexterity);
+		RepositoryStmt::Read(row, 27, e.heroic_agility);
+		RepositoryStmt::Read(row, 28, e.heroic_intelligence);
+		RepositoryStmt::Read(row, 29, e.heroic_wisdom);
+		RepositoryStmt::Read(row, 30, e.heroic_charisma);
+		RepositoryStmt::Read(row, 31, e.heroic_magic_resist);
+		RepositoryStmt::Read(row, 32, e.heroic_fire_resist);
+		RepositoryStmt::Read(row, 33, e.heroic_cold_resist);
+		RepositoryStmt::Read(row, 34, e.heroic_poison_resist);
+		RepositoryStmt::Read(row, 35, e.heroic_disease_resist);
+		RepositoryStmt::Read(row, 36, e.heroic_corruption_resist);
+		RepositoryStmt::Read(row, 37, e.haste);
+		RepositoryStmt::Read(row, 38, e.accuracy);
+		RepositoryStmt::Read(row, 39, e.attack);
+		RepositoryStmt::Read(row, 40, e.avoidance);
+		RepositoryStmt::Read(row, 41, e.clairvoyance);
+		RepositoryStmt::Read(row, 42, e.combat_effects);
+		RepositoryStmt::Read(row, 43, e.damage_shield_mitigation);
+		RepositoryStmt::Read(row, 44, e.damage_shield);
+		RepositoryStmt::Read(row, 45, e.dot_shielding);
+		RepositoryStmt::Read(row, 46, e.hp_regen);
+		RepositoryStmt::Read(row, 47, e.mana_regen);
+		RepositoryStmt::Read(row, 48, e.endurance_regen);
+		RepositoryStmt::Read(row, 49, e.shielding);
+		RepositoryStmt::Read(row, 50, e.spell_damage);
+		RepositoryStmt::Read(row, 51, e.spell_shielding);
+		RepositoryStmt::Read(row, 52, e.strikethrough);
+		RepositoryStmt::Read(row, 53, e.stun_resist);
+		RepositoryStmt::Read(row, 54, e.backstab);
+		RepositoryStmt::Read(row, 55, e.wind);
+		RepositoryStmt::Read(row, 56, e.brass);
+		RepositoryStmt::Read(row, 57, e.string);
+		RepositoryStmt::Read(row, 58, e.percussion);
+		RepositoryStmt::Read(row, 59, e.singing);
+		RepositoryStmt::Read(row, 60, e.baking);
+		RepositoryStmt::Read(row, 61, e.alchemy);
+		RepositoryStmt::Read(row, 62, e.tailoring);
+		RepositoryStmt::Read(row, 63, e.blacksmithing);
+		RepositoryStmt::Read(row, 64, e.fletching);
+		RepositoryStmt::Read(row, 65, e.brewing);
+		RepositoryStmt::Read(row, 66, e.jewelry);
+		RepositoryStmt::Read(row, 67, e.pottery);
+		RepositoryStmt::Read(row, 68, e.research);
+		RepositoryStmt::Read(row, 69, e.alcohol);
+		RepositoryStmt::Read(row, 70, e.fishing);
+		RepositoryStmt::Read(row, 71, e.tinkering);
+		RepositoryStmt::Read(row, 72, e.created_at);
+		RepositoryStmt::Read(row, 73, e.updated_at);
+	}
+
+	static CharacterStatsRecord FindOnePrepared(
+		Database& db,
+		int character_stats_record_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterStatsRecordRepository>(db, character_stats_record_id);
+	}
+
+	static std::vector<CharacterStatsRecord> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterStatsRecordRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterStatsRecord &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterStatsRecordRepository>(db, e, e.character_id);
+	}
+
+	static CharacterStatsRecord InsertOnePrepared(
+		Database& db,
+		CharacterStatsRecord e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterStatsRecordRepository>(db, e);
+		if (id) {
+			e.character_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterStatsRecord> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterStatsRecordRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterStatsRecord> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterStatsRecordRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_STATS_RECORD_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterTaskTimersRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterTaskTimers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.task_id);
+		v.emplace_back(e.timer_type);
+		v.emplace_back(e.timer_group);
+		v.emplace_back(RepositoryStmt::DateTime(e.expire_time));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterTaskTimers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.task_id);
+		RepositoryStmt::Read(row, 3, e.timer_type);
+		RepositoryStmt::Read(row, 4, e.timer_group);
+		RepositoryStmt::Read(row, 5, e.expire_time);
+	}
+
+	static CharacterTaskTimers FindOnePrepared(
+		Database& db,
+		int character_task_timers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterTaskTimersRepository>(db, character_task_timers_id);
+	}
+
+	static std::vector<CharacterTaskTimers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterTaskTimersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterTaskTimers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterTaskTimersRepository>(db, e, e.id);
+	}
+
+	static CharacterTaskTimers InsertOnePrepared(
+		Database& db,
+		CharacterTaskTimers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterTaskTimersRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterTaskTimers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterTaskTimersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterTaskTimers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterTaskTimersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_TASK_TIMERS_REPOSITORY_H
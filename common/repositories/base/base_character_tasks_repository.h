@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterTasksRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterTasks &e
+	)
+	{
+		v.emplace_back(e.charid);
+		v.emplace_back(e.taskid);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.type);
+		v.emplace_back(e.acceptedtime);
+		v.emplace_back(e.was_rewarded);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterTasks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charid);
+		RepositoryStmt::Read(row, 1, e.taskid);
+		RepositoryStmt::Read(row, 2, e.slot);
+		RepositoryStmt::Read(row, 3, e.type);
+		RepositoryStmt::Read(row, 4, e.acceptedtime);
+		RepositoryStmt::Read(row, 5, e.was_rewarded);
+	}
+
+	static CharacterTasks FindOnePrepared(
+		Database& db,
+		int character_tasks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterTasksRepository>(db, character_tasks_id);
+	}
+
+	static std::vector<CharacterTasks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterTasksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterTasks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterTasksRepository>(db, e, e.charid);
+	}
+
+	static CharacterTasks InsertOnePrepared(
+		Database& db,
+		CharacterTasks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterTasksRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterTasks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterTasksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterTasks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterTasksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_TASKS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCharacterTributeRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CharacterTribute &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.tier);
+		v.emplace_back(e.tribute);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CharacterTribute &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.tier);
+		RepositoryStmt::Read(row, 3, e.tribute);
+	}
+
+	static CharacterTribute FindOnePrepared(
+		Database& db,
+		int character_tribute_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCharacterTributeRepository>(db, character_tribute_id);
+	}
+
+	static std::vector<CharacterTribute> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCharacterTributeRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CharacterTribute &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCharacterTributeRepository>(db, e, e.id);
+	}
+
+	static CharacterTribute InsertOnePrepared(
+		Database& db,
+		CharacterTribute e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCharacterTributeRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CharacterTribute> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCharacterTributeRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CharacterTribute> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCharacterTributeRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHARACTER_TRIBUTE_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseChatchannelReservedNamesRepository {
@@ -386,6 +387,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ChatchannelReservedNames &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ChatchannelReservedNames &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+	}
+
+	static ChatchannelReservedNames FindOnePrepared(
+		Database& db,
+		int chatchannel_reserved_names_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseChatchannelReservedNamesRepository>(db, chatchannel_reserved_names_id);
+	}
+
+	static std::vector<ChatchannelReservedNames> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseChatchannelReservedNamesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ChatchannelReservedNames &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseChatchannelReservedNamesRepository>(db, e, e.id);
+	}
+
+	static ChatchannelReservedNames InsertOnePrepared(
+		Database& db,
+		ChatchannelReservedNames e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseChatchannelReservedNamesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ChatchannelReservedNames> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseChatchannelReservedNamesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ChatchannelReservedNames> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseChatchannelReservedNamesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHATCHANNEL_RESERVED_NAMES_REPOSITORY_H
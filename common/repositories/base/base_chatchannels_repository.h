@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseChatchannelsRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Chatchannels &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.owner));
+		v.emplace_back(std::string_view(e.password));
+		v.emplace_back(e.minstatus);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Chatchannels &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.owner);
+		RepositoryStmt::Read(row, 3, e.password);
+		RepositoryStmt::Read(row, 4, e.minstatus);
+	}
+
+	static Chatchannels FindOnePrepared(
+		Database& db,
+		int chatchannels_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseChatchannelsRepository>(db, chatchannels_id);
+	}
+
+	static std::vector<Chatchannels> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseChatchannelsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Chatchannels &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseChatchannelsRepository>(db, e, e.id);
+	}
+
+	static Chatchannels InsertOnePrepared(
+		Database& db,
+		Chatchannels e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseChatchannelsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Chatchannels> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseChatchannelsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Chatchannels> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseChatchannelsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CHATCHANNELS_REPOSITORY_H
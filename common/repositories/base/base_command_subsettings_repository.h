@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCommandSubsettingsRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CommandSubsettings &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.parent_command));
+		v.emplace_back(std::string_view(e.sub_command));
+		v.emplace_back(e.access_level);
+		v.emplace_back(std::string_view(e.top_level_aliases));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CommandSubsettings &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.parent_command);
+		RepositoryStmt::Read(row, 2, e.sub_command);
+		RepositoryStmt::Read(row, 3, e.access_level);
+		RepositoryStmt::Read(row, 4, e.top_level_aliases);
+	}
+
+	static CommandSubsettings FindOnePrepared(
+		Database& db,
+		int command_subsettings_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCommandSubsettingsRepository>(db, command_subsettings_id);
+	}
+
+	static std::vector<CommandSubsettings> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCommandSubsettingsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CommandSubsettings &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCommandSubsettingsRepository>(db, e, e.id);
+	}
+
+	static CommandSubsettings InsertOnePrepared(
+		Database& db,
+		CommandSubsettings e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCommandSubsettingsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CommandSubsettings> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCommandSubsettingsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CommandSubsettings> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCommandSubsettingsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_COMMAND_SUBSETTINGS_REPOSITORY_H
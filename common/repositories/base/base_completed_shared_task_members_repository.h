@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCompletedSharedTaskMembersRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CompletedSharedTaskMembers &e
+	)
+	{
+		v.emplace_back(e.shared_task_id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.is_leader);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CompletedSharedTaskMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.shared_task_id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.is_leader);
+	}
+
+	static CompletedSharedTaskMembers FindOnePrepared(
+		Database& db,
+		int completed_shared_task_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCompletedSharedTaskMembersRepository>(db, completed_shared_task_members_id);
+	}
+
+	static std::vector<CompletedSharedTaskMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCompletedSharedTaskMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CompletedSharedTaskMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCompletedSharedTaskMembersRepository>(db, e, e.shared_task_id);
+	}
+
+	static CompletedSharedTaskMembers InsertOnePrepared(
+		Database& db,
+		CompletedSharedTaskMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCompletedSharedTaskMembersRepository>(db, e);
+		if (id) {
+			e.shared_task_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CompletedSharedTaskMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCompletedSharedTaskMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CompletedSharedTaskMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCompletedSharedTaskMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_COMPLETED_SHARED_TASK_MEMBERS_REPOSITORY_H
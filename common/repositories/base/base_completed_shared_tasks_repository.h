@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCompletedSharedTasksRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CompletedSharedTasks &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.task_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.accepted_time));
+		v.emplace_back(RepositoryStmt::DateTime(e.expire_time));
+		v.emplace_back(RepositoryStmt::DateTime(e.completion_time));
+		v.emplace_back(e.is_locked);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CompletedSharedTasks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.task_id);
+		RepositoryStmt::Read(row, 2, e.accepted_time);
+		RepositoryStmt::Read(row, 3, e.expire_time);
+		RepositoryStmt::Read(row, 4, e.completion_time);
+		RepositoryStmt::Read(row, 5, e.is_locked);
+	}
+
+	static CompletedSharedTasks FindOnePrepared(
+		Database& db,
+		int completed_shared_tasks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCompletedSharedTasksRepository>(db, completed_shared_tasks_id);
+	}
+
+	static std::vector<CompletedSharedTasks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCompletedSharedTasksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CompletedSharedTasks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCompletedSharedTasksRepository>(db, e, e.id);
+	}
+
+	static CompletedSharedTasks InsertOnePrepared(
+		Database& db,
+		CompletedSharedTasks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCompletedSharedTasksRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CompletedSharedTasks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCompletedSharedTasksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CompletedSharedTasks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCompletedSharedTasksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_COMPLETED_SHARED_TASKS_REPOSITORY_H
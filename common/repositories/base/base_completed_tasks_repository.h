@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseCompletedTasksRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const CompletedTasks &e
+	)
+	{
+		v.emplace_back(e.charid);
+		v.emplace_back(e.completedtime);
+		v.emplace_back(e.taskid);
+		v.emplace_back(e.activityid);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		CompletedTasks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charid);
+		RepositoryStmt::Read(row, 1, e.completedtime);
+		RepositoryStmt::Read(row, 2, e.taskid);
+		RepositoryStmt::Read(row, 3, e.activityid);
+	}
+
+	static CompletedTasks FindOnePrepared(
+		Database& db,
+		int completed_tasks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseCompletedTasksRepository>(db, completed_tasks_id);
+	}
+
+	static std::vector<CompletedTasks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseCompletedTasksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const CompletedTasks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseCompletedTasksRepository>(db, e, e.charid);
+	}
+
+	static CompletedTasks InsertOnePrepared(
+		Database& db,
+		CompletedTasks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseCompletedTasksRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<CompletedTasks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseCompletedTasksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<CompletedTasks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseCompletedTasksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_COMPLETED_TASKS_REPOSITORY_H
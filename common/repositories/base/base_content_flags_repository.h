@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseContentFlagsRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ContentFlags &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.flag_name));
+		v.emplace_back(e.enabled);
+		v.emplace_back(std::string_view(e.notes));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ContentFlags &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.flag_name);
+		RepositoryStmt::Read(row, 2, e.enabled);
+		RepositoryStmt::Read(row, 3, e.notes);
+	}
+
+	static ContentFlags FindOnePrepared(
+		Database& db,
+		int content_flags_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseContentFlagsRepository>(db, content_flags_id);
+	}
+
+	static std::vector<ContentFlags> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseContentFlagsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ContentFlags &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseContentFlagsRepository>(db, e, e.id);
+	}
+
+	static ContentFlags InsertOnePrepared(
+		Database& db,
+		ContentFlags e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseContentFlagsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ContentFlags> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseContentFlagsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ContentFlags> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseContentFlagsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_CONTENT_FLAGS_REPOSITORY_H
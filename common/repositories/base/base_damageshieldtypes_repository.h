@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDamageshieldtypesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Damageshieldtypes &e
+	)
+	{
+		v.emplace_back(e.spellid);
+		v.emplace_back(e.type);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Damageshieldtypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.spellid);
+		RepositoryStmt::Read(row, 1, e.type);
+	}
+
+	static Damageshieldtypes FindOnePrepared(
+		Database& db,
+		int damageshieldtypes_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDamageshieldtypesRepository>(db, damageshieldtypes_id);
+	}
+
+	static std::vector<Damageshieldtypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDamageshieldtypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Damageshieldtypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDamageshieldtypesRepository>(db, e, e.spellid);
+	}
+
+	static Damageshieldtypes InsertOnePrepared(
+		Database& db,
+		Damageshieldtypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDamageshieldtypesRepository>(db, e);
+		if (id) {
+			e.spellid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Damageshieldtypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDamageshieldtypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Damageshieldtypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDamageshieldtypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DAMAGESHIELDTYPES_REPOSITORY_H
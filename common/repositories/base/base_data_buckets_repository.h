@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 #include <cereal/cereal.hpp>
 class BaseDataBucketsRepository {
@@ -474,6 +475,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DataBuckets &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.key_));
+		v.emplace_back(std::string_view(e.value));
+		v.emplace_back(e.expires);
+		v.emplace_back(e.account_id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(e.bot_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DataBuckets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.key_);
+		RepositoryStmt::Read(row, 2, e.value);
+		RepositoryStmt::Read(row, 3, e.expires);
+		RepositoryStmt::Read(row, 4, e.account_id);
+		RepositoryStmt::Read(row, 5, e.character_id);
+		RepositoryStmt::Read(row, 6, e.npc_id);
+		RepositoryStmt::Read(row, 7, e.bot_id);
+	}
+
+	static DataBuckets FindOnePrepared(
+		Database& db,
+		int data_buckets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDataBucketsRepository>(db, data_buckets_id);
+	}
+
+	static std::vector<DataBuckets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDataBucketsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DataBuckets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDataBucketsRepository>(db, e, e.id);
+	}
+
+	static DataBuckets InsertOnePrepared(
+		Database& db,
+		DataBuckets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDataBucketsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DataBuckets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDataBucketsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DataBuckets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDataBucketsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DATA_BUCKETS_REPOSITORY_H
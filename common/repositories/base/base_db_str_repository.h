@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDbStrRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DbStr &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.type);
+		v.emplace_back(std::string_view(e.value));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DbStr &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.value);
+	}
+
+	static DbStr FindOnePrepared(
+		Database& db,
+		int db_str_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDbStrRepository>(db, db_str_id);
+	}
+
+	static std::vector<DbStr> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDbStrRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DbStr &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDbStrRepository>(db, e, e.id);
+	}
+
+	static DbStr InsertOnePrepared(
+		Database& db,
+		DbStr e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDbStrRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DbStr> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDbStrRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DbStr> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDbStrRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DB_STR_REPOSITORY_H
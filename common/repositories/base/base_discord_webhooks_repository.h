@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDiscordWebhooksRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DiscordWebhooks &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.webhook_name));
+		v.emplace_back(std::string_view(e.webhook_url));
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+		v.emplace_back(RepositoryStmt::DateTime(e.deleted_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DiscordWebhooks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.webhook_name);
+		RepositoryStmt::Read(row, 2, e.webhook_url);
+		RepositoryStmt::Read(row, 3, e.created_at);
+		RepositoryStmt::Read(row, 4, e.deleted_at);
+	}
+
+	static DiscordWebhooks FindOnePrepared(
+		Database& db,
+		int discord_webhooks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDiscordWebhooksRepository>(db, discord_webhooks_id);
+	}
+
+	static std::vector<DiscordWebhooks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDiscordWebhooksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DiscordWebhooks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDiscordWebhooksRepository>(db, e, e.id);
+	}
+
+	static DiscordWebhooks InsertOnePrepared(
+		Database& db,
+		DiscordWebhooks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDiscordWebhooksRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DiscordWebhooks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDiscordWebhooksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DiscordWebhooks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDiscordWebhooksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DISCORD_WEBHOOKS_REPOSITORY_H
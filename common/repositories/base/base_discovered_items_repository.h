@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDiscoveredItemsRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DiscoveredItems &e
+	)
+	{
+		v.emplace_back(e.item_id);
+		v.emplace_back(std::string_view(e.char_name));
+		v.emplace_back(e.discovered_date);
+		v.emplace_back(e.account_status);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DiscoveredItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.item_id);
+		RepositoryStmt::Read(row, 1, e.char_name);
+		RepositoryStmt::Read(row, 2, e.discovered_date);
+		RepositoryStmt::Read(row, 3, e.account_status);
+	}
+
+	static DiscoveredItems FindOnePrepared(
+		Database& db,
+		int discovered_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDiscoveredItemsRepository>(db, discovered_items_id);
+	}
+
+	static std::vector<DiscoveredItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDiscoveredItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DiscoveredItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDiscoveredItemsRepository>(db, e, e.item_id);
+	}
+
+	static DiscoveredItems InsertOnePrepared(
+		Database& db,
+		DiscoveredItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDiscoveredItemsRepository>(db, e);
+		if (id) {
+			e.item_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DiscoveredItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDiscoveredItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DiscoveredItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDiscoveredItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DISCOVERED_ITEMS_REPOSITORY_H
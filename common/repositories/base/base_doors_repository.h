@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDoorsRepository {
@@ -806,6 +807,151 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Doors &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.doorid);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.version);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.pos_y);
+		v.emplace_back(e.pos_x);
+		v.emplace_back(e.pos_z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.opentype);
+		v.emplace_back(e.guild);
+		v.emplace_back(e.lockpick);
+		v.emplace_back(e.keyitem);
+		v.emplace_back(e.nokeyring);
+		v.emplace_back(e.triggerdoor);
+		v.emplace_back(e.triggertype);
+		v.emplace_back(e.disable_timer);
+		v.emplace_back(e.doorisopen);
+		v.emplace_back(e.door_param);
+		v.emplace_back(std::string_view(e.dest_zone));
+		v.emplace_back(e.dest_instance);
+		v.emplace_back(e.dest_x);
+		v.emplace_back(e.dest_y);
+		v.emplace_back(e.dest_z);
+		v.emplace_back(e.dest_heading);
+		v.emplace_back(e.invert_state);
+		v.emplace_back(e.incline);
+		v.emplace_back(e.size);
+		v.emplace_back(e.buffer);
+		v.emplace_back(e.client_version_mask);
+		v.emplace_back(e.is_ldon_door);
+		v.emplace_back(e.close_timer_ms);
+		v.emplace_back(e.dz_switch_id);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Doors &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.doorid);
+		RepositoryStmt::Read(row, 2, e.zone);
+		RepositoryStmt::Read(row, 3, e.version);
+		RepositoryStmt::Read(row, 4, e.name);
+		RepositoryStmt::Read(row, 5, e.pos_y);
+		RepositoryStmt::Read(row, 6, e.pos_x);
+		RepositoryStmt::Read(row, 7, e.pos_z);
+		RepositoryStmt::Read(row, 8, e.heading);
+		RepositoryStmt::Read(row, 9, e.opentype);
+		RepositoryStmt::Read(row, 10, e.guild);
+		RepositoryStmt::Read(row, 11, e.lockpick);
+		RepositoryStmt::Read(row, 12, e.keyitem);
+		RepositoryStmt::Read(row, 13, e.nokeyring);
+		RepositoryStmt::Read(row, 14, e.triggerdoor);
+		RepositoryStmt::Read(row, 15, e.triggertype);
+		RepositoryStmt::Read(row, 16, e.disable_timer);
+		RepositoryStmt::Read(row, 17, e.doorisopen);
+		RepositoryStmt::Read(row, 18, e.door_param);
+		RepositoryStmt::Read(row, 19, e.dest_zone);
+		RepositoryStmt::Read(row, 20, e.dest_instance);
+		RepositoryStmt::Read(row, 21, e.dest_x);
+		RepositoryStmt::Read(row, 22, e.dest_y);
+		RepositoryStmt::Read(row, 23, e.dest_z);
+		RepositoryStmt::Read(row, 24, e.dest_heading);
+		RepositoryStmt::Read(row, 25, e.invert_state);
+		RepositoryStmt::Read(row, 26, e.incline);
+		RepositoryStmt::Read(row, 27, e.size);
+		RepositoryStmt::Read(row, 28, e.buffer);
+		RepositoryStmt::Read(row, 29, e.client_version_mask);
+		RepositoryStmt::Read(row, 30, e.is_ldon_door);
+		RepositoryStmt::Read(row, 31, e.close_timer_ms);
+		RepositoryStmt::Read(row, 32, e.dz_switch_id);
+		RepositoryStmt::Read(row, 33, e.min_expansion);
+		RepositoryStmt::Read(row, 34, e.max_expansion);
+		RepositoryStmt::Read(row, 35, e.content_flags);
+		RepositoryStmt::Read(row, 36, e.content_flags_disabled);
+	}
+
+	static Doors FindOnePrepared(
+		Database& db,
+		int doors_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDoorsRepository>(db, doors_id);
+	}
+
+	static std::vector<Doors> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDoorsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Doors &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDoorsRepository>(db, e, e.id);
+	}
+
+	static Doors InsertOnePrepared(
+		Database& db,
+		Doors e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDoorsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Doors> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDoorsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Doors> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDoorsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DOORS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDynamicZoneMembersRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DynamicZoneMembers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.dynamic_zone_id);
+		v.emplace_back(e.character_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DynamicZoneMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.dynamic_zone_id);
+		RepositoryStmt::Read(row, 2, e.character_id);
+	}
+
+	static DynamicZoneMembers FindOnePrepared(
+		Database& db,
+		int dynamic_zone_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDynamicZoneMembersRepository>(db, dynamic_zone_members_id);
+	}
+
+	static std::vector<DynamicZoneMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDynamicZoneMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DynamicZoneMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDynamicZoneMembersRepository>(db, e, e.id);
+	}
+
+	static DynamicZoneMembers InsertOnePrepared(
+		Database& db,
+		DynamicZoneMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDynamicZoneMembersRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DynamicZoneMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDynamicZoneMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DynamicZoneMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDynamicZoneMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DYNAMIC_ZONE_MEMBERS_REPOSITORY_H
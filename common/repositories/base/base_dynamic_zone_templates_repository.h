@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDynamicZoneTemplatesRepository {
@@ -626,6 +627,121 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DynamicZoneTemplates &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.zone_version);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.min_players);
+		v.emplace_back(e.max_players);
+		v.emplace_back(e.duration_seconds);
+		v.emplace_back(e.dz_switch_id);
+		v.emplace_back(e.compass_zone_id);
+		v.emplace_back(e.compass_x);
+		v.emplace_back(e.compass_y);
+		v.emplace_back(e.compass_z);
+		v.emplace_back(e.return_zone_id);
+		v.emplace_back(e.return_x);
+		v.emplace_back(e.return_y);
+		v.emplace_back(e.return_z);
+		v.emplace_back(e.return_h);
+		v.emplace_back(e.override_zone_in);
+		v.emplace_back(e.zone_in_x);
+		v.emplace_back(e.zone_in_y);
+		v.emplace_back(e.zone_in_z);
+		v.emplace_back(e.zone_in_h);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DynamicZoneTemplates &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone_id);
+		RepositoryStmt::Read(row, 2, e.zone_version);
+		RepositoryStmt::Read(row, 3, e.name);
+		RepositoryStmt::Read(row, 4, e.min_players);
+		RepositoryStmt::Read(row, 5, e.max_players);
+		RepositoryStmt::Read(row, 6, e.duration_seconds);
+		RepositoryStmt::Read(row, 7, e.dz_switch_id);
+		RepositoryStmt::Read(row, 8, e.compass_zone_id);
+		RepositoryStmt::Read(row, 9, e.compass_x);
+		RepositoryStmt::Read(row, 10, e.compass_y);
+		RepositoryStmt::Read(row, 11, e.compass_z);
+		RepositoryStmt::Read(row, 12, e.return_zone_id);
+		RepositoryStmt::Read(row, 13, e.return_x);
+		RepositoryStmt::Read(row, 14, e.return_y);
+		RepositoryStmt::Read(row, 15, e.return_z);
+		RepositoryStmt::Read(row, 16, e.return_h);
+		RepositoryStmt::Read(row, 17, e.override_zone_in);
+		RepositoryStmt::Read(row, 18, e.zone_in_x);
+		RepositoryStmt::Read(row, 19, e.zone_in_y);
+		RepositoryStmt::Read(row, 20, e.zone_in_z);
+		RepositoryStmt::Read(row, 21, e.zone_in_h);
+	}
+
+	static DynamicZoneTemplates FindOnePrepared(
+		Database& db,
+		int dynamic_zone_templates_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDynamicZoneTemplatesRepository>(db, dynamic_zone_templates_id);
+	}
+
+	static std::vector<DynamicZoneTemplates> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDynamicZoneTemplatesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DynamicZoneTemplates &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDynamicZoneTemplatesRepository>(db, e, e.id);
+	}
+
+	static DynamicZoneTemplates InsertOnePrepared(
+		Database& db,
+		DynamicZoneTemplates e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDynamicZoneTemplatesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DynamicZoneTemplates> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDynamicZoneTemplatesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DynamicZoneTemplates> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDynamicZoneTemplatesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DYNAMIC_ZONE_TEMPLATES_REPOSITORY_H
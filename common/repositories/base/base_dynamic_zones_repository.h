@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseDynamicZonesRepository {
@@ -638,6 +639,123 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const DynamicZones &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.type);
+		v.emplace_back(std::string_view(e.uuid));
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.leader_id);
+		v.emplace_back(e.min_players);
+		v.emplace_back(e.max_players);
+		v.emplace_back(e.dz_switch_id);
+		v.emplace_back(e.compass_zone_id);
+		v.emplace_back(e.compass_x);
+		v.emplace_back(e.compass_y);
+		v.emplace_back(e.compass_z);
+		v.emplace_back(e.safe_return_zone_id);
+		v.emplace_back(e.safe_return_x);
+		v.emplace_back(e.safe_return_y);
+		v.emplace_back(e.safe_return_z);
+		v.emplace_back(e.safe_return_heading);
+		v.emplace_back(e.zone_in_x);
+		v.emplace_back(e.zone_in_y);
+		v.emplace_back(e.zone_in_z);
+		v.emplace_back(e.zone_in_heading);
+		v.emplace_back(e.has_zone_in);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		DynamicZones &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.instance_id);
+		RepositoryStmt::Read(row, 2, e.type);
+		RepositoryStmt::Read(row, 3, e.uuid);
+		RepositoryStmt::Read(row, 4, e.name);
+		RepositoryStmt::Read(row, 5, e.leader_id);
+		RepositoryStmt::Read(row, 6, e.min_players);
+		RepositoryStmt::Read(row, 7, e.max_players);
+		RepositoryStmt::Read(row, 8, e.dz_switch_id);
+		RepositoryStmt::Read(row, 9, e.compass_zone_id);
+		RepositoryStmt::Read(row, 10, e.compass_x);
+		RepositoryStmt::Read(row, 11, e.compass_y);
+		RepositoryStmt::Read(row, 12, e.compass_z);
+		RepositoryStmt::Read(row, 13, e.safe_return_zone_id);
+		RepositoryStmt::Read(row, 14, e.safe_return_x);
+		RepositoryStmt::Read(row, 15, e.safe_return_y);
+		RepositoryStmt::Read(row, 16, e.safe_return_z);
+		RepositoryStmt::Read(row, 17, e.safe_return_heading);
+		RepositoryStmt::Read(row, 18, e.zone_in_x);
+		RepositoryStmt::Read(row, 19, e.zone_in_y);
+		RepositoryStmt::Read(row, 20, e.zone_in_z);
+		RepositoryStmt::Read(row, 21, e.zone_in_heading);
+		RepositoryStmt::Read(row, 22, e.has_zone_in);
+	}
+
+	static DynamicZones FindOnePrepared(
+		Database& db,
+		int dynamic_zones_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseDynamicZonesRepository>(db, dynamic_zones_id);
+	}
+
+	static std::vector<DynamicZones> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseDynamicZonesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const DynamicZones &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseDynamicZonesRepository>(db, e, e.id);
+	}
+
+	static DynamicZones InsertOnePrepared(
+		Database& db,
+		DynamicZones e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseDynamicZonesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<DynamicZones> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseDynamicZonesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<DynamicZones> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseDynamicZonesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_DYNAMIC_ZONES_REPOSITORY_H
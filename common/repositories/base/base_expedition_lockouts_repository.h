@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseExpeditionLockoutsRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ExpeditionLockouts &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.expedition_id);
+		v.emplace_back(std::string_view(e.event_name));
+		v.emplace_back(RepositoryStmt::DateTime(e.expire_time));
+		v.emplace_back(e.duration);
+		v.emplace_back(std::string_view(e.from_expedition_uuid));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ExpeditionLockouts &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.expedition_id);
+		RepositoryStmt::Read(row, 2, e.event_name);
+		RepositoryStmt::Read(row, 3, e.expire_time);
+		RepositoryStmt::Read(row, 4, e.duration);
+		RepositoryStmt::Read(row, 5, e.from_expedition_uuid);
+	}
+
+	static ExpeditionLockouts FindOnePrepared(
+		Database& db,
+		int expedition_lockouts_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseExpeditionLockoutsRepository>(db, expedition_lockouts_id);
+	}
+
+	static std::vector<ExpeditionLockouts> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseExpeditionLockoutsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ExpeditionLockouts &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseExpeditionLockoutsRepository>(db, e, e.id);
+	}
+
+	static ExpeditionLockouts InsertOnePrepared(
+		Database& db,
+		ExpeditionLockouts e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseExpeditionLockoutsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ExpeditionLockouts> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseExpeditionLockoutsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ExpeditionLockouts> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseExpeditionLockoutsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_EXPEDITION_LOCKOUTS_REPOSITORY_H
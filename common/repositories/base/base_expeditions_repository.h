@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseExpeditionsRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Expeditions &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.dynamic_zone_id);
+		v.emplace_back(e.add_replay_on_join);
+		v.emplace_back(e.is_locked);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Expeditions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.dynamic_zone_id);
+		RepositoryStmt::Read(row, 2, e.add_replay_on_join);
+		RepositoryStmt::Read(row, 3, e.is_locked);
+	}
+
+	static Expeditions FindOnePrepared(
+		Database& db,
+		int expeditions_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseExpeditionsRepository>(db, expeditions_id);
+	}
+
+	static std::vector<Expeditions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseExpeditionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Expeditions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseExpeditionsRepository>(db, e, e.id);
+	}
+
+	static Expeditions InsertOnePrepared(
+		Database& db,
+		Expeditions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseExpeditionsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Expeditions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseExpeditionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Expeditions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseExpeditionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_EXPEDITIONS_REPOSITORY_H
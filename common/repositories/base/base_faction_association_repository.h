@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFactionAssociationRepository {
@@ -615,6 +616,119 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const FactionAssociation &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.id_1);
+		v.emplace_back(e.mod_1);
+		v.emplace_back(e.id_2);
+		v.emplace_back(e.mod_2);
+		v.emplace_back(e.id_3);
+		v.emplace_back(e.mod_3);
+		v.emplace_back(e.id_4);
+		v.emplace_back(e.mod_4);
+		v.emplace_back(e.id_5);
+		v.emplace_back(e.mod_5);
+		v.emplace_back(e.id_6);
+		v.emplace_back(e.mod_6);
+		v.emplace_back(e.id_7);
+		v.emplace_back(e.mod_7);
+		v.emplace_back(e.id_8);
+		v.emplace_back(e.mod_8);
+		v.emplace_back(e.id_9);
+		v.emplace_back(e.mod_9);
+		v.emplace_back(e.id_10);
+		v.emplace_back(e.mod_10);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		FactionAssociation &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.id_1);
+		RepositoryStmt::Read(row, 2, e.mod_1);
+		RepositoryStmt::Read(row, 3, e.id_2);
+		RepositoryStmt::Read(row, 4, e.mod_2);
+		RepositoryStmt::Read(row, 5, e.id_3);
+		RepositoryStmt::Read(row, 6, e.mod_3);
+		RepositoryStmt::Read(row, 7, e.id_4);
+		RepositoryStmt::Read(row, 8, e.mod_4);
+		RepositoryStmt::Read(row, 9, e.id_5);
+		RepositoryStmt::Read(row, 10, e.mod_5);
+		RepositoryStmt::Read(row, 11, e.id_6);
+		RepositoryStmt::Read(row, 12, e.mod_6);
+		RepositoryStmt::Read(row, 13, e.id_7);
+		RepositoryStmt::Read(row, 14, e.mod_7);
+		RepositoryStmt::Read(row, 15, e.id_8);
+		RepositoryStmt::Read(row, 16, e.mod_8);
+		RepositoryStmt::Read(row, 17, e.id_9);
+		RepositoryStmt::Read(row, 18, e.mod_9);
+		RepositoryStmt::Read(row, 19, e.id_10);
+		RepositoryStmt::Read(row, 20, e.mod_10);
+	}
+
+	static FactionAssociation FindOnePrepared(
+		Database& db,
+		int faction_association_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFactionAssociationRepository>(db, faction_association_id);
+	}
+
+	static std::vector<FactionAssociation> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFactionAssociationRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const FactionAssociation &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFactionAssociationRepository>(db, e, e.id);
+	}
+
+	static FactionAssociation InsertOnePrepared(
+		Database& db,
+		FactionAssociation e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFactionAssociationRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<FactionAssociation> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFactionAssociationRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<FactionAssociation> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFactionAssociationRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FACTION_ASSOCIATION_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFactionBaseDataRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const FactionBaseData &e
+	)
+	{
+		v.emplace_back(e.client_faction_id);
+		v.emplace_back(e.min);
+		v.emplace_back(e.max);
+		v.emplace_back(e.unk_hero1);
+		v.emplace_back(e.unk_hero2);
+		v.emplace_back(e.unk_hero3);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		FactionBaseData &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.client_faction_id);
+		RepositoryStmt::Read(row, 1, e.min);
+		RepositoryStmt::Read(row, 2, e.max);
+		RepositoryStmt::Read(row, 3, e.unk_hero1);
+		RepositoryStmt::Read(row, 4, e.unk_hero2);
+		RepositoryStmt::Read(row, 5, e.unk_hero3);
+	}
+
+	static FactionBaseData FindOnePrepared(
+		Database& db,
+		int faction_base_data_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFactionBaseDataRepository>(db, faction_base_data_id);
+	}
+
+	static std::vector<FactionBaseData> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFactionBaseDataRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const FactionBaseData &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFactionBaseDataRepository>(db, e, e.client_faction_id);
+	}
+
+	static FactionBaseData InsertOnePrepared(
+		Database& db,
+		FactionBaseData e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFactionBaseDataRepository>(db, e);
+		if (id) {
+			e.client_faction_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<FactionBaseData> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFactionBaseDataRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<FactionBaseData> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFactionBaseDataRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FACTION_BASE_DATA_REPOSITORY_H
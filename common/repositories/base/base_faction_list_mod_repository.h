@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFactionListModRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const FactionListMod &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.faction_id);
+		v.emplace_back(e.mod);
+		v.emplace_back(std::string_view(e.mod_name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		FactionListMod &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.faction_id);
+		RepositoryStmt::Read(row, 2, e.mod);
+		RepositoryStmt::Read(row, 3, e.mod_name);
+	}
+
+	static FactionListMod FindOnePrepared(
+		Database& db,
+		int faction_list_mod_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFactionListModRepository>(db, faction_list_mod_id);
+	}
+
+	static std::vector<FactionListMod> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFactionListModRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const FactionListMod &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFactionListModRepository>(db, e, e.id);
+	}
+
+	static FactionListMod InsertOnePrepared(
+		Database& db,
+		FactionListMod e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFactionListModRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<FactionListMod> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFactionListModRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<FactionListMod> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFactionListModRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FACTION_LIST_MOD_REPOSITORY_H
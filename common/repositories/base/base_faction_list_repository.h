@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFactionListRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const FactionList &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.base);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		FactionList &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.base);
+	}
+
+	static FactionList FindOnePrepared(
+		Database& db,
+		int faction_list_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFactionListRepository>(db, faction_list_id);
+	}
+
+	static std::vector<FactionList> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFactionListRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const FactionList &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFactionListRepository>(db, e, e.id);
+	}
+
+	static FactionList InsertOnePrepared(
+		Database& db,
+		FactionList e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFactionListRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<FactionList> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFactionListRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<FactionList> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFactionListRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FACTION_LIST_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFactionValuesRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const FactionValues &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.faction_id);
+		v.emplace_back(e.current_value);
+		v.emplace_back(e.temp);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		FactionValues &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.faction_id);
+		RepositoryStmt::Read(row, 2, e.current_value);
+		RepositoryStmt::Read(row, 3, e.temp);
+	}
+
+	static FactionValues FindOnePrepared(
+		Database& db,
+		int faction_values_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFactionValuesRepository>(db, faction_values_id);
+	}
+
+	static std::vector<FactionValues> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFactionValuesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const FactionValues &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFactionValuesRepository>(db, e, e.char_id);
+	}
+
+	static FactionValues InsertOnePrepared(
+		Database& db,
+		FactionValues e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFactionValuesRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<FactionValues> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFactionValuesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<FactionValues> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFactionValuesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FACTION_VALUES_REPOSITORY_H
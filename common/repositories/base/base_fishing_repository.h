@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFishingRepository {
@@ -494,6 +495,99 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Fishing &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.Itemid);
+		v.emplace_back(e.skill_level);
+		v.emplace_back(e.chance);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(e.npc_chance);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Fishing &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.Itemid);
+		RepositoryStmt::Read(row, 3, e.skill_level);
+		RepositoryStmt::Read(row, 4, e.chance);
+		RepositoryStmt::Read(row, 5, e.npc_id);
+		RepositoryStmt::Read(row, 6, e.npc_chance);
+		RepositoryStmt::Read(row, 7, e.min_expansion);
+		RepositoryStmt::Read(row, 8, e.max_expansion);
+		RepositoryStmt::Read(row, 9, e.content_flags);
+		RepositoryStmt::Read(row, 10, e.content_flags_disabled);
+	}
+
+	static Fishing FindOnePrepared(
+		Database& db,
+		int fishing_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFishingRepository>(db, fishing_id);
+	}
+
+	static std::vector<Fishing> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFishingRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Fishing &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFishingRepository>(db, e, e.id);
+	}
+
+	static Fishing InsertOnePrepared(
+		Database& db,
+		Fishing e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFishingRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Fishing> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFishingRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Fishing> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFishingRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FISHING_REPOSITORY_H
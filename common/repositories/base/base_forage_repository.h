@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseForageRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Forage &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.Itemid);
+		v.emplace_back(e.level);
+		v.emplace_back(e.chance);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Forage &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.Itemid);
+		RepositoryStmt::Read(row, 3, e.level);
+		RepositoryStmt::Read(row, 4, e.chance);
+		RepositoryStmt::Read(row, 5, e.min_expansion);
+		RepositoryStmt::Read(row, 6, e.max_expansion);
+		RepositoryStmt::Read(row, 7, e.content_flags);
+		RepositoryStmt::Read(row, 8, e.content_flags_disabled);
+	}
+
+	static Forage FindOnePrepared(
+		Database& db,
+		int forage_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseForageRepository>(db, forage_id);
+	}
+
+	static std::vector<Forage> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseForageRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Forage &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseForageRepository>(db, e, e.id);
+	}
+
+	static Forage InsertOnePrepared(
+		Database& db,
+		Forage e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseForageRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Forage> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseForageRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Forage> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseForageRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FORAGE_REPOSITORY_H
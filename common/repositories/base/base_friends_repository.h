@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseFriendsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Friends &e
+	)
+	{
+		v.emplace_back(e.charid);
+		v.emplace_back(e.type);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Friends &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charid);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.name);
+	}
+
+	static Friends FindOnePrepared(
+		Database& db,
+		int friends_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseFriendsRepository>(db, friends_id);
+	}
+
+	static std::vector<Friends> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseFriendsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Friends &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseFriendsRepository>(db, e, e.charid);
+	}
+
+	static Friends InsertOnePrepared(
+		Database& db,
+		Friends e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseFriendsRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Friends> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseFriendsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Friends> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseFriendsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_FRIENDS_REPOSITORY_H
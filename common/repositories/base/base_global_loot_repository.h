@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGlobalLootRepository {
@@ -566,6 +567,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GlobalLoot &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.description));
+		v.emplace_back(e.loottable_id);
+		v.emplace_back(e.enabled);
+		v.emplace_back(e.min_level);
+		v.emplace_back(e.max_level);
+		v.emplace_back(e.rare);
+		v.emplace_back(e.raid);
+		v.emplace_back(std::string_view(e.race));
+		v.emplace_back(std::string_view(e.class_));
+		v.emplace_back(std::string_view(e.bodytype));
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.hot_zone);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GlobalLoot &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.description);
+		RepositoryStmt::Read(row, 2, e.loottable_id);
+		RepositoryStmt::Read(row, 3, e.enabled);
+		RepositoryStmt::Read(row, 4, e.min_level);
+		RepositoryStmt::Read(row, 5, e.max_level);
+		RepositoryStmt::Read(row, 6, e.rare);
+		RepositoryStmt::Read(row, 7, e.raid);
+		RepositoryStmt::Read(row, 8, e.race);
+		RepositoryStmt::Read(row, 9, e.class_);
+		RepositoryStmt::Read(row, 10, e.bodytype);
+		RepositoryStmt::Read(row, 11, e.zone);
+		RepositoryStmt::Read(row, 12, e.hot_zone);
+		RepositoryStmt::Read(row, 13, e.min_expansion);
+		RepositoryStmt::Read(row, 14, e.max_expansion);
+		RepositoryStmt::Read(row, 15, e.content_flags);
+		RepositoryStmt::Read(row, 16, e.content_flags_disabled);
+	}
+
+	static GlobalLoot FindOnePrepared(
+		Database& db,
+		int global_loot_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGlobalLootRepository>(db, global_loot_id);
+	}
+
+	static std::vector<GlobalLoot> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGlobalLootRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GlobalLoot &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGlobalLootRepository>(db, e, e.id);
+	}
+
+	static GlobalLoot InsertOnePrepared(
+		Database& db,
+		GlobalLoot e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGlobalLootRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GlobalLoot> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGlobalLootRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GlobalLoot> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGlobalLootRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GLOBAL_LOOT_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGmIpsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GmIps &e
+	)
+	{
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.account_id);
+		v.emplace_back(std::string_view(e.ip_address));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GmIps &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.name);
+		RepositoryStmt::Read(row, 1, e.account_id);
+		RepositoryStmt::Read(row, 2, e.ip_address);
+	}
+
+	static GmIps FindOnePrepared(
+		Database& db,
+		int gm_ips_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGmIpsRepository>(db, gm_ips_id);
+	}
+
+	static std::vector<GmIps> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGmIpsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GmIps &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGmIpsRepository>(db, e, e.account_id);
+	}
+
+	static GmIps InsertOnePrepared(
+		Database& db,
+		GmIps e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGmIpsRepository>(db, e);
+		if (id) {
+			e.account_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GmIps> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGmIpsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GmIps> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGmIpsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GM_IPS_REPOSITORY_H
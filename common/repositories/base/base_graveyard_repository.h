@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGraveyardRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Graveyard &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Graveyard &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone_id);
+		RepositoryStmt::Read(row, 2, e.x);
+		RepositoryStmt::Read(row, 3, e.y);
+		RepositoryStmt::Read(row, 4, e.z);
+		RepositoryStmt::Read(row, 5, e.heading);
+	}
+
+	static Graveyard FindOnePrepared(
+		Database& db,
+		int graveyard_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGraveyardRepository>(db, graveyard_id);
+	}
+
+	static std::vector<Graveyard> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGraveyardRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Graveyard &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGraveyardRepository>(db, e, e.id);
+	}
+
+	static Graveyard InsertOnePrepared(
+		Database& db,
+		Graveyard e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGraveyardRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Graveyard> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGraveyardRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Graveyard> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGraveyardRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GRAVEYARD_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGridEntriesRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GridEntries &e
+	)
+	{
+		v.emplace_back(e.gridid);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.number);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.pause);
+		v.emplace_back(e.centerpoint);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GridEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.gridid);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.number);
+		RepositoryStmt::Read(row, 3, e.x);
+		RepositoryStmt::Read(row, 4, e.y);
+		RepositoryStmt::Read(row, 5, e.z);
+		RepositoryStmt::Read(row, 6, e.heading);
+		RepositoryStmt::Read(row, 7, e.pause);
+		RepositoryStmt::Read(row, 8, e.centerpoint);
+	}
+
+	static GridEntries FindOnePrepared(
+		Database& db,
+		int grid_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGridEntriesRepository>(db, grid_entries_id);
+	}
+
+	static std::vector<GridEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGridEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GridEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGridEntriesRepository>(db, e, e.gridid);
+	}
+
+	static GridEntries InsertOnePrepared(
+		Database& db,
+		GridEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGridEntriesRepository>(db, e);
+		if (id) {
+			e.gridid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GridEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGridEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GridEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGridEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GRID_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGridRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Grid &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.type);
+		v.emplace_back(e.type2);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Grid &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.type);
+		RepositoryStmt::Read(row, 3, e.type2);
+	}
+
+	static Grid FindOnePrepared(
+		Database& db,
+		int grid_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGridRepository>(db, grid_id);
+	}
+
+	static std::vector<Grid> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGridRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Grid &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGridRepository>(db, e, e.id);
+	}
+
+	static Grid InsertOnePrepared(
+		Database& db,
+		Grid e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGridRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Grid> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGridRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Grid> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGridRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GRID_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGroundSpawnsRepository {
@@ -590,6 +591,115 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GroundSpawns &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.version);
+		v.emplace_back(e.max_x);
+		v.emplace_back(e.max_y);
+		v.emplace_back(e.max_z);
+		v.emplace_back(e.min_x);
+		v.emplace_back(e.min_y);
+		v.emplace_back(e.heading);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.item);
+		v.emplace_back(e.max_allowed);
+		v.emplace_back(std::string_view(e.comment));
+		v.emplace_back(e.respawn_timer);
+		v.emplace_back(e.fix_z);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GroundSpawns &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.max_x);
+		RepositoryStmt::Read(row, 4, e.max_y);
+		RepositoryStmt::Read(row, 5, e.max_z);
+		RepositoryStmt::Read(row, 6, e.min_x);
+		RepositoryStmt::Read(row, 7, e.min_y);
+		RepositoryStmt::Read(row, 8, e.heading);
+		RepositoryStmt::Read(row, 9, e.name);
+		RepositoryStmt::Read(row, 10, e.item);
+		RepositoryStmt::Read(row, 11, e.max_allowed);
+		RepositoryStmt::Read(row, 12, e.comment);
+		RepositoryStmt::Read(row, 13, e.respawn_timer);
+		RepositoryStmt::Read(row, 14, e.fix_z);
+		RepositoryStmt::Read(row, 15, e.min_expansion);
+		RepositoryStmt::Read(row, 16, e.max_expansion);
+		RepositoryStmt::Read(row, 17, e.content_flags);
+		RepositoryStmt::Read(row, 18, e.content_flags_disabled);
+	}
+
+	static GroundSpawns FindOnePrepared(
+		Database& db,
+		int ground_spawns_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGroundSpawnsRepository>(db, ground_spawns_id);
+	}
+
+	static std::vector<GroundSpawns> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGroundSpawnsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GroundSpawns &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGroundSpawnsRepository>(db, e, e.id);
+	}
+
+	static GroundSpawns InsertOnePrepared(
+		Database& db,
+		GroundSpawns e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGroundSpawnsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GroundSpawns> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGroundSpawnsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GroundSpawns> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGroundSpawnsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GROUND_SPAWNS_REPOSITORY_H
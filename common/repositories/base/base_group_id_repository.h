@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGroupIdRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GroupId &e
+	)
+	{
+		v.emplace_back(e.group_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.merc_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GroupId &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.group_id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.character_id);
+		RepositoryStmt::Read(row, 3, e.bot_id);
+		RepositoryStmt::Read(row, 4, e.merc_id);
+	}
+
+	static GroupId FindOnePrepared(
+		Database& db,
+		int group_id_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGroupIdRepository>(db, group_id_id);
+	}
+
+	static std::vector<GroupId> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGroupIdRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GroupId &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGroupIdRepository>(db, e, e.group_id);
+	}
+
+	static GroupId InsertOnePrepared(
+		Database& db,
+		GroupId e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGroupIdRepository>(db, e);
+		if (id) {
+			e.group_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GroupId> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGroupIdRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GroupId> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGroupIdRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GROUP_ID_REPOSITORY_H
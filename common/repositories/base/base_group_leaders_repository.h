@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGroupLeadersRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GroupLeaders &e
+	)
+	{
+		v.emplace_back(e.gid);
+		v.emplace_back(std::string_view(e.leadername));
+		v.emplace_back(std::string_view(e.marknpc));
+		v.emplace_back(std::string_view(e.leadershipaa));
+		v.emplace_back(std::string_view(e.maintank));
+		v.emplace_back(std::string_view(e.assist));
+		v.emplace_back(std::string_view(e.puller));
+		v.emplace_back(std::string_view(e.mentoree));
+		v.emplace_back(e.mentor_percent);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GroupLeaders &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.gid);
+		RepositoryStmt::Read(row, 1, e.leadername);
+		RepositoryStmt::Read(row, 2, e.marknpc);
+		RepositoryStmt::Read(row, 3, e.leadershipaa);
+		RepositoryStmt::Read(row, 4, e.maintank);
+		RepositoryStmt::Read(row, 5, e.assist);
+		RepositoryStmt::Read(row, 6, e.puller);
+		RepositoryStmt::Read(row, 7, e.mentoree);
+		RepositoryStmt::Read(row, 8, e.mentor_percent);
+	}
+
+	static GroupLeaders FindOnePrepared(
+		Database& db,
+		int group_leaders_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGroupLeadersRepository>(db, group_leaders_id);
+	}
+
+	static std::vector<GroupLeaders> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGroupLeadersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GroupLeaders &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGroupLeadersRepository>(db, e, e.gid);
+	}
+
+	static GroupLeaders InsertOnePrepared(
+		Database& db,
+		GroupLeaders e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGroupLeadersRepository>(db, e);
+		if (id) {
+			e.gid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GroupLeaders> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGroupLeadersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GroupLeaders> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGroupLeadersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GROUP_LEADERS_REPOSITORY_H
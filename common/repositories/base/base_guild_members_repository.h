@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGuildMembersRepository {
@@ -483,6 +484,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GuildMembers &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.guild_id);
+		v.emplace_back(e.rank_);
+		v.emplace_back(e.tribute_enable);
+		v.emplace_back(e.total_tribute);
+		v.emplace_back(e.last_tribute);
+		v.emplace_back(e.banker);
+		v.emplace_back(std::string_view(e.public_note));
+		v.emplace_back(e.alt);
+		v.emplace_back(e.online);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GuildMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.guild_id);
+		RepositoryStmt::Read(row, 2, e.rank_);
+		RepositoryStmt::Read(row, 3, e.tribute_enable);
+		RepositoryStmt::Read(row, 4, e.total_tribute);
+		RepositoryStmt::Read(row, 5, e.last_tribute);
+		RepositoryStmt::Read(row, 6, e.banker);
+		RepositoryStmt::Read(row, 7, e.public_note);
+		RepositoryStmt::Read(row, 8, e.alt);
+		RepositoryStmt::Read(row, 9, e.online);
+	}
+
+	static GuildMembers FindOnePrepared(
+		Database& db,
+		int guild_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildMembersRepository>(db, guild_members_id);
+	}
+
+	static std::vector<GuildMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GuildMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildMembersRepository>(db, e, e.char_id);
+	}
+
+	static GuildMembers InsertOnePrepared(
+		Database& db,
+		GuildMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildMembersRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GuildMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GuildMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILD_MEMBERS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GuildPermissions &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.perm_id);
+		v.emplace_back(e.guild_id);
+		v.emplace_back(e.permission);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GuildPermissions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.perm_id);
+		RepositoryStmt::Read(row, 2, e.guild_id);
+		RepositoryStmt::Read(row, 3, e.permission);
+	}
+
+	static GuildPermissions FindOnePrepared(
+		Database& db,
+		int guild_permissions_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildPermissionsRepository>(db, guild_permissions_id);
+	}
+
+	static std::vector<GuildPermissions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildPermissionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GuildPermissions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildPermissionsRepository>(db, e, e.id);
+	}
+
+	static GuildPermissions InsertOnePrepared(
+		Database& db,
+		GuildPermissions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildPermissionsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GuildPermissions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildPermissionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GuildPermissions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildPermissionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILD_PERMISSIONS_REPOSITORY_H
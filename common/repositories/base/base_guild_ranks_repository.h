@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGuildRanksRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GuildRanks &e
+	)
+	{
+		v.emplace_back(e.guild_id);
+		v.emplace_back(e.rank_);
+		v.emplace_back(std::string_view(e.title));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GuildRanks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.guild_id);
+		RepositoryStmt::Read(row, 1, e.rank_);
+		RepositoryStmt::Read(row, 2, e.title);
+	}
+
+	static GuildRanks FindOnePrepared(
+		Database& db,
+		int guild_ranks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildRanksRepository>(db, guild_ranks_id);
+	}
+
+	static std::vector<GuildRanks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildRanksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GuildRanks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildRanksRepository>(db, e, e.guild_id);
+	}
+
+	static GuildRanks InsertOnePrepared(
+		Database& db,
+		GuildRanks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildRanksRepository>(db, e);
+		if (id) {
+			e.guild_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GuildRanks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildRanksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GuildRanks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildRanksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILD_RANKS_REPOSITORY_H
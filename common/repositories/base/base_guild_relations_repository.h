@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseGuildRelationsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GuildRelations &e
+	)
+	{
+		v.emplace_back(e.guild1);
+		v.emplace_back(e.guild2);
+		v.emplace_back(e.relation);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GuildRelations &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.guild1);
+		RepositoryStmt::Read(row, 1, e.guild2);
+		RepositoryStmt::Read(row, 2, e.relation);
+	}
+
+	static GuildRelations FindOnePrepared(
+		Database& db,
+		int guild_relations_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildRelationsRepository>(db, guild_relations_id);
+	}
+
+	static std::vector<GuildRelations> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildRelationsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GuildRelations &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildRelationsRepository>(db, e, e.guild1);
+	}
+
+	static GuildRelations InsertOnePrepared(
+		Database& db,
+		GuildRelations e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildRelationsRepository>(db, e);
+		if (id) {
+			e.guild1 = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GuildRelations> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildRelationsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GuildRelations> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildRelationsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILD_RELATIONS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -448,6 +449,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const GuildTributes &e
+	)
+	{
+		v.emplace_back(e.guild_id);
+		v.emplace_back(e.tribute_id_1);
+		v.emplace_back(e.tribute_id_1_tier);
+		v.emplace_back(e.tribute_id_2);
+		v.emplace_back(e.tribute_id_2_tier);
+		v.emplace_back(e.time_remaining);
+		v.emplace_back(e.enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		GuildTributes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.guild_id);
+		RepositoryStmt::Read(row, 1, e.tribute_id_1);
+		RepositoryStmt::Read(row, 2, e.tribute_id_1_tier);
+		RepositoryStmt::Read(row, 3, e.tribute_id_2);
+		RepositoryStmt::Read(row, 4, e.tribute_id_2_tier);
+		RepositoryStmt::Read(row, 5, e.time_remaining);
+		RepositoryStmt::Read(row, 6, e.enabled);
+	}
+
+	static GuildTributes FindOnePrepared(
+		Database& db,
+		int guild_tributes_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildTributesRepository>(db, guild_tributes_id);
+	}
+
+	static std::vector<GuildTributes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildTributesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const GuildTributes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildTributesRepository>(db, e, e.guild_id);
+	}
+
+	static GuildTributes InsertOnePrepared(
+		Database& db,
+		GuildTributes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildTributesRepository>(db, e);
+		if (id) {
+			e.guild_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<GuildTributes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildTributesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<GuildTributes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildTributesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILD_TRIBUTES_REPOSITORY_H
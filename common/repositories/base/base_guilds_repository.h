@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -483,6 +484,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Guilds &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.leader);
+		v.emplace_back(e.minstatus);
+		v.emplace_back(std::string_view(e.motd));
+		v.emplace_back(e.tribute);
+		v.emplace_back(std::string_view(e.motd_setter));
+		v.emplace_back(std::string_view(e.channel));
+		v.emplace_back(std::string_view(e.url));
+		v.emplace_back(e.favor);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Guilds &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.leader);
+		RepositoryStmt::Read(row, 3, e.minstatus);
+		RepositoryStmt::Read(row, 4, e.motd);
+		RepositoryStmt::Read(row, 5, e.tribute);
+		RepositoryStmt::Read(row, 6, e.motd_setter);
+		RepositoryStmt::Read(row, 7, e.channel);
+		RepositoryStmt::Read(row, 8, e.url);
+		RepositoryStmt::Read(row, 9, e.favor);
+	}
+
+	static Guilds FindOnePrepared(
+		Database& db,
+		int guilds_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseGuildsRepository>(db, guilds_id);
+	}
+
+	static std::vector<Guilds> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseGuildsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Guilds &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseGuildsRepository>(db, e, e.id);
+	}
+
+	static Guilds InsertOnePrepared(
+		Database& db,
+		Guilds e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseGuildsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Guilds> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseGuildsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Guilds> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseGuildsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_GUILDS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseHorsesRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Horses &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.filename));
+		v.emplace_back(e.race);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.texture);
+		v.emplace_back(e.mountspeed);
+		v.emplace_back(std::string_view(e.notes));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Horses &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.filename);
+		RepositoryStmt::Read(row, 2, e.race);
+		RepositoryStmt::Read(row, 3, e.gender);
+		RepositoryStmt::Read(row, 4, e.texture);
+		RepositoryStmt::Read(row, 5, e.mountspeed);
+		RepositoryStmt::Read(row, 6, e.notes);
+	}
+
+	static Horses FindOnePrepared(
+		Database& db,
+		int horses_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseHorsesRepository>(db, horses_id);
+	}
+
+	static std::vector<Horses> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseHorsesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Horses &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseHorsesRepository>(db, e, e.id);
+	}
+
+	static Horses InsertOnePrepared(
+		Database& db,
+		Horses e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseHorsesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Horses> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseHorsesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Horses> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseHorsesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_HORSES_REPOSITORY_H
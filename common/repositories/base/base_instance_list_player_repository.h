@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseInstanceListPlayerRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const InstanceListPlayer &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.charid);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		InstanceListPlayer &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.charid);
+	}
+
+	static InstanceListPlayer FindOnePrepared(
+		Database& db,
+		int instance_list_player_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseInstanceListPlayerRepository>(db, instance_list_player_id);
+	}
+
+	static std::vector<InstanceListPlayer> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseInstanceListPlayerRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const InstanceListPlayer &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseInstanceListPlayerRepository>(db, e, e.id);
+	}
+
+	static InstanceListPlayer InsertOnePrepared(
+		Database& db,
+		InstanceListPlayer e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseInstanceListPlayerRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<InstanceListPlayer> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseInstanceListPlayerRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<InstanceListPlayer> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseInstanceListPlayerRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_INSTANCE_LIST_PLAYER_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseInstanceListRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const InstanceList &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zone);
+		v.emplace_back(e.version);
+		v.emplace_back(e.is_global);
+		v.emplace_back(e.start_time);
+		v.emplace_back(e.duration);
+		v.emplace_back(e.never_expires);
+		v.emplace_back(std::string_view(e.notes));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		InstanceList &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.is_global);
+		RepositoryStmt::Read(row, 4, e.start_time);
+		RepositoryStmt::Read(row, 5, e.duration);
+		RepositoryStmt::Read(row, 6, e.never_expires);
+		RepositoryStmt::Read(row, 7, e.notes);
+	}
+
+	static InstanceList FindOnePrepared(
+		Database& db,
+		int instance_list_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseInstanceListRepository>(db, instance_list_id);
+	}
+
+	static std::vector<InstanceList> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseInstanceListRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const InstanceList &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseInstanceListRepository>(db, e, e.id);
+	}
+
+	static InstanceList InsertOnePrepared(
+		Database& db,
+		InstanceList e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseInstanceListRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<InstanceList> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseInstanceListRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<InstanceList> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseInstanceListRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_INSTANCE_LIST_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseInventorySnapshotsRepository {
@@ -37,6 +38,8 @@ public:
 		uint32_t    ornamentidfile;
 		int32_t     ornament_hero_model;
 		uint64_t    guid;
+		uint8_t     removed;
+		uint32_t    base_time_index;
 	};
 
 	static std::string PrimaryKey()
@@ -65,6 +68,8 @@ public:
 			"ornamentidfile",
 			"ornament_hero_model",
 			"guid",
+			"removed",
+			"base_time_index",
 		};
 	}
 
@@ -89,6 +94,8 @@ public:
 			"ornamentidfile",
 			"ornament_hero_model",
 			"guid",
+			"removed",
+			"base_time_index",
 		};
 	}
 
@@ -147,6 +154,8 @@ public:
 		e.ornamentidfile      = 0;
 		e.ornament_hero_model = 0;
 		e.guid                = 0;
+		e.removed             = 0;
+		e.base_time_index     = 0;
 
 		return e;
 	}
@@ -201,6 +210,8 @@ public:
 			e.ornamentidfile      = row[15] ? static_cast<uint32_t>(strtoul(row[15], nullptr, 10)) : 0;
 			e.ornament_hero_model = row[16] ? static_cast<int32_t>(atoi(row[16])) : 0;
 			e.guid                = row[17] ? strtoull(row[17], nullptr, 10) : 0;
+			e.removed             = row[18] ? static_cast<uint8_t>(strtoul(row[18], nullptr, 10)) : 0;
+			e.base_time_index     = row[19] ? static_cast<uint32_t>(strtoul(row[19], nullptr, 10)) : 0;
 
 			return e;
 		}
@@ -252,6 +263,8 @@ public:
 		v.push_back(columns[15] + " = " + std::to_string(e.ornamentidfile));
 		v.push_back(columns[16] + " = " + std::to_string(e.ornament_hero_model));
 		v.push_back(columns[17] + " = " + std::to_string(e.guid));
+		v.push_back(columns[18] + " = " + std::to_string(e.removed));
+		v.push_back(columns[19] + " = " + std::to_string(e.base_time_index));
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -291,6 +304,8 @@ public:
 		v.push_back(std::to_string(e.ornamentidfile));
 		v.push_back(std::to_string(e.ornament_hero_model));
 		v.push_back(std::to_string(e.guid));
+		v.push_back(std::to_string(e.removed));
+		v.push_back(std::to_string(e.base_time_index));
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -338,6 +353,8 @@ public:
 			v.push_back(std::to_string(e.ornamentidfile));
 			v.push_back(std::to_string(e.ornament_hero_model));
 			v.push_back(std::to_string(e.guid));
+			v.push_back(std::to_string(e.removed));
+			v.push_back(std::to_string(e.base_time_index));
 
 			insert_chunks.push_back("(" + Strings::Implode(",", v) + ")");
 		}
@@ -389,6 +406,8 @@ public:
 			e.ornamentidfile      = row[15] ? static_cast<uint32_t>(strtoul(row[15], nullptr, 10)) : 0;
 			e.ornament_hero_model = row[16] ? static_cast<int32_t>(atoi(row[16])) : 0;
 			e.guid                = row[17] ? strtoull(row[17], nullptr, 10) : 0;
+			e.removed             = row[18] ? static_cast<uint8_t>(strtoul(row[18], nullptr, 10)) : 0;
+			e.base_time_index     = row[19] ? static_cast<uint32_t>(strtoul(row[19], nullptr, 10)) : 0;
 
 			all_entries.push_back(e);
 		}
@@ -431,6 +450,8 @@ public:
 			e.ornamentidfile      = row[15] ? static_cast<uint32_t>(strtoul(row[15], nullptr, 10)) : 0;
 			e.ornament_hero_model = row[16] ? static_cast<int32_t>(atoi(row[16])) : 0;
 			e.guid                = row[17] ? strtoull(row[17], nullptr, 10) : 0;
+			e.removed             = row[18] ? static_cast<uint8_t>(strtoul(row[18], nullptr, 10)) : 0;
+			e.base_time_index     = row[19] ? static_cast<uint32_t>(strtoul(row[19], nullptr, 10)) : 0;
 
 			all_entries.push_back(e);
 		}
@@ -523,6 +544,8 @@ public:
 		v.push_back(std::to_string(e.ornamentidfile));
 		v.push_back(std::to_string(e.ornament_hero_model));
 		v.push_back(std::to_string(e.guid));
+		v.push_back(std::to_string(e.removed));
+		v.push_back(std::to_string(e.base_time_index));
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -563,6 +586,8 @@ public:
 			v.push_back(std::to_string(e.ornamentidfile));
 			v.push_back(std::to_string(e.ornament_hero_model));
 			v.push_back(std::to_string(e.guid));
+			v.push_back(std::to_string(e.removed));
+			v.push_back(std::to_string(e.base_time_index));
 
 			insert_chunks.push_back("(" + Strings::Implode(",", v) + ")");
 		}
@@ -579,6 +604,117 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const InventorySnapshots &e
+	)
+	{
+		v.emplace_back(e.time_index);
+		v.emplace_back(e.charid);
+		v.emplace_back(e.slotid);
+		v.emplace_back(e.itemid);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.color);
+		v.emplace_back(e.augslot1);
+		v.emplace_back(e.augslot2);
+		v.emplace_back(e.augslot3);
+		v.emplace_back(e.augslot4);
+		v.emplace_back(e.augslot5);
+		v.emplace_back(e.augslot6);
+		v.emplace_back(e.instnodrop);
+		v.emplace_back(std::string_view(e.custom_data));
+		v.emplace_back(e.ornamenticon);
+		v.emplace_back(e.ornamentidfile);
+		v.emplace_back(e.ornament_hero_model);
+		v.emplace_back(e.guid);
+		v.emplace_back(e.removed);
+		v.emplace_back(e.base_time_index);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		InventorySnapshots &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.time_index);
+		RepositoryStmt::Read(row, 1, e.charid);
+		RepositoryStmt::Read(row, 2, e.slotid);
+		RepositoryStmt::Read(row, 3, e.itemid);
+		RepositoryStmt::Read(row, 4, e.charges);
+		RepositoryStmt::Read(row, 5, e.color);
+		RepositoryStmt::Read(row, 6, e.augslot1);
+		RepositoryStmt::Read(row, 7, e.augslot2);
+		RepositoryStmt::Read(row, 8, e.augslot3);
+		RepositoryStmt::Read(row, 9, e.augslot4);
+		RepositoryStmt::Read(row, 10, e.augslot5);
+		RepositoryStmt::Read(row, 11, e.augslot6);
+		RepositoryStmt::Read(row, 12, e.instnodrop);
+		RepositoryStmt::Read(row, 13, e.custom_data);
+		RepositoryStmt::Read(row, 14, e.ornamenticon);
+		RepositoryStmt::Read(row, 15, e.ornamentidfile);
+		RepositoryStmt::Read(row, 16, e.ornament_hero_model);
+		RepositoryStmt::Read(row, 17, e.guid);
+		RepositoryStmt::Read(row, 18, e.removed);
+		RepositoryStmt::Read(row, 19, e.base_time_index);
+	}
+
+	static InventorySnapshots FindOnePrepared(
+		Database& db,
+		int inventory_snapshots_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseInventorySnapshotsRepository>(db, inventory_snapshots_id);
+	}
+
+	static std::vector<InventorySnapshots> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseInventorySnapshotsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const InventorySnapshots &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseInventorySnapshotsRepository>(db, e, e.time_index);
+	}
+
+	static InventorySnapshots InsertOnePrepared(
+		Database& db,
+		InventorySnapshots e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseInventorySnapshotsRepository>(db, e);
+		if (id) {
+			e.time_index = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<InventorySnapshots> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseInventorySnapshotsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<InventorySnapshots> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseInventorySnapshotsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_INVENTORY_SNAPSHOTS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseIpExemptionsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const IpExemptions &e
+	)
+	{
+		v.emplace_back(e.exemption_id);
+		v.emplace_back(std::string_view(e.exemption_ip));
+		v.emplace_back(e.exemption_amount);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		IpExemptions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.exemption_id);
+		RepositoryStmt::Read(row, 1, e.exemption_ip);
+		RepositoryStmt::Read(row, 2, e.exemption_amount);
+	}
+
+	static IpExemptions FindOnePrepared(
+		Database& db,
+		int ip_exemptions_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseIpExemptionsRepository>(db, ip_exemptions_id);
+	}
+
+	static std::vector<IpExemptions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseIpExemptionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const IpExemptions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseIpExemptionsRepository>(db, e, e.exemption_id);
+	}
+
+	static IpExemptions InsertOnePrepared(
+		Database& db,
+		IpExemptions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseIpExemptionsRepository>(db, e);
+		if (id) {
+			e.exemption_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<IpExemptions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseIpExemptionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<IpExemptions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseIpExemptionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_IP_EXEMPTIONS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseItemsEvolvingDetailsRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ItemsEvolvingDetails &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.item_evo_id);
+		v.emplace_back(e.item_evolve_level);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.sub_type);
+		v.emplace_back(e.required_amount);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ItemsEvolvingDetails &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.item_evo_id);
+		RepositoryStmt::Read(row, 2, e.item_evolve_level);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.type);
+		RepositoryStmt::Read(row, 5, e.sub_type);
+		RepositoryStmt::Read(row, 6, e.required_amount);
+	}
+
+	static ItemsEvolvingDetails FindOnePrepared(
+		Database& db,
+		int items_evolving_details_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseItemsEvolvingDetailsRepository>(db, items_evolving_details_id);
+	}
+
+	static std::vector<ItemsEvolvingDetails> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseItemsEvolvingDetailsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ItemsEvolvingDetails &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseItemsEvolvingDetailsRepository>(db, e, e.id);
+	}
+
+	static ItemsEvolvingDetails InsertOnePrepared(
+		Database& db,
+		ItemsEvolvingDetails e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseItemsEvolvingDetailsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ItemsEvolvingDetails> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseItemsEvolvingDetailsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ItemsEvolvingDetails> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseItemsEvolvingDetailsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ITEMS_EVOLVING_DETAILS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseItemsRepository {
@@ -3783,6 +3784,647 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Items &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.minstatus);
+		v.emplace_back(std::string_view(e.Name));
+		v.emplace_back(e.aagi);
+		v.emplace_back(e.ac);
+		v.emplace_back(e.accuracy);
+		v.emplace_back(e.acha);
+		v.emplace_back(e.adex);
+		v.emplace_back(e.aint);
+		v.emplace_back(e.artifactflag);
+		v.emplace_back(e.asta);
+		v.emplace_back(e.astr);
+		v.emplace_back(e.attack);
+		v.emplace_back(e.augrestrict);
+		v.emplace_back(e.augslot1type);
+		v.emplace_back(e.augslot1visible);
+		v.emplace_back(e.augslot2type);
+		v.emplace_back(e.augslot2visible);
+		v.emplace_back(e.augslot3type);
+		v.emplace_back(e.augslot3visible);
+		v.emplace_back(e.augslot4type);
+		v.emplace_back(e.augslot4visible);
+		v.emplace_back(e.augslot5type);
+		v.emplace_back(e.augslot5visible);
+		v.emplace_back(e.augslot6type);
+		v.emplace_back(e.augslot6visible);
+		v.emplace_back(e.augtype);
+		v.emplace_back(e.avoidance);
+		v.emplace_back(e.awis);
+		v.emplace_back(e.bagsize);
+		v.emplace_back(e.bagslots);
+		v.emplace_back(e.bagtype);
+		v.emplace_back(e.bagwr);
+		v.emplace_back(e.banedmgamt);
+		v.emplace_back(e.banedmgraceamt);
+		v.emplace_back(e.banedmgbody);
+		v.emplace_back(e.banedmgrace);
+		v.emplace_back(e.bardtype);
+		v.emplace_back(e.bardvalue);
+		v.emplace_back(e.book);
+		v.emplace_back(e.casttime);
+		v.emplace_back(e.casttime_);
+		v.emplace_back(std::string_view(e.charmfile));
+		v.emplace_back(std::string_view(e.charmfileid));
+		v.emplace_back(e.classes);
+		v.emplace_back(e.color);
+		v.emplace_back(std::string_view(e.combateffects));
+		v.emplace_back(e.extradmgskill);
+		v.emplace_back(e.extradmgamt);
+		v.emplace_back(e.price);
+		v.emplace_back(e.cr);
+		v.emplace_back(e.damage);
+		v.emplace_back(e.damageshield);
+		v.emplace_back(e.deity);
+		v.emplace_back(e.delay);
+		v.emplace_back(e.augdistiller);
+		v.emplace_back(e.dotshielding);
+		v.emplace_back(e.dr);
+		v.emplace_back(e.clicktype);
+		v.emplace_back(e.clicklevel2);
+		v.emplace_back(e.elemdmgtype);
+		v.emplace_back(e.elemdmgamt);
+		v.emplace_back(e.endur);
+		v.emplace_back(e.factionamt1);
+		v.emplace_back(e.factionamt2);
+		v.emplace_back(e.factionamt3);
+		v.emplace_back(e.factionamt4);
+		v.emplace_back(e.factionmod1);
+		v.emplace_back(e.factionmod2);
+		v.emplace_back(e.factionmod3);
+		v.emplace_back(e.factionmod4);
+		v.emplace_back(std::string_view(e.filename));
+		v.emplace_back(e.focuseffect);
+		v.emplace_back(e.fr);
+		v.emplace_back(e.fvnodrop);
+		v.emplace_back(e.haste);
+		v.emplace_back(e.clicklevel);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.regen);
+		v.emplace_back(e.icon);
+		v.emplace_back(std::string_view(e.idfile));
+		v.emplace_back(e.itemclass);
+		v.emplace_back(e.itemtype);
+		v.emplace_back(e.ldonprice);
+		v.emplace_back(e.ldontheme);
+		v.emplace_back(e.ldonsold);
+		v.emplace_back(e.light);
+		v.emplace_back(std::string_view(e.lore));
+		v.emplace_back(e.loregroup);
+		v.emplace_back(e.magic);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.manaregen);
+		v.emplace_back(e.enduranceregen);
+		v.emplace_back(e.material);
+		v.emplace_back(e.herosforgemodel);
+		v.emplace_back(e.maxcharges);
+		v.emplace_back(e.mr);
+		v.emplace_back(e.nodrop);
+		v.emplace_back(e.norent);
+		v.emplace_back(e.pendingloreflag);
+		v.emplace_back(e.pr);
+		v.emplace_back(e.procrate);
+		v.emplace_back(e.races);
+		v.emplace_back(e.range_);
+		v.emplace_back(e.reclevel);
+		v.emplace_back(e.recskill);
+		v.emplace_back(e.reqlevel);
+		v.emplace_back(e.sellrate);
+		v.emplace_back(e.shielding);
+		v.emplace_back(e.size);
+		v.emplace_back(e.skillmodtype);
+		v.emplace_back(e.skillmodvalue);
+		v.emplace_back(e.slots);
+		v.emplace_back(e.clickeffect);
+		v.emplace_back(e.spellshield);
+		v.emplace_back(e.strikethrough);
+		v.emplace_back(e.stunresist);
+		v.emplace_back(e.summonedflag);
+		v.emplace_back(e.tradeskills);
+		v.emplace_back(e.favor);
+		v.emplace_back(e.weight);
+		v.emplace_back(e.UNK012);
+		v.emplace_back(e.UNK013);
+		v.emplace_back(e.benefitflag);
+		v.emplace_back(e.UNK054);
+		v.emplace_back(e.UNK059);
+		v.emplace_back(e.booktype);
+		v.emplace_back(e.recastdelay);
+		v.emplace_back(e.recasttype);
+		v.emplace_back(e.guildfavor);
+		v.emplace_back(e.UNK123);
+		v.emplace_back(e.UNK124);
+		v.emplace_back(e.attuneable);
+		v.emplace_back(e.nopet);
+		v.emplace_back(RepositoryStmt::DateTime(e.updated));
+		v.emplace_back(std::string_view(e.comment));
+		v.emplace_back(e.UNK127);
+		v.emplace_back(e.pointtype);
+		v.emplace_back(e.potionbelt);
+		v.emplace_back(e.potionbeltslots);
+		v.emplace_back(e.stacksize);
+		v.emplace_back(e.notransfer);
+		v.emplace_back(e.stackable);
+		v.emplace_back(std::string_view(e.UNK134));
+		v.emplace_back(e.UNK137);
+		v.emplace_back(e.proceffect);
+		v.emplace_back(e.proctype);
+		v.emplace_back(e.proclevel2);
+		v.emplace_back(e.proclevel);
+		v.emplace_back(e.UNK142);
+		v.emplace_back(e.worneffect);
+		v.emplace_back(e.worntype);
+		v.emplace_back(e.wornlevel2);
+		v.emplace_back(e.wornlevel);
+		v.emplace_back(e.UNK147);
+		v.emplace_back(e.focustype);
+		v.emplace_back(e.focuslevel2);
+		v.emplace_back(e.focuslevel);
+		v.emplace_back(e.UNK152);
+		v.emplace_back(e.scrolleffect);
+		v.emplace_back(e.scrolltype);
+		v.emplace_back(e.scrolllevel2);
+		v.emplace_back(e.scrolllevel);
+		v.emplace_back(e.UNK157);
+		v.emplace_back(RepositoryStmt::DateTime(e.serialized));
+		v.emplace_back(RepositoryStmt::DateTime(e.verified));
+		v.emplace_back(std::string_view(e.serialization));
+		v.emplace_back(std::string_view(e.source));
+		v.emplace_back(e.UNK033);
+		v.emplace_back(std::string_view(e.lorefile));
+		v.emplace_back(e.UNK014);
+		v.emplace_back(e.svcorruption);
+		v.emplace_back(e.skillmodmax);
+		v.emplace_back(e.UNK060);
+		v.emplace_back(e.augslot1unk2);
+		v.emplace_back(e.augslot2unk2);
+		v.emplace_back(e.augslot3unk2);
+		v.emplace_back(e.augslot4unk2);
+		v.emplace_back(e.augslot5unk2);
+		v.emplace_back(e.augslot6unk2);
+		v.emplace_back(e.UNK120);
+		v.emplace_back(e.UNK121);
+		v.emplace_back(e.questitemflag);
+		v.emplace_back(std::string_view(e.UNK132));
+		v.emplace_back(e.clickunk5);
+		v.emplace_back(std::string_view(e.clickunk6));
+		v.emplace_back(e.clickunk7);
+		v.emplace_back(e.procunk1);
+		v.emplace_back(e.procunk2);
+		v.emplace_back(e.procunk3);
+		v.emplace_back(e.procunk4);
+		v.emplace_back(std::string_view(e.procunk6));
+		v.emplace_back(e.procunk7);
+		v.emplace_back(e.wornunk1);
+		v.emplace_back(e.wornunk2);
+		v.emplace_back(e.wornunk3);
+		v.emplace_back(e.wornunk4);
+		v.emplace_back(e.wornunk5);
+		v.emplace_back(std::string_view(e.wornunk6));
+		v.emplace_back(e.wornunk7);
+		v.emplace_back(e.focusunk1);
+		v.emplace_back(e.focusunk2);
+		v.emplace_back(e.focusunk3);
+		v.emplace_back(e.focusunk4);
+		v.emplace_back(e.focusunk5);
+		v.emplace_back(std::string_view(e.focusunk6));
+		v.emplace_back(e.focusunk7);
+		v.emplace_back(e.scrollunk1);
+		v.emplace_back(e.scrollunk2);
+		v.emplace_back(e.scrollunk3);
+		v.emplace_back(e.scrollunk4);
+		v.emplace_back(e.scrollunk5);
+		v.emplace_back(std::string_view(e.scrollunk6));
+		v.emplace_back(e.scrollunk7);
+		v.emplace_back(e.UNK193);
+		v.emplace_back(e.purity);
+		v.emplace_back(e.evoitem);
+		v.emplace_back(e.evoid);
+		v.emplace_back(e.evolvinglevel);
+		v.emplace_back(e.evomax);
+		v.emplace_back(std::string_view(e.clickname));
+		v.emplace_back(std::string_view(e.procname));
+		v.emplace_back(std::string_view(e.wornname));
+		v.emplace_back(std::string_view(e.focusname));
+		v.emplace_back(std::string_view(e.scrollname));
+		v.emplace_back(e.dsmitigation);
+		v.emplace_back(e.heroic_str);
+		v.emplace_back(e.heroic_int);
+		v.emplace_back(e.heroic_wis);
+		v.emplace_back(e.heroic_agi);
+		v.emplace_back(e.heroic_dex);
+		v.emplace_back(e.heroic_sta);
+		v.emplace_back(e.heroic_cha);
+		v.emplace_back(e.heroic_pr);
+		v.emplace_back(e.heroic_dr);
+		v.emplace_back(e.heroic_fr);
+		v.emplace_back(e.heroic_cr);
+		v.emplace_back(e.heroic_mr);
+		v.emplace_back(e.heroic_svcorrup);
+		v.emplace_back(e.healamt);
+		v.emplace_back(e.spelldmg);
+		v.emplace_back(e.clairvoyance);
+		v.emplace_back(e.backstabdmg);
+		v.emplace_back(std::string_view(e.created));
+		v.emplace_back(e.elitematerial);
+		v.emplace_back(e.ldonsellbackrate);
+		v.emplace_back(e.scriptfileid);
+		v.emplace_back(e.expendablearrow);
+		v.emplace_back(e.powersourcecapacity);
+		v.emplace_back(e.bardeffect);
+		v.emplace_back(e.bardeffecttype);
+		v.emplace_back(e.bardlevel2);
+		v.emplace_back(e.bardlevel);
+		v.emplace_back(e.bardunk1);
+		v.emplace_back(e.bardunk2);
+		v.emplace_back(e.bardunk3);
+		v.emplace_back(e.bardunk4);
+		v.emplace_back(e.bardunk5);
+		v.emplace_back(std::string_view(e.bardname));
+		v.emplace_back(e.bardunk7);
+		v.emplace_back(e.UNK214);
+		v.emplace_back(e.subtype);
+		v.emplace_back(e.UNK220);
+		v.emplace_back(e.UNK221);
+		v.emplace_back(e.heirloom);
+		v.emplace_back(e.UNK223);
+		v.emplace_back(e.UNK224);
+		v.emplace_back(e.UNK225);
+		v.emplace_back(e.UNK226);
+		v.emplace_back(e.UNK227);
+		v.emplace_back(e.UNK228);
+		v.emplace_back(e.UNK229);
+		v.emplace_back(e.UNK230);
+		v.emplace_back(e.UNK231);
+		v.emplace_back(e.UNK232);
+		v.emplace_back(e.UNK233);
+		v.emplace_back(e.UNK234);
+		v.emplace_back(e.placeable);
+		v.emplace_back(e.UNK236);
+		v.emplace_back(e.UNK237);
+		v.emplace_back(e.UNK238);
+		v.emplace_back(e.UNK239);
+		v.emplace_back(e.UNK240);
+		v.emplace_back(e.UNK241);
+		v.emplace_back(e.epicitem);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Items &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.minstatus);
+		RepositoryStmt::Read(row, 2, e.Name);
+		RepositoryStmt::Read(row, 3, e.aagi);
+		RepositoryStmt::Read(row, 4, e.ac);
+		RepositoryStmt::Read(row, 5, e.accuracy);
+		RepositoryStmt::Read(row, 6, e.acha);
+		RepositoryStmt::Read(row, 7, e.adex);
+		RepositoryStmt::Read(row, 8, e.aint);
+		RepositoryStmt::Read(row, 9, e.artifactflag);
+		RepositoryStmt::Read(row, 10, e.asta);
+		RepositoryStmt::Read(row, 11, e.astr);
+		RepositoryStmt::Read(row, 12, e.attack);
+		RepositoryStmt::Read(row, 13, e.augrestrict);
+		RepositoryStmt::Read(row, 14, e.augslot1type);
+		RepositoryStmt::Read(row, 15, e.augslot1visible);
+		RepositoryStmt::Read(row, 16, e.augslot2type);
+		RepositoryStmt::Read(row, 17, e.augslot2visible);
+		RepositoryStmt::Read(row, 18, e.augslot3type);
+		RepositoryStmt::Read(row, 19, e.augslot3visible);
+		RepositoryStmt::Read(row, 20, e.augslot4type);
+		RepositoryStmt::Read(row, 21, e.augslot4visible);
+		RepositoryStmt::Read(row, 22, e.augslot5type);
+		RepositoryStmt::Read(row, 23, e.augslot5visible);
+		RepositoryStmt::Read(row, 24, e.augslot6type);
+		RepositoryStmt::Read(row, 25, e.augslot6visible);
+		RepositoryStmt::Read(row, 26, e.augtype);
+		RepositoryStmt::Read(row, 27, e.avoidance);
+		RepositoryStmt::Read(row, 28, e.awis);
+		RepositoryStmt::Read(row, 29, e.bagsize);
+		RepositoryStmt::Read(row, 30, e.bagslots);
+		RepositoryStmt::Read(row, 31, e.bagtype);
+		RepositoryStmt::Read(row, 32, e.bagwr);
+		RepositoryStmt::Read(row, 33, e.banedmgamt);
+		RepositoryStmt::Read(row, 34, e.banedmgraceamt);
+		RepositoryStmt::Read(row, 35, e.banedmgbody);
+		RepositoryStmt::Read(row, 36, e.banedmgrace);
+		RepositoryStmt::Read(row, 37, e.bardtype);
+		RepositoryStmt::Read(row, 38, e.bardvalue);
+		RepositoryStmt::Read(row, 39, e.book);
+		RepositoryStmt::Read(row, 40, e.casttime);
+		RepositoryStmt::Read(row, 41, e.casttime_);
+		RepositoryStmt::Read(row, 42, e.charmfile);
+		RepositoryStmt::Read(row, 43, e.charmfileid);
+		RepositoryStmt::Read(row, 44, e.classes);
+		RepositoryStmt::Read(row, 45, e.color);
+		RepositoryStmt::Read(row, 46, e.combateffects);
+		RepositoryStmt::Read(row, 47, e.extradmgskill);
+		RepositoryStmt::Read(row, 48, e.extradmgamt);
+		RepositoryStmt::Read(row, 49, e.price);
+		RepositoryStmt::Read(row, 50, e.cr);
+		RepositoryStmt::Read(row, 51, e.damage);
+		RepositoryStmt::Read(row, 52, e.damageshield);
+		RepositoryStmt::Read(row, 53, e.deity);
+		RepositoryStmt::Read(row, 54, e.delay);
+		RepositoryStmt::Read(row, 55, e.augdistiller);
+		RepositoryStmt::Read(row, 56, e.dotshielding);
+		RepositoryStmt::Read(row, 57, e.dr);
+		RepositoryStmt::Read(row, 58, e.clicktype);
+		RepositoryStmt::Read(row, 59, e.clicklevel2);
+		RepositoryStmt::Read(row, 60, e.elemdmgtype);
+		RepositoryStmt::Read(row, 61, e.elemdmgamt);
+		RepositoryStmt::Read(row, 62, e.endur);
+		RepositoryStmt::Read(row, 63, e.factionamt1);
+		RepositoryStmt::Read(row, 64, e.factionamt2);
+		RepositoryStmt::Read(row, 65, e.factionamt3);
+		RepositoryStmt::Read(row, 66, e.factionamt4);
+		RepositoryStmt::Read(row, 67, e.factionmod1);
+		RepositoryStmt::Read(row, 68, e.factionmod2);
+		RepositoryStmt::Read(row, 69, e.factionmod3);
+		RepositoryStmt::Read(row, 70, e.factionmod4);
+		RepositoryStmt::Read(row, 71, e.filename);
+		RepositoryStmt::Read(row, 72, e.focuseffect);
+		RepositoryStmt::Read(row, 73, e.fr);
+		RepositoryStmt::Read(row, 74, e.fvnodrop);
+		RepositoryStmt::Read(row, 75, e.haste);
+		RepositoryStmt::Read(row, 76, e.clicklevel);
+		RepositoryStmt::Read(row, 77, e.hp);
+		RepositoryStmt::Read(row, 78, e.regen);
+		RepositoryStmt::Read(row, 79, e.icon);
+		RepositoryStmt::Read(row, 80, e.idfile);
+		RepositoryStmt::Read(row, 81, e.itemclass);
+		RepositoryStmt::Read(row, 82, e.itemtype);
+		RepositoryStmt::Read(row, 83, e.ldonprice);
+		RepositoryStmt::Read(row, 84, e.ldontheme);
+		RepositoryStmt::Read(row, 85, e.ldonsold);
+		RepositoryStmt::Read(row, 86, e.light);
+		RepositoryStmt::Read(row, 87, e.lore);
+		RepositoryStmt::Read(row, 88, e.loregroup);
+		RepositoryStmt::Read(row, 89, e.magic);
+		RepositoryStmt::Read(row, 90, e.mana);
+		RepositoryStmt::Read(row, 91, e.manaregen);
+		RepositoryStmt::Read(row, 92, e.enduranceregen);
+		RepositoryStmt::Read(row, 93, e.material);
+		RepositoryStmt::Read(row, 94, e.herosforgemodel);
+		RepositoryStmt::Read(row, 95, e.maxcharges);
+		RepositoryStmt::Read(row, 96, e.mr);
+		RepositoryStmt::Read(row, 97, e.nodrop);
+		RepositoryStmt::Read(row, 98, e.norent);
+		RepositoryStmt::Read(row, 99, e.pendingloreflag);
+		RepositoryStmt::Read(row, 100, e.pr);
+		RepositoryStmt::Read(row, 101, e.procrate);
+		RepositoryStmt::Read(row, 102, e.races);
+		RepositoryStmt::Read(row, 103, e.range_);
+		RepositoryStmt::Read(row, 104, e.reclevel);
+		RepositoryStmt::Read(row, 105, e.recskill);
+		RepositoryStmt::Read(row, 106, e.reqlevel);
+		RepositoryStmt::Read(row, 107, e.sellrate);
+		RepositoryStmt::Read(row, 108, e.shielding);
+		RepositoryStmt::Read(row, 109, e.size);
+		RepositoryStmt::Read(row, 110, e.skillmodtype);
+		RepositoryStmt::Read(row, 111, e.skillmodvalue);
+		RepositoryStmt::Read(row, 112, e.slots);
+		RepositoryStmt::Read(row, 113, e.clickeffect);
+		RepositoryStmt::Read(row, 114, e.spellshield);
+		RepositoryStmt::Read(row, 115, e.strikethrough);
+		RepositoryStmt::Read(row, 116, e.stunresist);
+		RepositoryStmt::Read(row, 117, e.summonedflag);
+		RepositoryStmt::Read(row, 118, e.tradeskills);
+		RepositoryStmt::Read(row, 119, e.favor);
+		RepositoryStmt::Read(row, 120, e.weight);
+		RepositoryStmt::Read(row, 121, e.UNK012);
+		RepositoryStmt::Read(row, 122, e.UNK013);
+		RepositoryStmt::Read(row, 123, e.benefitflag);
+		RepositoryStmt::Read(row, 124, e.UNK054);
+		RepositoryStmt::Read(row, 125, e.UNK059);
+		RepositoryStmt::Read(row, 126, e.booktype);
+		RepositoryStmt::Read(row, 127, e.recastdelay);
+		RepositoryStmt::Read(row, 128, e.recasttype);
+		RepositoryStmt::Read(row, 129, e.guildfavor);
+		RepositoryStmt::Read(row, 130, e.UNK123);
+		RepositoryStmt::Read(row, 131, e.UNK124);
+		RepositoryStmt::Read(row, 132, e.attuneable);
+		RepositoryStmt::Read(row, 133, e.nopet);
+		RepositoryStmt::Read(row, 134, e.updated);
+		RepositoryStmt::Read(row, 135, e.comment);
+		RepositoryStmt::Read(row, 136, e.UNK127);
+		RepositoryStmt::Read(row, 137, e.pointtype);
+		RepositoryStmt::Read(row, 138, e.potionbelt);
+		RepositoryStmt::Read(row, 139, e.potionbeltslots);
+		RepositoryStmt::Read(row, 140, e.stacksize);
+		RepositoryStmt::Read(row, 141, e.notransfer);
+		RepositoryStmt::Read(row, 142, e.stackable);
+		RepositoryStmt::Read(row, 143, e.UNK134);
+		RepositoryStmt::Read(row, 144, e.UNK137);
+		RepositoryStmt::Read(row, 145, e.proceffect);
+		RepositoryStmt::Read(row, 146, e.proctype);
+		RepositoryStmt::Read(row, 147, e.proclevel2);
+		RepositoryStmt::Read(row, 148, e.proclevel);
+		RepositoryStmt::Read(row, 149, e.UNK142);
+		RepositoryStmt::Read(row, 150, e.worneffect);
+		RepositoryStmt::Read(row, 151, e.worntype);
+		RepositoryStmt::Read(row, 152, e.wornlevel2);
+		RepositoryStmt::Read(row, 153, e.wornlevel);
+		RepositoryStmt::Read(row, 154, e.UNK147);
+		RepositoryStmt::Read(row, 155, e.focustype);
+		RepositoryStmt::Read(row, 156, e.focuslevel2);
+		RepositoryStmt::Read(row, 157, e.focuslevel);
+		RepositoryStmt::Read(row, 158, e.UNK152);
+		RepositoryStmt::Read(row, 159, e.scrolleffect);
+		RepositoryStmt::Read(row, 160, e.scrolltype);
+		RepositoryStmt::Read(row, 161, e.scrolllevel2);
+		RepositoryStmt::Read(row, 162, e.scrolllevel);
+		RepositoryStmt::Read(row, 163, e.UNK157);
+		RepositoryStmt::Read(row, 164, e.serialized);
+		RepositoryStmt::Read(row, 165, e.verified);
+		RepositoryStmt::Read(row, 166, e.serialization);
+		RepositoryStmt::Read(row, 167, e.source);
+		RepositoryStmt::Read(row, 168, e.UNK033);
+		RepositoryStmt::Read(row, 169, e.lorefile);
+		RepositoryStmt::Read(row, 170, e.UNK014);
+		RepositoryStmt::Read(row, 171, e.svcorruption);
+		RepositoryStmt::Read(row, 172, e.skillmodmax);
+		RepositoryStmt::Read(row, 173, e.UNK060);
+		RepositoryStmt::Read(row, 174, e.augslot1unk2);
+		RepositoryStmt::Read(row, 175, e.augslot2unk2);
+		RepositoryStmt::Read(row, 176, e.augslot3unk2);
+		RepositoryStmt::Read(row, 177, e.augslot4unk2);
+		RepositoryStmt::Read(row, 178, e.augslot5unk2);
+		RepositoryStmt::Read(row, 179, e.augslot6unk2);
+		RepositoryStmt::Read(row, 180, e.UNK120);
+		RepositoryStmt::Read(row, 181, e.UNK121);
+		RepositoryStmt::Read(row, 182, e.questitemflag);
+		RepositoryStmt::Read(row, 183, e.UNK132);
+		RepositoryStmt::Read(row, 184, e.clickunk5);
+		RepositoryStmt::Read(row, 185, e.clickunk6);
+		RepositoryStmt::Read(row, 186, e.clickunk7);
+		RepositoryStmt::Read(row, 187, e.procunk1);
+		RepositoryStmt::Read(row, 188, e.procunk2);
+		RepositoryStmt::Read(row, 189, e.procunk3);
+		RepositoryStmt::Read(row, 190, e.procunk4);
+		RepositoryStmt::Read(row, 191, e.procunk6);
+		RepositoryStmt::Read(row, 192, e.procunk7);
+		RepositoryStmt::Read(row, 193, e.wornunk1);
+		RepositoryStmt::Read(row, 194, e.wornunk2);
+		RepositoryStmt::Read(row, 195, e.wornunk3);
+		RepositoryStmt::Read(row, 196, e.wornunk4);
+		RepositoryStmt::Read(row, 197, e.wornunk5);
+		RepositoryStmt::Read(row, 198, e.wornunk6);
+		RepositoryStmt::Read(row, 199, e.wornunk7);
+		RepositoryStmt::Read(row, 200, e.focusunk1);
+		RepositoryStmt::Read(row, 201, e.focusunk2);
+		RepositoryStmt::Read(row, 202, e.focusunk3);
+		RepositoryStmt::Read(row, 203, e.focusunk4);
+		RepositoryStmt::Read(row, 204, e.focusunk5);
+		RepositoryStmt::Read(row, 205, e.focusunk6);
+		RepositoryStmt::Read(row, 206, e.focusunk7);
+		RepositoryStmt::Read(row, 207, e.scrollunk1);
+		RepositoryStmt::Read(row, 208, e.scrollunk2);
+		RepositoryStmt::Read(row, 209, e.scrollunk3);
+		RepositoryStmt::Read(row, 210, e.scrollunk4);
+		RepositoryStmt::Read(row, 211, e.scrollunk5);
+		RepositoryStmt::Read(row, 212, e.scrollunk6);
+		RepositoryStmt::Read(row, 213, e.scrollunk7);
+		RepositoryStmt::Read(row, 214, e.UNK193);
+		RepositoryStmt::Read(row, 215, e.purity);
+		RepositoryStmt::Read(row, 216, e.evoitem);
+		RepositoryStmt::Read(row, 217, e.evoid);
+		RepositoryStmt::Read(row, 218, e.evolvinglevel);
+		RepositoryStmt::Read(row, 219, e.evomax);
+		RepositoryStmt::Read(row, 220, e.clickname);
+		RepositoryStmt::Read(row, 221, e.procname);
+		RepositoryStmt::Read(row, 222, e.wornname);
+		RepositoryStmt::Read(row, 223, e.focusname);
+		RepositoryStmt::Read(row, 224, e.scrollname);
+		RepositoryStmt::Read(row, 225, e.dsmitigation);
+		RepositoryStmt::Read(row, 226, e.heroic_str);
+		RepositoryStmt::Read(row, 227, e.heroic_int);
+		RepositoryStmt::Read(row, 228, e.heroic_wis);
+		RepositoryStmt::Read(row, 229, e.heroic_agi);
+		RepositoryStmt::Read(row, 230, e.heroic_dex);
+		RepositoryStmt::Read(row, 231, e.heroic_sta);
+		RepositoryStmt::Read(row, 232, e.heroic_cha);
+		RepositoryStmt::Read(row, 233, e.heroic_pr);
+		RepositoryStmt::Read(row, 234, e.heroic_dr);
+		RepositoryStmt::Read(row, 235, e.heroic_fr);
+		RepositoryStmt::Read(row, 236, e.heroic_cr);
+		RepositoryStmt::Read(row, 237, e.heroic_mr);
+		RepositoryStmt::Read(row, 238, e.heroic_svcorrup);
+		RepositoryStmt::Read(row, 239, e.healamt);
+		RepositoryStmt::Read(row, 240, e.spelldmg);
+		RepositoryStmt::Read(row, 241, e.clairvoyance);
+		RepositoryStmt::Read(row, 242, e.backstabdmg);
+		RepositoryStmt::Read(row, 243, e.created);
+		RepositoryStmt::Read(row, 244, e.elitematerial);
+		RepositoryStmt::Read(row, 245, e.ldonsellbackrate);
+		RepositoryStmt::Read(row, 246, e.scriptfileid);
+		RepositoryStmt::Read(row, 247, e.expendablearrow);
+		RepositoryStmt::Read(row, 248, e.powersourcecapacity);
+		RepositoryStmt::Read(row, 249, e.bardeffect);
+		RepositoryStmt::Read(row, 250, e.bardeffecttype);
+		RepositoryStmt::Read(row, 251, e.bardlevel2);
+		RepositoryStmt::Read(row, 252, e.bardlevel);
+		RepositoryStmt::Read(row, 253, e.bardunk1);
+		RepositoryStmt::Read(row, 254, e.bardunk2);
+		RepositoryStmt::Read(row, 255, e.bardunk3);
+		RepositoryStmt::Read(row, 256, e.bardunk4);
+		RepositoryStmt::Read(row, 257, e.bardunk5);
+		RepositoryStmt::Read(row, 258, e.bardname);
+		RepositoryStmt::Read(row, 259, e.bardunk7);
+		RepositoryStmt::Read(row, 260, e.UNK214);
+		RepositoryStmt::Read(row, 261, e.subtype);
+		RepositoryStmt::Read(row, 262, e.UNK220);
+		RepositoryStmt::Read(row, 263, e.UNK221);
+		RepositoryStmt::Read(row, 264, e.heirloom);
+		RepositoryStmt::Read(row, 265, e.UNK223);
+		RepositoryStmt::Read(row, 266, e.UNK224);
+		RepositoryStmt::Read(row, 267, e.UNK225);
+		RepositoryStmt::Read(row, 268, e.UNK226);
+		RepositoryStmt::Read(row, 269, e.UNK227);
+		RepositoryStmt::Read(row, 270, e.UNK228);
+		RepositoryStmt::Read(row, 271, e.UNK229);
+		RepositoryStmt::Read(row, 272, e.UNK230);
+		RepositoryStmt::Read(row, 273, e.UNK231);
+		RepositoryStmt::Read(row, 274, e.UNK232);
+		RepositoryStmt::Read(row, 275, e.UNK233);
+		RepositoryStmt::Read(row, 276, e.UNK234);
+		RepositoryStmt::Read(row, 277, e.placeable);
+		RepositoryStmt::Read(row, 278, e.UNK236);
+		RepositoryStmt::Read(row, 279, e.UNK237);
+		RepositoryStmt::Read(row, 280, e.UNK238);
+		RepositoryStmt::Read(row, 281, e.UNK239);
+		RepositoryStmt::Read(row, 282, e.UNK240);
+		RepositoryStmt::Read(row, 283, e.UNK241);
+		RepositoryStmt::Read(row, 284, e.epicitem);
+	}
+
+	static Items FindOnePrepared(
+		Database& db,
+		int items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseItemsRepository>(db, items_id);
+	}
+
+	static std::vector<Items> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Items &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseItemsRepository>(db, e, e.id);
+	}
+
+	static Items InsertOnePrepared(
+		Database& db,
+		Items e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Items> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Items> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ITEMS_REPOSITORY_H
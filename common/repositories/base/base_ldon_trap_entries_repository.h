@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLdonTrapEntriesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LdonTrapEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.trap_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LdonTrapEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.trap_id);
+	}
+
+	static LdonTrapEntries FindOnePrepared(
+		Database& db,
+		int ldon_trap_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLdonTrapEntriesRepository>(db, ldon_trap_entries_id);
+	}
+
+	static std::vector<LdonTrapEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLdonTrapEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LdonTrapEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLdonTrapEntriesRepository>(db, e, e.id);
+	}
+
+	static LdonTrapEntries InsertOnePrepared(
+		Database& db,
+		LdonTrapEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLdonTrapEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LdonTrapEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLdonTrapEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LdonTrapEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLdonTrapEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LDON_TRAP_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLdonTrapTemplatesRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LdonTrapTemplates &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.skill);
+		v.emplace_back(e.locked);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LdonTrapTemplates &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.skill);
+		RepositoryStmt::Read(row, 4, e.locked);
+	}
+
+	static LdonTrapTemplates FindOnePrepared(
+		Database& db,
+		int ldon_trap_templates_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLdonTrapTemplatesRepository>(db, ldon_trap_templates_id);
+	}
+
+	static std::vector<LdonTrapTemplates> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLdonTrapTemplatesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LdonTrapTemplates &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLdonTrapTemplatesRepository>(db, e, e.id);
+	}
+
+	static LdonTrapTemplates InsertOnePrepared(
+		Database& db,
+		LdonTrapTemplates e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLdonTrapTemplatesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LdonTrapTemplates> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLdonTrapTemplatesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LdonTrapTemplates> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLdonTrapTemplatesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LDON_TRAP_TEMPLATES_REPOSITORY_H
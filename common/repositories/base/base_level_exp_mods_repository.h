@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLevelExpModsRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LevelExpMods &e
+	)
+	{
+		v.emplace_back(e.level);
+		v.emplace_back(e.exp_mod);
+		v.emplace_back(e.aa_exp_mod);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LevelExpMods &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.level);
+		RepositoryStmt::Read(row, 1, e.exp_mod);
+		RepositoryStmt::Read(row, 2, e.aa_exp_mod);
+	}
+
+	static LevelExpMods FindOnePrepared(
+		Database& db,
+		int level_exp_mods_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLevelExpModsRepository>(db, level_exp_mods_id);
+	}
+
+	static std::vector<LevelExpMods> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLevelExpModsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LevelExpMods &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLevelExpModsRepository>(db, e, e.level);
+	}
+
+	static LevelExpMods InsertOnePrepared(
+		Database& db,
+		LevelExpMods e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLevelExpModsRepository>(db, e);
+		if (id) {
+			e.level = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LevelExpMods> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLevelExpModsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LevelExpMods> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLevelExpModsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LEVEL_EXP_MODS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLfguildRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Lfguild &e
+	)
+	{
+		v.emplace_back(e.type);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.comment));
+		v.emplace_back(e.fromlevel);
+		v.emplace_back(e.tolevel);
+		v.emplace_back(e.classes);
+		v.emplace_back(e.aacount);
+		v.emplace_back(e.timezone);
+		v.emplace_back(e.timeposted);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Lfguild &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.type);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.comment);
+		RepositoryStmt::Read(row, 3, e.fromlevel);
+		RepositoryStmt::Read(row, 4, e.tolevel);
+		RepositoryStmt::Read(row, 5, e.classes);
+		RepositoryStmt::Read(row, 6, e.aacount);
+		RepositoryStmt::Read(row, 7, e.timezone);
+		RepositoryStmt::Read(row, 8, e.timeposted);
+	}
+
+	static Lfguild FindOnePrepared(
+		Database& db,
+		int lfguild_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLfguildRepository>(db, lfguild_id);
+	}
+
+	static std::vector<Lfguild> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLfguildRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Lfguild &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLfguildRepository>(db, e, e.type);
+	}
+
+	static Lfguild InsertOnePrepared(
+		Database& db,
+		Lfguild e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLfguildRepository>(db, e);
+		if (id) {
+			e.type = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Lfguild> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLfguildRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Lfguild> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLfguildRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LFGUILD_REPOSITORY_H
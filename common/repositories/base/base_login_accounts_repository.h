@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoginAccountsRepository {
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoginAccounts &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.account_name));
+		v.emplace_back(std::string_view(e.account_password));
+		v.emplace_back(std::string_view(e.account_email));
+		v.emplace_back(std::string_view(e.source_loginserver));
+		v.emplace_back(std::string_view(e.last_ip_address));
+		v.emplace_back(RepositoryStmt::DateTime(e.last_login_date));
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+		v.emplace_back(RepositoryStmt::DateTime(e.updated_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoginAccounts &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.account_name);
+		RepositoryStmt::Read(row, 2, e.account_password);
+		RepositoryStmt::Read(row, 3, e.account_email);
+		RepositoryStmt::Read(row, 4, e.source_loginserver);
+		RepositoryStmt::Read(row, 5, e.last_ip_address);
+		RepositoryStmt::Read(row, 6, e.last_login_date);
+		RepositoryStmt::Read(row, 7, e.created_at);
+		RepositoryStmt::Read(row, 8, e.updated_at);
+	}
+
+	static LoginAccounts FindOnePrepared(
+		Database& db,
+		int login_accounts_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoginAccountsRepository>(db, login_accounts_id);
+	}
+
+	static std::vector<LoginAccounts> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoginAccountsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoginAccounts &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoginAccountsRepository>(db, e, e.id);
+	}
+
+	static LoginAccounts InsertOnePrepared(
+		Database& db,
+		LoginAccounts e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoginAccountsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoginAccounts> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoginAccountsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoginAccounts> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoginAccountsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGIN_ACCOUNTS_REPOSITORY_H
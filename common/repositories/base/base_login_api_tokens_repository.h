@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoginApiTokensRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoginApiTokens &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.token));
+		v.emplace_back(e.can_write);
+		v.emplace_back(e.can_read);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+		v.emplace_back(RepositoryStmt::DateTime(e.updated_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoginApiTokens &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.token);
+		RepositoryStmt::Read(row, 2, e.can_write);
+		RepositoryStmt::Read(row, 3, e.can_read);
+		RepositoryStmt::Read(row, 4, e.created_at);
+		RepositoryStmt::Read(row, 5, e.updated_at);
+	}
+
+	static LoginApiTokens FindOnePrepared(
+		Database& db,
+		int login_api_tokens_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoginApiTokensRepository>(db, login_api_tokens_id);
+	}
+
+	static std::vector<LoginApiTokens> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoginApiTokensRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoginApiTokens &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoginApiTokensRepository>(db, e, e.id);
+	}
+
+	static LoginApiTokens InsertOnePrepared(
+		Database& db,
+		LoginApiTokens e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoginApiTokensRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoginApiTokens> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoginApiTokensRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoginApiTokens> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoginApiTokensRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGIN_API_TOKENS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoginServerAdminsRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoginServerAdmins &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.account_name));
+		v.emplace_back(std::string_view(e.account_password));
+		v.emplace_back(std::string_view(e.first_name));
+		v.emplace_back(std::string_view(e.last_name));
+		v.emplace_back(std::string_view(e.email));
+		v.emplace_back(RepositoryStmt::DateTime(e.registration_date));
+		v.emplace_back(std::string_view(e.registration_ip_address));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoginServerAdmins &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.account_name);
+		RepositoryStmt::Read(row, 2, e.account_password);
+		RepositoryStmt::Read(row, 3, e.first_name);
+		RepositoryStmt::Read(row, 4, e.last_name);
+		RepositoryStmt::Read(row, 5, e.email);
+		RepositoryStmt::Read(row, 6, e.registration_date);
+		RepositoryStmt::Read(row, 7, e.registration_ip_address);
+	}
+
+	static LoginServerAdmins FindOnePrepared(
+		Database& db,
+		int login_server_admins_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoginServerAdminsRepository>(db, login_server_admins_id);
+	}
+
+	static std::vector<LoginServerAdmins> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoginServerAdminsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoginServerAdmins &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoginServerAdminsRepository>(db, e, e.id);
+	}
+
+	static LoginServerAdmins InsertOnePrepared(
+		Database& db,
+		LoginServerAdmins e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoginServerAdminsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoginServerAdmins> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoginServerAdminsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoginServerAdmins> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoginServerAdminsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGIN_SERVER_ADMINS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoginServerListTypesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoginServerListTypes &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.description));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoginServerListTypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.description);
+	}
+
+	static LoginServerListTypes FindOnePrepared(
+		Database& db,
+		int login_server_list_types_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoginServerListTypesRepository>(db, login_server_list_types_id);
+	}
+
+	static std::vector<LoginServerListTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoginServerListTypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoginServerListTypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoginServerListTypesRepository>(db, e, e.id);
+	}
+
+	static LoginServerListTypes InsertOnePrepared(
+		Database& db,
+		LoginServerListTypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoginServerListTypesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoginServerListTypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoginServerListTypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoginServerListTypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoginServerListTypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGIN_SERVER_LIST_TYPES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoginWorldServersRepository {
@@ -482,6 +483,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoginWorldServers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.long_name));
+		v.emplace_back(std::string_view(e.short_name));
+		v.emplace_back(std::string_view(e.tag_description));
+		v.emplace_back(e.login_server_list_type_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.last_login_date));
+		v.emplace_back(std::string_view(e.last_ip_address));
+		v.emplace_back(e.login_server_admin_id);
+		v.emplace_back(e.is_server_trusted);
+		v.emplace_back(std::string_view(e.note));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoginWorldServers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.long_name);
+		RepositoryStmt::Read(row, 2, e.short_name);
+		RepositoryStmt::Read(row, 3, e.tag_description);
+		RepositoryStmt::Read(row, 4, e.login_server_list_type_id);
+		RepositoryStmt::Read(row, 5, e.last_login_date);
+		RepositoryStmt::Read(row, 6, e.last_ip_address);
+		RepositoryStmt::Read(row, 7, e.login_server_admin_id);
+		RepositoryStmt::Read(row, 8, e.is_server_trusted);
+		RepositoryStmt::Read(row, 9, e.note);
+	}
+
+	static LoginWorldServers FindOnePrepared(
+		Database& db,
+		int login_world_servers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoginWorldServersRepository>(db, login_world_servers_id);
+	}
+
+	static std::vector<LoginWorldServers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoginWorldServersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoginWorldServers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoginWorldServersRepository>(db, e, e.id);
+	}
+
+	static LoginWorldServers InsertOnePrepared(
+		Database& db,
+		LoginWorldServers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoginWorldServersRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoginWorldServers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoginWorldServersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoginWorldServers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoginWorldServersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGIN_WORLD_SERVERS_REPOSITORY_H
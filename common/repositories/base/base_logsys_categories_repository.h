@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLogsysCategoriesRepository {
@@ -447,6 +448,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LogsysCategories &e
+	)
+	{
+		v.emplace_back(e.log_category_id);
+		v.emplace_back(std::string_view(e.log_category_description));
+		v.emplace_back(e.log_to_console);
+		v.emplace_back(e.log_to_file);
+		v.emplace_back(e.log_to_gmsay);
+		v.emplace_back(e.log_to_discord);
+		v.emplace_back(e.discord_webhook_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LogsysCategories &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.log_category_id);
+		RepositoryStmt::Read(row, 1, e.log_category_description);
+		RepositoryStmt::Read(row, 2, e.log_to_console);
+		RepositoryStmt::Read(row, 3, e.log_to_file);
+		RepositoryStmt::Read(row, 4, e.log_to_gmsay);
+		RepositoryStmt::Read(row, 5, e.log_to_discord);
+		RepositoryStmt::Read(row, 6, e.discord_webhook_id);
+	}
+
+	static LogsysCategories FindOnePrepared(
+		Database& db,
+		int logsys_categories_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLogsysCategoriesRepository>(db, logsys_categories_id);
+	}
+
+	static std::vector<LogsysCategories> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLogsysCategoriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LogsysCategories &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLogsysCategoriesRepository>(db, e, e.log_category_id);
+	}
+
+	static LogsysCategories InsertOnePrepared(
+		Database& db,
+		LogsysCategories e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLogsysCategoriesRepository>(db, e);
+		if (id) {
+			e.log_category_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LogsysCategories> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLogsysCategoriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LogsysCategories> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLogsysCategoriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOGSYS_CATEGORIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLootdropEntriesRepository {
@@ -543,6 +544,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LootdropEntries &e
+	)
+	{
+		v.emplace_back(e.lootdrop_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.item_charges);
+		v.emplace_back(e.equip_item);
+		v.emplace_back(e.chance);
+		v.emplace_back(e.disabled_chance);
+		v.emplace_back(e.trivial_min_level);
+		v.emplace_back(e.trivial_max_level);
+		v.emplace_back(e.multiplier);
+		v.emplace_back(e.npc_min_level);
+		v.emplace_back(e.npc_max_level);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LootdropEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.lootdrop_id);
+		RepositoryStmt::Read(row, 1, e.item_id);
+		RepositoryStmt::Read(row, 2, e.item_charges);
+		RepositoryStmt::Read(row, 3, e.equip_item);
+		RepositoryStmt::Read(row, 4, e.chance);
+		RepositoryStmt::Read(row, 5, e.disabled_chance);
+		RepositoryStmt::Read(row, 6, e.trivial_min_level);
+		RepositoryStmt::Read(row, 7, e.trivial_max_level);
+		RepositoryStmt::Read(row, 8, e.multiplier);
+		RepositoryStmt::Read(row, 9, e.npc_min_level);
+		RepositoryStmt::Read(row, 10, e.npc_max_level);
+		RepositoryStmt::Read(row, 11, e.min_expansion);
+		RepositoryStmt::Read(row, 12, e.max_expansion);
+		RepositoryStmt::Read(row, 13, e.content_flags);
+		RepositoryStmt::Read(row, 14, e.content_flags_disabled);
+	}
+
+	static LootdropEntries FindOnePrepared(
+		Database& db,
+		int lootdrop_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLootdropEntriesRepository>(db, lootdrop_entries_id);
+	}
+
+	static std::vector<LootdropEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLootdropEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LootdropEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLootdropEntriesRepository>(db, e, e.lootdrop_id);
+	}
+
+	static LootdropEntries InsertOnePrepared(
+		Database& db,
+		LootdropEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLootdropEntriesRepository>(db, e);
+		if (id) {
+			e.lootdrop_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LootdropEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLootdropEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LootdropEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLootdropEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOOTDROP_ENTRIES_REPOSITORY_H
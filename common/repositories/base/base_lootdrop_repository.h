@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLootdropRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Lootdrop &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Lootdrop &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.min_expansion);
+		RepositoryStmt::Read(row, 3, e.max_expansion);
+		RepositoryStmt::Read(row, 4, e.content_flags);
+		RepositoryStmt::Read(row, 5, e.content_flags_disabled);
+	}
+
+	static Lootdrop FindOnePrepared(
+		Database& db,
+		int lootdrop_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLootdropRepository>(db, lootdrop_id);
+	}
+
+	static std::vector<Lootdrop> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLootdropRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Lootdrop &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLootdropRepository>(db, e, e.id);
+	}
+
+	static Lootdrop InsertOnePrepared(
+		Database& db,
+		Lootdrop e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLootdropRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Lootdrop> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLootdropRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Lootdrop> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLootdropRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOOTDROP_REPOSITORY_H
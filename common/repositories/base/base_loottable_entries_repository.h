@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoottableEntriesRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const LoottableEntries &e
+	)
+	{
+		v.emplace_back(e.loottable_id);
+		v.emplace_back(e.lootdrop_id);
+		v.emplace_back(e.multiplier);
+		v.emplace_back(e.droplimit);
+		v.emplace_back(e.mindrop);
+		v.emplace_back(e.probability);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		LoottableEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.loottable_id);
+		RepositoryStmt::Read(row, 1, e.lootdrop_id);
+		RepositoryStmt::Read(row, 2, e.multiplier);
+		RepositoryStmt::Read(row, 3, e.droplimit);
+		RepositoryStmt::Read(row, 4, e.mindrop);
+		RepositoryStmt::Read(row, 5, e.probability);
+	}
+
+	static LoottableEntries FindOnePrepared(
+		Database& db,
+		int loottable_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoottableEntriesRepository>(db, loottable_entries_id);
+	}
+
+	static std::vector<LoottableEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoottableEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const LoottableEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoottableEntriesRepository>(db, e, e.loottable_id);
+	}
+
+	static LoottableEntries InsertOnePrepared(
+		Database& db,
+		LoottableEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoottableEntriesRepository>(db, e);
+		if (id) {
+			e.loottable_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<LoottableEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoottableEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<LoottableEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoottableEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOOTTABLE_ENTRIES_REPOSITORY_H
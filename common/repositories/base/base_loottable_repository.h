@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseLoottableRepository {
@@ -482,6 +483,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Loottable &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.mincash);
+		v.emplace_back(e.maxcash);
+		v.emplace_back(e.avgcoin);
+		v.emplace_back(e.done);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Loottable &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.mincash);
+		RepositoryStmt::Read(row, 3, e.maxcash);
+		RepositoryStmt::Read(row, 4, e.avgcoin);
+		RepositoryStmt::Read(row, 5, e.done);
+		RepositoryStmt::Read(row, 6, e.min_expansion);
+		RepositoryStmt::Read(row, 7, e.max_expansion);
+		RepositoryStmt::Read(row, 8, e.content_flags);
+		RepositoryStmt::Read(row, 9, e.content_flags_disabled);
+	}
+
+	static Loottable FindOnePrepared(
+		Database& db,
+		int loottable_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseLoottableRepository>(db, loottable_id);
+	}
+
+	static std::vector<Loottable> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseLoottableRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Loottable &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseLoottableRepository>(db, e, e.id);
+	}
+
+	static Loottable InsertOnePrepared(
+		Database& db,
+		Loottable e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseLoottableRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Loottable> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseLoottableRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Loottable> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseLoottableRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_LOOTTABLE_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseMailRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Mail &e
+	)
+	{
+		v.emplace_back(e.msgid);
+		v.emplace_back(e.charid);
+		v.emplace_back(e.timestamp);
+		v.emplace_back(std::string_view(e.from));
+		v.emplace_back(std::string_view(e.subject));
+		v.emplace_back(std::string_view(e.body));
+		v.emplace_back(std::string_view(e.to));
+		v.emplace_back(e.status);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Mail &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.msgid);
+		RepositoryStmt::Read(row, 1, e.charid);
+		RepositoryStmt::Read(row, 2, e.timestamp);
+		RepositoryStmt::Read(row, 3, e.from);
+		RepositoryStmt::Read(row, 4, e.subject);
+		RepositoryStmt::Read(row, 5, e.body);
+		RepositoryStmt::Read(row, 6, e.to);
+		RepositoryStmt::Read(row, 7, e.status);
+	}
+
+	static Mail FindOnePrepared(
+		Database& db,
+		int mail_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMailRepository>(db, mail_id);
+	}
+
+	static std::vector<Mail> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMailRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Mail &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMailRepository>(db, e, e.msgid);
+	}
+
+	static Mail InsertOnePrepared(
+		Database& db,
+		Mail e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMailRepository>(db, e);
+		if (id) {
+			e.msgid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Mail> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMailRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Mail> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMailRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MAIL_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -483,6 +484,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercArmorinfo &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.merc_npc_type_id);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.texture);
+		v.emplace_back(e.helmtexture);
+		v.emplace_back(e.armortint_id);
+		v.emplace_back(e.armortint_red);
+		v.emplace_back(e.armortint_green);
+		v.emplace_back(e.armortint_blue);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercArmorinfo &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.merc_npc_type_id);
+		RepositoryStmt::Read(row, 2, e.minlevel);
+		RepositoryStmt::Read(row, 3, e.maxlevel);
+		RepositoryStmt::Read(row, 4, e.texture);
+		RepositoryStmt::Read(row, 5, e.helmtexture);
+		RepositoryStmt::Read(row, 6, e.armortint_id);
+		RepositoryStmt::Read(row, 7, e.armortint_red);
+		RepositoryStmt::Read(row, 8, e.armortint_green);
+		RepositoryStmt::Read(row, 9, e.armortint_blue);
+	}
+
+	static MercArmorinfo FindOnePrepared(
+		Database& db,
+		int merc_armorinfo_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercArmorinfoRepository>(db, merc_armorinfo_id);
+	}
+
+	static std::vector<MercArmorinfo> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercArmorinfoRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercArmorinfo &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercArmorinfoRepository>(db, e, e.id);
+	}
+
+	static MercArmorinfo InsertOnePrepared(
+		Database& db,
+		MercArmorinfo e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercArmorinfoRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercArmorinfo> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercArmorinfoRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercArmorinfo> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercArmorinfoRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_ARMORINFO_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseMercBuffsRepository {
@@ -590,6 +591,115 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercBuffs &e
+	)
+	{
+		v.emplace_back(e.MercBuffId);
+		v.emplace_back(e.MercId);
+		v.emplace_back(e.SpellId);
+		v.emplace_back(e.CasterLevel);
+		v.emplace_back(e.DurationFormula);
+		v.emplace_back(e.TicsRemaining);
+		v.emplace_back(e.PoisonCounters);
+		v.emplace_back(e.DiseaseCounters);
+		v.emplace_back(e.CurseCounters);
+		v.emplace_back(e.CorruptionCounters);
+		v.emplace_back(e.HitCount);
+		v.emplace_back(e.MeleeRune);
+		v.emplace_back(e.MagicRune);
+		v.emplace_back(e.dot_rune);
+		v.emplace_back(e.caston_x);
+		v.emplace_back(e.Persistent);
+		v.emplace_back(e.caston_y);
+		v.emplace_back(e.caston_z);
+		v.emplace_back(e.ExtraDIChance);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercBuffs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.MercBuffId);
+		RepositoryStmt::Read(row, 1, e.MercId);
+		RepositoryStmt::Read(row, 2, e.SpellId);
+		RepositoryStmt::Read(row, 3, e.CasterLevel);
+		RepositoryStmt::Read(row, 4, e.DurationFormula);
+		RepositoryStmt::Read(row, 5, e.TicsRemaining);
+		RepositoryStmt::Read(row, 6, e.PoisonCounters);
+		RepositoryStmt::Read(row, 7, e.DiseaseCounters);
+		RepositoryStmt::Read(row, 8, e.CurseCounters);
+		RepositoryStmt::Read(row, 9, e.CorruptionCounters);
+		RepositoryStmt::Read(row, 10, e.HitCount);
+		RepositoryStmt::Read(row, 11, e.MeleeRune);
+		RepositoryStmt::Read(row, 12, e.MagicRune);
+		RepositoryStmt::Read(row, 13, e.dot_rune);
+		RepositoryStmt::Read(row, 14, e.caston_x);
+		RepositoryStmt::Read(row, 15, e.Persistent);
+		RepositoryStmt::Read(row, 16, e.caston_y);
+		RepositoryStmt::Read(row, 17, e.caston_z);
+		RepositoryStmt::Read(row, 18, e.ExtraDIChance);
+	}
+
+	static MercBuffs FindOnePrepared(
+		Database& db,
+		int merc_buffs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercBuffsRepository>(db, merc_buffs_id);
+	}
+
+	static std::vector<MercBuffs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercBuffsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercBuffs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercBuffsRepository>(db, e, e.MercBuffId);
+	}
+
+	static MercBuffs InsertOnePrepared(
+		Database& db,
+		MercBuffs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercBuffsRepository>(db, e);
+		if (id) {
+			e.MercBuffId = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercBuffs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercBuffsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercBuffs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercBuffsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_BUFFS_REPOSITORY_H
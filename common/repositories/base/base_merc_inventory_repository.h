@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercInventory &e
+	)
+	{
+		v.emplace_back(e.merc_inventory_id);
+		v.emplace_back(e.merc_subtype_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.min_level);
+		v.emplace_back(e.max_level);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercInventory &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_inventory_id);
+		RepositoryStmt::Read(row, 1, e.merc_subtype_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.min_level);
+		RepositoryStmt::Read(row, 4, e.max_level);
+	}
+
+	static MercInventory FindOnePrepared(
+		Database& db,
+		int merc_inventory_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercInventoryRepository>(db, merc_inventory_id);
+	}
+
+	static std::vector<MercInventory> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercInventoryRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercInventory &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercInventoryRepository>(db, e, e.merc_inventory_id);
+	}
+
+	static MercInventory InsertOnePrepared(
+		Database& db,
+		MercInventory e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercInventoryRepository>(db, e);
+		if (id) {
+			e.merc_inventory_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercInventory> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercInventoryRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercInventory> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercInventoryRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_INVENTORY_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercMerchantEntries &e
+	)
+	{
+		v.emplace_back(e.merc_merchant_entry_id);
+		v.emplace_back(e.merc_merchant_template_id);
+		v.emplace_back(e.merchant_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercMerchantEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_merchant_entry_id);
+		RepositoryStmt::Read(row, 1, e.merc_merchant_template_id);
+		RepositoryStmt::Read(row, 2, e.merchant_id);
+	}
+
+	static MercMerchantEntries FindOnePrepared(
+		Database& db,
+		int merc_merchant_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercMerchantEntriesRepository>(db, merc_merchant_entries_id);
+	}
+
+	static std::vector<MercMerchantEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercMerchantEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercMerchantEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercMerchantEntriesRepository>(db, e, e.merc_merchant_entry_id);
+	}
+
+	static MercMerchantEntries InsertOnePrepared(
+		Database& db,
+		MercMerchantEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercMerchantEntriesRepository>(db, e);
+		if (id) {
+			e.merc_merchant_entry_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercMerchantEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercMerchantEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_MERCHANT_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercMerchantTemplateEntries &e
+	)
+	{
+		v.emplace_back(e.merc_merchant_template_entry_id);
+		v.emplace_back(e.merc_merchant_template_id);
+		v.emplace_back(e.merc_template_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercMerchantTemplateEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_merchant_template_entry_id);
+		RepositoryStmt::Read(row, 1, e.merc_merchant_template_id);
+		RepositoryStmt::Read(row, 2, e.merc_template_id);
+	}
+
+	static MercMerchantTemplateEntries FindOnePrepared(
+		Database& db,
+		int merc_merchant_template_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercMerchantTemplateEntriesRepository>(db, merc_merchant_template_entries_id);
+	}
+
+	static std::vector<MercMerchantTemplateEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercMerchantTemplateEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercMerchantTemplateEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercMerchantTemplateEntriesRepository>(db, e, e.merc_merchant_template_entry_id);
+	}
+
+	static MercMerchantTemplateEntries InsertOnePrepared(
+		Database& db,
+		MercMerchantTemplateEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercMerchantTemplateEntriesRepository>(db, e);
+		if (id) {
+			e.merc_merchant_template_entry_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantTemplateEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercMerchantTemplateEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantTemplateEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercMerchantTemplateEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_MERCHANT_TEMPLATE_ENTRIES_REPOSITORY_H
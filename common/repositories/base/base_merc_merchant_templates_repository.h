@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercMerchantTemplates &e
+	)
+	{
+		v.emplace_back(e.merc_merchant_template_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.qglobal));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercMerchantTemplates &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_merchant_template_id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.qglobal);
+	}
+
+	static MercMerchantTemplates FindOnePrepared(
+		Database& db,
+		int merc_merchant_templates_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercMerchantTemplatesRepository>(db, merc_merchant_templates_id);
+	}
+
+	static std::vector<MercMerchantTemplates> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercMerchantTemplatesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercMerchantTemplates &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercMerchantTemplatesRepository>(db, e, e.merc_merchant_template_id);
+	}
+
+	static MercMerchantTemplates InsertOnePrepared(
+		Database& db,
+		MercMerchantTemplates e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercMerchantTemplatesRepository>(db, e);
+		if (id) {
+			e.merc_merchant_template_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantTemplates> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercMerchantTemplatesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercMerchantTemplates> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercMerchantTemplatesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_MERCHANT_TEMPLATES_REPOSITORY_H
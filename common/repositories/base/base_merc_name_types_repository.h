@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -412,6 +413,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercNameTypes &e
+	)
+	{
+		v.emplace_back(e.name_type_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(std::string_view(e.prefix));
+		v.emplace_back(std::string_view(e.suffix));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercNameTypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.name_type_id);
+		RepositoryStmt::Read(row, 1, e.class_id);
+		RepositoryStmt::Read(row, 2, e.prefix);
+		RepositoryStmt::Read(row, 3, e.suffix);
+	}
+
+	static MercNameTypes FindOnePrepared(
+		Database& db,
+		int merc_name_types_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercNameTypesRepository>(db, merc_name_types_id);
+	}
+
+	static std::vector<MercNameTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercNameTypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercNameTypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercNameTypesRepository>(db, e, e.name_type_id);
+	}
+
+	static MercNameTypes InsertOnePrepared(
+		Database& db,
+		MercNameTypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercNameTypesRepository>(db, e);
+		if (id) {
+			e.name_type_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercNameTypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercNameTypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercNameTypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercNameTypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_NAME_TYPES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercNpcTypes &e
+	)
+	{
+		v.emplace_back(e.merc_npc_type_id);
+		v.emplace_back(e.proficiency_id);
+		v.emplace_back(e.tier_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercNpcTypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_npc_type_id);
+		RepositoryStmt::Read(row, 1, e.proficiency_id);
+		RepositoryStmt::Read(row, 2, e.tier_id);
+		RepositoryStmt::Read(row, 3, e.class_id);
+		RepositoryStmt::Read(row, 4, e.name);
+	}
+
+	static MercNpcTypes FindOnePrepared(
+		Database& db,
+		int merc_npc_types_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercNpcTypesRepository>(db, merc_npc_types_id);
+	}
+
+	static std::vector<MercNpcTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercNpcTypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercNpcTypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercNpcTypesRepository>(db, e, e.merc_npc_type_id);
+	}
+
+	static MercNpcTypes InsertOnePrepared(
+		Database& db,
+		MercNpcTypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercNpcTypesRepository>(db, e);
+		if (id) {
+			e.merc_npc_type_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercNpcTypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercNpcTypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercNpcTypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercNpcTypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_NPC_TYPES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -471,6 +472,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercSpellListEntries &e
+	)
+	{
+		v.emplace_back(e.merc_spell_list_entry_id);
+		v.emplace_back(e.merc_spell_list_id);
+		v.emplace_back(e.spell_id);
+		v.emplace_back(e.spell_type);
+		v.emplace_back(e.stance_id);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.procChance);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercSpellListEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_spell_list_entry_id);
+		RepositoryStmt::Read(row, 1, e.merc_spell_list_id);
+		RepositoryStmt::Read(row, 2, e.spell_id);
+		RepositoryStmt::Read(row, 3, e.spell_type);
+		RepositoryStmt::Read(row, 4, e.stance_id);
+		RepositoryStmt::Read(row, 5, e.minlevel);
+		RepositoryStmt::Read(row, 6, e.maxlevel);
+		RepositoryStmt::Read(row, 7, e.slot);
+		RepositoryStmt::Read(row, 8, e.procChance);
+	}
+
+	static MercSpellListEntries FindOnePrepared(
+		Database& db,
+		int merc_spell_list_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercSpellListEntriesRepository>(db, merc_spell_list_entries_id);
+	}
+
+	static std::vector<MercSpellListEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercSpellListEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercSpellListEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercSpellListEntriesRepository>(db, e, e.merc_spell_list_entry_id);
+	}
+
+	static MercSpellListEntries InsertOnePrepared(
+		Database& db,
+		MercSpellListEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercSpellListEntriesRepository>(db, e);
+		if (id) {
+			e.merc_spell_list_entry_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercSpellListEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercSpellListEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercSpellListEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercSpellListEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_SPELL_LIST_ENTRIES_REPOSITORY_H
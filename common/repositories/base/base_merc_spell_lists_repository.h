@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercSpellLists &e
+	)
+	{
+		v.emplace_back(e.merc_spell_list_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(e.proficiency_id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercSpellLists &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_spell_list_id);
+		RepositoryStmt::Read(row, 1, e.class_id);
+		RepositoryStmt::Read(row, 2, e.proficiency_id);
+		RepositoryStmt::Read(row, 3, e.name);
+	}
+
+	static MercSpellLists FindOnePrepared(
+		Database& db,
+		int merc_spell_lists_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercSpellListsRepository>(db, merc_spell_lists_id);
+	}
+
+	static std::vector<MercSpellLists> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercSpellListsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercSpellLists &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercSpellListsRepository>(db, e, e.merc_spell_list_id);
+	}
+
+	static MercSpellLists InsertOnePrepared(
+		Database& db,
+		MercSpellLists e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercSpellListsRepository>(db, e);
+		if (id) {
+			e.merc_spell_list_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercSpellLists> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercSpellListsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercSpellLists> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercSpellListsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_SPELL_LISTS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercStanceEntries &e
+	)
+	{
+		v.emplace_back(e.merc_stance_entry_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(e.proficiency_id);
+		v.emplace_back(e.stance_id);
+		v.emplace_back(e.isdefault);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercStanceEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_stance_entry_id);
+		RepositoryStmt::Read(row, 1, e.class_id);
+		RepositoryStmt::Read(row, 2, e.proficiency_id);
+		RepositoryStmt::Read(row, 3, e.stance_id);
+		RepositoryStmt::Read(row, 4, e.isdefault);
+	}
+
+	static MercStanceEntries FindOnePrepared(
+		Database& db,
+		int merc_stance_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercStanceEntriesRepository>(db, merc_stance_entries_id);
+	}
+
+	static std::vector<MercStanceEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercStanceEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercStanceEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercStanceEntriesRepository>(db, e, e.merc_stance_entry_id);
+	}
+
+	static MercStanceEntries InsertOnePrepared(
+		Database& db,
+		MercStanceEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercStanceEntriesRepository>(db, e);
+		if (id) {
+			e.merc_stance_entry_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercStanceEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercStanceEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercStanceEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercStanceEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_STANCE_ENTRIES_REPOSITORY_H
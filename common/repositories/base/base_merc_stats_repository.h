@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -760,6 +761,143 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercStats &e
+	)
+	{
+		v.emplace_back(e.merc_npc_type_id);
+		v.emplace_back(e.clientlevel);
+		v.emplace_back(e.level);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.AC);
+		v.emplace_back(e.ATK);
+		v.emplace_back(e.STR);
+		v.emplace_back(e.STA);
+		v.emplace_back(e.DEX);
+		v.emplace_back(e.AGI);
+		v.emplace_back(e._INT);
+		v.emplace_back(e.WIS);
+		v.emplace_back(e.CHA);
+		v.emplace_back(e.MR);
+		v.emplace_back(e.CR);
+		v.emplace_back(e.DR);
+		v.emplace_back(e.FR);
+		v.emplace_back(e.PR);
+		v.emplace_back(e.Corrup);
+		v.emplace_back(e.mindmg);
+		v.emplace_back(e.maxdmg);
+		v.emplace_back(e.attack_count);
+		v.emplace_back(e.attack_speed);
+		v.emplace_back(e.attack_delay);
+		v.emplace_back(std::string_view(e.special_abilities));
+		v.emplace_back(e.Accuracy);
+		v.emplace_back(e.hp_regen_rate);
+		v.emplace_back(e.mana_regen_rate);
+		v.emplace_back(e.runspeed);
+		v.emplace_back(e.statscale);
+		v.emplace_back(e.spellscale);
+		v.emplace_back(e.healscale);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercStats &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_npc_type_id);
+		RepositoryStmt::Read(row, 1, e.clientlevel);
+		RepositoryStmt::Read(row, 2, e.level);
+		RepositoryStmt::Read(row, 3, e.hp);
+		RepositoryStmt::Read(row, 4, e.mana);
+		RepositoryStmt::Read(row, 5, e.AC);
+		RepositoryStmt::Read(row, 6, e.ATK);
+		RepositoryStmt::Read(row, 7, e.STR);
+		RepositoryStmt::Read(row, 8, e.STA);
+		RepositoryStmt::Read(row, 9, e.DEX);
+		RepositoryStmt::Read(row, 10, e.AGI);
+		RepositoryStmt::Read(row, 11, e._INT);
+		RepositoryStmt::Read(row, 12, e.WIS);
+		RepositoryStmt::Read(row, 13, e.CHA);
+		RepositoryStmt::Read(row, 14, e.MR);
+		RepositoryStmt::Read(row, 15, e.CR);
+		RepositoryStmt::Read(row, 16, e.DR);
+		RepositoryStmt::Read(row, 17, e.FR);
+		RepositoryStmt::Read(row, 18, e.PR);
+		RepositoryStmt::Read(row, 19, e.Corrup);
+		RepositoryStmt::Read(row, 20, e.mindmg);
+		RepositoryStmt::Read(row, 21, e.maxdmg);
+		RepositoryStmt::Read(row, 22, e.attack_count);
+		RepositoryStmt::Read(row, 23, e.attack_speed);
+		RepositoryStmt::Read(row, 24, e.attack_delay);
+		RepositoryStmt::Read(row, 25, e.special_abilities);
+		RepositoryStmt::Read(row, 26, e.Accuracy);
+		RepositoryStmt::Read(row, 27, e.hp_regen_rate);
+		RepositoryStmt::Read(row, 28, e.mana_regen_rate);
+		RepositoryStmt::Read(row, 29, e.runspeed);
+		RepositoryStmt::Read(row, 30, e.statscale);
+		RepositoryStmt::Read(row, 31, e.spellscale);
+		RepositoryStmt::Read(row, 32, e.healscale);
+	}
+
+	static MercStats FindOnePrepared(
+		Database& db,
+		int merc_stats_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercStatsRepository>(db, merc_stats_id);
+	}
+
+	static std::vector<MercStats> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercStatsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercStats &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercStatsRepository>(db, e, e.merc_npc_type_id);
+	}
+
+	static MercStats InsertOnePrepared(
+		Database& db,
+		MercStats e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercStatsRepository>(db, e);
+		if (id) {
+			e.merc_npc_type_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercStats> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercStatsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercStats> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercStatsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_STATS_REPOSITORY_H
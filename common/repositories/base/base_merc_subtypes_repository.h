@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercSubtypes &e
+	)
+	{
+		v.emplace_back(e.merc_subtype_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(e.tier_id);
+		v.emplace_back(e.confidence_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercSubtypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_subtype_id);
+		RepositoryStmt::Read(row, 1, e.class_id);
+		RepositoryStmt::Read(row, 2, e.tier_id);
+		RepositoryStmt::Read(row, 3, e.confidence_id);
+	}
+
+	static MercSubtypes FindOnePrepared(
+		Database& db,
+		int merc_subtypes_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercSubtypesRepository>(db, merc_subtypes_id);
+	}
+
+	static std::vector<MercSubtypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercSubtypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercSubtypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercSubtypesRepository>(db, e, e.merc_subtype_id);
+	}
+
+	static MercSubtypes InsertOnePrepared(
+		Database& db,
+		MercSubtypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercSubtypesRepository>(db, e);
+		if (id) {
+			e.merc_subtype_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercSubtypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercSubtypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercSubtypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercSubtypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_SUBTYPES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -447,6 +448,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercTemplates &e
+	)
+	{
+		v.emplace_back(e.merc_template_id);
+		v.emplace_back(e.merc_type_id);
+		v.emplace_back(e.merc_subtype_id);
+		v.emplace_back(e.merc_npc_type_id);
+		v.emplace_back(std::string_view(e.dbstring));
+		v.emplace_back(e.name_type_id);
+		v.emplace_back(e.clientversion);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercTemplates &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_template_id);
+		RepositoryStmt::Read(row, 1, e.merc_type_id);
+		RepositoryStmt::Read(row, 2, e.merc_subtype_id);
+		RepositoryStmt::Read(row, 3, e.merc_npc_type_id);
+		RepositoryStmt::Read(row, 4, e.dbstring);
+		RepositoryStmt::Read(row, 5, e.name_type_id);
+		RepositoryStmt::Read(row, 6, e.clientversion);
+	}
+
+	static MercTemplates FindOnePrepared(
+		Database& db,
+		int merc_templates_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercTemplatesRepository>(db, merc_templates_id);
+	}
+
+	static std::vector<MercTemplates> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercTemplatesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercTemplates &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercTemplatesRepository>(db, e, e.merc_template_id);
+	}
+
+	static MercTemplates InsertOnePrepared(
+		Database& db,
+		MercTemplates e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercTemplatesRepository>(db, e);
+		if (id) {
+			e.merc_template_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercTemplates> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercTemplatesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercTemplates> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercTemplatesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_TEMPLATES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercTypes &e
+	)
+	{
+		v.emplace_back(e.merc_type_id);
+		v.emplace_back(e.race_id);
+		v.emplace_back(e.proficiency_id);
+		v.emplace_back(std::string_view(e.dbstring));
+		v.emplace_back(e.clientversion);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercTypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merc_type_id);
+		RepositoryStmt::Read(row, 1, e.race_id);
+		RepositoryStmt::Read(row, 2, e.proficiency_id);
+		RepositoryStmt::Read(row, 3, e.dbstring);
+		RepositoryStmt::Read(row, 4, e.clientversion);
+	}
+
+	static MercTypes FindOnePrepared(
+		Database& db,
+		int merc_types_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercTypesRepository>(db, merc_types_id);
+	}
+
+	static std::vector<MercTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercTypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercTypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercTypesRepository>(db, e, e.merc_type_id);
+	}
+
+	static MercTypes InsertOnePrepared(
+		Database& db,
+		MercTypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercTypesRepository>(db, e);
+		if (id) {
+			e.merc_type_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercTypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercTypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercTypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercTypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_TYPES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 
@@ -459,6 +460,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MercWeaponinfo &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.merc_npc_type_id);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.d_melee_texture1);
+		v.emplace_back(e.d_melee_texture2);
+		v.emplace_back(e.prim_melee_type);
+		v.emplace_back(e.sec_melee_type);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MercWeaponinfo &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.merc_npc_type_id);
+		RepositoryStmt::Read(row, 2, e.minlevel);
+		RepositoryStmt::Read(row, 3, e.maxlevel);
+		RepositoryStmt::Read(row, 4, e.d_melee_texture1);
+		RepositoryStmt::Read(row, 5, e.d_melee_texture2);
+		RepositoryStmt::Read(row, 6, e.prim_melee_type);
+		RepositoryStmt::Read(row, 7, e.sec_melee_type);
+	}
+
+	static MercWeaponinfo FindOnePrepared(
+		Database& db,
+		int merc_weaponinfo_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercWeaponinfoRepository>(db, merc_weaponinfo_id);
+	}
+
+	static std::vector<MercWeaponinfo> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercWeaponinfoRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MercWeaponinfo &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercWeaponinfoRepository>(db, e, e.id);
+	}
+
+	static MercWeaponinfo InsertOnePrepared(
+		Database& db,
+		MercWeaponinfo e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercWeaponinfoRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MercWeaponinfo> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercWeaponinfoRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MercWeaponinfo> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercWeaponinfoRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERC_WEAPONINFO_REPOSITORY_H
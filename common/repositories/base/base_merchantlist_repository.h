@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseMerchantlistRepository {
@@ -567,6 +568,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Merchantlist &e
+	)
+	{
+		v.emplace_back(e.merchantid);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.item);
+		v.emplace_back(e.faction_required);
+		v.emplace_back(e.level_required);
+		v.emplace_back(e.min_status);
+		v.emplace_back(e.max_status);
+		v.emplace_back(e.alt_currency_cost);
+		v.emplace_back(e.classes_required);
+		v.emplace_back(e.probability);
+		v.emplace_back(std::string_view(e.bucket_name));
+		v.emplace_back(std::string_view(e.bucket_value));
+		v.emplace_back(e.bucket_comparison);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Merchantlist &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.merchantid);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.item);
+		RepositoryStmt::Read(row, 3, e.faction_required);
+		RepositoryStmt::Read(row, 4, e.level_required);
+		RepositoryStmt::Read(row, 5, e.min_status);
+		RepositoryStmt::Read(row, 6, e.max_status);
+		RepositoryStmt::Read(row, 7, e.alt_currency_cost);
+		RepositoryStmt::Read(row, 8, e.classes_required);
+		RepositoryStmt::Read(row, 9, e.probability);
+		RepositoryStmt::Read(row, 10, e.bucket_name);
+		RepositoryStmt::Read(row, 11, e.bucket_value);
+		RepositoryStmt::Read(row, 12, e.bucket_comparison);
+		RepositoryStmt::Read(row, 13, e.min_expansion);
+		RepositoryStmt::Read(row, 14, e.max_expansion);
+		RepositoryStmt::Read(row, 15, e.content_flags);
+		RepositoryStmt::Read(row, 16, e.content_flags_disabled);
+	}
+
+	static Merchantlist FindOnePrepared(
+		Database& db,
+		int merchantlist_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMerchantlistRepository>(db, merchantlist_id);
+	}
+
+	static std::vector<Merchantlist> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMerchantlistRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Merchantlist &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMerchantlistRepository>(db, e, e.merchantid);
+	}
+
+	static Merchantlist InsertOnePrepared(
+		Database& db,
+		Merchantlist e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMerchantlistRepository>(db, e);
+		if (id) {
+			e.merchantid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Merchantlist> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMerchantlistRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Merchantlist> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMerchantlistRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERCHANTLIST_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseMerchantlistTempRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const MerchantlistTemp &e
+	)
+	{
+		v.emplace_back(e.npcid);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.itemid);
+		v.emplace_back(e.charges);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		MerchantlistTemp &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.npcid);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.zone_id);
+		RepositoryStmt::Read(row, 3, e.instance_id);
+		RepositoryStmt::Read(row, 4, e.itemid);
+		RepositoryStmt::Read(row, 5, e.charges);
+	}
+
+	static MerchantlistTemp FindOnePrepared(
+		Database& db,
+		int merchantlist_temp_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMerchantlistTempRepository>(db, merchantlist_temp_id);
+	}
+
+	static std::vector<MerchantlistTemp> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMerchantlistTempRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const MerchantlistTemp &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMerchantlistTempRepository>(db, e, e.npcid);
+	}
+
+	static MerchantlistTemp InsertOnePrepared(
+		Database& db,
+		MerchantlistTemp e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMerchantlistTempRepository>(db, e);
+		if (id) {
+			e.npcid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<MerchantlistTemp> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMerchantlistTempRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<MerchantlistTemp> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMerchantlistTempRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERCHANTLIST_TEMP_REPOSITORY_H
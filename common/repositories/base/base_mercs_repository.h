@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseMercsRepository {
@@ -650,6 +651,125 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Mercs &e
+	)
+	{
+		v.emplace_back(e.MercID);
+		v.emplace_back(e.OwnerCharacterID);
+		v.emplace_back(e.Slot);
+		v.emplace_back(std::string_view(e.Name));
+		v.emplace_back(e.TemplateID);
+		v.emplace_back(e.SuspendedTime);
+		v.emplace_back(e.IsSuspended);
+		v.emplace_back(e.TimerRemaining);
+		v.emplace_back(e.Gender);
+		v.emplace_back(e.MercSize);
+		v.emplace_back(e.StanceID);
+		v.emplace_back(e.HP);
+		v.emplace_back(e.Mana);
+		v.emplace_back(e.Endurance);
+		v.emplace_back(e.Face);
+		v.emplace_back(e.LuclinHairStyle);
+		v.emplace_back(e.LuclinHairColor);
+		v.emplace_back(e.LuclinEyeColor);
+		v.emplace_back(e.LuclinEyeColor2);
+		v.emplace_back(e.LuclinBeardColor);
+		v.emplace_back(e.LuclinBeard);
+		v.emplace_back(e.DrakkinHeritage);
+		v.emplace_back(e.DrakkinTattoo);
+		v.emplace_back(e.DrakkinDetails);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Mercs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.MercID);
+		RepositoryStmt::Read(row, 1, e.OwnerCharacterID);
+		RepositoryStmt::Read(row, 2, e.Slot);
+		RepositoryStmt::Read(row, 3, e.Name);
+		RepositoryStmt::Read(row, 4, e.TemplateID);
+		RepositoryStmt::Read(row, 5, e.SuspendedTime);
+		RepositoryStmt::Read(row, 6, e.IsSuspended);
+		RepositoryStmt::Read(row, 7, e.TimerRemaining);
+		RepositoryStmt::Read(row, 8, e.Gender);
+		RepositoryStmt::Read(row, 9, e.MercSize);
+		RepositoryStmt::Read(row, 10, e.StanceID);
+		RepositoryStmt::Read(row, 11, e.HP);
+		RepositoryStmt::Read(row, 12, e.Mana);
+		RepositoryStmt::Read(row, 13, e.Endurance);
+		RepositoryStmt::Read(row, 14, e.Face);
+		RepositoryStmt::Read(row, 15, e.LuclinHairStyle);
+		RepositoryStmt::Read(row, 16, e.LuclinHairColor);
+		RepositoryStmt::Read(row, 17, e.LuclinEyeColor);
+		RepositoryStmt::Read(row, 18, e.LuclinEyeColor2);
+		RepositoryStmt::Read(row, 19, e.LuclinBeardColor);
+		RepositoryStmt::Read(row, 20, e.LuclinBeard);
+		RepositoryStmt::Read(row, 21, e.DrakkinHeritage);
+		RepositoryStmt::Read(row, 22, e.DrakkinTattoo);
+		RepositoryStmt::Read(row, 23, e.DrakkinDetails);
+	}
+
+	static Mercs FindOnePrepared(
+		Database& db,
+		int mercs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseMercsRepository>(db, mercs_id);
+	}
+
+	static std::vector<Mercs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseMercsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Mercs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseMercsRepository>(db, e, e.MercID);
+	}
+
+	static Mercs InsertOnePrepared(
+		Database& db,
+		Mercs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseMercsRepository>(db, e);
+		if (id) {
+			e.MercID = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Mercs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseMercsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Mercs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseMercsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_MERCS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNameFilterRepository {
@@ -386,6 +387,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NameFilter &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NameFilter &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+	}
+
+	static NameFilter FindOnePrepared(
+		Database& db,
+		int name_filter_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNameFilterRepository>(db, name_filter_id);
+	}
+
+	static std::vector<NameFilter> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNameFilterRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NameFilter &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNameFilterRepository>(db, e, e.id);
+	}
+
+	static NameFilter InsertOnePrepared(
+		Database& db,
+		NameFilter e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNameFilterRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NameFilter> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNameFilterRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NameFilter> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNameFilterRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NAME_FILTER_REPOSITORY_H
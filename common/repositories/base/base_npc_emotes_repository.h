@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcEmotesRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcEmotes &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.emoteid);
+		v.emplace_back(e.event_);
+		v.emplace_back(e.type);
+		v.emplace_back(std::string_view(e.text));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcEmotes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.emoteid);
+		RepositoryStmt::Read(row, 2, e.event_);
+		RepositoryStmt::Read(row, 3, e.type);
+		RepositoryStmt::Read(row, 4, e.text);
+	}
+
+	static NpcEmotes FindOnePrepared(
+		Database& db,
+		int npc_emotes_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcEmotesRepository>(db, npc_emotes_id);
+	}
+
+	static std::vector<NpcEmotes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcEmotesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcEmotes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcEmotesRepository>(db, e, e.id);
+	}
+
+	static NpcEmotes InsertOnePrepared(
+		Database& db,
+		NpcEmotes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcEmotesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcEmotes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcEmotesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcEmotes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcEmotesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_EMOTES_REPOSITORY_H
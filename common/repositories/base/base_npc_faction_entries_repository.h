@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcFactionEntriesRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcFactionEntries &e
+	)
+	{
+		v.emplace_back(e.npc_faction_id);
+		v.emplace_back(e.faction_id);
+		v.emplace_back(e.value);
+		v.emplace_back(e.npc_value);
+		v.emplace_back(e.temp);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcFactionEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.npc_faction_id);
+		RepositoryStmt::Read(row, 1, e.faction_id);
+		RepositoryStmt::Read(row, 2, e.value);
+		RepositoryStmt::Read(row, 3, e.npc_value);
+		RepositoryStmt::Read(row, 4, e.temp);
+	}
+
+	static NpcFactionEntries FindOnePrepared(
+		Database& db,
+		int npc_faction_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcFactionEntriesRepository>(db, npc_faction_entries_id);
+	}
+
+	static std::vector<NpcFactionEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcFactionEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcFactionEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcFactionEntriesRepository>(db, e, e.npc_faction_id);
+	}
+
+	static NpcFactionEntries InsertOnePrepared(
+		Database& db,
+		NpcFactionEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcFactionEntriesRepository>(db, e);
+		if (id) {
+			e.npc_faction_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcFactionEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcFactionEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcFactionEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcFactionEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_FACTION_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcFactionRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcFaction &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.primaryfaction);
+		v.emplace_back(e.ignore_primary_assist);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcFaction &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.primaryfaction);
+		RepositoryStmt::Read(row, 3, e.ignore_primary_assist);
+	}
+
+	static NpcFaction FindOnePrepared(
+		Database& db,
+		int npc_faction_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcFactionRepository>(db, npc_faction_id);
+	}
+
+	static std::vector<NpcFaction> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcFactionRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcFaction &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcFactionRepository>(db, e, e.id);
+	}
+
+	static NpcFaction InsertOnePrepared(
+		Database& db,
+		NpcFaction e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcFactionRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcFaction> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcFactionRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcFaction> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcFactionRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_FACTION_REPOSITORY_H
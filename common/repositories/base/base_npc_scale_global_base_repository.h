@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcScaleGlobalBaseRepository {
@@ -759,6 +760,143 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcScaleGlobalBase &e
+	)
+	{
+		v.emplace_back(e.type);
+		v.emplace_back(e.level);
+		v.emplace_back(std::string_view(e.zone_id_list));
+		v.emplace_back(std::string_view(e.instance_version_list));
+		v.emplace_back(e.ac);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.accuracy);
+		v.emplace_back(e.slow_mitigation);
+		v.emplace_back(e.attack);
+		v.emplace_back(e.strength);
+		v.emplace_back(e.stamina);
+		v.emplace_back(e.dexterity);
+		v.emplace_back(e.agility);
+		v.emplace_back(e.intelligence);
+		v.emplace_back(e.wisdom);
+		v.emplace_back(e.charisma);
+		v.emplace_back(e.magic_resist);
+		v.emplace_back(e.cold_resist);
+		v.emplace_back(e.fire_resist);
+		v.emplace_back(e.poison_resist);
+		v.emplace_back(e.disease_resist);
+		v.emplace_back(e.corruption_resist);
+		v.emplace_back(e.physical_resist);
+		v.emplace_back(e.min_dmg);
+		v.emplace_back(e.max_dmg);
+		v.emplace_back(e.hp_regen_rate);
+		v.emplace_back(e.hp_regen_per_second);
+		v.emplace_back(e.attack_delay);
+		v.emplace_back(e.spell_scale);
+		v.emplace_back(e.heal_scale);
+		v.emplace_back(e.avoidance);
+		v.emplace_back(e.heroic_strikethrough);
+		v.emplace_back(std::string_view(e.special_abilities));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcScaleGlobalBase &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.type);
+		RepositoryStmt::Read(row, 1, e.level);
+		RepositoryStmt::Read(row, 2, e.zone_id_list);
+		RepositoryStmt::Read(row, 3, e.instance_version_list);
+		RepositoryStmt::Read(row, 4, e.ac);
+		RepositoryStmt::Read(row, 5, e.hp);
+		RepositoryStmt::Read(row, 6, e.accuracy);
+		RepositoryStmt::Read(row, 7, e.slow_mitigation);
+		RepositoryStmt::Read(row, 8, e.attack);
+		RepositoryStmt::Read(row, 9, e.strength);
+		RepositoryStmt::Read(row, 10, e.stamina);
+		RepositoryStmt::Read(row, 11, e.dexterity);
+		RepositoryStmt::Read(row, 12, e.agility);
+		RepositoryStmt::Read(row, 13, e.intelligence);
+		RepositoryStmt::Read(row, 14, e.wisdom);
+		RepositoryStmt::Read(row, 15, e.charisma);
+		RepositoryStmt::Read(row, 16, e.magic_resist);
+		RepositoryStmt::Read(row, 17, e.cold_resist);
+		RepositoryStmt::Read(row, 18, e.fire_resist);
+		RepositoryStmt::Read(row, 19, e.poison_resist);
+		RepositoryStmt::Read(row, 20, e.disease_resist);
+		RepositoryStmt::Read(row, 21, e.corruption_resist);
+		RepositoryStmt::Read(row, 22, e.physical_resist);
+		RepositoryStmt::Read(row, 23, e.min_dmg);
+		RepositoryStmt::Read(row, 24, e.max_dmg);
+		RepositoryStmt::Read(row, 25, e.hp_regen_rate);
+		RepositoryStmt::Read(row, 26, e.hp_regen_per_second);
+		RepositoryStmt::Read(row, 27, e.attack_delay);
+		RepositoryStmt::Read(row, 28, e.spell_scale);
+		RepositoryStmt::Read(row, 29, e.heal_scale);
+		RepositoryStmt::Read(row, 30, e.avoidance);
+		RepositoryStmt::Read(row, 31, e.heroic_strikethrough);
+		RepositoryStmt::Read(row, 32, e.special_abilities);
+	}
+
+	static NpcScaleGlobalBase FindOnePrepared(
+		Database& db,
+		int npc_scale_global_base_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcScaleGlobalBaseRepository>(db, npc_scale_global_base_id);
+	}
+
+	static std::vector<NpcScaleGlobalBase> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcScaleGlobalBaseRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcScaleGlobalBase &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcScaleGlobalBaseRepository>(db, e, e.type);
+	}
+
+	static NpcScaleGlobalBase InsertOnePrepared(
+		Database& db,
+		NpcScaleGlobalBase e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcScaleGlobalBaseRepository>(db, e);
+		if (id) {
+			e.type = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcScaleGlobalBase> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcScaleGlobalBaseRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcScaleGlobalBase> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcScaleGlobalBaseRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_SCALE_GLOBAL_BASE_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcSpellsEffectsEntriesRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcSpellsEffectsEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_spells_effects_id);
+		v.emplace_back(e.spell_effect_id);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.se_base);
+		v.emplace_back(e.se_limit);
+		v.emplace_back(e.se_max);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcSpellsEffectsEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_spells_effects_id);
+		RepositoryStmt::Read(row, 2, e.spell_effect_id);
+		RepositoryStmt::Read(row, 3, e.minlevel);
+		RepositoryStmt::Read(row, 4, e.maxlevel);
+		RepositoryStmt::Read(row, 5, e.se_base);
+		RepositoryStmt::Read(row, 6, e.se_limit);
+		RepositoryStmt::Read(row, 7, e.se_max);
+	}
+
+	static NpcSpellsEffectsEntries FindOnePrepared(
+		Database& db,
+		int npc_spells_effects_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcSpellsEffectsEntriesRepository>(db, npc_spells_effects_entries_id);
+	}
+
+	static std::vector<NpcSpellsEffectsEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcSpellsEffectsEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcSpellsEffectsEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcSpellsEffectsEntriesRepository>(db, e, e.id);
+	}
+
+	static NpcSpellsEffectsEntries InsertOnePrepared(
+		Database& db,
+		NpcSpellsEffectsEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcSpellsEffectsEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEffectsEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcSpellsEffectsEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEffectsEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcSpellsEffectsEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_SPELLS_EFFECTS_ENTRIES_REPOSITORY_H
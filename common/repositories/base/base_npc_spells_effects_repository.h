@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcSpellsEffectsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcSpellsEffects &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.parent_list);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcSpellsEffects &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.parent_list);
+	}
+
+	static NpcSpellsEffects FindOnePrepared(
+		Database& db,
+		int npc_spells_effects_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcSpellsEffectsRepository>(db, npc_spells_effects_id);
+	}
+
+	static std::vector<NpcSpellsEffects> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcSpellsEffectsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcSpellsEffects &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcSpellsEffectsRepository>(db, e, e.id);
+	}
+
+	static NpcSpellsEffects InsertOnePrepared(
+		Database& db,
+		NpcSpellsEffects e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcSpellsEffectsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEffects> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcSpellsEffectsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEffects> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcSpellsEffectsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_SPELLS_EFFECTS_REPOSITORY_H
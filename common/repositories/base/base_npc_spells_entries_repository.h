@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcSpellsEntriesRepository {
@@ -554,6 +555,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcSpellsEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_spells_id);
+		v.emplace_back(e.spellid);
+		v.emplace_back(e.type);
+		v.emplace_back(e.minlevel);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.manacost);
+		v.emplace_back(e.recast_delay);
+		v.emplace_back(e.priority);
+		v.emplace_back(e.resist_adjust);
+		v.emplace_back(e.min_hp);
+		v.emplace_back(e.max_hp);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcSpellsEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_spells_id);
+		RepositoryStmt::Read(row, 2, e.spellid);
+		RepositoryStmt::Read(row, 3, e.type);
+		RepositoryStmt::Read(row, 4, e.minlevel);
+		RepositoryStmt::Read(row, 5, e.maxlevel);
+		RepositoryStmt::Read(row, 6, e.manacost);
+		RepositoryStmt::Read(row, 7, e.recast_delay);
+		RepositoryStmt::Read(row, 8, e.priority);
+		RepositoryStmt::Read(row, 9, e.resist_adjust);
+		RepositoryStmt::Read(row, 10, e.min_hp);
+		RepositoryStmt::Read(row, 11, e.max_hp);
+		RepositoryStmt::Read(row, 12, e.min_expansion);
+		RepositoryStmt::Read(row, 13, e.max_expansion);
+		RepositoryStmt::Read(row, 14, e.content_flags);
+		RepositoryStmt::Read(row, 15, e.content_flags_disabled);
+	}
+
+	static NpcSpellsEntries FindOnePrepared(
+		Database& db,
+		int npc_spells_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcSpellsEntriesRepository>(db, npc_spells_entries_id);
+	}
+
+	static std::vector<NpcSpellsEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcSpellsEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcSpellsEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcSpellsEntriesRepository>(db, e, e.id);
+	}
+
+	static NpcSpellsEntries InsertOnePrepared(
+		Database& db,
+		NpcSpellsEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcSpellsEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcSpellsEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcSpellsEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcSpellsEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_SPELLS_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcSpellsRepository {
@@ -614,6 +615,119 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcSpells &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.parent_list);
+		v.emplace_back(e.attack_proc);
+		v.emplace_back(e.proc_chance);
+		v.emplace_back(e.range_proc);
+		v.emplace_back(e.rproc_chance);
+		v.emplace_back(e.defensive_proc);
+		v.emplace_back(e.dproc_chance);
+		v.emplace_back(e.fail_recast);
+		v.emplace_back(e.engaged_no_sp_recast_min);
+		v.emplace_back(e.engaged_no_sp_recast_max);
+		v.emplace_back(e.engaged_b_self_chance);
+		v.emplace_back(e.engaged_b_other_chance);
+		v.emplace_back(e.engaged_d_chance);
+		v.emplace_back(e.pursue_no_sp_recast_min);
+		v.emplace_back(e.pursue_no_sp_recast_max);
+		v.emplace_back(e.pursue_d_chance);
+		v.emplace_back(e.idle_no_sp_recast_min);
+		v.emplace_back(e.idle_no_sp_recast_max);
+		v.emplace_back(e.idle_b_chance);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcSpells &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.parent_list);
+		RepositoryStmt::Read(row, 3, e.attack_proc);
+		RepositoryStmt::Read(row, 4, e.proc_chance);
+		RepositoryStmt::Read(row, 5, e.range_proc);
+		RepositoryStmt::Read(row, 6, e.rproc_chance);
+		RepositoryStmt::Read(row, 7, e.defensive_proc);
+		RepositoryStmt::Read(row, 8, e.dproc_chance);
+		RepositoryStmt::Read(row, 9, e.fail_recast);
+		RepositoryStmt::Read(row, 10, e.engaged_no_sp_recast_min);
+		RepositoryStmt::Read(row, 11, e.engaged_no_sp_recast_max);
+		RepositoryStmt::Read(row, 12, e.engaged_b_self_chance);
+		RepositoryStmt::Read(row, 13, e.engaged_b_other_chance);
+		RepositoryStmt::Read(row, 14, e.engaged_d_chance);
+		RepositoryStmt::Read(row, 15, e.pursue_no_sp_recast_min);
+		RepositoryStmt::Read(row, 16, e.pursue_no_sp_recast_max);
+		RepositoryStmt::Read(row, 17, e.pursue_d_chance);
+		RepositoryStmt::Read(row, 18, e.idle_no_sp_recast_min);
+		RepositoryStmt::Read(row, 19, e.idle_no_sp_recast_max);
+		RepositoryStmt::Read(row, 20, e.idle_b_chance);
+	}
+
+	static NpcSpells FindOnePrepared(
+		Database& db,
+		int npc_spells_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcSpellsRepository>(db, npc_spells_id);
+	}
+
+	static std::vector<NpcSpells> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcSpellsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcSpells &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcSpellsRepository>(db, e, e.id);
+	}
+
+	static NpcSpells InsertOnePrepared(
+		Database& db,
+		NpcSpells e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcSpellsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcSpells> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcSpellsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcSpells> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcSpellsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_SPELLS_REPOSITORY_H
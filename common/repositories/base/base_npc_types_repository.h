@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcTypesRepository {
@@ -1922,6 +1923,337 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcTypes &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.lastname));
+		v.emplace_back(e.level);
+		v.emplace_back(e.race);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.bodytype);
+		v.emplace_back(e.hp);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.texture);
+		v.emplace_back(e.helmtexture);
+		v.emplace_back(e.herosforgemodel);
+		v.emplace_back(e.size);
+		v.emplace_back(e.hp_regen_rate);
+		v.emplace_back(e.hp_regen_per_second);
+		v.emplace_back(e.mana_regen_rate);
+		v.emplace_back(e.loottable_id);
+		v.emplace_back(e.merchant_id);
+		v.emplace_back(e.greed);
+		v.emplace_back(e.alt_currency_id);
+		v.emplace_back(e.npc_spells_id);
+		v.emplace_back(e.npc_spells_effects_id);
+		v.emplace_back(e.npc_faction_id);
+		v.emplace_back(e.adventure_template_id);
+		v.emplace_back(e.trap_template);
+		v.emplace_back(e.mindmg);
+		v.emplace_back(e.maxdmg);
+		v.emplace_back(e.attack_count);
+		v.emplace_back(std::string_view(e.npcspecialattks));
+		v.emplace_back(std::string_view(e.special_abilities));
+		v.emplace_back(e.aggroradius);
+		v.emplace_back(e.assistradius);
+		v.emplace_back(e.face);
+		v.emplace_back(e.luclin_hairstyle);
+		v.emplace_back(e.luclin_haircolor);
+		v.emplace_back(e.luclin_eyecolor);
+		v.emplace_back(e.luclin_eyecolor2);
+		v.emplace_back(e.luclin_beardcolor);
+		v.emplace_back(e.luclin_beard);
+		v.emplace_back(e.drakkin_heritage);
+		v.emplace_back(e.drakkin_tattoo);
+		v.emplace_back(e.drakkin_details);
+		v.emplace_back(e.armortint_id);
+		v.emplace_back(e.armortint_red);
+		v.emplace_back(e.armortint_green);
+		v.emplace_back(e.armortint_blue);
+		v.emplace_back(e.d_melee_texture1);
+		v.emplace_back(e.d_melee_texture2);
+		v.emplace_back(std::string_view(e.ammo_idfile));
+		v.emplace_back(e.prim_melee_type);
+		v.emplace_back(e.sec_melee_type);
+		v.emplace_back(e.ranged_type);
+		v.emplace_back(e.runspeed);
+		v.emplace_back(e.MR);
+		v.emplace_back(e.CR);
+		v.emplace_back(e.DR);
+		v.emplace_back(e.FR);
+		v.emplace_back(e.PR);
+		v.emplace_back(e.Corrup);
+		v.emplace_back(e.PhR);
+		v.emplace_back(e.see_invis);
+		v.emplace_back(e.see_invis_undead);
+		v.emplace_back(e.qglobal);
+		v.emplace_back(e.AC);
+		v.emplace_back(e.npc_aggro);
+		v.emplace_back(e.spawn_limit);
+		v.emplace_back(e.attack_speed);
+		v.emplace_back(e.attack_delay);
+		v.emplace_back(e.findable);
+		v.emplace_back(e.STR);
+		v.emplace_back(e.STA);
+		v.emplace_back(e.DEX);
+		v.emplace_back(e.AGI);
+		v.emplace_back(e._INT);
+		v.emplace_back(e.WIS);
+		v.emplace_back(e.CHA);
+		v.emplace_back(e.see_hide);
+		v.emplace_back(e.see_improved_hide);
+		v.emplace_back(e.trackable);
+		v.emplace_back(e.isbot);
+		v.emplace_back(e.exclude);
+		v.emplace_back(e.ATK);
+		v.emplace_back(e.Accuracy);
+		v.emplace_back(e.Avoidance);
+		v.emplace_back(e.slow_mitigation);
+		v.emplace_back(e.version);
+		v.emplace_back(e.maxlevel);
+		v.emplace_back(e.scalerate);
+		v.emplace_back(e.private_corpse);
+		v.emplace_back(e.unique_spawn_by_name);
+		v.emplace_back(e.underwater);
+		v.emplace_back(e.isquest);
+		v.emplace_back(e.emoteid);
+		v.emplace_back(e.spellscale);
+		v.emplace_back(e.healscale);
+		v.emplace_back(e.no_target_hotkey);
+		v.emplace_back(e.raid_target);
+		v.emplace_back(e.armtexture);
+		v.emplace_back(e.bracertexture);
+		v.emplace_back(e.handtexture);
+		v.emplace_back(e.legtexture);
+		v.emplace_back(e.feettexture);
+		v.emplace_back(e.light);
+		v.emplace_back(e.walkspeed);
+		v.emplace_back(e.peqid);
+		v.emplace_back(e.unique_);
+		v.emplace_back(e.fixed);
+		v.emplace_back(e.ignore_despawn);
+		v.emplace_back(e.show_name);
+		v.emplace_back(e.untargetable);
+		v.emplace_back(e.charm_ac);
+		v.emplace_back(e.charm_min_dmg);
+		v.emplace_back(e.charm_max_dmg);
+		v.emplace_back(e.charm_attack_delay);
+		v.emplace_back(e.charm_accuracy_rating);
+		v.emplace_back(e.charm_avoidance_rating);
+		v.emplace_back(e.charm_atk);
+		v.emplace_back(e.skip_global_loot);
+		v.emplace_back(e.rare_spawn);
+		v.emplace_back(e.stuck_behavior);
+		v.emplace_back(e.model);
+		v.emplace_back(e.flymode);
+		v.emplace_back(e.always_aggro);
+		v.emplace_back(e.exp_mod);
+		v.emplace_back(e.heroic_strikethrough);
+		v.emplace_back(e.faction_amount);
+		v.emplace_back(e.keeps_sold_items);
+		v.emplace_back(e.is_parcel_merchant);
+		v.emplace_back(e.multiquest_enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcTypes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.lastname);
+		RepositoryStmt::Read(row, 3, e.level);
+		RepositoryStmt::Read(row, 4, e.race);
+		RepositoryStmt::Read(row, 5, e.class_);
+		RepositoryStmt::Read(row, 6, e.bodytype);
+		RepositoryStmt::Read(row, 7, e.hp);
+		RepositoryStmt::Read(row, 8, e.mana);
+		RepositoryStmt::Read(row, 9, e.gender);
+		RepositoryStmt::Read(row, 10, e.texture);
+		RepositoryStmt::Read(row, 11, e.helmtexture);
+		RepositoryStmt::Read(row, 12, e.herosforgemodel);
+		RepositoryStmt::Read(row, 13, e.size);
+		RepositoryStmt::Read(row, 14, e.hp_regen_rate);
+		RepositoryStmt::Read(row, 15, e.hp_regen_per_second);
+		RepositoryStmt::Read(row, 16, e.mana_regen_rate);
+		RepositoryStmt::Read(row, 17, e.loottable_id);
+		RepositoryStmt::Read(row, 18, e.merchant_id);
+		RepositoryStmt::Read(row, 19, e.greed);
+		RepositoryStmt::Read(row, 20, e.alt_currency_id);
+		RepositoryStmt::Read(row, 21, e.npc_spells_id);
+		RepositoryStmt::Read(row, 22, e.npc_spells_effects_id);
+		RepositoryStmt::Read(row, 23, e.npc_faction_id);
+		RepositoryStmt::Read(row, 24, e.adventure_template_id);
+		RepositoryStmt::Read(row, 25, e.trap_template);
+		RepositoryStmt::Read(row, 26, e.mindmg);
+		RepositoryStmt::Read(row, 27, e.maxdmg);
+		RepositoryStmt::Read(row, 28, e.attack_count);
+		RepositoryStmt::Read(row, 29, e.npcspecialattks);
+		RepositoryStmt::Read(row, 30, e.special_abilities);
+		RepositoryStmt::Read(row, 31, e.aggroradius);
+		RepositoryStmt::Read(row, 32, e.assistradius);
+		RepositoryStmt::Read(row, 33, e.face);
+		RepositoryStmt::Read(row, 34, e.luclin_hairstyle);
+		RepositoryStmt::Read(row, 35, e.luclin_haircolor);
+		RepositoryStmt::Read(row, 36, e.luclin_eyecolor);
+		RepositoryStmt::Read(row, 37, e.luclin_eyecolor2);
+		RepositoryStmt::Read(row, 38, e.luclin_beardcolor);
+		RepositoryStmt::Read(row, 39, e.luclin_beard);
+		RepositoryStmt::Read(row, 40, e.drakkin_heritage);
+		RepositoryStmt::Read(row, 41, e.drakkin_tattoo);
+		RepositoryStmt::Read(row, 42, e.drakkin_details);
+		RepositoryStmt::Read(row, 43, e.armortint_id);
+		RepositoryStmt::Read(row, 44, e.armortint_red);
+		RepositoryStmt::Read(row, 45, e.armortint_green);
+		RepositoryStmt::Read(row, 46, e.armortint_blue);
+		RepositoryStmt::Read(row, 47, e.d_melee_texture1);
+		RepositoryStmt::Read(row, 48, e.d_melee_texture2);
+		RepositoryStmt::Read(row, 49, e.ammo_idfile);
+		RepositoryStmt::Read(row, 50, e.prim_melee_type);
+		RepositoryStmt::Read(row, 51, e.sec_melee_type);
+		RepositoryStmt::Read(row, 52, e.ranged_type);
+		RepositoryStmt::Read(row, 53, e.runspeed);
+		RepositoryStmt::Read(row, 54, e.MR);
+		RepositoryStmt::Read(row, 55, e.CR);
+		RepositoryStmt::Read(row, 56, e.DR);
+		RepositoryStmt::Read(row, 57, e.FR);
+		RepositoryStmt::Read(row, 58, e.PR);
+		RepositoryStmt::Read(row, 59, e.Corrup);
+		RepositoryStmt::Read(row, 60, e.PhR);
+		RepositoryStmt::Read(row, 61, e.see_invis);
+		RepositoryStmt::Read(row, 62, e.see_invis_undead);
+		RepositoryStmt::Read(row, 63, e.qglobal);
+		RepositoryStmt::Read(row, 64, e.AC);
+		RepositoryStmt::Read(row, 65, e.npc_aggro);
+		RepositoryStmt::Read(row, 66, e.spawn_limit);
+		RepositoryStmt::Read(row, 67, e.attack_speed);
+		RepositoryStmt::Read(row, 68, e.attack_delay);
+		RepositoryStmt::Read(row, 69, e.findable);
+		RepositoryStmt::Read(row, 70, e.STR);
+		RepositoryStmt::Read(row, 71, e.STA);
+		RepositoryStmt::Read(row, 72, e.DEX);
+		RepositoryStmt::Read(row, 73, e.AGI);
+		RepositoryStmt::Read(row, 74, e._INT);
+		RepositoryStmt::Read(row, 75, e.WIS);
+		RepositoryStmt::Read(row, 76, e.CHA);
+		RepositoryStmt::Read(row, 77, e.see_hide);
+		RepositoryStmt::Read(row, 78, e.see_improved_hide);
+		RepositoryStmt::Read(row, 79, e.trackable);
+		RepositoryStmt::Read(row, 80, e.isbot);
+		RepositoryStmt::Read(row, 81, e.exclude);
+		RepositoryStmt::Read(row, 82, e.ATK);
+		RepositoryStmt::Read(row, 83, e.Accuracy);
+		RepositoryStmt::Read(row, 84, e.Avoidance);
+		RepositoryStmt::Read(row, 85, e.slow_mitigation);
+		RepositoryStmt::Read(row, 86, e.version);
+		RepositoryStmt::Read(row, 87, e.maxlevel);
+		RepositoryStmt::Read(row, 88, e.scalerate);
+		RepositoryStmt::Read(row, 89, e.private_corpse);
+		RepositoryStmt::Read(row, 90, e.unique_spawn_by_name);
+		RepositoryStmt::Read(row, 91, e.underwater);
+		RepositoryStmt::Read(row, 92, e.isquest);
+		RepositoryStmt::Read(row, 93, e.emoteid);
+		RepositoryStmt::Read(row, 94, e.spellscale);
+		RepositoryStmt::Read(row, 95, e.healscale);
+		RepositoryStmt::Read(row, 96, e.no_target_hotkey);
+		RepositoryStmt::Read(row, 97, e.raid_target);
+		RepositoryStmt::Read(row, 98, e.armtexture);
+		RepositoryStmt::Read(row, 99, e.bracertexture);
+		RepositoryStmt::Read(row, 100, e.handtexture);
+		RepositoryStmt::Read(row, 101, e.legtexture);
+		RepositoryStmt::Read(row, 102, e.feettexture);
+		RepositoryStmt::Read(row, 103, e.light);
+		RepositoryStmt::Read(row, 104, e.walkspeed);
+		RepositoryStmt::Read(row, 105, e.peqid);
+		RepositoryStmt::Read(row, 106, e.unique_);
+		RepositoryStmt::Read(row, 107, e.fixed);
+		RepositoryStmt::Read(row, 108, e.ignore_despawn);
+		RepositoryStmt::Read(row, 109, e.show_name);
+		RepositoryStmt::Read(row, 110, e.untargetable);
+		RepositoryStmt::Read(row, 111, e.charm_ac);
+		RepositoryStmt::Read(row, 112, e.charm_min_dmg);
+		RepositoryStmt::Read(row, 113, e.charm_max_dmg);
+		RepositoryStmt::Read(row, 114, e.charm_attack_delay);
+		RepositoryStmt::Read(row, 115, e.charm_accuracy_rating);
+		RepositoryStmt::Read(row, 116, e.charm_avoidance_rating);
+		RepositoryStmt::Read(row, 117, e.charm_atk);
+		RepositoryStmt::Read(row, 118, e.skip_global_loot);
+		RepositoryStmt::Read(row, 119, e.rare_spawn);
+		RepositoryStmt::Read(row, 120, e.stuck_behavior);
+		RepositoryStmt::Read(row, 121, e.model);
+		RepositoryStmt::Read(row, 122, e.flymode);
+		RepositoryStmt::Read(row, 123, e.always_aggro);
+		RepositoryStmt::Read(row, 124, e.exp_mod);
+		RepositoryStmt::Read(row, 125, e.heroic_strikethrough);
+		RepositoryStmt::Read(row, 126, e.faction_amount);
+		RepositoryStmt::Read(row, 127, e.keeps_sold_items);
+		RepositoryStmt::Read(row, 128, e.is_parcel_merchant);
+		RepositoryStmt::Read(row, 129, e.multiquest_enabled);
+	}
+
+	static NpcTypes FindOnePrepared(
+		Database& db,
+		int npc_types_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcTypesRepository>(db, npc_types_id);
+	}
+
+	static std::vector<NpcTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcTypesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcTypes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcTypesRepository>(db, e, e.id);
+	}
+
+	static NpcTypes InsertOnePrepared(
+		Database& db,
+		NpcTypes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcTypesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcTypes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcTypesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcTypes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcTypesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_TYPES_REPOSITORY_H
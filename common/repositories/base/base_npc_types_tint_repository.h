@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseNpcTypesTintRepository {
@@ -711,6 +712,135 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const NpcTypesTint &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.tint_set_name));
+		v.emplace_back(e.red1h);
+		v.emplace_back(e.grn1h);
+		v.emplace_back(e.blu1h);
+		v.emplace_back(e.red2c);
+		v.emplace_back(e.grn2c);
+		v.emplace_back(e.blu2c);
+		v.emplace_back(e.red3a);
+		v.emplace_back(e.grn3a);
+		v.emplace_back(e.blu3a);
+		v.emplace_back(e.red4b);
+		v.emplace_back(e.grn4b);
+		v.emplace_back(e.blu4b);
+		v.emplace_back(e.red5g);
+		v.emplace_back(e.grn5g);
+		v.emplace_back(e.blu5g);
+		v.emplace_back(e.red6l);
+		v.emplace_back(e.grn6l);
+		v.emplace_back(e.blu6l);
+		v.emplace_back(e.red7f);
+		v.emplace_back(e.grn7f);
+		v.emplace_back(e.blu7f);
+		v.emplace_back(e.red8x);
+		v.emplace_back(e.grn8x);
+		v.emplace_back(e.blu8x);
+		v.emplace_back(e.red9x);
+		v.emplace_back(e.grn9x);
+		v.emplace_back(e.blu9x);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		NpcTypesTint &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.tint_set_name);
+		RepositoryStmt::Read(row, 2, e.red1h);
+		RepositoryStmt::Read(row, 3, e.grn1h);
+		RepositoryStmt::Read(row, 4, e.blu1h);
+		RepositoryStmt::Read(row, 5, e.red2c);
+		RepositoryStmt::Read(row, 6, e.grn2c);
+		RepositoryStmt::Read(row, 7, e.blu2c);
+		RepositoryStmt::Read(row, 8, e.red3a);
+		RepositoryStmt::Read(row, 9, e.grn3a);
+		RepositoryStmt::Read(row, 10, e.blu3a);
+		RepositoryStmt::Read(row, 11, e.red4b);
+		RepositoryStmt::Read(row, 12, e.grn4b);
+		RepositoryStmt::Read(row, 13, e.blu4b);
+		RepositoryStmt::Read(row, 14, e.red5g);
+		RepositoryStmt::Read(row, 15, e.grn5g);
+		RepositoryStmt::Read(row, 16, e.blu5g);
+		RepositoryStmt::Read(row, 17, e.red6l);
+		RepositoryStmt::Read(row, 18, e.grn6l);
+		RepositoryStmt::Read(row, 19, e.blu6l);
+		RepositoryStmt::Read(row, 20, e.red7f);
+		RepositoryStmt::Read(row, 21, e.grn7f);
+		RepositoryStmt::Read(row, 22, e.blu7f);
+		RepositoryStmt::Read(row, 23, e.red8x);
+		RepositoryStmt::Read(row, 24, e.grn8x);
+		RepositoryStmt::Read(row, 25, e.blu8x);
+		RepositoryStmt::Read(row, 26, e.red9x);
+		RepositoryStmt::Read(row, 27, e.grn9x);
+		RepositoryStmt::Read(row, 28, e.blu9x);
+	}
+
+	static NpcTypesTint FindOnePrepared(
+		Database& db,
+		int npc_types_tint_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseNpcTypesTintRepository>(db, npc_types_tint_id);
+	}
+
+	static std::vector<NpcTypesTint> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseNpcTypesTintRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const NpcTypesTint &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseNpcTypesTintRepository>(db, e, e.id);
+	}
+
+	static NpcTypesTint InsertOnePrepared(
+		Database& db,
+		NpcTypesTint e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseNpcTypesTintRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<NpcTypesTint> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseNpcTypesTintRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<NpcTypesTint> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseNpcTypesTintRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_NPC_TYPES_TINT_REPOSITORY_H
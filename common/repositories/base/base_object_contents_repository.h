@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseObjectContentsRepository {
@@ -507,6 +508,101 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ObjectContents &e
+	)
+	{
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.parentid);
+		v.emplace_back(e.bagidx);
+		v.emplace_back(e.itemid);
+		v.emplace_back(e.charges);
+		v.emplace_back(RepositoryStmt::DateTime(e.droptime));
+		v.emplace_back(e.augslot1);
+		v.emplace_back(e.augslot2);
+		v.emplace_back(e.augslot3);
+		v.emplace_back(e.augslot4);
+		v.emplace_back(e.augslot5);
+		v.emplace_back(e.augslot6);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ObjectContents &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.zoneid);
+		RepositoryStmt::Read(row, 1, e.parentid);
+		RepositoryStmt::Read(row, 2, e.bagidx);
+		RepositoryStmt::Read(row, 3, e.itemid);
+		RepositoryStmt::Read(row, 4, e.charges);
+		RepositoryStmt::Read(row, 5, e.droptime);
+		RepositoryStmt::Read(row, 6, e.augslot1);
+		RepositoryStmt::Read(row, 7, e.augslot2);
+		RepositoryStmt::Read(row, 8, e.augslot3);
+		RepositoryStmt::Read(row, 9, e.augslot4);
+		RepositoryStmt::Read(row, 10, e.augslot5);
+		RepositoryStmt::Read(row, 11, e.augslot6);
+	}
+
+	static ObjectContents FindOnePrepared(
+		Database& db,
+		int object_contents_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseObjectContentsRepository>(db, object_contents_id);
+	}
+
+	static std::vector<ObjectContents> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseObjectContentsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ObjectContents &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseObjectContentsRepository>(db, e, e.parentid);
+	}
+
+	static ObjectContents InsertOnePrepared(
+		Database& db,
+		ObjectContents e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseObjectContentsRepository>(db, e);
+		if (id) {
+			e.parentid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ObjectContents> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseObjectContentsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ObjectContents> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseObjectContentsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_OBJECT_CONTENTS_REPOSITORY_H
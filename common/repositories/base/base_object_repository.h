@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseObjectRepository {
@@ -722,6 +723,137 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Object &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(e.version);
+		v.emplace_back(e.xpos);
+		v.emplace_back(e.ypos);
+		v.emplace_back(e.zpos);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.itemid);
+		v.emplace_back(e.charges);
+		v.emplace_back(std::string_view(e.objectname));
+		v.emplace_back(e.type);
+		v.emplace_back(e.icon);
+		v.emplace_back(e.size_percentage);
+		v.emplace_back(e.unknown24);
+		v.emplace_back(e.unknown60);
+		v.emplace_back(e.unknown64);
+		v.emplace_back(e.unknown68);
+		v.emplace_back(e.unknown72);
+		v.emplace_back(e.unknown76);
+		v.emplace_back(e.unknown84);
+		v.emplace_back(e.size);
+		v.emplace_back(e.solid_type);
+		v.emplace_back(e.incline);
+		v.emplace_back(e.tilt_x);
+		v.emplace_back(e.tilt_y);
+		v.emplace_back(std::string_view(e.display_name));
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Object &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneid);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.xpos);
+		RepositoryStmt::Read(row, 4, e.ypos);
+		RepositoryStmt::Read(row, 5, e.zpos);
+		RepositoryStmt::Read(row, 6, e.heading);
+		RepositoryStmt::Read(row, 7, e.itemid);
+		RepositoryStmt::Read(row, 8, e.charges);
+		RepositoryStmt::Read(row, 9, e.objectname);
+		RepositoryStmt::Read(row, 10, e.type);
+		RepositoryStmt::Read(row, 11, e.icon);
+		RepositoryStmt::Read(row, 12, e.size_percentage);
+		RepositoryStmt::Read(row, 13, e.unknown24);
+		RepositoryStmt::Read(row, 14, e.unknown60);
+		RepositoryStmt::Read(row, 15, e.unknown64);
+		RepositoryStmt::Read(row, 16, e.unknown68);
+		RepositoryStmt::Read(row, 17, e.unknown72);
+		RepositoryStmt::Read(row, 18, e.unknown76);
+		RepositoryStmt::Read(row, 19, e.unknown84);
+		RepositoryStmt::Read(row, 20, e.size);
+		RepositoryStmt::Read(row, 21, e.solid_type);
+		RepositoryStmt::Read(row, 22, e.incline);
+		RepositoryStmt::Read(row, 23, e.tilt_x);
+		RepositoryStmt::Read(row, 24, e.tilt_y);
+		RepositoryStmt::Read(row, 25, e.display_name);
+		RepositoryStmt::Read(row, 26, e.min_expansion);
+		RepositoryStmt::Read(row, 27, e.max_expansion);
+		RepositoryStmt::Read(row, 28, e.content_flags);
+		RepositoryStmt::Read(row, 29, e.content_flags_disabled);
+	}
+
+	static Object FindOnePrepared(
+		Database& db,
+		int object_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseObjectRepository>(db, object_id);
+	}
+
+	static std::vector<Object> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseObjectRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Object &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseObjectRepository>(db, e, e.id);
+	}
+
+	static Object InsertOnePrepared(
+		Database& db,
+		Object e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseObjectRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Object> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseObjectRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Object> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseObjectRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_OBJECT_REPOSITORY_H
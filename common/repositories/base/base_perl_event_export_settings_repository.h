@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePerlEventExportSettingsRepository {
@@ -447,6 +448,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PerlEventExportSettings &e
+	)
+	{
+		v.emplace_back(e.event_id);
+		v.emplace_back(std::string_view(e.event_description));
+		v.emplace_back(e.export_qglobals);
+		v.emplace_back(e.export_mob);
+		v.emplace_back(e.export_zone);
+		v.emplace_back(e.export_item);
+		v.emplace_back(e.export_event);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PerlEventExportSettings &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.event_id);
+		RepositoryStmt::Read(row, 1, e.event_description);
+		RepositoryStmt::Read(row, 2, e.export_qglobals);
+		RepositoryStmt::Read(row, 3, e.export_mob);
+		RepositoryStmt::Read(row, 4, e.export_zone);
+		RepositoryStmt::Read(row, 5, e.export_item);
+		RepositoryStmt::Read(row, 6, e.export_event);
+	}
+
+	static PerlEventExportSettings FindOnePrepared(
+		Database& db,
+		int perl_event_export_settings_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePerlEventExportSettingsRepository>(db, perl_event_export_settings_id);
+	}
+
+	static std::vector<PerlEventExportSettings> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePerlEventExportSettingsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PerlEventExportSettings &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePerlEventExportSettingsRepository>(db, e, e.event_id);
+	}
+
+	static PerlEventExportSettings InsertOnePrepared(
+		Database& db,
+		PerlEventExportSettings e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePerlEventExportSettingsRepository>(db, e);
+		if (id) {
+			e.event_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PerlEventExportSettings> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePerlEventExportSettingsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PerlEventExportSettings> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePerlEventExportSettingsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PERL_EVENT_EXPORT_SETTINGS_REPOSITORY_H
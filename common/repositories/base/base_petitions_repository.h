@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePetitionsRepository {
@@ -554,6 +555,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Petitions &e
+	)
+	{
+		v.emplace_back(e.dib);
+		v.emplace_back(e.petid);
+		v.emplace_back(std::string_view(e.charname));
+		v.emplace_back(std::string_view(e.accountname));
+		v.emplace_back(std::string_view(e.lastgm));
+		v.emplace_back(std::string_view(e.petitiontext));
+		v.emplace_back(std::string_view(e.gmtext));
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.urgency);
+		v.emplace_back(e.charclass);
+		v.emplace_back(e.charrace);
+		v.emplace_back(e.charlevel);
+		v.emplace_back(e.checkouts);
+		v.emplace_back(e.unavailables);
+		v.emplace_back(e.ischeckedout);
+		v.emplace_back(e.senttime);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Petitions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.dib);
+		RepositoryStmt::Read(row, 1, e.petid);
+		RepositoryStmt::Read(row, 2, e.charname);
+		RepositoryStmt::Read(row, 3, e.accountname);
+		RepositoryStmt::Read(row, 4, e.lastgm);
+		RepositoryStmt::Read(row, 5, e.petitiontext);
+		RepositoryStmt::Read(row, 6, e.gmtext);
+		RepositoryStmt::Read(row, 7, e.zone);
+		RepositoryStmt::Read(row, 8, e.urgency);
+		RepositoryStmt::Read(row, 9, e.charclass);
+		RepositoryStmt::Read(row, 10, e.charrace);
+		RepositoryStmt::Read(row, 11, e.charlevel);
+		RepositoryStmt::Read(row, 12, e.checkouts);
+		RepositoryStmt::Read(row, 13, e.unavailables);
+		RepositoryStmt::Read(row, 14, e.ischeckedout);
+		RepositoryStmt::Read(row, 15, e.senttime);
+	}
+
+	static Petitions FindOnePrepared(
+		Database& db,
+		int petitions_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePetitionsRepository>(db, petitions_id);
+	}
+
+	static std::vector<Petitions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePetitionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Petitions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePetitionsRepository>(db, e, e.dib);
+	}
+
+	static Petitions InsertOnePrepared(
+		Database& db,
+		Petitions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePetitionsRepository>(db, e);
+		if (id) {
+			e.dib = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Petitions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePetitionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Petitions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePetitionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PETITIONS_REPOSITORY_H
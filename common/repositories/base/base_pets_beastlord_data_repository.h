@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePetsBeastlordDataRepository {
@@ -444,6 +445,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PetsBeastlordData &e
+	)
+	{
+		v.emplace_back(e.player_race);
+		v.emplace_back(e.pet_race);
+		v.emplace_back(e.texture);
+		v.emplace_back(e.helm_texture);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.size_modifier);
+		v.emplace_back(e.face);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PetsBeastlordData &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.player_race);
+		RepositoryStmt::Read(row, 1, e.pet_race);
+		RepositoryStmt::Read(row, 2, e.texture);
+		RepositoryStmt::Read(row, 3, e.helm_texture);
+		RepositoryStmt::Read(row, 4, e.gender);
+		RepositoryStmt::Read(row, 5, e.size_modifier);
+		RepositoryStmt::Read(row, 6, e.face);
+	}
+
+	static PetsBeastlordData FindOnePrepared(
+		Database& db,
+		int pets_beastlord_data_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePetsBeastlordDataRepository>(db, pets_beastlord_data_id);
+	}
+
+	static std::vector<PetsBeastlordData> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePetsBeastlordDataRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PetsBeastlordData &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePetsBeastlordDataRepository>(db, e, e.player_race);
+	}
+
+	static PetsBeastlordData InsertOnePrepared(
+		Database& db,
+		PetsBeastlordData e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePetsBeastlordDataRepository>(db, e);
+		if (id) {
+			e.player_race = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PetsBeastlordData> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePetsBeastlordDataRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PetsBeastlordData> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePetsBeastlordDataRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PETS_BEASTLORD_DATA_REPOSITORY_H
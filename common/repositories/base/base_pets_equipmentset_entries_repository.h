@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePetsEquipmentsetEntriesRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PetsEquipmentsetEntries &e
+	)
+	{
+		v.emplace_back(e.set_id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PetsEquipmentsetEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.set_id);
+		RepositoryStmt::Read(row, 1, e.slot);
+		RepositoryStmt::Read(row, 2, e.item_id);
+	}
+
+	static PetsEquipmentsetEntries FindOnePrepared(
+		Database& db,
+		int pets_equipmentset_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePetsEquipmentsetEntriesRepository>(db, pets_equipmentset_entries_id);
+	}
+
+	static std::vector<PetsEquipmentsetEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePetsEquipmentsetEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PetsEquipmentsetEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePetsEquipmentsetEntriesRepository>(db, e, e.set_id);
+	}
+
+	static PetsEquipmentsetEntries InsertOnePrepared(
+		Database& db,
+		PetsEquipmentsetEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePetsEquipmentsetEntriesRepository>(db, e);
+		if (id) {
+			e.set_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PetsEquipmentsetEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePetsEquipmentsetEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PetsEquipmentsetEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePetsEquipmentsetEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PETS_EQUIPMENTSET_ENTRIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePetsEquipmentsetRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PetsEquipmentset &e
+	)
+	{
+		v.emplace_back(e.set_id);
+		v.emplace_back(std::string_view(e.setname));
+		v.emplace_back(e.nested_set);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PetsEquipmentset &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.set_id);
+		RepositoryStmt::Read(row, 1, e.setname);
+		RepositoryStmt::Read(row, 2, e.nested_set);
+	}
+
+	static PetsEquipmentset FindOnePrepared(
+		Database& db,
+		int pets_equipmentset_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePetsEquipmentsetRepository>(db, pets_equipmentset_id);
+	}
+
+	static std::vector<PetsEquipmentset> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePetsEquipmentsetRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PetsEquipmentset &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePetsEquipmentsetRepository>(db, e, e.set_id);
+	}
+
+	static PetsEquipmentset InsertOnePrepared(
+		Database& db,
+		PetsEquipmentset e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePetsEquipmentsetRepository>(db, e);
+		if (id) {
+			e.set_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PetsEquipmentset> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePetsEquipmentsetRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PetsEquipmentset> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePetsEquipmentsetRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PETS_EQUIPMENTSET_REPOSITORY_H
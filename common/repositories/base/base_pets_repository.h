@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePetsRepository {
@@ -470,6 +471,95 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Pets &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.type));
+		v.emplace_back(e.petpower);
+		v.emplace_back(e.npcID);
+		v.emplace_back(e.temp);
+		v.emplace_back(e.petcontrol);
+		v.emplace_back(e.petnaming);
+		v.emplace_back(e.monsterflag);
+		v.emplace_back(e.equipmentset);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Pets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.petpower);
+		RepositoryStmt::Read(row, 3, e.npcID);
+		RepositoryStmt::Read(row, 4, e.temp);
+		RepositoryStmt::Read(row, 5, e.petcontrol);
+		RepositoryStmt::Read(row, 6, e.petnaming);
+		RepositoryStmt::Read(row, 7, e.monsterflag);
+		RepositoryStmt::Read(row, 8, e.equipmentset);
+	}
+
+	static Pets FindOnePrepared(
+		Database& db,
+		int pets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePetsRepository>(db, pets_id);
+	}
+
+	static std::vector<Pets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Pets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePetsRepository>(db, e, e.id);
+	}
+
+	static Pets InsertOnePrepared(
+		Database& db,
+		Pets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePetsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Pets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Pets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PETS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventAaPurchaseRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventAaPurchase &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.aa_ability_id);
+		v.emplace_back(e.cost);
+		v.emplace_back(e.previous_id);
+		v.emplace_back(e.next_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventAaPurchase &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.aa_ability_id);
+		RepositoryStmt::Read(row, 2, e.cost);
+		RepositoryStmt::Read(row, 3, e.previous_id);
+		RepositoryStmt::Read(row, 4, e.next_id);
+		RepositoryStmt::Read(row, 5, e.created_at);
+	}
+
+	static PlayerEventAaPurchase FindOnePrepared(
+		Database& db,
+		int player_event_aa_purchase_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventAaPurchaseRepository>(db, player_event_aa_purchase_id);
+	}
+
+	static std::vector<PlayerEventAaPurchase> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventAaPurchaseRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventAaPurchase &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventAaPurchaseRepository>(db, e, e.id);
+	}
+
+	static PlayerEventAaPurchase InsertOnePrepared(
+		Database& db,
+		PlayerEventAaPurchase e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventAaPurchaseRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventAaPurchase> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventAaPurchaseRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventAaPurchase> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventAaPurchaseRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_AA_PURCHASE_REPOSITORY_H
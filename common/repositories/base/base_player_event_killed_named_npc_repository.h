@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventKilledNamedNpcRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventKilledNamedNpc &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.npc_name));
+		v.emplace_back(e.combat_time_seconds);
+		v.emplace_back(e.total_damage_per_second_taken);
+		v.emplace_back(e.total_heal_per_second_taken);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventKilledNamedNpc &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_id);
+		RepositoryStmt::Read(row, 2, e.npc_name);
+		RepositoryStmt::Read(row, 3, e.combat_time_seconds);
+		RepositoryStmt::Read(row, 4, e.total_damage_per_second_taken);
+		RepositoryStmt::Read(row, 5, e.total_heal_per_second_taken);
+		RepositoryStmt::Read(row, 6, e.created_at);
+	}
+
+	static PlayerEventKilledNamedNpc FindOnePrepared(
+		Database& db,
+		int player_event_killed_named_npc_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventKilledNamedNpcRepository>(db, player_event_killed_named_npc_id);
+	}
+
+	static std::vector<PlayerEventKilledNamedNpc> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventKilledNamedNpcRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventKilledNamedNpc &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventKilledNamedNpcRepository>(db, e, e.id);
+	}
+
+	static PlayerEventKilledNamedNpc InsertOnePrepared(
+		Database& db,
+		PlayerEventKilledNamedNpc e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventKilledNamedNpcRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventKilledNamedNpc> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventKilledNamedNpcRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventKilledNamedNpc> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventKilledNamedNpcRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_KILLED_NAMED_NPC_REPOSITORY_H
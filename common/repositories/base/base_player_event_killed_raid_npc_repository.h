@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventKilledRaidNpcRepository {
@@ -446,6 +447,91 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventKilledRaidNpc &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.npc_name));
+		v.emplace_back(e.combat_time_seconds);
+		v.emplace_back(e.total_damage_per_second_taken);
+		v.emplace_back(e.total_heal_per_second_taken);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventKilledRaidNpc &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_id);
+		RepositoryStmt::Read(row, 2, e.npc_name);
+		RepositoryStmt::Read(row, 3, e.combat_time_seconds);
+		RepositoryStmt::Read(row, 4, e.total_damage_per_second_taken);
+		RepositoryStmt::Read(row, 5, e.total_heal_per_second_taken);
+		RepositoryStmt::Read(row, 6, e.created_at);
+	}
+
+	static PlayerEventKilledRaidNpc FindOnePrepared(
+		Database& db,
+		int player_event_killed_raid_npc_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventKilledRaidNpcRepository>(db, player_event_killed_raid_npc_id);
+	}
+
+	static std::vector<PlayerEventKilledRaidNpc> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventKilledRaidNpcRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventKilledRaidNpc &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventKilledRaidNpcRepository>(db, e, e.id);
+	}
+
+	static PlayerEventKilledRaidNpc InsertOnePrepared(
+		Database& db,
+		PlayerEventKilledRaidNpc e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventKilledRaidNpcRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventKilledRaidNpc> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventKilledRaidNpcRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventKilledRaidNpc> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventKilledRaidNpcRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_KILLED_RAID_NPC_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventLogSettingsRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventLogSettings &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.event_name));
+		v.emplace_back(e.event_enabled);
+		v.emplace_back(e.retention_days);
+		v.emplace_back(e.discord_webhook_id);
+		v.emplace_back(e.etl_enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventLogSettings &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.event_name);
+		RepositoryStmt::Read(row, 2, e.event_enabled);
+		RepositoryStmt::Read(row, 3, e.retention_days);
+		RepositoryStmt::Read(row, 4, e.discord_webhook_id);
+		RepositoryStmt::Read(row, 5, e.etl_enabled);
+	}
+
+	static PlayerEventLogSettings FindOnePrepared(
+		Database& db,
+		int player_event_log_settings_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventLogSettingsRepository>(db, player_event_log_settings_id);
+	}
+
+	static std::vector<PlayerEventLogSettings> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventLogSettingsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventLogSettings &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventLogSettingsRepository>(db, e, e.id);
+	}
+
+	static PlayerEventLogSettings InsertOnePrepared(
+		Database& db,
+		PlayerEventLogSettings e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventLogSettingsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLogSettings> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventLogSettingsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLogSettings> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventLogSettingsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_LOG_SETTINGS_REPOSITORY_H
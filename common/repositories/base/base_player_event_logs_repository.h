@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 #include <cereal/cereal.hpp>
 class BasePlayerEventLogsRepository {
@@ -31,6 +32,7 @@ public:
 		int32_t     event_type_id;
 		std::string event_type_name;
 		std::string event_data;
+		std::string event_data_binary;
 		int64_t     etl_table_id;
 		time_t      created_at;
 
@@ -51,6 +53,7 @@ public:
 				CEREAL_NVP(event_type_id),
 				CEREAL_NVP(event_type_name),
 				CEREAL_NVP(event_data),
+				CEREAL_NVP(event_data_binary),
 				CEREAL_NVP(etl_table_id),
 				CEREAL_NVP(created_at)
 			);
@@ -77,6 +80,7 @@ public:
 			"event_type_id",
 			"event_type_name",
 			"event_data",
+			"event_data_binary",
 			"etl_table_id",
 			"created_at",
 		};
@@ -97,6 +101,7 @@ public:
 			"event_type_id",
 			"event_type_name",
 			"event_data",
+			"event_data_binary",
 			"etl_table_id",
 			"UNIX_TIMESTAMP(created_at)",
 		};
@@ -139,20 +144,21 @@ public:
 	{
 		PlayerEventLogs e{};
 
-		e.id              = 0;
-		e.account_id      = 0;
-		e.character_id    = 0;
-		e.zone_id         = 0;
-		e.instance_id     = 0;
-		e.x               = 0;
-		e.y               = 0;
-		e.z               = 0;
-		e.heading         = 0;
-		e.event_type_id   = 0;
-		e.event_type_name = "";
-		e.event_data      = "";
-		e.etl_table_id    = 0;
-		e.created_at      = 0;
+		e.id                = 0;
+		e.account_id        = 0;
+		e.character_id      = 0;
+		e.zone_id           = 0;
+		e.instance_id       = 0;
+		e.x                 = 0;
+		e.y                 = 0;
+		e.z                 = 0;
+		e.heading           = 0;
+		e.event_type_id     = 0;
+		e.event_type_name   = "";
+		e.event_data        = "";
+		e.event_data_binary = "";
+		e.etl_table_id      = 0;
+		e.created_at        = 0;
 
 		return e;
 	}
@@ -189,20 +195,21 @@ public:
 		if (results.RowCount() == 1) {
 			PlayerEventLogs e{};
 
-			e.id              = row[0] ? strtoll(row[0], nullptr, 10) : 0;
-			e.account_id      = row[1] ? strtoll(row[1], nullptr, 10) : 0;
-			e.character_id    = row[2] ? strtoll(row[2], nullptr, 10) : 0;
-			e.zone_id         = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
-			e.instance_id     = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
-			e.x               = row[5] ? strtof(row[5], nullptr) : 0;
-			e.y               = row[6] ? strtof(row[6], nullptr) : 0;
-			e.z               = row[7] ? strtof(row[7], nullptr) : 0;
-			e.heading         = row[8] ? strtof(row[8], nullptr) : 0;
-			e.event_type_id   = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
-			e.event_type_name = row[10] ? row[10] : "";
-			e.event_data      = row[11] ? row[11] : "";
-			e.etl_table_id    = row[12] ? strtoll(row[12], nullptr, 10) : 0;
-			e.created_at      = strtoll(row[13] ? row[13] : "-1", nullptr, 10);
+			e.id                = row[0] ? strtoll(row[0], nullptr, 10) : 0;
+			e.account_id        = row[1] ? strtoll(row[1], nullptr, 10) : 0;
+			e.character_id      = row[2] ? strtoll(row[2], nullptr, 10) : 0;
+			e.zone_id           = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
+			e.instance_id       = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
+			e.x                 = row[5] ? strtof(row[5], nullptr) : 0;
+			e.y                 = row[6] ? strtof(row[6], nullptr) : 0;
+			e.z                 = row[7] ? strtof(row[7], nullptr) : 0;
+			e.heading           = row[8] ? strtof(row[8], nullptr) : 0;
+			e.event_type_id     = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
+			e.event_type_name   = row[10] ? row[10] : "";
+			e.event_data        = row[11] ? row[11] : "";
+			e.event_data_binary = row[12] ? row[12] : "";
+			e.etl_table_id      = row[13] ? strtoll(row[13], nullptr, 10) : 0;
+			e.created_at        = strtoll(row[14] ? row[14] : "-1", nullptr, 10);
 
 			return e;
 		}
@@ -247,8 +254,9 @@ public:
 		v.push_back(columns[9] + " = " + std::to_string(e.event_type_id));
 		v.push_back(columns[10] + " = '" + Strings::Escape(e.event_type_name) + "'");
 		v.push_back(columns[11] + " = '" + Strings::Escape(e.event_data) + "'");
-		v.push_back(columns[12] + " = " + std::to_string(e.etl_table_id));
-		v.push_back(columns[13] + " = FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
+		v.push_back(columns[12] + " = '" + e.event_data_binary + "'");
+		v.push_back(columns[13] + " = " + std::to_string(e.etl_table_id));
+		v.push_back(columns[14] + " = FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -282,6 +290,7 @@ public:
 		v.push_back(std::to_string(e.event_type_id));
 		v.push_back("'" + Strings::Escape(e.event_type_name) + "'");
 		v.push_back("'" + Strings::Escape(e.event_data) + "'");
+		v.push_back("'" + e.event_data_binary + "'");
 		v.push_back(std::to_string(e.etl_table_id));
 		v.push_back("FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
 
@@ -325,6 +334,7 @@ public:
 			v.push_back(std::to_string(e.event_type_id));
 			v.push_back("'" + Strings::Escape(e.event_type_name) + "'");
 			v.push_back("'" + Strings::Escape(e.event_data) + "'");
+			v.push_back("'" + e.event_data_binary + "'");
 			v.push_back(std::to_string(e.etl_table_id));
 			v.push_back("FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
 
@@ -360,20 +370,21 @@ public:
 		for (auto row = results.begin(); row != results.end(); ++row) {
 			PlayerEventLogs e{};
 
-			e.id              = row[0] ? strtoll(row[0], nullptr, 10) : 0;
-			e.account_id      = row[1] ? strtoll(row[1], nullptr, 10) : 0;
-			e.character_id    = row[2] ? strtoll(row[2], nullptr, 10) : 0;
-			e.zone_id         = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
-			e.instance_id     = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
-			e.x               = row[5] ? strtof(row[5], nullptr) : 0;
-			e.y               = row[6] ? strtof(row[6], nullptr) : 0;
-			e.z               = row[7] ? strtof(row[7], nullptr) : 0;
-			e.heading         = row[8] ? strtof(row[8], nullptr) : 0;
-			e.event_type_id   = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
-			e.event_type_name = row[10] ? row[10] : "";
-			e.event_data      = row[11] ? row[11] : "";
-			e.etl_table_id    = row[12] ? strtoll(row[12], nullptr, 10) : 0;
-			e.created_at      = strtoll(row[13] ? row[13] : "-1", nullptr, 10);
+			e.id                = row[0] ? strtoll(row[0], nullptr, 10) : 0;
+			e.account_id        = row[1] ? strtoll(row[1], nullptr, 10) : 0;
+			e.character_id      = row[2] ? strtoll(row[2], nullptr, 10) : 0;
+			e.zone_id           = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
+			e.instance_id       = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
+			e.x                 = row[5] ? strtof(row[5], nullptr) : 0;
+			e.y                 = row[6] ? strtof(row[6], nullptr) : 0;
+			e.z                 = row[7] ? strtof(row[7], nullptr) : 0;
+			e.heading           = row[8] ? strtof(row[8], nullptr) : 0;
+			e.event_type_id     = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
+			e.event_type_name   = row[10] ? row[10] : "";
+			e.event_data        = row[11] ? row[11] : "";
+			e.event_data_binary = row[12] ? row[12] : "";
+			e.etl_table_id      = row[13] ? strtoll(row[13], nullptr, 10) : 0;
+			e.created_at        = strtoll(row[14] ? row[14] : "-1", nullptr, 10);
 
 			all_entries.push_back(e);
 		}
@@ -398,20 +409,21 @@ public:
 		for (auto row = results.begin(); row != results.end(); ++row) {
 			PlayerEventLogs e{};
 
-			e.id              = row[0] ? strtoll(row[0], nullptr, 10) : 0;
-			e.account_id      = row[1] ? strtoll(row[1], nullptr, 10) : 0;
-			e.character_id    = row[2] ? strtoll(row[2], nullptr, 10) : 0;
-			e.zone_id         = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
-			e.instance_id     = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
-			e.x               = row[5] ? strtof(row[5], nullptr) : 0;
-			e.y               = row[6] ? strtof(row[6], nullptr) : 0;
-			e.z               = row[7] ? strtof(row[7], nullptr) : 0;
-			e.heading         = row[8] ? strtof(row[8], nullptr) : 0;
-			e.event_type_id   = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
-			e.event_type_name = row[10] ? row[10] : "";
-			e.event_data      = row[11] ? row[11] : "";
-			e.etl_table_id    = row[12] ? strtoll(row[12], nullptr, 10) : 0;
-			e.created_at      = strtoll(row[13] ? row[13] : "-1", nullptr, 10);
+			e.id                = row[0] ? strtoll(row[0], nullptr, 10) : 0;
+			e.account_id        = row[1] ? strtoll(row[1], nullptr, 10) : 0;
+			e.character_id      = row[2] ? strtoll(row[2], nullptr, 10) : 0;
+			e.zone_id           = row[3] ? static_cast<int32_t>(atoi(row[3])) : 0;
+			e.instance_id       = row[4] ? static_cast<int32_t>(atoi(row[4])) : 0;
+			e.x                 = row[5] ? strtof(row[5], nullptr) : 0;
+			e.y                 = row[6] ? strtof(row[6], nullptr) : 0;
+			e.z                 = row[7] ? strtof(row[7], nullptr) : 0;
+			e.heading           = row[8] ? strtof(row[8], nullptr) : 0;
+			e.event_type_id     = row[9] ? static_cast<int32_t>(atoi(row[9])) : 0;
+			e.event_type_name   = row[10] ? row[10] : "";
+			e.event_data        = row[11] ? row[11] : "";
+			e.event_data_binary = row[12] ? row[12] : "";
+			e.etl_table_id      = row[13] ? strtoll(row[13], nullptr, 10) : 0;
+			e.created_at        = strtoll(row[14] ? row[14] : "-1", nullptr, 10);
 
 			all_entries.push_back(e);
 		}
@@ -498,6 +510,7 @@ public:
 		v.push_back(std::to_string(e.event_type_id));
 		v.push_back("'" + Strings::Escape(e.event_type_name) + "'");
 		v.push_back("'" + Strings::Escape(e.event_data) + "'");
+		v.push_back("'" + e.event_data_binary + "'");
 		v.push_back(std::to_string(e.etl_table_id));
 		v.push_back("FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
 
@@ -534,6 +547,7 @@ public:
 			v.push_back(std::to_string(e.event_type_id));
 			v.push_back("'" + Strings::Escape(e.event_type_name) + "'");
 			v.push_back("'" + Strings::Escape(e.event_data) + "'");
+			v.push_back("'" + e.event_data_binary + "'");
 			v.push_back(std::to_string(e.etl_table_id));
 			v.push_back("FROM_UNIXTIME(" + (e.created_at > 0 ? std::to_string(e.created_at) : "null") + ")");
 
@@ -552,6 +566,107 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventLogs &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.account_id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.event_type_id);
+		v.emplace_back(std::string_view(e.event_type_name));
+		v.emplace_back(std::string_view(e.event_data));
+		v.emplace_back(std::string_view(e.event_data_binary));
+		v.emplace_back(e.etl_table_id);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventLogs &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.account_id);
+		RepositoryStmt::Read(row, 2, e.character_id);
+		RepositoryStmt::Read(row, 3, e.zone_id);
+		RepositoryStmt::Read(row, 4, e.instance_id);
+		RepositoryStmt::Read(row, 5, e.x);
+		RepositoryStmt::Read(row, 6, e.y);
+		RepositoryStmt::Read(row, 7, e.z);
+		RepositoryStmt::Read(row, 8, e.heading);
+		RepositoryStmt::Read(row, 9, e.event_type_id);
+		RepositoryStmt::Read(row, 10, e.event_type_name);
+		RepositoryStmt::Read(row, 11, e.event_data);
+		RepositoryStmt::Read(row, 12, e.event_data_binary);
+		RepositoryStmt::Read(row, 13, e.etl_table_id);
+		RepositoryStmt::Read(row, 14, e.created_at);
+	}
+
+	static PlayerEventLogs FindOnePrepared(
+		Database& db,
+		int player_event_logs_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventLogsRepository>(db, player_event_logs_id);
+	}
+
+	static std::vector<PlayerEventLogs> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventLogsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventLogs &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventLogsRepository>(db, e, e.id);
+	}
+
+	static PlayerEventLogs InsertOnePrepared(
+		Database& db,
+		PlayerEventLogs e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventLogsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLogs> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventLogsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLogs> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventLogsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_LOGS_REPOSITORY_H
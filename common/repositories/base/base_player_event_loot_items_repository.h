@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventLootItemsRepository {
@@ -518,6 +519,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventLootItems &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(std::string_view(e.item_name));
+		v.emplace_back(e.charges);
+		v.emplace_back(e.augment_1_id);
+		v.emplace_back(e.augment_2_id);
+		v.emplace_back(e.augment_3_id);
+		v.emplace_back(e.augment_4_id);
+		v.emplace_back(e.augment_5_id);
+		v.emplace_back(e.augment_6_id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.corpse_name));
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventLootItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.item_id);
+		RepositoryStmt::Read(row, 2, e.item_name);
+		RepositoryStmt::Read(row, 3, e.charges);
+		RepositoryStmt::Read(row, 4, e.augment_1_id);
+		RepositoryStmt::Read(row, 5, e.augment_2_id);
+		RepositoryStmt::Read(row, 6, e.augment_3_id);
+		RepositoryStmt::Read(row, 7, e.augment_4_id);
+		RepositoryStmt::Read(row, 8, e.augment_5_id);
+		RepositoryStmt::Read(row, 9, e.augment_6_id);
+		RepositoryStmt::Read(row, 10, e.npc_id);
+		RepositoryStmt::Read(row, 11, e.corpse_name);
+		RepositoryStmt::Read(row, 12, e.created_at);
+	}
+
+	static PlayerEventLootItems FindOnePrepared(
+		Database& db,
+		int player_event_loot_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventLootItemsRepository>(db, player_event_loot_items_id);
+	}
+
+	static std::vector<PlayerEventLootItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventLootItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventLootItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventLootItemsRepository>(db, e, e.id);
+	}
+
+	static PlayerEventLootItems InsertOnePrepared(
+		Database& db,
+		PlayerEventLootItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventLootItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLootItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventLootItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventLootItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventLootItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_LOOT_ITEMS_REPOSITORY_H
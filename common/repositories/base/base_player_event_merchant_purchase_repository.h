@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventMerchantPurchaseRepository {
@@ -506,6 +507,101 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventMerchantPurchase &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.merchant_name));
+		v.emplace_back(e.merchant_type);
+		v.emplace_back(e.item_id);
+		v.emplace_back(std::string_view(e.item_name));
+		v.emplace_back(e.charges);
+		v.emplace_back(e.cost);
+		v.emplace_back(e.alternate_currency_id);
+		v.emplace_back(e.player_money_balance);
+		v.emplace_back(e.player_currency_balance);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventMerchantPurchase &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_id);
+		RepositoryStmt::Read(row, 2, e.merchant_name);
+		RepositoryStmt::Read(row, 3, e.merchant_type);
+		RepositoryStmt::Read(row, 4, e.item_id);
+		RepositoryStmt::Read(row, 5, e.item_name);
+		RepositoryStmt::Read(row, 6, e.charges);
+		RepositoryStmt::Read(row, 7, e.cost);
+		RepositoryStmt::Read(row, 8, e.alternate_currency_id);
+		RepositoryStmt::Read(row, 9, e.player_money_balance);
+		RepositoryStmt::Read(row, 10, e.player_currency_balance);
+		RepositoryStmt::Read(row, 11, e.created_at);
+	}
+
+	static PlayerEventMerchantPurchase FindOnePrepared(
+		Database& db,
+		int player_event_merchant_purchase_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventMerchantPurchaseRepository>(db, player_event_merchant_purchase_id);
+	}
+
+	static std::vector<PlayerEventMerchantPurchase> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventMerchantPurchaseRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventMerchantPurchase &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventMerchantPurchaseRepository>(db, e, e.id);
+	}
+
+	static PlayerEventMerchantPurchase InsertOnePrepared(
+		Database& db,
+		PlayerEventMerchantPurchase e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventMerchantPurchaseRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventMerchantPurchase> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventMerchantPurchaseRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventMerchantPurchase> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventMerchantPurchaseRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_MERCHANT_PURCHASE_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventMerchantSellRepository {
@@ -506,6 +507,101 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventMerchantSell &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.merchant_name));
+		v.emplace_back(e.merchant_type);
+		v.emplace_back(e.item_id);
+		v.emplace_back(std::string_view(e.item_name));
+		v.emplace_back(e.charges);
+		v.emplace_back(e.cost);
+		v.emplace_back(e.alternate_currency_id);
+		v.emplace_back(e.player_money_balance);
+		v.emplace_back(e.player_currency_balance);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventMerchantSell &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_id);
+		RepositoryStmt::Read(row, 2, e.merchant_name);
+		RepositoryStmt::Read(row, 3, e.merchant_type);
+		RepositoryStmt::Read(row, 4, e.item_id);
+		RepositoryStmt::Read(row, 5, e.item_name);
+		RepositoryStmt::Read(row, 6, e.charges);
+		RepositoryStmt::Read(row, 7, e.cost);
+		RepositoryStmt::Read(row, 8, e.alternate_currency_id);
+		RepositoryStmt::Read(row, 9, e.player_money_balance);
+		RepositoryStmt::Read(row, 10, e.player_currency_balance);
+		RepositoryStmt::Read(row, 11, e.created_at);
+	}
+
+	static PlayerEventMerchantSell FindOnePrepared(
+		Database& db,
+		int player_event_merchant_sell_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventMerchantSellRepository>(db, player_event_merchant_sell_id);
+	}
+
+	static std::vector<PlayerEventMerchantSell> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventMerchantSellRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventMerchantSell &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventMerchantSellRepository>(db, e, e.id);
+	}
+
+	static PlayerEventMerchantSell InsertOnePrepared(
+		Database& db,
+		PlayerEventMerchantSell e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventMerchantSellRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventMerchantSell> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventMerchantSellRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventMerchantSell> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventMerchantSellRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_MERCHANT_SELL_REPOSITORY_H
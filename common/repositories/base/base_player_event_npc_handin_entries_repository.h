@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventNpcHandinEntriesRepository {
@@ -518,6 +519,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventNpcHandinEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.player_event_npc_handin_id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.evolve_level);
+		v.emplace_back(e.evolve_amount);
+		v.emplace_back(e.augment_1_id);
+		v.emplace_back(e.augment_2_id);
+		v.emplace_back(e.augment_3_id);
+		v.emplace_back(e.augment_4_id);
+		v.emplace_back(e.augment_5_id);
+		v.emplace_back(e.augment_6_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventNpcHandinEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.player_event_npc_handin_id);
+		RepositoryStmt::Read(row, 2, e.type);
+		RepositoryStmt::Read(row, 3, e.item_id);
+		RepositoryStmt::Read(row, 4, e.charges);
+		RepositoryStmt::Read(row, 5, e.evolve_level);
+		RepositoryStmt::Read(row, 6, e.evolve_amount);
+		RepositoryStmt::Read(row, 7, e.augment_1_id);
+		RepositoryStmt::Read(row, 8, e.augment_2_id);
+		RepositoryStmt::Read(row, 9, e.augment_3_id);
+		RepositoryStmt::Read(row, 10, e.augment_4_id);
+		RepositoryStmt::Read(row, 11, e.augment_5_id);
+		RepositoryStmt::Read(row, 12, e.augment_6_id);
+	}
+
+	static PlayerEventNpcHandinEntries FindOnePrepared(
+		Database& db,
+		int player_event_npc_handin_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventNpcHandinEntriesRepository>(db, player_event_npc_handin_entries_id);
+	}
+
+	static std::vector<PlayerEventNpcHandinEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventNpcHandinEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventNpcHandinEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventNpcHandinEntriesRepository>(db, e, e.id);
+	}
+
+	static PlayerEventNpcHandinEntries InsertOnePrepared(
+		Database& db,
+		PlayerEventNpcHandinEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventNpcHandinEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventNpcHandinEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventNpcHandinEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventNpcHandinEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventNpcHandinEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_NPC_HANDIN_ENTRIES_REPOSITORY_H
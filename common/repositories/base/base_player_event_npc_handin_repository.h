@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventNpcHandinRepository {
@@ -518,6 +519,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventNpcHandin &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.npc_id);
+		v.emplace_back(std::string_view(e.npc_name));
+		v.emplace_back(e.handin_copper);
+		v.emplace_back(e.handin_silver);
+		v.emplace_back(e.handin_gold);
+		v.emplace_back(e.handin_platinum);
+		v.emplace_back(e.return_copper);
+		v.emplace_back(e.return_silver);
+		v.emplace_back(e.return_gold);
+		v.emplace_back(e.return_platinum);
+		v.emplace_back(e.is_quest_handin);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventNpcHandin &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.npc_id);
+		RepositoryStmt::Read(row, 2, e.npc_name);
+		RepositoryStmt::Read(row, 3, e.handin_copper);
+		RepositoryStmt::Read(row, 4, e.handin_silver);
+		RepositoryStmt::Read(row, 5, e.handin_gold);
+		RepositoryStmt::Read(row, 6, e.handin_platinum);
+		RepositoryStmt::Read(row, 7, e.return_copper);
+		RepositoryStmt::Read(row, 8, e.return_silver);
+		RepositoryStmt::Read(row, 9, e.return_gold);
+		RepositoryStmt::Read(row, 10, e.return_platinum);
+		RepositoryStmt::Read(row, 11, e.is_quest_handin);
+		RepositoryStmt::Read(row, 12, e.created_at);
+	}
+
+	static PlayerEventNpcHandin FindOnePrepared(
+		Database& db,
+		int player_event_npc_handin_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventNpcHandinRepository>(db, player_event_npc_handin_id);
+	}
+
+	static std::vector<PlayerEventNpcHandin> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventNpcHandinRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventNpcHandin &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventNpcHandinRepository>(db, e, e.id);
+	}
+
+	static PlayerEventNpcHandin InsertOnePrepared(
+		Database& db,
+		PlayerEventNpcHandin e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventNpcHandinRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventNpcHandin> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventNpcHandinRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventNpcHandin> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventNpcHandinRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_NPC_HANDIN_REPOSITORY_H
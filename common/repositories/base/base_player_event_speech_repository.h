@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventSpeechRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventSpeech &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.to_char_id));
+		v.emplace_back(std::string_view(e.from_char_id));
+		v.emplace_back(e.guild_id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.min_status);
+		v.emplace_back(std::string_view(e.message));
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventSpeech &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.to_char_id);
+		RepositoryStmt::Read(row, 2, e.from_char_id);
+		RepositoryStmt::Read(row, 3, e.guild_id);
+		RepositoryStmt::Read(row, 4, e.type);
+		RepositoryStmt::Read(row, 5, e.min_status);
+		RepositoryStmt::Read(row, 6, e.message);
+		RepositoryStmt::Read(row, 7, e.created_at);
+	}
+
+	static PlayerEventSpeech FindOnePrepared(
+		Database& db,
+		int player_event_speech_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventSpeechRepository>(db, player_event_speech_id);
+	}
+
+	static std::vector<PlayerEventSpeech> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventSpeechRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventSpeech &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventSpeechRepository>(db, e, e.id);
+	}
+
+	static PlayerEventSpeech InsertOnePrepared(
+		Database& db,
+		PlayerEventSpeech e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventSpeechRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventSpeech> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventSpeechRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventSpeech> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventSpeechRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_SPEECH_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventTradeEntriesRepository {
@@ -530,6 +531,105 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventTradeEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.player_event_trade_id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.slot);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.augment_1_id);
+		v.emplace_back(e.augment_2_id);
+		v.emplace_back(e.augment_3_id);
+		v.emplace_back(e.augment_4_id);
+		v.emplace_back(e.augment_5_id);
+		v.emplace_back(e.augment_6_id);
+		v.emplace_back(e.in_bag);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventTradeEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.player_event_trade_id);
+		RepositoryStmt::Read(row, 2, e.char_id);
+		RepositoryStmt::Read(row, 3, e.slot);
+		RepositoryStmt::Read(row, 4, e.item_id);
+		RepositoryStmt::Read(row, 5, e.charges);
+		RepositoryStmt::Read(row, 6, e.augment_1_id);
+		RepositoryStmt::Read(row, 7, e.augment_2_id);
+		RepositoryStmt::Read(row, 8, e.augment_3_id);
+		RepositoryStmt::Read(row, 9, e.augment_4_id);
+		RepositoryStmt::Read(row, 10, e.augment_5_id);
+		RepositoryStmt::Read(row, 11, e.augment_6_id);
+		RepositoryStmt::Read(row, 12, e.in_bag);
+		RepositoryStmt::Read(row, 13, e.created_at);
+	}
+
+	static PlayerEventTradeEntries FindOnePrepared(
+		Database& db,
+		int player_event_trade_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventTradeEntriesRepository>(db, player_event_trade_entries_id);
+	}
+
+	static std::vector<PlayerEventTradeEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventTradeEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventTradeEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventTradeEntriesRepository>(db, e, e.id);
+	}
+
+	static PlayerEventTradeEntries InsertOnePrepared(
+		Database& db,
+		PlayerEventTradeEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventTradeEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventTradeEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventTradeEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventTradeEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventTradeEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_TRADE_ENTRIES_REPOSITORY_H
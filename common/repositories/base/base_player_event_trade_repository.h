@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerEventTradeRepository {
@@ -506,6 +507,101 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerEventTrade &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.char1_id);
+		v.emplace_back(e.char2_id);
+		v.emplace_back(e.char1_copper);
+		v.emplace_back(e.char1_silver);
+		v.emplace_back(e.char1_gold);
+		v.emplace_back(e.char1_platinum);
+		v.emplace_back(e.char2_copper);
+		v.emplace_back(e.char2_silver);
+		v.emplace_back(e.char2_gold);
+		v.emplace_back(e.char2_platinum);
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerEventTrade &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.char1_id);
+		RepositoryStmt::Read(row, 2, e.char2_id);
+		RepositoryStmt::Read(row, 3, e.char1_copper);
+		RepositoryStmt::Read(row, 4, e.char1_silver);
+		RepositoryStmt::Read(row, 5, e.char1_gold);
+		RepositoryStmt::Read(row, 6, e.char1_platinum);
+		RepositoryStmt::Read(row, 7, e.char2_copper);
+		RepositoryStmt::Read(row, 8, e.char2_silver);
+		RepositoryStmt::Read(row, 9, e.char2_gold);
+		RepositoryStmt::Read(row, 10, e.char2_platinum);
+		RepositoryStmt::Read(row, 11, e.created_at);
+	}
+
+	static PlayerEventTrade FindOnePrepared(
+		Database& db,
+		int player_event_trade_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerEventTradeRepository>(db, player_event_trade_id);
+	}
+
+	static std::vector<PlayerEventTrade> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerEventTradeRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerEventTrade &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerEventTradeRepository>(db, e, e.id);
+	}
+
+	static PlayerEventTrade InsertOnePrepared(
+		Database& db,
+		PlayerEventTrade e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerEventTradeRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventTrade> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerEventTradeRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerEventTrade> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerEventTradeRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_EVENT_TRADE_REPOSITORY_H
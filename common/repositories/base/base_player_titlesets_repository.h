@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BasePlayerTitlesetsRepository {
@@ -398,6 +399,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const PlayerTitlesets &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.title_set);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		PlayerTitlesets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.char_id);
+		RepositoryStmt::Read(row, 2, e.title_set);
+	}
+
+	static PlayerTitlesets FindOnePrepared(
+		Database& db,
+		int player_titlesets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BasePlayerTitlesetsRepository>(db, player_titlesets_id);
+	}
+
+	static std::vector<PlayerTitlesets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BasePlayerTitlesetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const PlayerTitlesets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BasePlayerTitlesetsRepository>(db, e, e.id);
+	}
+
+	static PlayerTitlesets InsertOnePrepared(
+		Database& db,
+		PlayerTitlesets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BasePlayerTitlesetsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<PlayerTitlesets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BasePlayerTitlesetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<PlayerTitlesets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BasePlayerTitlesetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_PLAYER_TITLESETS_REPOSITORY_H
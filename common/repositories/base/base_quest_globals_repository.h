@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseQuestGlobalsRepository {
@@ -435,6 +436,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const QuestGlobals &e
+	)
+	{
+		v.emplace_back(e.charid);
+		v.emplace_back(e.npcid);
+		v.emplace_back(e.zoneid);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.value));
+		v.emplace_back(e.expdate);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		QuestGlobals &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charid);
+		RepositoryStmt::Read(row, 1, e.npcid);
+		RepositoryStmt::Read(row, 2, e.zoneid);
+		RepositoryStmt::Read(row, 3, e.name);
+		RepositoryStmt::Read(row, 4, e.value);
+		RepositoryStmt::Read(row, 5, e.expdate);
+	}
+
+	static QuestGlobals FindOnePrepared(
+		Database& db,
+		int quest_globals_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseQuestGlobalsRepository>(db, quest_globals_id);
+	}
+
+	static std::vector<QuestGlobals> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseQuestGlobalsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const QuestGlobals &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseQuestGlobalsRepository>(db, e, e.charid);
+	}
+
+	static QuestGlobals InsertOnePrepared(
+		Database& db,
+		QuestGlobals e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseQuestGlobalsRepository>(db, e);
+		if (id) {
+			e.charid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<QuestGlobals> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseQuestGlobalsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<QuestGlobals> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseQuestGlobalsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_QUEST_GLOBALS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseRaidDetailsRepository {
@@ -519,6 +520,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const RaidDetails &e
+	)
+	{
+		v.emplace_back(e.raidid);
+		v.emplace_back(e.loottype);
+		v.emplace_back(e.locked);
+		v.emplace_back(std::string_view(e.motd));
+		v.emplace_back(e.marked_npc_1_entity_id);
+		v.emplace_back(e.marked_npc_1_zone_id);
+		v.emplace_back(e.marked_npc_1_instance_id);
+		v.emplace_back(e.marked_npc_2_entity_id);
+		v.emplace_back(e.marked_npc_2_zone_id);
+		v.emplace_back(e.marked_npc_2_instance_id);
+		v.emplace_back(e.marked_npc_3_entity_id);
+		v.emplace_back(e.marked_npc_3_zone_id);
+		v.emplace_back(e.marked_npc_3_instance_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		RaidDetails &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.raidid);
+		RepositoryStmt::Read(row, 1, e.loottype);
+		RepositoryStmt::Read(row, 2, e.locked);
+		RepositoryStmt::Read(row, 3, e.motd);
+		RepositoryStmt::Read(row, 4, e.marked_npc_1_entity_id);
+		RepositoryStmt::Read(row, 5, e.marked_npc_1_zone_id);
+		RepositoryStmt::Read(row, 6, e.marked_npc_1_instance_id);
+		RepositoryStmt::Read(row, 7, e.marked_npc_2_entity_id);
+		RepositoryStmt::Read(row, 8, e.marked_npc_2_zone_id);
+		RepositoryStmt::Read(row, 9, e.marked_npc_2_instance_id);
+		RepositoryStmt::Read(row, 10, e.marked_npc_3_entity_id);
+		RepositoryStmt::Read(row, 11, e.marked_npc_3_zone_id);
+		RepositoryStmt::Read(row, 12, e.marked_npc_3_instance_id);
+	}
+
+	static RaidDetails FindOnePrepared(
+		Database& db,
+		int raid_details_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseRaidDetailsRepository>(db, raid_details_id);
+	}
+
+	static std::vector<RaidDetails> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseRaidDetailsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const RaidDetails &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseRaidDetailsRepository>(db, e, e.raidid);
+	}
+
+	static RaidDetails InsertOnePrepared(
+		Database& db,
+		RaidDetails e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseRaidDetailsRepository>(db, e);
+		if (id) {
+			e.raidid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<RaidDetails> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseRaidDetailsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<RaidDetails> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseRaidDetailsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_RAID_DETAILS_REPOSITORY_H
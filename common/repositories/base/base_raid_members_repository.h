@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseRaidMembersRepository {
@@ -530,6 +531,105 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const RaidMembers &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.raidid);
+		v.emplace_back(e.charid);
+		v.emplace_back(e.bot_id);
+		v.emplace_back(e.groupid);
+		v.emplace_back(e._class);
+		v.emplace_back(e.level);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.isgroupleader);
+		v.emplace_back(e.israidleader);
+		v.emplace_back(e.islooter);
+		v.emplace_back(e.is_marker);
+		v.emplace_back(e.is_assister);
+		v.emplace_back(std::string_view(e.note));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		RaidMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.raidid);
+		RepositoryStmt::Read(row, 2, e.charid);
+		RepositoryStmt::Read(row, 3, e.bot_id);
+		RepositoryStmt::Read(row, 4, e.groupid);
+		RepositoryStmt::Read(row, 5, e._class);
+		RepositoryStmt::Read(row, 6, e.level);
+		RepositoryStmt::Read(row, 7, e.name);
+		RepositoryStmt::Read(row, 8, e.isgroupleader);
+		RepositoryStmt::Read(row, 9, e.israidleader);
+		RepositoryStmt::Read(row, 10, e.islooter);
+		RepositoryStmt::Read(row, 11, e.is_marker);
+		RepositoryStmt::Read(row, 12, e.is_assister);
+		RepositoryStmt::Read(row, 13, e.note);
+	}
+
+	static RaidMembers FindOnePrepared(
+		Database& db,
+		int raid_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseRaidMembersRepository>(db, raid_members_id);
+	}
+
+	static std::vector<RaidMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseRaidMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const RaidMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseRaidMembersRepository>(db, e, e.id);
+	}
+
+	static RaidMembers InsertOnePrepared(
+		Database& db,
+		RaidMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseRaidMembersRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<RaidMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseRaidMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<RaidMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseRaidMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_RAID_MEMBERS_REPOSITORY_H
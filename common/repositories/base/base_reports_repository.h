@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseReportsRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Reports &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.reported));
+		v.emplace_back(std::string_view(e.reported_text));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Reports &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.reported);
+		RepositoryStmt::Read(row, 3, e.reported_text);
+	}
+
+	static Reports FindOnePrepared(
+		Database& db,
+		int reports_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseReportsRepository>(db, reports_id);
+	}
+
+	static std::vector<Reports> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseReportsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Reports &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseReportsRepository>(db, e, e.id);
+	}
+
+	static Reports InsertOnePrepared(
+		Database& db,
+		Reports e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseReportsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Reports> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseReportsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Reports> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseReportsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_REPORTS_REPOSITORY_H
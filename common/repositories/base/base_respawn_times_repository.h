@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseRespawnTimesRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const RespawnTimes &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.start);
+		v.emplace_back(e.duration);
+		v.emplace_back(e.instance_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		RespawnTimes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.start);
+		RepositoryStmt::Read(row, 2, e.duration);
+		RepositoryStmt::Read(row, 3, e.instance_id);
+	}
+
+	static RespawnTimes FindOnePrepared(
+		Database& db,
+		int respawn_times_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseRespawnTimesRepository>(db, respawn_times_id);
+	}
+
+	static std::vector<RespawnTimes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseRespawnTimesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const RespawnTimes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseRespawnTimesRepository>(db, e, e.id);
+	}
+
+	static RespawnTimes InsertOnePrepared(
+		Database& db,
+		RespawnTimes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseRespawnTimesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<RespawnTimes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseRespawnTimesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<RespawnTimes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseRespawnTimesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_RESPAWN_TIMES_REPOSITORY_H
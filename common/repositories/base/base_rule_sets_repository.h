@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseRuleSetsRepository {
@@ -386,6 +387,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const RuleSets &e
+	)
+	{
+		v.emplace_back(e.ruleset_id);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		RuleSets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.ruleset_id);
+		RepositoryStmt::Read(row, 1, e.name);
+	}
+
+	static RuleSets FindOnePrepared(
+		Database& db,
+		int rule_sets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseRuleSetsRepository>(db, rule_sets_id);
+	}
+
+	static std::vector<RuleSets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseRuleSetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const RuleSets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseRuleSetsRepository>(db, e, e.ruleset_id);
+	}
+
+	static RuleSets InsertOnePrepared(
+		Database& db,
+		RuleSets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseRuleSetsRepository>(db, e);
+		if (id) {
+			e.ruleset_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<RuleSets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseRuleSetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<RuleSets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseRuleSetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_RULE_SETS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseRuleValuesRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const RuleValues &e
+	)
+	{
+		v.emplace_back(e.ruleset_id);
+		v.emplace_back(std::string_view(e.rule_name));
+		v.emplace_back(std::string_view(e.rule_value));
+		v.emplace_back(std::string_view(e.notes));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		RuleValues &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.ruleset_id);
+		RepositoryStmt::Read(row, 1, e.rule_name);
+		RepositoryStmt::Read(row, 2, e.rule_value);
+		RepositoryStmt::Read(row, 3, e.notes);
+	}
+
+	static RuleValues FindOnePrepared(
+		Database& db,
+		int rule_values_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseRuleValuesRepository>(db, rule_values_id);
+	}
+
+	static std::vector<RuleValues> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseRuleValuesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const RuleValues &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseRuleValuesRepository>(db, e, e.ruleset_id);
+	}
+
+	static RuleValues InsertOnePrepared(
+		Database& db,
+		RuleValues e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseRuleValuesRepository>(db, e);
+		if (id) {
+			e.ruleset_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<RuleValues> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseRuleValuesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<RuleValues> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseRuleValuesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_RULE_VALUES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSaylinkRepository {
@@ -386,6 +387,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Saylink &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.phrase));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Saylink &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.phrase);
+	}
+
+	static Saylink FindOnePrepared(
+		Database& db,
+		int saylink_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSaylinkRepository>(db, saylink_id);
+	}
+
+	static std::vector<Saylink> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSaylinkRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Saylink &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSaylinkRepository>(db, e, e.id);
+	}
+
+	static Saylink InsertOnePrepared(
+		Database& db,
+		Saylink e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSaylinkRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Saylink> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSaylinkRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Saylink> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSaylinkRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SAYLINK_REPOSITORY_H
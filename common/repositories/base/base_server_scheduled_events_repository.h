@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseServerScheduledEventsRepository {
@@ -566,6 +567,111 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ServerScheduledEvents &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.description));
+		v.emplace_back(std::string_view(e.event_type));
+		v.emplace_back(std::string_view(e.event_data));
+		v.emplace_back(e.minute_start);
+		v.emplace_back(e.hour_start);
+		v.emplace_back(e.day_start);
+		v.emplace_back(e.month_start);
+		v.emplace_back(e.year_start);
+		v.emplace_back(e.minute_end);
+		v.emplace_back(e.hour_end);
+		v.emplace_back(e.day_end);
+		v.emplace_back(e.month_end);
+		v.emplace_back(e.year_end);
+		v.emplace_back(std::string_view(e.cron_expression));
+		v.emplace_back(RepositoryStmt::DateTime(e.created_at));
+		v.emplace_back(RepositoryStmt::DateTime(e.deleted_at));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ServerScheduledEvents &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.description);
+		RepositoryStmt::Read(row, 2, e.event_type);
+		RepositoryStmt::Read(row, 3, e.event_data);
+		RepositoryStmt::Read(row, 4, e.minute_start);
+		RepositoryStmt::Read(row, 5, e.hour_start);
+		RepositoryStmt::Read(row, 6, e.day_start);
+		RepositoryStmt::Read(row, 7, e.month_start);
+		RepositoryStmt::Read(row, 8, e.year_start);
+		RepositoryStmt::Read(row, 9, e.minute_end);
+		RepositoryStmt::Read(row, 10, e.hour_end);
+		RepositoryStmt::Read(row, 11, e.day_end);
+		RepositoryStmt::Read(row, 12, e.month_end);
+		RepositoryStmt::Read(row, 13, e.year_end);
+		RepositoryStmt::Read(row, 14, e.cron_expression);
+		RepositoryStmt::Read(row, 15, e.created_at);
+		RepositoryStmt::Read(row, 16, e.deleted_at);
+	}
+
+	static ServerScheduledEvents FindOnePrepared(
+		Database& db,
+		int server_scheduled_events_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseServerScheduledEventsRepository>(db, server_scheduled_events_id);
+	}
+
+	static std::vector<ServerScheduledEvents> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseServerScheduledEventsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ServerScheduledEvents &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseServerScheduledEventsRepository>(db, e, e.id);
+	}
+
+	static ServerScheduledEvents InsertOnePrepared(
+		Database& db,
+		ServerScheduledEvents e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseServerScheduledEventsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ServerScheduledEvents> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseServerScheduledEventsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ServerScheduledEvents> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseServerScheduledEventsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SERVER_SCHEDULED_EVENTS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSharedTaskActivityStateRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SharedTaskActivityState &e
+	)
+	{
+		v.emplace_back(e.shared_task_id);
+		v.emplace_back(e.activity_id);
+		v.emplace_back(e.done_count);
+		v.emplace_back(RepositoryStmt::DateTime(e.updated_time));
+		v.emplace_back(RepositoryStmt::DateTime(e.completed_time));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SharedTaskActivityState &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.shared_task_id);
+		RepositoryStmt::Read(row, 1, e.activity_id);
+		RepositoryStmt::Read(row, 2, e.done_count);
+		RepositoryStmt::Read(row, 3, e.updated_time);
+		RepositoryStmt::Read(row, 4, e.completed_time);
+	}
+
+	static SharedTaskActivityState FindOnePrepared(
+		Database& db,
+		int shared_task_activity_state_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSharedTaskActivityStateRepository>(db, shared_task_activity_state_id);
+	}
+
+	static std::vector<SharedTaskActivityState> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSharedTaskActivityStateRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SharedTaskActivityState &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSharedTaskActivityStateRepository>(db, e, e.shared_task_id);
+	}
+
+	static SharedTaskActivityState InsertOnePrepared(
+		Database& db,
+		SharedTaskActivityState e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSharedTaskActivityStateRepository>(db, e);
+		if (id) {
+			e.shared_task_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskActivityState> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSharedTaskActivityStateRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskActivityState> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSharedTaskActivityStateRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SHARED_TASK_ACTIVITY_STATE_REPOSITORY_H
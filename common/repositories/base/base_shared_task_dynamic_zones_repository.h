@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSharedTaskDynamicZonesRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SharedTaskDynamicZones &e
+	)
+	{
+		v.emplace_back(e.shared_task_id);
+		v.emplace_back(e.dynamic_zone_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SharedTaskDynamicZones &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.shared_task_id);
+		RepositoryStmt::Read(row, 1, e.dynamic_zone_id);
+	}
+
+	static SharedTaskDynamicZones FindOnePrepared(
+		Database& db,
+		int shared_task_dynamic_zones_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSharedTaskDynamicZonesRepository>(db, shared_task_dynamic_zones_id);
+	}
+
+	static std::vector<SharedTaskDynamicZones> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSharedTaskDynamicZonesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SharedTaskDynamicZones &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSharedTaskDynamicZonesRepository>(db, e, e.shared_task_id);
+	}
+
+	static SharedTaskDynamicZones InsertOnePrepared(
+		Database& db,
+		SharedTaskDynamicZones e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSharedTaskDynamicZonesRepository>(db, e);
+		if (id) {
+			e.shared_task_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskDynamicZones> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSharedTaskDynamicZonesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskDynamicZones> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSharedTaskDynamicZonesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SHARED_TASK_DYNAMIC_ZONES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSharedTaskMembersRepository {
@@ -399,6 +400,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SharedTaskMembers &e
+	)
+	{
+		v.emplace_back(e.shared_task_id);
+		v.emplace_back(e.character_id);
+		v.emplace_back(e.is_leader);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SharedTaskMembers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.shared_task_id);
+		RepositoryStmt::Read(row, 1, e.character_id);
+		RepositoryStmt::Read(row, 2, e.is_leader);
+	}
+
+	static SharedTaskMembers FindOnePrepared(
+		Database& db,
+		int shared_task_members_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSharedTaskMembersRepository>(db, shared_task_members_id);
+	}
+
+	static std::vector<SharedTaskMembers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSharedTaskMembersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SharedTaskMembers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSharedTaskMembersRepository>(db, e, e.shared_task_id);
+	}
+
+	static SharedTaskMembers InsertOnePrepared(
+		Database& db,
+		SharedTaskMembers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSharedTaskMembersRepository>(db, e);
+		if (id) {
+			e.shared_task_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskMembers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSharedTaskMembersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SharedTaskMembers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSharedTaskMembersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SHARED_TASK_MEMBERS_REPOSITORY_H
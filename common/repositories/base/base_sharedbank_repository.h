@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSharedbankRepository {
@@ -555,6 +556,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Sharedbank &e
+	)
+	{
+		v.emplace_back(e.account_id);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.color);
+		v.emplace_back(e.augment_one);
+		v.emplace_back(e.augment_two);
+		v.emplace_back(e.augment_three);
+		v.emplace_back(e.augment_four);
+		v.emplace_back(e.augment_five);
+		v.emplace_back(e.augment_six);
+		v.emplace_back(std::string_view(e.custom_data));
+		v.emplace_back(e.ornament_icon);
+		v.emplace_back(e.ornament_idfile);
+		v.emplace_back(e.ornament_hero_model);
+		v.emplace_back(e.guid);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Sharedbank &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.account_id);
+		RepositoryStmt::Read(row, 1, e.slot_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.charges);
+		RepositoryStmt::Read(row, 4, e.color);
+		RepositoryStmt::Read(row, 5, e.augment_one);
+		RepositoryStmt::Read(row, 6, e.augment_two);
+		RepositoryStmt::Read(row, 7, e.augment_three);
+		RepositoryStmt::Read(row, 8, e.augment_four);
+		RepositoryStmt::Read(row, 9, e.augment_five);
+		RepositoryStmt::Read(row, 10, e.augment_six);
+		RepositoryStmt::Read(row, 11, e.custom_data);
+		RepositoryStmt::Read(row, 12, e.ornament_icon);
+		RepositoryStmt::Read(row, 13, e.ornament_idfile);
+		RepositoryStmt::Read(row, 14, e.ornament_hero_model);
+		RepositoryStmt::Read(row, 15, e.guid);
+	}
+
+	static Sharedbank FindOnePrepared(
+		Database& db,
+		int sharedbank_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSharedbankRepository>(db, sharedbank_id);
+	}
+
+	static std::vector<Sharedbank> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSharedbankRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Sharedbank &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSharedbankRepository>(db, e, e.account_id);
+	}
+
+	static Sharedbank InsertOnePrepared(
+		Database& db,
+		Sharedbank e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSharedbankRepository>(db, e);
+		if (id) {
+			e.account_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Sharedbank> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSharedbankRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Sharedbank> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSharedbankRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SHAREDBANK_REPOSITORY_H
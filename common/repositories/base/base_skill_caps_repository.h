@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSkillCapsRepository {
@@ -434,6 +435,89 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SkillCaps &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.skill_id);
+		v.emplace_back(e.class_id);
+		v.emplace_back(e.level);
+		v.emplace_back(e.cap);
+		v.emplace_back(e.class_);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SkillCaps &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.skill_id);
+		RepositoryStmt::Read(row, 2, e.class_id);
+		RepositoryStmt::Read(row, 3, e.level);
+		RepositoryStmt::Read(row, 4, e.cap);
+		RepositoryStmt::Read(row, 5, e.class_);
+	}
+
+	static SkillCaps FindOnePrepared(
+		Database& db,
+		int skill_caps_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSkillCapsRepository>(db, skill_caps_id);
+	}
+
+	static std::vector<SkillCaps> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSkillCapsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SkillCaps &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSkillCapsRepository>(db, e, e.id);
+	}
+
+	static SkillCaps InsertOnePrepared(
+		Database& db,
+		SkillCaps e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSkillCapsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SkillCaps> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSkillCapsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SkillCaps> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSkillCapsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SKILL_CAPS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawn2DisabledRepository {
@@ -410,6 +411,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Spawn2Disabled &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.spawn2_id);
+		v.emplace_back(e.instance_id);
+		v.emplace_back(e.disabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Spawn2Disabled &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.spawn2_id);
+		RepositoryStmt::Read(row, 2, e.instance_id);
+		RepositoryStmt::Read(row, 3, e.disabled);
+	}
+
+	static Spawn2Disabled FindOnePrepared(
+		Database& db,
+		int spawn2_disabled_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawn2DisabledRepository>(db, spawn2_disabled_id);
+	}
+
+	static std::vector<Spawn2Disabled> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawn2DisabledRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Spawn2Disabled &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawn2DisabledRepository>(db, e, e.id);
+	}
+
+	static Spawn2Disabled InsertOnePrepared(
+		Database& db,
+		Spawn2Disabled e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawn2DisabledRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Spawn2Disabled> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawn2DisabledRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Spawn2Disabled> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawn2DisabledRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWN2_DISABLED_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawn2Repository {
@@ -590,6 +591,115 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Spawn2 &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.spawngroupID);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.version);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.respawntime);
+		v.emplace_back(e.variance);
+		v.emplace_back(e.pathgrid);
+		v.emplace_back(e.path_when_zone_idle);
+		v.emplace_back(e._condition);
+		v.emplace_back(e.cond_value);
+		v.emplace_back(e.animation);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Spawn2 &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.spawngroupID);
+		RepositoryStmt::Read(row, 2, e.zone);
+		RepositoryStmt::Read(row, 3, e.version);
+		RepositoryStmt::Read(row, 4, e.x);
+		RepositoryStmt::Read(row, 5, e.y);
+		RepositoryStmt::Read(row, 6, e.z);
+		RepositoryStmt::Read(row, 7, e.heading);
+		RepositoryStmt::Read(row, 8, e.respawntime);
+		RepositoryStmt::Read(row, 9, e.variance);
+		RepositoryStmt::Read(row, 10, e.pathgrid);
+		RepositoryStmt::Read(row, 11, e.path_when_zone_idle);
+		RepositoryStmt::Read(row, 12, e._condition);
+		RepositoryStmt::Read(row, 13, e.cond_value);
+		RepositoryStmt::Read(row, 14, e.animation);
+		RepositoryStmt::Read(row, 15, e.min_expansion);
+		RepositoryStmt::Read(row, 16, e.max_expansion);
+		RepositoryStmt::Read(row, 17, e.content_flags);
+		RepositoryStmt::Read(row, 18, e.content_flags_disabled);
+	}
+
+	static Spawn2 FindOnePrepared(
+		Database& db,
+		int spawn2_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawn2Repository>(db, spawn2_id);
+	}
+
+	static std::vector<Spawn2> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawn2Repository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Spawn2 &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawn2Repository>(db, e, e.id);
+	}
+
+	static Spawn2 InsertOnePrepared(
+		Database& db,
+		Spawn2 e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawn2Repository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Spawn2> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawn2Repository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Spawn2> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawn2Repository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWN2_REPOSITORY_H
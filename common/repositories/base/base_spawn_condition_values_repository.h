@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawnConditionValuesRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpawnConditionValues &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.value);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.instance_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpawnConditionValues &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.value);
+		RepositoryStmt::Read(row, 2, e.zone);
+		RepositoryStmt::Read(row, 3, e.instance_id);
+	}
+
+	static SpawnConditionValues FindOnePrepared(
+		Database& db,
+		int spawn_condition_values_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawnConditionValuesRepository>(db, spawn_condition_values_id);
+	}
+
+	static std::vector<SpawnConditionValues> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawnConditionValuesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpawnConditionValues &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawnConditionValuesRepository>(db, e, e.id);
+	}
+
+	static SpawnConditionValues InsertOnePrepared(
+		Database& db,
+		SpawnConditionValues e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawnConditionValuesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpawnConditionValues> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawnConditionValuesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpawnConditionValues> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawnConditionValuesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWN_CONDITION_VALUES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawnConditionsRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpawnConditions &e
+	)
+	{
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.id);
+		v.emplace_back(e.value);
+		v.emplace_back(e.onchange);
+		v.emplace_back(std::string_view(e.name));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpawnConditions &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.zone);
+		RepositoryStmt::Read(row, 1, e.id);
+		RepositoryStmt::Read(row, 2, e.value);
+		RepositoryStmt::Read(row, 3, e.onchange);
+		RepositoryStmt::Read(row, 4, e.name);
+	}
+
+	static SpawnConditions FindOnePrepared(
+		Database& db,
+		int spawn_conditions_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawnConditionsRepository>(db, spawn_conditions_id);
+	}
+
+	static std::vector<SpawnConditions> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawnConditionsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpawnConditions &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawnConditionsRepository>(db, e, e.id);
+	}
+
+	static SpawnConditions InsertOnePrepared(
+		Database& db,
+		SpawnConditions e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawnConditionsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpawnConditions> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawnConditionsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpawnConditions> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawnConditionsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWN_CONDITIONS_REPOSITORY_H
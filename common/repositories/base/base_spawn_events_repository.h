@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawnEventsRepository {
@@ -530,6 +531,105 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpawnEvents &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.cond_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.period);
+		v.emplace_back(e.next_minute);
+		v.emplace_back(e.next_hour);
+		v.emplace_back(e.next_day);
+		v.emplace_back(e.next_month);
+		v.emplace_back(e.next_year);
+		v.emplace_back(e.enabled);
+		v.emplace_back(e.action);
+		v.emplace_back(e.argument);
+		v.emplace_back(e.strict);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpawnEvents &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.cond_id);
+		RepositoryStmt::Read(row, 3, e.name);
+		RepositoryStmt::Read(row, 4, e.period);
+		RepositoryStmt::Read(row, 5, e.next_minute);
+		RepositoryStmt::Read(row, 6, e.next_hour);
+		RepositoryStmt::Read(row, 7, e.next_day);
+		RepositoryStmt::Read(row, 8, e.next_month);
+		RepositoryStmt::Read(row, 9, e.next_year);
+		RepositoryStmt::Read(row, 10, e.enabled);
+		RepositoryStmt::Read(row, 11, e.action);
+		RepositoryStmt::Read(row, 12, e.argument);
+		RepositoryStmt::Read(row, 13, e.strict);
+	}
+
+	static SpawnEvents FindOnePrepared(
+		Database& db,
+		int spawn_events_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawnEventsRepository>(db, spawn_events_id);
+	}
+
+	static std::vector<SpawnEvents> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawnEventsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpawnEvents &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawnEventsRepository>(db, e, e.id);
+	}
+
+	static SpawnEvents InsertOnePrepared(
+		Database& db,
+		SpawnEvents e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawnEventsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpawnEvents> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawnEventsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpawnEvents> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawnEventsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWN_EVENTS_REPOSITORY_H
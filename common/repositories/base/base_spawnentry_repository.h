@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawnentryRepository {
@@ -483,6 +484,97 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Spawnentry &e
+	)
+	{
+		v.emplace_back(e.spawngroupID);
+		v.emplace_back(e.npcID);
+		v.emplace_back(e.chance);
+		v.emplace_back(e.condition_value_filter);
+		v.emplace_back(e.min_time);
+		v.emplace_back(e.max_time);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Spawnentry &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.spawngroupID);
+		RepositoryStmt::Read(row, 1, e.npcID);
+		RepositoryStmt::Read(row, 2, e.chance);
+		RepositoryStmt::Read(row, 3, e.condition_value_filter);
+		RepositoryStmt::Read(row, 4, e.min_time);
+		RepositoryStmt::Read(row, 5, e.max_time);
+		RepositoryStmt::Read(row, 6, e.min_expansion);
+		RepositoryStmt::Read(row, 7, e.max_expansion);
+		RepositoryStmt::Read(row, 8, e.content_flags);
+		RepositoryStmt::Read(row, 9, e.content_flags_disabled);
+	}
+
+	static Spawnentry FindOnePrepared(
+		Database& db,
+		int spawnentry_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawnentryRepository>(db, spawnentry_id);
+	}
+
+	static std::vector<Spawnentry> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawnentryRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Spawnentry &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawnentryRepository>(db, e, e.spawngroupID);
+	}
+
+	static Spawnentry InsertOnePrepared(
+		Database& db,
+		Spawnentry e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawnentryRepository>(db, e);
+		if (id) {
+			e.spawngroupID = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Spawnentry> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawnentryRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Spawnentry> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawnentryRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWNENTRY_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpawngroupRepository {
@@ -518,6 +519,103 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Spawngroup &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.spawn_limit);
+		v.emplace_back(e.dist);
+		v.emplace_back(e.max_x);
+		v.emplace_back(e.min_x);
+		v.emplace_back(e.max_y);
+		v.emplace_back(e.min_y);
+		v.emplace_back(e.delay);
+		v.emplace_back(e.mindelay);
+		v.emplace_back(e.despawn);
+		v.emplace_back(e.despawn_timer);
+		v.emplace_back(e.wp_spawns);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Spawngroup &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.spawn_limit);
+		RepositoryStmt::Read(row, 3, e.dist);
+		RepositoryStmt::Read(row, 4, e.max_x);
+		RepositoryStmt::Read(row, 5, e.min_x);
+		RepositoryStmt::Read(row, 6, e.max_y);
+		RepositoryStmt::Read(row, 7, e.min_y);
+		RepositoryStmt::Read(row, 8, e.delay);
+		RepositoryStmt::Read(row, 9, e.mindelay);
+		RepositoryStmt::Read(row, 10, e.despawn);
+		RepositoryStmt::Read(row, 11, e.despawn_timer);
+		RepositoryStmt::Read(row, 12, e.wp_spawns);
+	}
+
+	static Spawngroup FindOnePrepared(
+		Database& db,
+		int spawngroup_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpawngroupRepository>(db, spawngroup_id);
+	}
+
+	static std::vector<Spawngroup> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpawngroupRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Spawngroup &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpawngroupRepository>(db, e, e.id);
+	}
+
+	static Spawngroup InsertOnePrepared(
+		Database& db,
+		Spawngroup e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpawngroupRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Spawngroup> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpawngroupRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Spawngroup> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpawngroupRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPAWNGROUP_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpellBucketsRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpellBuckets &e
+	)
+	{
+		v.emplace_back(e.spell_id);
+		v.emplace_back(std::string_view(e.bucket_name));
+		v.emplace_back(std::string_view(e.bucket_value));
+		v.emplace_back(e.bucket_comparison);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpellBuckets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.spell_id);
+		RepositoryStmt::Read(row, 1, e.bucket_name);
+		RepositoryStmt::Read(row, 2, e.bucket_value);
+		RepositoryStmt::Read(row, 3, e.bucket_comparison);
+	}
+
+	static SpellBuckets FindOnePrepared(
+		Database& db,
+		int spell_buckets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpellBucketsRepository>(db, spell_buckets_id);
+	}
+
+	static std::vector<SpellBuckets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpellBucketsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpellBuckets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpellBucketsRepository>(db, e, e.spell_id);
+	}
+
+	static SpellBuckets InsertOnePrepared(
+		Database& db,
+		SpellBuckets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpellBucketsRepository>(db, e);
+		if (id) {
+			e.spell_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpellBuckets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpellBucketsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpellBuckets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpellBucketsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPELL_BUCKETS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpellGlobalsRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpellGlobals &e
+	)
+	{
+		v.emplace_back(e.spellid);
+		v.emplace_back(std::string_view(e.spell_name));
+		v.emplace_back(std::string_view(e.qglobal));
+		v.emplace_back(std::string_view(e.value));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpellGlobals &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.spellid);
+		RepositoryStmt::Read(row, 1, e.spell_name);
+		RepositoryStmt::Read(row, 2, e.qglobal);
+		RepositoryStmt::Read(row, 3, e.value);
+	}
+
+	static SpellGlobals FindOnePrepared(
+		Database& db,
+		int spell_globals_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpellGlobalsRepository>(db, spell_globals_id);
+	}
+
+	static std::vector<SpellGlobals> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpellGlobalsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpellGlobals &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpellGlobalsRepository>(db, e, e.spellid);
+	}
+
+	static SpellGlobals InsertOnePrepared(
+		Database& db,
+		SpellGlobals e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpellGlobalsRepository>(db, e);
+		if (id) {
+			e.spellid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpellGlobals> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpellGlobalsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpellGlobals> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpellGlobalsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPELL_GLOBALS_REPOSITORY_H
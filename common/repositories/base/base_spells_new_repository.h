@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseSpellsNewRepository {
@@ -3207,6 +3208,551 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const SpellsNew &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.player_1));
+		v.emplace_back(std::string_view(e.teleport_zone));
+		v.emplace_back(std::string_view(e.you_cast));
+		v.emplace_back(std::string_view(e.other_casts));
+		v.emplace_back(std::string_view(e.cast_on_you));
+		v.emplace_back(std::string_view(e.cast_on_other));
+		v.emplace_back(std::string_view(e.spell_fades));
+		v.emplace_back(e.range_);
+		v.emplace_back(e.aoerange);
+		v.emplace_back(e.pushback);
+		v.emplace_back(e.pushup);
+		v.emplace_back(e.cast_time);
+		v.emplace_back(e.recovery_time);
+		v.emplace_back(e.recast_time);
+		v.emplace_back(e.buffdurationformula);
+		v.emplace_back(e.buffduration);
+		v.emplace_back(e.AEDuration);
+		v.emplace_back(e.mana);
+		v.emplace_back(e.effect_base_value1);
+		v.emplace_back(e.effect_base_value2);
+		v.emplace_back(e.effect_base_value3);
+		v.emplace_back(e.effect_base_value4);
+		v.emplace_back(e.effect_base_value5);
+		v.emplace_back(e.effect_base_value6);
+		v.emplace_back(e.effect_base_value7);
+		v.emplace_back(e.effect_base_value8);
+		v.emplace_back(e.effect_base_value9);
+		v.emplace_back(e.effect_base_value10);
+		v.emplace_back(e.effect_base_value11);
+		v.emplace_back(e.effect_base_value12);
+		v.emplace_back(e.effect_limit_value1);
+		v.emplace_back(e.effect_limit_value2);
+		v.emplace_back(e.effect_limit_value3);
+		v.emplace_back(e.effect_limit_value4);
+		v.emplace_back(e.effect_limit_value5);
+		v.emplace_back(e.effect_limit_value6);
+		v.emplace_back(e.effect_limit_value7);
+		v.emplace_back(e.effect_limit_value8);
+		v.emplace_back(e.effect_limit_value9);
+		v.emplace_back(e.effect_limit_value10);
+		v.emplace_back(e.effect_limit_value11);
+		v.emplace_back(e.effect_limit_value12);
+		v.emplace_back(e.max1);
+		v.emplace_back(e.max2);
+		v.emplace_back(e.max3);
+		v.emplace_back(e.max4);
+		v.emplace_back(e.max5);
+		v.emplace_back(e.max6);
+		v.emplace_back(e.max7);
+		v.emplace_back(e.max8);
+		v.emplace_back(e.max9);
+		v.emplace_back(e.max10);
+		v.emplace_back(e.max11);
+		v.emplace_back(e.max12);
+		v.emplace_back(e.icon);
+		v.emplace_back(e.memicon);
+		v.emplace_back(e.components1);
+		v.emplace_back(e.components2);
+		v.emplace_back(e.components3);
+		v.emplace_back(e.components4);
+		v.emplace_back(e.component_counts1);
+		v.emplace_back(e.component_counts2);
+		v.emplace_back(e.component_counts3);
+		v.emplace_back(e.component_counts4);
+		v.emplace_back(e.NoexpendReagent1);
+		v.emplace_back(e.NoexpendReagent2);
+		v.emplace_back(e.NoexpendReagent3);
+		v.emplace_back(e.NoexpendReagent4);
+		v.emplace_back(e.formula1);
+		v.emplace_back(e.formula2);
+		v.emplace_back(e.formula3);
+		v.emplace_back(e.formula4);
+		v.emplace_back(e.formula5);
+		v.emplace_back(e.formula6);
+		v.emplace_back(e.formula7);
+		v.emplace_back(e.formula8);
+		v.emplace_back(e.formula9);
+		v.emplace_back(e.formula10);
+		v.emplace_back(e.formula11);
+		v.emplace_back(e.formula12);
+		v.emplace_back(e.LightType);
+		v.emplace_back(e.goodEffect);
+		v.emplace_back(e.Activated);
+		v.emplace_back(e.resisttype);
+		v.emplace_back(e.effectid1);
+		v.emplace_back(e.effectid2);
+		v.emplace_back(e.effectid3);
+		v.emplace_back(e.effectid4);
+		v.emplace_back(e.effectid5);
+		v.emplace_back(e.effectid6);
+		v.emplace_back(e.effectid7);
+		v.emplace_back(e.effectid8);
+		v.emplace_back(e.effectid9);
+		v.emplace_back(e.effectid10);
+		v.emplace_back(e.effectid11);
+		v.emplace_back(e.effectid12);
+		v.emplace_back(e.targettype);
+		v.emplace_back(e.basediff);
+		v.emplace_back(e.skill);
+		v.emplace_back(e.zonetype);
+		v.emplace_back(e.EnvironmentType);
+		v.emplace_back(e.TimeOfDay);
+		v.emplace_back(e.classes1);
+		v.emplace_back(e.classes2);
+		v.emplace_back(e.classes3);
+		v.emplace_back(e.classes4);
+		v.emplace_back(e.classes5);
+		v.emplace_back(e.classes6);
+		v.emplace_back(e.classes7);
+		v.emplace_back(e.classes8);
+		v.emplace_back(e.classes9);
+		v.emplace_back(e.classes10);
+		v.emplace_back(e.classes11);
+		v.emplace_back(e.classes12);
+		v.emplace_back(e.classes13);
+		v.emplace_back(e.classes14);
+		v.emplace_back(e.classes15);
+		v.emplace_back(e.classes16);
+		v.emplace_back(e.CastingAnim);
+		v.emplace_back(e.TargetAnim);
+		v.emplace_back(e.TravelType);
+		v.emplace_back(e.SpellAffectIndex);
+		v.emplace_back(e.disallow_sit);
+		v.emplace_back(e.deities0);
+		v.emplace_back(e.deities1);
+		v.emplace_back(e.deities2);
+		v.emplace_back(e.deities3);
+		v.emplace_back(e.deities4);
+		v.emplace_back(e.deities5);
+		v.emplace_back(e.deities6);
+		v.emplace_back(e.deities7);
+		v.emplace_back(e.deities8);
+		v.emplace_back(e.deities9);
+		v.emplace_back(e.deities10);
+		v.emplace_back(e.deities11);
+		v.emplace_back(e.deities12);
+		v.emplace_back(e.deities13);
+		v.emplace_back(e.deities14);
+		v.emplace_back(e.deities15);
+		v.emplace_back(e.deities16);
+		v.emplace_back(e.field142);
+		v.emplace_back(e.field143);
+		v.emplace_back(e.new_icon);
+		v.emplace_back(e.spellanim);
+		v.emplace_back(e.uninterruptable);
+		v.emplace_back(e.ResistDiff);
+		v.emplace_back(e.dot_stacking_exempt);
+		v.emplace_back(e.deleteable);
+		v.emplace_back(e.RecourseLink);
+		v.emplace_back(e.no_partial_resist);
+		v.emplace_back(e.field152);
+		v.emplace_back(e.field153);
+		v.emplace_back(e.short_buff_box);
+		v.emplace_back(e.descnum);
+		v.emplace_back(e.typedescnum);
+		v.emplace_back(e.effectdescnum);
+		v.emplace_back(e.effectdescnum2);
+		v.emplace_back(e.npc_no_los);
+		v.emplace_back(e.field160);
+		v.emplace_back(e.reflectable);
+		v.emplace_back(e.bonushate);
+		v.emplace_back(e.field163);
+		v.emplace_back(e.field164);
+		v.emplace_back(e.ldon_trap);
+		v.emplace_back(e.EndurCost);
+		v.emplace_back(e.EndurTimerIndex);
+		v.emplace_back(e.IsDiscipline);
+		v.emplace_back(e.field169);
+		v.emplace_back(e.field170);
+		v.emplace_back(e.field171);
+		v.emplace_back(e.field172);
+		v.emplace_back(e.HateAdded);
+		v.emplace_back(e.EndurUpkeep);
+		v.emplace_back(e.numhitstype);
+		v.emplace_back(e.numhits);
+		v.emplace_back(e.pvpresistbase);
+		v.emplace_back(e.pvpresistcalc);
+		v.emplace_back(e.pvpresistcap);
+		v.emplace_back(e.spell_category);
+		v.emplace_back(e.pvp_duration);
+		v.emplace_back(e.pvp_duration_cap);
+		v.emplace_back(e.pcnpc_only_flag);
+		v.emplace_back(e.cast_not_standing);
+		v.emplace_back(e.can_mgb);
+		v.emplace_back(e.nodispell);
+		v.emplace_back(e.npc_category);
+		v.emplace_back(e.npc_usefulness);
+		v.emplace_back(e.MinResist);
+		v.emplace_back(e.MaxResist);
+		v.emplace_back(e.viral_targets);
+		v.emplace_back(e.viral_timer);
+		v.emplace_back(e.nimbuseffect);
+		v.emplace_back(e.ConeStartAngle);
+		v.emplace_back(e.ConeStopAngle);
+		v.emplace_back(e.sneaking);
+		v.emplace_back(e.not_extendable);
+		v.emplace_back(e.field198);
+		v.emplace_back(e.field199);
+		v.emplace_back(e.suspendable);
+		v.emplace_back(e.viral_range);
+		v.emplace_back(e.songcap);
+		v.emplace_back(e.field203);
+		v.emplace_back(e.field204);
+		v.emplace_back(e.no_block);
+		v.emplace_back(e.field206);
+		v.emplace_back(e.spellgroup);
+		v.emplace_back(e.rank_);
+		v.emplace_back(e.field209);
+		v.emplace_back(e.field210);
+		v.emplace_back(e.CastRestriction);
+		v.emplace_back(e.allowrest);
+		v.emplace_back(e.InCombat);
+		v.emplace_back(e.OutofCombat);
+		v.emplace_back(e.field215);
+		v.emplace_back(e.field216);
+		v.emplace_back(e.field217);
+		v.emplace_back(e.aemaxtargets);
+		v.emplace_back(e.maxtargets);
+		v.emplace_back(e.field220);
+		v.emplace_back(e.field221);
+		v.emplace_back(e.field222);
+		v.emplace_back(e.field223);
+		v.emplace_back(e.persistdeath);
+		v.emplace_back(e.field225);
+		v.emplace_back(e.field226);
+		v.emplace_back(e.min_dist);
+		v.emplace_back(e.min_dist_mod);
+		v.emplace_back(e.max_dist);
+		v.emplace_back(e.max_dist_mod);
+		v.emplace_back(e.min_range);
+		v.emplace_back(e.field232);
+		v.emplace_back(e.field233);
+		v.emplace_back(e.field234);
+		v.emplace_back(e.field235);
+		v.emplace_back(e.field236);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		SpellsNew &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.player_1);
+		RepositoryStmt::Read(row, 3, e.teleport_zone);
+		RepositoryStmt::Read(row, 4, e.you_cast);
+		RepositoryStmt::Read(row, 5, e.other_casts);
+		RepositoryStmt::Read(row, 6, e.cast_on_you);
+		RepositoryStmt::Read(row, 7, e.cast_on_other);
+		RepositoryStmt::Read(row, 8, e.spell_fades);
+		RepositoryStmt::Read(row, 9, e.range_);
+		RepositoryStmt::Read(row, 10, e.aoerange);
+		RepositoryStmt::Read(row, 11, e.pushback);
+		RepositoryStmt::Read(row, 12, e.pushup);
+		RepositoryStmt::Read(row, 13, e.cast_time);
+		RepositoryStmt::Read(row, 14, e.recovery_time);
+		RepositoryStmt::Read(row, 15, e.recast_time);
+		RepositoryStmt::Read(row, 16, e.buffdurationformula);
+		RepositoryStmt::Read(row, 17, e.buffduration);
+		RepositoryStmt::Read(row, 18, e.AEDuration);
+		RepositoryStmt::Read(row, 19, e.mana);
+		RepositoryStmt::Read(row, 20, e.effect_base_value1);
+		RepositoryStmt::Read(row, 21, e.effect_base_value2);
+		RepositoryStmt::Read(row, 22, e.effect_base_value3);
+		RepositoryStmt::Read(row, 23, e.effect_base_value4);
+		RepositoryStmt::Read(row, 24, e.effect_base_value5);
+		RepositoryStmt::Read(row, 25, e.effect_base_value6);
+		RepositoryStmt::Read(row, 26, e.effect_base_value7);
+		RepositoryStmt::Read(row, 27, e.effect_base_value8);
+		RepositoryStmt::Read(row, 28, e.effect_base_value9);
+		RepositoryStmt::Read(row, 29, e.effect_base_value10);
+		RepositoryStmt::Read(row, 30, e.effect_base_value11);
+		RepositoryStmt::Read(row, 31, e.effect_base_value12);
+		RepositoryStmt::Read(row, 32, e.effect_limit_value1);
+		RepositoryStmt::Read(row, 33, e.effect_limit_value2);
+		RepositoryStmt::Read(row, 34, e.effect_limit_value3);
+		RepositoryStmt::Read(row, 35, e.effect_limit_value4);
+		RepositoryStmt::Read(row, 36, e.effect_limit_value5);
+		RepositoryStmt::Read(row, 37, e.effect_limit_value6);
+		RepositoryStmt::Read(row, 38, e.effect_limit_value7);
+		RepositoryStmt::Read(row, 39, e.effect_limit_value8);
+		RepositoryStmt::Read(row, 40, e.effect_limit_value9);
+		RepositoryStmt::Read(row, 41, e.effect_limit_value10);
+		RepositoryStmt::Read(row, 42, e.effect_limit_value11);
+		RepositoryStmt::Read(row, 43, e.effect_limit_value12);
+		RepositoryStmt::Read(row, 44, e.max1);
+		RepositoryStmt::Read(row, 45, e.max2);
+		RepositoryStmt::Read(row, 46, e.max3);
+		RepositoryStmt::Read(row, 47, e.max4);
+		RepositoryStmt::Read(row, 48, e.max5);
+		RepositoryStmt::Read(row, 49, e.max6);
+		RepositoryStmt::Read(row, 50, e.max7);
+		RepositoryStmt::Read(row, 51, e.max8);
+		RepositoryStmt::Read(row, 52, e.max9);
+		RepositoryStmt::Read(row, 53, e.max10);
+		RepositoryStmt::Read(row, 54, e.max11);
+		RepositoryStmt::Read(row, 55, e.max12);
+		RepositoryStmt::Read(row, 56, e.icon);
+		RepositoryStmt::Read(row, 57, e.memicon);
+		RepositoryStmt::Read(row, 58, e.components1);
+		RepositoryStmt::Read(row, 59, e.components2);
+		RepositoryStmt::Read(row, 60, e.components3);
+		RepositoryStmt::Read(row, 61, e.components4);
+		RepositoryStmt::Read(row, 62, e.component_counts1);
+		RepositoryStmt::Read(row, 63, e.component_counts2);
+		RepositoryStmt::Read(row, 64, e.component_counts3);
+		RepositoryStmt::Read(row, 65, e.component_counts4);
+		RepositoryStmt::Read(row, 66, e.NoexpendReagent1);
+		RepositoryStmt::Read(row, 67, e.NoexpendReagent2);
+		RepositoryStmt::Read(row, 68, e.NoexpendReagent3);
+		RepositoryStmt::Read(row, 69, e.NoexpendReagent4);
+		RepositoryStmt::Read(row, 70, e.formula1);
+		RepositoryStmt::Read(row, 71, e.formula2);
+		RepositoryStmt::Read(row, 72, e.formula3);
+		RepositoryStmt::Read(row, 73, e.formula4);
+		RepositoryStmt::Read(row, 74, e.formula5);
+		RepositoryStmt::Read(row, 75, e.formula6);
+		RepositoryStmt::Read(row, 76, e.formula7);
+		RepositoryStmt::Read(row, 77, e.formula8);
+		RepositoryStmt::Read(row, 78, e.formula9);
+		RepositoryStmt::Read(row, 79, e.formula10);
+		RepositoryStmt::Read(row, 80, e.formula11);
+		RepositoryStmt::Read(row, 81, e.formula12);
+		RepositoryStmt::Read(row, 82, e.LightType);
+		RepositoryStmt::Read(row, 83, e.goodEffect);
+		RepositoryStmt::Read(row, 84, e.Activated);
+		RepositoryStmt::Read(row, 85, e.resisttype);
+		RepositoryStmt::Read(row, 86, e.effectid1);
+		RepositoryStmt::Read(row, 87, e.effectid2);
+		RepositoryStmt::Read(row, 88, e.effectid3);
+		RepositoryStmt::Read(row, 89, e.effectid4);
+		RepositoryStmt::Read(row, 90, e.effectid5);
+		RepositoryStmt::Read(row, 91, e.effectid6);
+		RepositoryStmt::Read(row, 92, e.effectid7);
+		RepositoryStmt::Read(row, 93, e.effectid8);
+		RepositoryStmt::Read(row, 94, e.effectid9);
+		RepositoryStmt::Read(row, 95, e.effectid10);
+		RepositoryStmt::Read(row, 96, e.effectid11);
+		RepositoryStmt::Read(row, 97, e.effectid12);
+		RepositoryStmt::Read(row, 98, e.targettype);
+		RepositoryStmt::Read(row, 99, e.basediff);
+		RepositoryStmt::Read(row, 100, e.skill);
+		RepositoryStmt::Read(row, 101, e.zonetype);
+		RepositoryStmt::Read(row, 102, e.EnvironmentType);
+		RepositoryStmt::Read(row, 103, e.TimeOfDay);
+		RepositoryStmt::Read(row, 104, e.classes1);
+		RepositoryStmt::Read(row, 105, e.classes2);
+		RepositoryStmt::Read(row, 106, e.classes3);
+		RepositoryStmt::Read(row, 107, e.classes4);
+		RepositoryStmt::Read(row, 108, e.classes5);
+		RepositoryStmt::Read(row, 109, e.classes6);
+		RepositoryStmt::Read(row, 110, e.classes7);
+		RepositoryStmt::Read(row, 111, e.classes8);
+		RepositoryStmt::Read(row, 112, e.classes9);
+		RepositoryStmt::Read(row, 113, e.classes10);
+		RepositoryStmt::Read(row, 114, e.classes11);
+		RepositoryStmt::Read(row, 115, e.classes12);
+		RepositoryStmt::Read(row, 116, e.classes13);
+		RepositoryStmt::Read(row, 117, e.classes14);
+		RepositoryStmt::Read(row, 118, e.classes15);
+		RepositoryStmt::Read(row, 119, e.classes16);
+		RepositoryStmt::Read(row, 120, e.CastingAnim);
+		RepositoryStmt::Read(row, 121, e.TargetAnim);
+		RepositoryStmt::Read(row, 122, e.TravelType);
+		RepositoryStmt::Read(row, 123, e.SpellAffectIndex);
+		RepositoryStmt::Read(row, 124, e.disallow_sit);
+		RepositoryStmt::Read(row, 125, e.deities0);
+		RepositoryStmt::Read(row, 126, e.deities1);
+		RepositoryStmt::Read(row, 127, e.deities2);
+		RepositoryStmt::Read(row, 128, e.deities3);
+		RepositoryStmt::Read(row, 129, e.deities4);
+		RepositoryStmt::Read(row, 130, e.deities5);
+		RepositoryStmt::Read(row, 131, e.deities6);
+		RepositoryStmt::Read(row, 132, e.deities7);
+		RepositoryStmt::Read(row, 133, e.deities8);
+		RepositoryStmt::Read(row, 134, e.deities9);
+		RepositoryStmt::Read(row, 135, e.deities10);
+		RepositoryStmt::Read(row, 136, e.deities11);
+		RepositoryStmt::Read(row, 137, e.deities12);
+		RepositoryStmt::Read(row, 138, e.deities13);
+		RepositoryStmt::Read(row, 139, e.deities14);
+		RepositoryStmt::Read(row, 140, e.deities15);
+		RepositoryStmt::Read(row, 141, e.deities16);
+		RepositoryStmt::Read(row, 142, e.field142);
+		RepositoryStmt::Read(row, 143, e.field143);
+		RepositoryStmt::Read(row, 144, e.new_icon);
+		RepositoryStmt::Read(row, 145, e.spellanim);
+		RepositoryStmt::Read(row, 146, e.uninterruptable);
+		RepositoryStmt::Read(row, 147, e.ResistDiff);
+		RepositoryStmt::Read(row, 148, e.dot_stacking_exempt);
+		RepositoryStmt::Read(row, 149, e.deleteable);
+		RepositoryStmt::Read(row, 150, e.RecourseLink);
+		RepositoryStmt::Read(row, 151, e.no_partial_resist);
+		RepositoryStmt::Read(row, 152, e.field152);
+		RepositoryStmt::Read(row, 153, e.field153);
+		RepositoryStmt::Read(row, 154, e.short_buff_box);
+		RepositoryStmt::Read(row, 155, e.descnum);
+		RepositoryStmt::Read(row, 156, e.typedescnum);
+		RepositoryStmt::Read(row, 157, e.effectdescnum);
+		RepositoryStmt::Read(row, 158, e.effectdescnum2);
+		RepositoryStmt::Read(row, 159, e.npc_no_los);
+		RepositoryStmt::Read(row, 160, e.field160);
+		RepositoryStmt::Read(row, 161, e.reflectable);
+		RepositoryStmt::Read(row, 162, e.bonushate);
+		RepositoryStmt::Read(row, 163, e.field163);
+		RepositoryStmt::Read(row, 164, e.field164);
+		RepositoryStmt::Read(row, 165, e.ldon_trap);
+		RepositoryStmt::Read(row, 166, e.EndurCost);
+		RepositoryStmt::Read(row, 167, e.EndurTimerIndex);
+		RepositoryStmt::Read(row, 168, e.IsDiscipline);
+		RepositoryStmt::Read(row, 169, e.field169);
+		RepositoryStmt::Read(row, 170, e.field170);
+		RepositoryStmt::Read(row, 171, e.field171);
+		RepositoryStmt::Read(row, 172, e.field172);
+		RepositoryStmt::Read(row, 173, e.HateAdded);
+		RepositoryStmt::Read(row, 174, e.EndurUpkeep);
+		RepositoryStmt::Read(row, 175, e.numhitstype);
+		RepositoryStmt::Read(row, 176, e.numhits);
+		RepositoryStmt::Read(row, 177, e.pvpresistbase);
+		RepositoryStmt::Read(row, 178, e.pvpresistcalc);
+		RepositoryStmt::Read(row, 179, e.pvpresistcap);
+		RepositoryStmt::Read(row, 180, e.spell_category);
+		RepositoryStmt::Read(row, 181, e.pvp_duration);
+		RepositoryStmt::Read(row, 182, e.pvp_duration_cap);
+		RepositoryStmt::Read(row, 183, e.pcnpc_only_flag);
+		RepositoryStmt::Read(row, 184, e.cast_not_standing);
+		RepositoryStmt::Read(row, 185, e.can_mgb);
+		RepositoryStmt::Read(row, 186, e.nodispell);
+		RepositoryStmt::Read(row, 187, e.npc_category);
+		RepositoryStmt::Read(row, 188, e.npc_usefulness);
+		RepositoryStmt::Read(row, 189, e.MinResist);
+		RepositoryStmt::Read(row, 190, e.MaxResist);
+		RepositoryStmt::Read(row, 191, e.viral_targets);
+		RepositoryStmt::Read(row, 192, e.viral_timer);
+		RepositoryStmt::Read(row, 193, e.nimbuseffect);
+		RepositoryStmt::Read(row, 194, e.ConeStartAngle);
+		RepositoryStmt::Read(row, 195, e.ConeStopAngle);
+		RepositoryStmt::Read(row, 196, e.sneaking);
+		RepositoryStmt::Read(row, 197, e.not_extendable);
+		RepositoryStmt::Read(row, 198, e.field198);
+		RepositoryStmt::Read(row, 199, e.field199);
+		RepositoryStmt::Read(row, 200, e.suspendable);
+		RepositoryStmt::Read(row, 201, e.viral_range);
+		RepositoryStmt::Read(row, 202, e.songcap);
+		RepositoryStmt::Read(row, 203, e.field203);
+		RepositoryStmt::Read(row, 204, e.field204);
+		RepositoryStmt::Read(row, 205, e.no_block);
+		RepositoryStmt::Read(row, 206, e.field206);
+		RepositoryStmt::Read(row, 207, e.spellgroup);
+		RepositoryStmt::Read(row, 208, e.rank_);
+		RepositoryStmt::Read(row, 209, e.field209);
+		RepositoryStmt::Read(row, 210, e.field210);
+		RepositoryStmt::Read(row, 211, e.CastRestriction);
+		RepositoryStmt::Read(row, 212, e.allowrest);
+		RepositoryStmt::Read(row, 213, e.InCombat);
+		RepositoryStmt::Read(row, 214, e.OutofCombat);
+		RepositoryStmt::Read(row, 215, e.field215);
+		RepositoryStmt::Read(row, 216, e.field216);
+		RepositoryStmt::Read(row, 217, e.field217);
+		RepositoryStmt::Read(row, 218, e.aemaxtargets);
+		RepositoryStmt::Read(row, 219, e.maxtargets);
+		RepositoryStmt::Read(row, 220, e.field220);
+		RepositoryStmt::Read(row, 221, e.field221);
+		RepositoryStmt::Read(row, 222, e.field222);
+		RepositoryStmt::Read(row, 223, e.field223);
+		RepositoryStmt::Read(row, 224, e.persistdeath);
+		RepositoryStmt::Read(row, 225, e.field225);
+		RepositoryStmt::Read(row, 226, e.field226);
+		RepositoryStmt::Read(row, 227, e.min_dist);
+		RepositoryStmt::Read(row, 228, e.min_dist_mod);
+		RepositoryStmt::Read(row, 229, e.max_dist);
+		RepositoryStmt::Read(row, 230, e.max_dist_mod);
+		RepositoryStmt::Read(row, 231, e.min_range);
+		RepositoryStmt::Read(row, 232, e.field232);
+		RepositoryStmt::Read(row, 233, e.field233);
+		RepositoryStmt::Read(row, 234, e.field234);
+		RepositoryStmt::Read(row, 235, e.field235);
+		RepositoryStmt::Read(row, 236, e.field236);
+	}
+
+	static SpellsNew FindOnePrepared(
+		Database& db,
+		int spells_new_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseSpellsNewRepository>(db, spells_new_id);
+	}
+
+	static std::vector<SpellsNew> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseSpellsNewRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const SpellsNew &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseSpellsNewRepository>(db, e, e.id);
+	}
+
+	static SpellsNew InsertOnePrepared(
+		Database& db,
+		SpellsNew e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseSpellsNewRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<SpellsNew> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseSpellsNewRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<SpellsNew> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseSpellsNewRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_SPELLS_NEW_REPOSITORY_H
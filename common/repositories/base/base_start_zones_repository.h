@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseStartZonesRepository {
@@ -591,6 +592,115 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const StartZones &e
+	)
+	{
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.zone_id);
+		v.emplace_back(e.bind_id);
+		v.emplace_back(e.player_choice);
+		v.emplace_back(e.player_class);
+		v.emplace_back(e.player_deity);
+		v.emplace_back(e.player_race);
+		v.emplace_back(e.start_zone);
+		v.emplace_back(e.bind_x);
+		v.emplace_back(e.bind_y);
+		v.emplace_back(e.bind_z);
+		v.emplace_back(e.select_rank);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		StartZones &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.x);
+		RepositoryStmt::Read(row, 1, e.y);
+		RepositoryStmt::Read(row, 2, e.z);
+		RepositoryStmt::Read(row, 3, e.heading);
+		RepositoryStmt::Read(row, 4, e.zone_id);
+		RepositoryStmt::Read(row, 5, e.bind_id);
+		RepositoryStmt::Read(row, 6, e.player_choice);
+		RepositoryStmt::Read(row, 7, e.player_class);
+		RepositoryStmt::Read(row, 8, e.player_deity);
+		RepositoryStmt::Read(row, 9, e.player_race);
+		RepositoryStmt::Read(row, 10, e.start_zone);
+		RepositoryStmt::Read(row, 11, e.bind_x);
+		RepositoryStmt::Read(row, 12, e.bind_y);
+		RepositoryStmt::Read(row, 13, e.bind_z);
+		RepositoryStmt::Read(row, 14, e.select_rank);
+		RepositoryStmt::Read(row, 15, e.min_expansion);
+		RepositoryStmt::Read(row, 16, e.max_expansion);
+		RepositoryStmt::Read(row, 17, e.content_flags);
+		RepositoryStmt::Read(row, 18, e.content_flags_disabled);
+	}
+
+	static StartZones FindOnePrepared(
+		Database& db,
+		int start_zones_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseStartZonesRepository>(db, start_zones_id);
+	}
+
+	static std::vector<StartZones> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseStartZonesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const StartZones &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseStartZonesRepository>(db, e, e.player_choice);
+	}
+
+	static StartZones InsertOnePrepared(
+		Database& db,
+		StartZones e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseStartZonesRepository>(db, e);
+		if (id) {
+			e.player_choice = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<StartZones> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseStartZonesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<StartZones> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseStartZonesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_START_ZONES_REPOSITORY_H
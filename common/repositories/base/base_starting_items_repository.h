@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseStartingItemsRepository {
@@ -590,6 +591,115 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const StartingItems &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.class_list));
+		v.emplace_back(std::string_view(e.race_list));
+		v.emplace_back(std::string_view(e.deity_list));
+		v.emplace_back(std::string_view(e.zone_id_list));
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.item_charges);
+		v.emplace_back(e.augment_one);
+		v.emplace_back(e.augment_two);
+		v.emplace_back(e.augment_three);
+		v.emplace_back(e.augment_four);
+		v.emplace_back(e.augment_five);
+		v.emplace_back(e.augment_six);
+		v.emplace_back(e.status);
+		v.emplace_back(e.inventory_slot);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		StartingItems &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.class_list);
+		RepositoryStmt::Read(row, 2, e.race_list);
+		RepositoryStmt::Read(row, 3, e.deity_list);
+		RepositoryStmt::Read(row, 4, e.zone_id_list);
+		RepositoryStmt::Read(row, 5, e.item_id);
+		RepositoryStmt::Read(row, 6, e.item_charges);
+		RepositoryStmt::Read(row, 7, e.augment_one);
+		RepositoryStmt::Read(row, 8, e.augment_two);
+		RepositoryStmt::Read(row, 9, e.augment_three);
+		RepositoryStmt::Read(row, 10, e.augment_four);
+		RepositoryStmt::Read(row, 11, e.augment_five);
+		RepositoryStmt::Read(row, 12, e.augment_six);
+		RepositoryStmt::Read(row, 13, e.status);
+		RepositoryStmt::Read(row, 14, e.inventory_slot);
+		RepositoryStmt::Read(row, 15, e.min_expansion);
+		RepositoryStmt::Read(row, 16, e.max_expansion);
+		RepositoryStmt::Read(row, 17, e.content_flags);
+		RepositoryStmt::Read(row, 18, e.content_flags_disabled);
+	}
+
+	static StartingItems FindOnePrepared(
+		Database& db,
+		int starting_items_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseStartingItemsRepository>(db, starting_items_id);
+	}
+
+	static std::vector<StartingItems> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseStartingItemsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const StartingItems &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseStartingItemsRepository>(db, e, e.id);
+	}
+
+	static StartingItems InsertOnePrepared(
+		Database& db,
+		StartingItems e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseStartingItemsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<StartingItems> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseStartingItemsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<StartingItems> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseStartingItemsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_STARTING_ITEMS_REPOSITORY_H
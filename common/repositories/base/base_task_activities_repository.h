@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTaskActivitiesRepository {
@@ -663,6 +664,127 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const TaskActivities &e
+	)
+	{
+		v.emplace_back(e.taskid);
+		v.emplace_back(e.activityid);
+		v.emplace_back(e.req_activity_id);
+		v.emplace_back(e.step);
+		v.emplace_back(e.activitytype);
+		v.emplace_back(std::string_view(e.target_name));
+		v.emplace_back(e.goalmethod);
+		v.emplace_back(e.goalcount);
+		v.emplace_back(std::string_view(e.description_override));
+		v.emplace_back(std::string_view(e.npc_match_list));
+		v.emplace_back(std::string_view(e.item_id_list));
+		v.emplace_back(std::string_view(e.item_list));
+		v.emplace_back(e.dz_switch_id);
+		v.emplace_back(e.min_x);
+		v.emplace_back(e.min_y);
+		v.emplace_back(e.min_z);
+		v.emplace_back(e.max_x);
+		v.emplace_back(e.max_y);
+		v.emplace_back(e.max_z);
+		v.emplace_back(std::string_view(e.skill_list));
+		v.emplace_back(std::string_view(e.spell_list));
+		v.emplace_back(std::string_view(e.zones));
+		v.emplace_back(e.zone_version);
+		v.emplace_back(e.optional);
+		v.emplace_back(e.list_group);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		TaskActivities &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.taskid);
+		RepositoryStmt::Read(row, 1, e.activityid);
+		RepositoryStmt::Read(row, 2, e.req_activity_id);
+		RepositoryStmt::Read(row, 3, e.step);
+		RepositoryStmt::Read(row, 4, e.activitytype);
+		RepositoryStmt::Read(row, 5, e.target_name);
+		RepositoryStmt::Read(row, 6, e.goalmethod);
+		RepositoryStmt::Read(row, 7, e.goalcount);
+		RepositoryStmt::Read(row, 8, e.description_override);
+		RepositoryStmt::Read(row, 9, e.npc_match_list);
+		RepositoryStmt::Read(row, 10, e.item_id_list);
+		RepositoryStmt::Read(row, 11, e.item_list);
+		RepositoryStmt::Read(row, 12, e.dz_switch_id);
+		RepositoryStmt::Read(row, 13, e.min_x);
+		RepositoryStmt::Read(row, 14, e.min_y);
+		RepositoryStmt::Read(row, 15, e.min_z);
+		RepositoryStmt::Read(row, 16, e.max_x);
+		RepositoryStmt::Read(row, 17, e.max_y);
+		RepositoryStmt::Read(row, 18, e.max_z);
+		RepositoryStmt::Read(row, 19, e.skill_list);
+		RepositoryStmt::Read(row, 20, e.spell_list);
+		RepositoryStmt::Read(row, 21, e.zones);
+		RepositoryStmt::Read(row, 22, e.zone_version);
+		RepositoryStmt::Read(row, 23, e.optional);
+		RepositoryStmt::Read(row, 24, e.list_group);
+	}
+
+	static TaskActivities FindOnePrepared(
+		Database& db,
+		int task_activities_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTaskActivitiesRepository>(db, task_activities_id);
+	}
+
+	static std::vector<TaskActivities> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTaskActivitiesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const TaskActivities &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTaskActivitiesRepository>(db, e, e.taskid);
+	}
+
+	static TaskActivities InsertOnePrepared(
+		Database& db,
+		TaskActivities e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTaskActivitiesRepository>(db, e);
+		if (id) {
+			e.taskid = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<TaskActivities> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTaskActivitiesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<TaskActivities> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTaskActivitiesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TASK_ACTIVITIES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTasksRepository {
@@ -711,6 +712,135 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Tasks &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.duration);
+		v.emplace_back(e.duration_code);
+		v.emplace_back(std::string_view(e.title));
+		v.emplace_back(std::string_view(e.description));
+		v.emplace_back(std::string_view(e.reward_text));
+		v.emplace_back(std::string_view(e.reward_id_list));
+		v.emplace_back(e.cash_reward);
+		v.emplace_back(e.exp_reward);
+		v.emplace_back(e.reward_method);
+		v.emplace_back(e.reward_points);
+		v.emplace_back(e.reward_point_type);
+		v.emplace_back(e.min_level);
+		v.emplace_back(e.max_level);
+		v.emplace_back(e.level_spread);
+		v.emplace_back(e.min_players);
+		v.emplace_back(e.max_players);
+		v.emplace_back(e.repeatable);
+		v.emplace_back(e.faction_reward);
+		v.emplace_back(std::string_view(e.completion_emote));
+		v.emplace_back(e.replay_timer_group);
+		v.emplace_back(e.replay_timer_seconds);
+		v.emplace_back(e.request_timer_group);
+		v.emplace_back(e.request_timer_seconds);
+		v.emplace_back(e.dz_template_id);
+		v.emplace_back(e.lock_activity_id);
+		v.emplace_back(e.faction_amount);
+		v.emplace_back(e.enabled);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Tasks &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.duration);
+		RepositoryStmt::Read(row, 3, e.duration_code);
+		RepositoryStmt::Read(row, 4, e.title);
+		RepositoryStmt::Read(row, 5, e.description);
+		RepositoryStmt::Read(row, 6, e.reward_text);
+		RepositoryStmt::Read(row, 7, e.reward_id_list);
+		RepositoryStmt::Read(row, 8, e.cash_reward);
+		RepositoryStmt::Read(row, 9, e.exp_reward);
+		RepositoryStmt::Read(row, 10, e.reward_method);
+		RepositoryStmt::Read(row, 11, e.reward_points);
+		RepositoryStmt::Read(row, 12, e.reward_point_type);
+		RepositoryStmt::Read(row, 13, e.min_level);
+		RepositoryStmt::Read(row, 14, e.max_level);
+		RepositoryStmt::Read(row, 15, e.level_spread);
+		RepositoryStmt::Read(row, 16, e.min_players);
+		RepositoryStmt::Read(row, 17, e.max_players);
+		RepositoryStmt::Read(row, 18, e.repeatable);
+		RepositoryStmt::Read(row, 19, e.faction_reward);
+		RepositoryStmt::Read(row, 20, e.completion_emote);
+		RepositoryStmt::Read(row, 21, e.replay_timer_group);
+		RepositoryStmt::Read(row, 22, e.replay_timer_seconds);
+		RepositoryStmt::Read(row, 23, e.request_timer_group);
+		RepositoryStmt::Read(row, 24, e.request_timer_seconds);
+		RepositoryStmt::Read(row, 25, e.dz_template_id);
+		RepositoryStmt::Read(row, 26, e.lock_activity_id);
+		RepositoryStmt::Read(row, 27, e.faction_amount);
+		RepositoryStmt::Read(row, 28, e.enabled);
+	}
+
+	static Tasks FindOnePrepared(
+		Database& db,
+		int tasks_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTasksRepository>(db, tasks_id);
+	}
+
+	static std::vector<Tasks> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTasksRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Tasks &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTasksRepository>(db, e, e.id);
+	}
+
+	static Tasks InsertOnePrepared(
+		Database& db,
+		Tasks e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTasksRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Tasks> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTasksRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Tasks> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTasksRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TASKS_REPOSITORY_H
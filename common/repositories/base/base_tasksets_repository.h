@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTasksetsRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Tasksets &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.taskid);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Tasksets &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.taskid);
+	}
+
+	static Tasksets FindOnePrepared(
+		Database& db,
+		int tasksets_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTasksetsRepository>(db, tasksets_id);
+	}
+
+	static std::vector<Tasksets> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTasksetsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Tasksets &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTasksetsRepository>(db, e, e.id);
+	}
+
+	static Tasksets InsertOnePrepared(
+		Database& db,
+		Tasksets e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTasksetsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Tasksets> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTasksetsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Tasksets> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTasksetsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TASKSETS_REPOSITORY_H
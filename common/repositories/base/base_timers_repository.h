@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTimersRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Timers &e
+	)
+	{
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.type);
+		v.emplace_back(e.start);
+		v.emplace_back(e.duration);
+		v.emplace_back(e.enable);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Timers &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.char_id);
+		RepositoryStmt::Read(row, 1, e.type);
+		RepositoryStmt::Read(row, 2, e.start);
+		RepositoryStmt::Read(row, 3, e.duration);
+		RepositoryStmt::Read(row, 4, e.enable);
+	}
+
+	static Timers FindOnePrepared(
+		Database& db,
+		int timers_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTimersRepository>(db, timers_id);
+	}
+
+	static std::vector<Timers> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTimersRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Timers &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTimersRepository>(db, e, e.char_id);
+	}
+
+	static Timers InsertOnePrepared(
+		Database& db,
+		Timers e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTimersRepository>(db, e);
+		if (id) {
+			e.char_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Timers> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTimersRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Timers> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTimersRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TIMERS_REPOSITORY_H
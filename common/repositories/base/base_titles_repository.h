@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTitlesRepository {
@@ -530,6 +531,105 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Titles &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.skill_id);
+		v.emplace_back(e.min_skill_value);
+		v.emplace_back(e.max_skill_value);
+		v.emplace_back(e.min_aa_points);
+		v.emplace_back(e.max_aa_points);
+		v.emplace_back(e.class_);
+		v.emplace_back(e.gender);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.status);
+		v.emplace_back(e.item_id);
+		v.emplace_back(std::string_view(e.prefix));
+		v.emplace_back(std::string_view(e.suffix));
+		v.emplace_back(e.title_set);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Titles &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.skill_id);
+		RepositoryStmt::Read(row, 2, e.min_skill_value);
+		RepositoryStmt::Read(row, 3, e.max_skill_value);
+		RepositoryStmt::Read(row, 4, e.min_aa_points);
+		RepositoryStmt::Read(row, 5, e.max_aa_points);
+		RepositoryStmt::Read(row, 6, e.class_);
+		RepositoryStmt::Read(row, 7, e.gender);
+		RepositoryStmt::Read(row, 8, e.char_id);
+		RepositoryStmt::Read(row, 9, e.status);
+		RepositoryStmt::Read(row, 10, e.item_id);
+		RepositoryStmt::Read(row, 11, e.prefix);
+		RepositoryStmt::Read(row, 12, e.suffix);
+		RepositoryStmt::Read(row, 13, e.title_set);
+	}
+
+	static Titles FindOnePrepared(
+		Database& db,
+		int titles_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTitlesRepository>(db, titles_id);
+	}
+
+	static std::vector<Titles> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTitlesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Titles &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTitlesRepository>(db, e, e.id);
+	}
+
+	static Titles InsertOnePrepared(
+		Database& db,
+		Titles e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTitlesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Titles> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTitlesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Titles> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTitlesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TITLES_REPOSITORY_H
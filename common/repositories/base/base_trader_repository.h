@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTraderRepository {
@@ -578,6 +579,113 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Trader &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.char_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.aug_slot_1);
+		v.emplace_back(e.aug_slot_2);
+		v.emplace_back(e.aug_slot_3);
+		v.emplace_back(e.aug_slot_4);
+		v.emplace_back(e.aug_slot_5);
+		v.emplace_back(e.aug_slot_6);
+		v.emplace_back(e.item_sn);
+		v.emplace_back(e.item_charges);
+		v.emplace_back(e.item_cost);
+		v.emplace_back(e.slot_id);
+		v.emplace_back(e.char_entity_id);
+		v.emplace_back(e.char_zone_id);
+		v.emplace_back(e.char_zone_instance_id);
+		v.emplace_back(e.active_transaction);
+		v.emplace_back(RepositoryStmt::DateTime(e.listing_date));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Trader &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.char_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.aug_slot_1);
+		RepositoryStmt::Read(row, 4, e.aug_slot_2);
+		RepositoryStmt::Read(row, 5, e.aug_slot_3);
+		RepositoryStmt::Read(row, 6, e.aug_slot_4);
+		RepositoryStmt::Read(row, 7, e.aug_slot_5);
+		RepositoryStmt::Read(row, 8, e.aug_slot_6);
+		RepositoryStmt::Read(row, 9, e.item_sn);
+		RepositoryStmt::Read(row, 10, e.item_charges);
+		RepositoryStmt::Read(row, 11, e.item_cost);
+		RepositoryStmt::Read(row, 12, e.slot_id);
+		RepositoryStmt::Read(row, 13, e.char_entity_id);
+		RepositoryStmt::Read(row, 14, e.char_zone_id);
+		RepositoryStmt::Read(row, 15, e.char_zone_instance_id);
+		RepositoryStmt::Read(row, 16, e.active_transaction);
+		RepositoryStmt::Read(row, 17, e.listing_date);
+	}
+
+	static Trader FindOnePrepared(
+		Database& db,
+		int trader_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTraderRepository>(db, trader_id);
+	}
+
+	static std::vector<Trader> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTraderRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Trader &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTraderRepository>(db, e, e.id);
+	}
+
+	static Trader InsertOnePrepared(
+		Database& db,
+		Trader e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTraderRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Trader> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTraderRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Trader> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTraderRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRADER_REPOSITORY_H
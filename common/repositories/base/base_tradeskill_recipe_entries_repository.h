@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTradeskillRecipeEntriesRepository {
@@ -458,6 +459,93 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const TradeskillRecipeEntries &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.recipe_id);
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.successcount);
+		v.emplace_back(e.failcount);
+		v.emplace_back(e.componentcount);
+		v.emplace_back(e.salvagecount);
+		v.emplace_back(e.iscontainer);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		TradeskillRecipeEntries &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.recipe_id);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.successcount);
+		RepositoryStmt::Read(row, 4, e.failcount);
+		RepositoryStmt::Read(row, 5, e.componentcount);
+		RepositoryStmt::Read(row, 6, e.salvagecount);
+		RepositoryStmt::Read(row, 7, e.iscontainer);
+	}
+
+	static TradeskillRecipeEntries FindOnePrepared(
+		Database& db,
+		int tradeskill_recipe_entries_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTradeskillRecipeEntriesRepository>(db, tradeskill_recipe_entries_id);
+	}
+
+	static std::vector<TradeskillRecipeEntries> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTradeskillRecipeEntriesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const TradeskillRecipeEntries &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTradeskillRecipeEntriesRepository>(db, e, e.id);
+	}
+
+	static TradeskillRecipeEntries InsertOnePrepared(
+		Database& db,
+		TradeskillRecipeEntries e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTradeskillRecipeEntriesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<TradeskillRecipeEntries> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTradeskillRecipeEntriesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<TradeskillRecipeEntries> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTradeskillRecipeEntriesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRADESKILL_RECIPE_ENTRIES_REPOSITORY_H
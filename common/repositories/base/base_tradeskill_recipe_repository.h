@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTradeskillRecipeRepository {
@@ -554,6 +555,109 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const TradeskillRecipe &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.tradeskill);
+		v.emplace_back(e.skillneeded);
+		v.emplace_back(e.trivial);
+		v.emplace_back(e.nofail);
+		v.emplace_back(e.replace_container);
+		v.emplace_back(std::string_view(e.notes));
+		v.emplace_back(e.must_learn);
+		v.emplace_back(e.learned_by_item_id);
+		v.emplace_back(e.quest);
+		v.emplace_back(e.enabled);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		TradeskillRecipe &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.tradeskill);
+		RepositoryStmt::Read(row, 3, e.skillneeded);
+		RepositoryStmt::Read(row, 4, e.trivial);
+		RepositoryStmt::Read(row, 5, e.nofail);
+		RepositoryStmt::Read(row, 6, e.replace_container);
+		RepositoryStmt::Read(row, 7, e.notes);
+		RepositoryStmt::Read(row, 8, e.must_learn);
+		RepositoryStmt::Read(row, 9, e.learned_by_item_id);
+		RepositoryStmt::Read(row, 10, e.quest);
+		RepositoryStmt::Read(row, 11, e.enabled);
+		RepositoryStmt::Read(row, 12, e.min_expansion);
+		RepositoryStmt::Read(row, 13, e.max_expansion);
+		RepositoryStmt::Read(row, 14, e.content_flags);
+		RepositoryStmt::Read(row, 15, e.content_flags_disabled);
+	}
+
+	static TradeskillRecipe FindOnePrepared(
+		Database& db,
+		int tradeskill_recipe_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTradeskillRecipeRepository>(db, tradeskill_recipe_id);
+	}
+
+	static std::vector<TradeskillRecipe> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTradeskillRecipeRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const TradeskillRecipe &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTradeskillRecipeRepository>(db, e, e.id);
+	}
+
+	static TradeskillRecipe InsertOnePrepared(
+		Database& db,
+		TradeskillRecipe e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTradeskillRecipeRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<TradeskillRecipe> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTradeskillRecipeRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<TradeskillRecipe> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTradeskillRecipeRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRADESKILL_RECIPE_REPOSITORY_H
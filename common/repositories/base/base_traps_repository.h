@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTrapsRepository {
@@ -662,6 +663,127 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Traps &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.version);
+		v.emplace_back(e.x);
+		v.emplace_back(e.y);
+		v.emplace_back(e.z);
+		v.emplace_back(e.chance);
+		v.emplace_back(e.maxzdiff);
+		v.emplace_back(e.radius);
+		v.emplace_back(e.effect);
+		v.emplace_back(e.effectvalue);
+		v.emplace_back(e.effectvalue2);
+		v.emplace_back(std::string_view(e.message));
+		v.emplace_back(e.skill);
+		v.emplace_back(e.level);
+		v.emplace_back(e.respawn_time);
+		v.emplace_back(e.respawn_var);
+		v.emplace_back(e.triggered_number);
+		v.emplace_back(e.group_);
+		v.emplace_back(e.despawn_when_triggered);
+		v.emplace_back(e.undetectable);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Traps &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.x);
+		RepositoryStmt::Read(row, 4, e.y);
+		RepositoryStmt::Read(row, 5, e.z);
+		RepositoryStmt::Read(row, 6, e.chance);
+		RepositoryStmt::Read(row, 7, e.maxzdiff);
+		RepositoryStmt::Read(row, 8, e.radius);
+		RepositoryStmt::Read(row, 9, e.effect);
+		RepositoryStmt::Read(row, 10, e.effectvalue);
+		RepositoryStmt::Read(row, 11, e.effectvalue2);
+		RepositoryStmt::Read(row, 12, e.message);
+		RepositoryStmt::Read(row, 13, e.skill);
+		RepositoryStmt::Read(row, 14, e.level);
+		RepositoryStmt::Read(row, 15, e.respawn_time);
+		RepositoryStmt::Read(row, 16, e.respawn_var);
+		RepositoryStmt::Read(row, 17, e.triggered_number);
+		RepositoryStmt::Read(row, 18, e.group_);
+		RepositoryStmt::Read(row, 19, e.despawn_when_triggered);
+		RepositoryStmt::Read(row, 20, e.undetectable);
+		RepositoryStmt::Read(row, 21, e.min_expansion);
+		RepositoryStmt::Read(row, 22, e.max_expansion);
+		RepositoryStmt::Read(row, 23, e.content_flags);
+		RepositoryStmt::Read(row, 24, e.content_flags_disabled);
+	}
+
+	static Traps FindOnePrepared(
+		Database& db,
+		int traps_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTrapsRepository>(db, traps_id);
+	}
+
+	static std::vector<Traps> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTrapsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Traps &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTrapsRepository>(db, e, e.id);
+	}
+
+	static Traps InsertOnePrepared(
+		Database& db,
+		Traps e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTrapsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Traps> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTrapsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Traps> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTrapsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRAPS_REPOSITORY_H
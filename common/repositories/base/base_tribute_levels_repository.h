@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTributeLevelsRepository {
@@ -411,6 +412,85 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const TributeLevels &e
+	)
+	{
+		v.emplace_back(e.tribute_id);
+		v.emplace_back(e.level);
+		v.emplace_back(e.cost);
+		v.emplace_back(e.item_id);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		TributeLevels &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.tribute_id);
+		RepositoryStmt::Read(row, 1, e.level);
+		RepositoryStmt::Read(row, 2, e.cost);
+		RepositoryStmt::Read(row, 3, e.item_id);
+	}
+
+	static TributeLevels FindOnePrepared(
+		Database& db,
+		int tribute_levels_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTributeLevelsRepository>(db, tribute_levels_id);
+	}
+
+	static std::vector<TributeLevels> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTributeLevelsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const TributeLevels &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTributeLevelsRepository>(db, e, e.tribute_id);
+	}
+
+	static TributeLevels InsertOnePrepared(
+		Database& db,
+		TributeLevels e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTributeLevelsRepository>(db, e);
+		if (id) {
+			e.tribute_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<TributeLevels> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTributeLevelsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<TributeLevels> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTributeLevelsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRIBUTE_LEVELS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseTributesRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Tributes &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.unknown);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(std::string_view(e.descr));
+		v.emplace_back(e.isguild);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Tributes &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.unknown);
+		RepositoryStmt::Read(row, 2, e.name);
+		RepositoryStmt::Read(row, 3, e.descr);
+		RepositoryStmt::Read(row, 4, e.isguild);
+	}
+
+	static Tributes FindOnePrepared(
+		Database& db,
+		int tributes_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseTributesRepository>(db, tributes_id);
+	}
+
+	static std::vector<Tributes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseTributesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Tributes &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseTributesRepository>(db, e, e.id);
+	}
+
+	static Tributes InsertOnePrepared(
+		Database& db,
+		Tributes e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseTributesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Tributes> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseTributesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Tributes> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseTributesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_TRIBUTES_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseVariablesRepository {
@@ -422,6 +423,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Variables &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.varname));
+		v.emplace_back(std::string_view(e.value));
+		v.emplace_back(std::string_view(e.information));
+		v.emplace_back(RepositoryStmt::DateTime(e.ts));
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Variables &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.varname);
+		RepositoryStmt::Read(row, 2, e.value);
+		RepositoryStmt::Read(row, 3, e.information);
+		RepositoryStmt::Read(row, 4, e.ts);
+	}
+
+	static Variables FindOnePrepared(
+		Database& db,
+		int variables_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseVariablesRepository>(db, variables_id);
+	}
+
+	static std::vector<Variables> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseVariablesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Variables &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseVariablesRepository>(db, e, e.id);
+	}
+
+	static Variables InsertOnePrepared(
+		Database& db,
+		Variables e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseVariablesRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Variables> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseVariablesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Variables> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseVariablesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_VARIABLES_REPOSITORY_H
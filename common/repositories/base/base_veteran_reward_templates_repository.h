@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseVeteranRewardTemplatesRepository {
@@ -423,6 +424,87 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const VeteranRewardTemplates &e
+	)
+	{
+		v.emplace_back(e.claim_id);
+		v.emplace_back(std::string_view(e.name));
+		v.emplace_back(e.item_id);
+		v.emplace_back(e.charges);
+		v.emplace_back(e.reward_slot);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		VeteranRewardTemplates &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.claim_id);
+		RepositoryStmt::Read(row, 1, e.name);
+		RepositoryStmt::Read(row, 2, e.item_id);
+		RepositoryStmt::Read(row, 3, e.charges);
+		RepositoryStmt::Read(row, 4, e.reward_slot);
+	}
+
+	static VeteranRewardTemplates FindOnePrepared(
+		Database& db,
+		int veteran_reward_templates_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseVeteranRewardTemplatesRepository>(db, veteran_reward_templates_id);
+	}
+
+	static std::vector<VeteranRewardTemplates> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseVeteranRewardTemplatesRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const VeteranRewardTemplates &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseVeteranRewardTemplatesRepository>(db, e, e.claim_id);
+	}
+
+	static VeteranRewardTemplates InsertOnePrepared(
+		Database& db,
+		VeteranRewardTemplates e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseVeteranRewardTemplatesRepository>(db, e);
+		if (id) {
+			e.claim_id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<VeteranRewardTemplates> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseVeteranRewardTemplatesRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<VeteranRewardTemplates> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseVeteranRewardTemplatesRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_VETERAN_REWARD_TEMPLATES_REPOSITORY_H
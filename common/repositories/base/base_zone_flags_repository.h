@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseZoneFlagsRepository {
@@ -387,6 +388,81 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ZoneFlags &e
+	)
+	{
+		v.emplace_back(e.charID);
+		v.emplace_back(e.zoneID);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ZoneFlags &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.charID);
+		RepositoryStmt::Read(row, 1, e.zoneID);
+	}
+
+	static ZoneFlags FindOnePrepared(
+		Database& db,
+		int zone_flags_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseZoneFlagsRepository>(db, zone_flags_id);
+	}
+
+	static std::vector<ZoneFlags> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseZoneFlagsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ZoneFlags &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseZoneFlagsRepository>(db, e, e.charID);
+	}
+
+	static ZoneFlags InsertOnePrepared(
+		Database& db,
+		ZoneFlags e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseZoneFlagsRepository>(db, e);
+		if (id) {
+			e.charID = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ZoneFlags> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseZoneFlagsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ZoneFlags> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseZoneFlagsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ZONE_FLAGS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseZonePointsRepository {
@@ -650,6 +651,125 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const ZonePoints &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(std::string_view(e.zone));
+		v.emplace_back(e.version);
+		v.emplace_back(e.number);
+		v.emplace_back(e.y);
+		v.emplace_back(e.x);
+		v.emplace_back(e.z);
+		v.emplace_back(e.heading);
+		v.emplace_back(e.target_y);
+		v.emplace_back(e.target_x);
+		v.emplace_back(e.target_z);
+		v.emplace_back(e.target_heading);
+		v.emplace_back(e.zoneinst);
+		v.emplace_back(e.target_zone_id);
+		v.emplace_back(e.target_instance);
+		v.emplace_back(e.buffer);
+		v.emplace_back(e.client_version_mask);
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+		v.emplace_back(e.is_virtual);
+		v.emplace_back(e.height);
+		v.emplace_back(e.width);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		ZonePoints &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zone);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.number);
+		RepositoryStmt::Read(row, 4, e.y);
+		RepositoryStmt::Read(row, 5, e.x);
+		RepositoryStmt::Read(row, 6, e.z);
+		RepositoryStmt::Read(row, 7, e.heading);
+		RepositoryStmt::Read(row, 8, e.target_y);
+		RepositoryStmt::Read(row, 9, e.target_x);
+		RepositoryStmt::Read(row, 10, e.target_z);
+		RepositoryStmt::Read(row, 11, e.target_heading);
+		RepositoryStmt::Read(row, 12, e.zoneinst);
+		RepositoryStmt::Read(row, 13, e.target_zone_id);
+		RepositoryStmt::Read(row, 14, e.target_instance);
+		RepositoryStmt::Read(row, 15, e.buffer);
+		RepositoryStmt::Read(row, 16, e.client_version_mask);
+		RepositoryStmt::Read(row, 17, e.min_expansion);
+		RepositoryStmt::Read(row, 18, e.max_expansion);
+		RepositoryStmt::Read(row, 19, e.content_flags);
+		RepositoryStmt::Read(row, 20, e.content_flags_disabled);
+		RepositoryStmt::Read(row, 21, e.is_virtual);
+		RepositoryStmt::Read(row, 22, e.height);
+		RepositoryStmt::Read(row, 23, e.width);
+	}
+
+	static ZonePoints FindOnePrepared(
+		Database& db,
+		int zone_points_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseZonePointsRepository>(db, zone_points_id);
+	}
+
+	static std::vector<ZonePoints> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseZonePointsRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const ZonePoints &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseZonePointsRepository>(db, e, e.id);
+	}
+
+	static ZonePoints InsertOnePrepared(
+		Database& db,
+		ZonePoints e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseZonePointsRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<ZonePoints> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseZonePointsRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<ZonePoints> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseZonePointsRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ZONE_POINTS_REPOSITORY_H
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../strings.h"
+#include "../stmt/repository_stmt.h"
 #include <ctime>
 
 class BaseZoneRepository {
@@ -1550,6 +1551,275 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	static void StmtBind(
+		std::vector<RepositoryStmt::param_t> &v,
+		const Zone &e
+	)
+	{
+		v.emplace_back(e.id);
+		v.emplace_back(e.zoneidnumber);
+		v.emplace_back(e.version);
+		v.emplace_back(std::string_view(e.short_name));
+		v.emplace_back(std::string_view(e.long_name));
+		v.emplace_back(e.min_status);
+		v.emplace_back(std::string_view(e.map_file_name));
+		v.emplace_back(std::string_view(e.note));
+		v.emplace_back(e.min_expansion);
+		v.emplace_back(e.max_expansion);
+		v.emplace_back(std::string_view(e.content_flags));
+		v.emplace_back(std::string_view(e.content_flags_disabled));
+		v.emplace_back(e.expansion);
+		v.emplace_back(std::string_view(e.file_name));
+		v.emplace_back(e.safe_x);
+		v.emplace_back(e.safe_y);
+		v.emplace_back(e.safe_z);
+		v.emplace_back(e.safe_heading);
+		v.emplace_back(e.graveyard_id);
+		v.emplace_back(e.min_level);
+		v.emplace_back(e.max_level);
+		v.emplace_back(e.timezone);
+		v.emplace_back(e.maxclients);
+		v.emplace_back(e.ruleset);
+		v.emplace_back(e.underworld);
+		v.emplace_back(e.minclip);
+		v.emplace_back(e.maxclip);
+		v.emplace_back(e.fog_minclip);
+		v.emplace_back(e.fog_maxclip);
+		v.emplace_back(e.fog_blue);
+		v.emplace_back(e.fog_red);
+		v.emplace_back(e.fog_green);
+		v.emplace_back(e.sky);
+		v.emplace_back(e.ztype);
+		v.emplace_back(e.zone_exp_multiplier);
+		v.emplace_back(e.walkspeed);
+		v.emplace_back(e.time_type);
+		v.emplace_back(e.fog_red1);
+		v.emplace_back(e.fog_green1);
+		v.emplace_back(e.fog_blue1);
+		v.emplace_back(e.fog_minclip1);
+		v.emplace_back(e.fog_maxclip1);
+		v.emplace_back(e.fog_red2);
+		v.emplace_back(e.fog_green2);
+		v.emplace_back(e.fog_blue2);
+		v.emplace_back(e.fog_minclip2);
+		v.emplace_back(e.fog_maxclip2);
+		v.emplace_back(e.fog_red3);
+		v.emplace_back(e.fog_green3);
+		v.emplace_back(e.fog_blue3);
+		v.emplace_back(e.fog_minclip3);
+		v.emplace_back(e.fog_maxclip3);
+		v.emplace_back(e.fog_red4);
+		v.emplace_back(e.fog_green4);
+		v.emplace_back(e.fog_blue4);
+		v.emplace_back(e.fog_minclip4);
+		v.emplace_back(e.fog_maxclip4);
+		v.emplace_back(e.fog_density);
+		v.emplace_back(std::string_view(e.flag_needed));
+		v.emplace_back(e.canbind);
+		v.emplace_back(e.cancombat);
+		v.emplace_back(e.canlevitate);
+		v.emplace_back(e.castoutdoor);
+		v.emplace_back(e.hotzone);
+		v.emplace_back(e.insttype);
+		v.emplace_back(e.shutdowndelay);
+		v.emplace_back(e.peqzone);
+		v.emplace_back(e.bypass_expansion_check);
+		v.emplace_back(e.suspendbuffs);
+		v.emplace_back(e.rain_chance1);
+		v.emplace_back(e.rain_chance2);
+		v.emplace_back(e.rain_chance3);
+		v.emplace_back(e.rain_chance4);
+		v.emplace_back(e.rain_duration1);
+		v.emplace_back(e.rain_duration2);
+		v.emplace_back(e.rain_duration3);
+		v.emplace_back(e.rain_duration4);
+		v.emplace_back(e.snow_chance1);
+		v.emplace_back(e.snow_chance2);
+		v.emplace_back(e.snow_chance3);
+		v.emplace_back(e.snow_chance4);
+		v.emplace_back(e.snow_duration1);
+		v.emplace_back(e.snow_duration2);
+		v.emplace_back(e.snow_duration3);
+		v.emplace_back(e.snow_duration4);
+		v.emplace_back(e.gravity);
+		v.emplace_back(e.type);
+		v.emplace_back(e.skylock);
+		v.emplace_back(e.fast_regen_hp);
+		v.emplace_back(e.fast_regen_mana);
+		v.emplace_back(e.fast_regen_endurance);
+		v.emplace_back(e.npc_max_aggro_dist);
+		v.emplace_back(e.client_update_range);
+		v.emplace_back(e.underworld_teleport_index);
+		v.emplace_back(e.lava_damage);
+		v.emplace_back(e.min_lava_damage);
+		v.emplace_back(e.idle_when_empty);
+		v.emplace_back(e.seconds_before_idle);
+		v.emplace_back(e.shard_at_player_count);
+	}
+
+	static void StmtRead(
+		const mysql::StmtRow &row,
+		Zone &e
+	)
+	{
+		RepositoryStmt::Read(row, 0, e.id);
+		RepositoryStmt::Read(row, 1, e.zoneidnumber);
+		RepositoryStmt::Read(row, 2, e.version);
+		RepositoryStmt::Read(row, 3, e.short_name);
+		RepositoryStmt::Read(row, 4, e.long_name);
+		RepositoryStmt::Read(row, 5, e.min_status);
+		RepositoryStmt::Read(row, 6, e.map_file_name);
+		RepositoryStmt::Read(row, 7, e.note);
+		RepositoryStmt::Read(row, 8, e.min_expansion);
+		RepositoryStmt::Read(row, 9, e.max_expansion);
+		RepositoryStmt::Read(row, 10, e.content_flags);
+		RepositoryStmt::Read(row, 11, e.content_flags_disabled);
+		RepositoryStmt::Read(row, 12, e.expansion);
+		RepositoryStmt::Read(row, 13, e.file_name);
+		RepositoryStmt::Read(row, 14, e.safe_x);
+		RepositoryStmt::Read(row, 15, e.safe_y);
+		RepositoryStmt::Read(row, 16, e.safe_z);
+		RepositoryStmt::Read(row, 17, e.safe_heading);
+		RepositoryStmt::Read(row, 18, e.graveyard_id);
+		RepositoryStmt::Read(row, 19, e.min_level);
+		RepositoryStmt::Read(row, 20, e.max_level);
+		RepositoryStmt::Read(row, 21, e.timezone);
+		RepositoryStmt::Read(row, 22, e.maxclients);
+		RepositoryStmt::Read(row, 23, e.ruleset);
+		RepositoryStmt::Read(row, 24, e.underworld);
+		RepositoryStmt::Read(row, 25, e.minclip);
+		RepositoryStmt::Read(row, 26, e.maxclip);
+		RepositoryStmt::Read(row, 27, e.fog_minclip);
+		RepositoryStmt::Read(row, 28, e.fog_maxclip);
+		RepositoryStmt::Read(row, 29, e.fog_blue);
+		RepositoryStmt::Read(row, 30, e.fog_red);
+		RepositoryStmt::Read(row, 31, e.fog_green);
+		RepositoryStmt::Read(row, 32, e.sky);
+		RepositoryStmt::Read(row, 33, e.ztype);
+		RepositoryStmt::Read(row, 34, e.zone_exp_multiplier);
+		RepositoryStmt::Read(row, 35, e.walkspeed);
+		RepositoryStmt::Read(row, 36, e.time_type);
+		RepositoryStmt::Read(row, 37, e.fog_red1);
+		RepositoryStmt::Read(row, 38, e.fog_green1);
+		RepositoryStmt::Read(row, 39, e.fog_blue1);
+		RepositoryStmt::Read(row, 40, e.fog_minclip1);
+		RepositoryStmt::Read(row, 41, e.fog_maxclip1);
+		RepositoryStmt::Read(row, 42, e.fog_red2);
+		RepositoryStmt::Read(row, 43, e.fog_green2);
+		RepositoryStmt::Read(row, 44, e.fog_blue2);
+		RepositoryStmt::Read(row, 45, e.fog_minclip2);
+		RepositoryStmt::Read(row, 46, e.fog_maxclip2);
+		RepositoryStmt::Read(row, 47, e.fog_red3);
+		RepositoryStmt::Read(row, 48, e.fog_green3);
+		RepositoryStmt::Read(row, 49, e.fog_blue3);
+		RepositoryStmt::Read(row, 50, e.fog_minclip3);
+		RepositoryStmt::Read(row, 51, e.fog_maxclip3);
+		RepositoryStmt::Read(row, 52, e.fog_red4);
+		RepositoryStmt::Read(row, 53, e.fog_green4);
+		RepositoryStmt::Read(row, 54, e.fog_blue4);
+		RepositoryStmt::Read(row, 55, e.fog_minclip4);
+		RepositoryStmt::Read(row, 56, e.fog_maxclip4);
+		RepositoryStmt::Read(row, 57, e.fog_density);
+		RepositoryStmt::Read(row, 58, e.flag_needed);
+		RepositoryStmt::Read(row, 59, e.canbind);
+		RepositoryStmt::Read(row, 60, e.cancombat);
+		RepositoryStmt::Read(row, 61, e.canlevitate);
+		RepositoryStmt::Read(row, 62, e.castoutdoor);
+		RepositoryStmt::Read(row, 63, e.hotzone);
+		RepositoryStmt::Read(row, 64, e.insttype);
+		RepositoryStmt::Read(row, 65, e.shutdowndelay);
+		RepositoryStmt::Read(row, 66, e.peqzone);
+		RepositoryStmt::Read(row, 67, e.bypass_expansion_check);
+		RepositoryStmt::Read(row, 68, e.suspendbuffs);
+		RepositoryStmt::Read(row, 69, e.rain_chance1);
+		RepositoryStmt::Read(row, 70, e.rain_chance2);
+		RepositoryStmt::Read(row, 71, e.rain_chance3);
+		RepositoryStmt::Read(row, 72, e.rain_chance4);
+		RepositoryStmt::Read(row, 73, e.rain_duration1);
+		RepositoryStmt::Read(row, 74, e.rain_duration2);
+		RepositoryStmt::Read(row, 75, e.rain_duration3);
+		RepositoryStmt::Read(row, 76, e.rain_duration4);
+		RepositoryStmt::Read(row, 77, e.snow_chance1);
+		RepositoryStmt::Read(row, 78, e.snow_chance2);
+		RepositoryStmt::Read(row, 79, e.snow_chance3);
+		RepositoryStmt::Read(row, 80, e.snow_chance4);
+		RepositoryStmt::Read(row, 81, e.snow_duration1);
+		RepositoryStmt::Read(row, 82, e.snow_duration2);
+		RepositoryStmt::Read(row, 83, e.snow_duration3);
+		RepositoryStmt::Read(row, 84, e.snow_duration4);
+		RepositoryStmt::Read(row, 85, e.gravity);
+		RepositoryStmt::Read(row, 86, e.type);
+		RepositoryStmt::Read(row, 87, e.skylock);
+		RepositoryStmt::Read(row, 88, e.fast_regen_hp);
+		RepositoryStmt::Read(row, 89, e.fast_regen_mana);
+		RepositoryStmt::Read(row, 90, e.fast_regen_endurance);
+		RepositoryStmt::Read(row, 91, e.npc_max_aggro_dist);
+		RepositoryStmt::Read(row, 92, e.client_update_range);
+		RepositoryStmt::Read(row, 93, e.underworld_teleport_index);
+		RepositoryStmt::Read(row, 94, e.lava_damage);
+		RepositoryStmt::Read(row, 95, e.min_lava_damage);
+		RepositoryStmt::Read(row, 96, e.idle_when_empty);
+		RepositoryStmt::Read(row, 97, e.seconds_before_idle);
+		RepositoryStmt::Read(row, 98, e.shard_at_player_count);
+	}
+
+	static Zone FindOnePrepared(
+		Database& db,
+		int zone_id
+	)
+	{
+		return RepositoryStmt::FindOne<BaseZoneRepository>(db, zone_id);
+	}
+
+	static std::vector<Zone> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<RepositoryStmt::param_t> &params = {}
+	)
+	{
+		return RepositoryStmt::GetWhere<BaseZoneRepository>(db, where_filter, params);
+	}
+
+	static int UpdateOnePrepared(
+		Database& db,
+		const Zone &e
+	)
+	{
+		return RepositoryStmt::UpdateOne<BaseZoneRepository>(db, e, e.id);
+	}
+
+	static Zone InsertOnePrepared(
+		Database& db,
+		Zone e
+	)
+	{
+		auto id = RepositoryStmt::InsertOne<BaseZoneRepository>(db, e);
+		if (id) {
+			e.id = *id;
+			return e;
+		}
+
+		e = NewEntity();
+
+		return e;
+	}
+
+	static int InsertManyPrepared(
+		Database& db,
+		const std::vector<Zone> &entries
+	)
+	{
+		return RepositoryStmt::InsertMany<BaseZoneRepository>(db, entries);
+	}
+
+	static int ReplaceManyPrepared(
+		Database& db,
+		const std::vector<Zone> &entries
+	)
+	{
+		return RepositoryStmt::ReplaceMany<BaseZoneRepository>(db, entries);
+	}
 };
 
 #endif //EQEMU_BASE_ZONE_REPOSITORY_H
@@ -5,6 +5,8 @@
 #include "../strings.h"
 #include "base/base_inventory_snapshots_repository.h"
 
+#include <map>
+
 class InventorySnapshotsRepository: public BaseInventorySnapshotsRepository {
 public:
 
@@ -68,6 +70,181 @@ public:
 
 		return count;
 	}
+
+	/**
+	 * Snapshots are stored as a full snapshot followed by deltas
+	 *
+	 * Rows of a full snapshot have a base_time_index of 0. Rows of a delta only hold the slots
+	 * that changed since the previous snapshot, slots that were emptied are written with
+	 * removed set, and reference the time_index of the full snapshot the chain started from
+	 */
+
+	// returns the time_index of the full snapshot time_index builds on, 0 when there is no snapshot at time_index
+	static uint32 GetBaseTimeIndex(Database& db, uint32 character_id, uint32 time_index)
+	{
+		auto results = db.QueryDatabase(
+			fmt::format(
+				"SELECT `base_time_index` FROM `inventory_snapshots` WHERE `charid` = {} AND `time_index` = {} LIMIT 1",
+				character_id,
+				time_index
+			)
+		);
+
+		if (!results.Success() || !results.RowCount()) {
+			return 0;
+		}
+
+		auto row = results.begin();
+
+		const uint32 base_time_index = Strings::ToUnsignedInt(row[0]);
+
+		return base_time_index ? base_time_index : time_index;
+	}
+
+	static uint32 GetLatestTimeIndex(Database& db, uint32 character_id)
+	{
+		auto results = db.QueryDatabase(
+			fmt::format(
+				"SELECT MAX(`time_index`) FROM `inventory_snapshots` WHERE `charid` = {}",
+				character_id
+			)
+		);
+
+		if (!results.Success() || !results.RowCount()) {
+			return 0;
+		}
+
+		auto row = results.begin();
+
+		return row[0] ? Strings::ToUnsignedInt(row[0]) : 0;
+	}
+
+	static int64 CountDeltas(Database& db, uint32 character_id, uint32 base_time_index)
+	{
+		auto results = db.QueryDatabase(
+			fmt::format(
+				"SELECT COUNT(DISTINCT `time_index`) FROM `inventory_snapshots` WHERE `charid` = {} AND `base_time_index` = {}",
+				character_id,
+				base_time_index
+			)
+		);
+
+		if (!results.Success() || !results.RowCount()) {
+			return 0;
+		}
+
+		auto row = results.begin();
+
+		return Strings::ToBigInt(row[0]);
+	}
+
+	static bool IsSameItem(const InventorySnapshots& a, const InventorySnapshots& b)
+	{
+		return a.itemid == b.itemid &&
+			a.charges == b.charges &&
+			a.color == b.color &&
+			a.augslot1 == b.augslot1 &&
+			a.augslot2 == b.augslot2 &&
+			a.augslot3 == b.augslot3 &&
+			a.augslot4 == b.augslot4 &&
+			a.augslot5 == b.augslot5 &&
+			a.augslot6 == b.augslot6 &&
+			a.instnodrop == b.instnodrop &&
+			a.custom_data == b.custom_data &&
+			a.ornamenticon == b.ornamenticon &&
+			a.ornamentidfile == b.ornamentidfile &&
+			a.ornament_hero_model == b.ornament_hero_model &&
+			a.guid == b.guid;
+	}
+
+	// reconstructs the inventory as of the snapshot at time_index keyed by slot
+	static std::map<uint32, InventorySnapshots> GetInventoryAt(Database& db, uint32 character_id, uint32 time_index)
+	{
+		std::map<uint32, InventorySnapshots> inventory;
+
+		const uint32 base_time_index = GetBaseTimeIndex(db, character_id, time_index);
+		if (!base_time_index) {
+			return inventory;
+		}
+
+		const auto rows = GetWhere(
+			db,
+			fmt::format(
+				"`charid` = {} AND `time_index` BETWEEN {} AND {} AND (`time_index` = {} OR `base_time_index` = {}) ORDER BY `time_index`",
+				character_id,
+				base_time_index,
+				time_index,
+				base_time_index,
+				base_time_index
+			)
+		);
+
+		for (const auto& e : rows) {
+			if (e.removed) {
+				inventory.erase(e.slotid);
+				continue;
+			}
+
+			inventory[e.slotid] = e;
+		}
+
+		return inventory;
+	}
+
+	// snapshots newer than delete_time whose base is at or before it are rewritten as full snapshots
+	// and the rest of their chain is moved onto them, so purging up to delete_time keeps every newer
+	// snapshot restorable
+	static void RebaseInventorySnapshots(Database& db, uint32 delete_time, uint32 character_id = 0)
+	{
+		auto results = db.QueryDatabase(
+			fmt::format(
+				"SELECT `charid`, `base_time_index`, MIN(`time_index`) FROM `inventory_snapshots` "
+				"WHERE `time_index` > {} AND `base_time_index` != 0 AND `base_time_index` <= {}{} "
+				"GROUP BY `charid`, `base_time_index`",
+				delete_time,
+				delete_time,
+				character_id ? fmt::format(" AND `charid` = {}", character_id) : ""
+			)
+		);
+
+		if (!results.Success()) {
+			return;
+		}
+
+		for (auto row : results) {
+			const uint32 charid          = Strings::ToUnsignedInt(row[0]);
+			const uint32 base_time_index = Strings::ToUnsignedInt(row[1]);
+			const uint32 time_index      = Strings::ToUnsignedInt(row[2]);
+
+			std::vector<InventorySnapshots> v;
+			for (auto& [slot_id, e] : GetInventoryAt(db, charid, time_index)) {
+				e.time_index      = time_index;
+				e.base_time_index = 0;
+				v.emplace_back(e);
+			}
+
+			db.TransactionBegin();
+
+			DeleteWhere(db, fmt::format("`charid` = {} AND `time_index` = {}", charid, time_index));
+
+			if (!v.empty() && InsertMany(db, v) != static_cast<int>(v.size())) {
+				db.TransactionRollback();
+				LogError("Failed to rebase inventory snapshot [{}] for character [{}]", time_index, charid);
+				continue;
+			}
+
+			db.QueryDatabase(
+				fmt::format(
+					"UPDATE `inventory_snapshots` SET `base_time_index` = {} WHERE `charid` = {} AND `base_time_index` = {}",
+					time_index,
+					charid,
+					base_time_index
+				)
+			);
+
+			db.TransactionCommit();
+		}
+	}
 };
 
 #endif //EQEMU_INVENTORY_SNAPSHOTS_REPOSITORY_H
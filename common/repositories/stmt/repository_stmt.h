@@ -0,0 +1,255 @@
+#ifndef EQEMU_REPOSITORY_STMT_H
+#define EQEMU_REPOSITORY_STMT_H
+
+#include "../../database.h"
+#include "../../mysql_stmt.h"
+#include "../../eqemu_logsys.h"
+#include "../../strings.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Prepared statement (binary protocol) path for generated repositories
+ *
+ * Base repositories generate StmtBind() and StmtRead(), which bind and decode every
+ * column in Columns() order in its native type, and forward their *Prepared methods here.
+ * This skips formatting, escaping and re-parsing every value as text. Statements are
+ * prepared once per connection and cached by query text in DBcore::GetPreparedStmt
+ *
+ * Failures are reported the same way the text path does (empty entity / 0 rows)
+ */
+namespace RepositoryStmt {
+	using param_t = mysql::PreparedStmt::param_t;
+
+	// rows bound per statement by InsertMany / ReplaceMany
+	constexpr size_t MAX_BATCH_ROWS = 32;
+
+	// mysql protocol limit on placeholders in a single statement
+	constexpr size_t MAX_PARAMS = 65535;
+
+	// datetime columns are written as FROM_UNIXTIME(?), zero is stored as null
+	template<typename T>
+	inline param_t DateTime(T v)
+	{
+		if (v > 0) {
+			return static_cast<int64_t>(v);
+		}
+
+		return nullptr;
+	}
+
+	// leaves the entity default in place when the column is NULL
+	template<typename T>
+	inline void Read(const mysql::StmtRow &row, size_t index, T &out)
+	{
+		if constexpr (std::is_same_v<T, std::string>) {
+			const mysql::StmtColumn *col = row.GetColumn(index);
+			if (!col || col->IsNull()) {
+				return;
+			}
+
+			if (auto sv = col->GetStrView()) {
+				out.assign(sv->data(), sv->size());
+			}
+			else if (auto s = col->GetStr()) {
+				out = std::move(*s);
+			}
+		}
+		else if (auto v = row.Get<T>(index)) {
+			out = *v;
+		}
+	}
+
+	namespace detail {
+		// datetime columns are selected through UNIX_TIMESTAMP() by the generator
+		template<typename R>
+		std::vector<std::string> Placeholders()
+		{
+			std::vector<std::string> v;
+			for (const auto &c: R::SelectColumns()) {
+				v.emplace_back(c.rfind("UNIX_TIMESTAMP(", 0) == 0 ? "FROM_UNIXTIME(?)" : "?");
+			}
+
+			return v;
+		}
+
+		template<typename R>
+		std::string ValuesQuery(const std::string &base, size_t rows)
+		{
+			const std::string        row = "(" + Strings::Implode(",", Placeholders<R>()) + ")";
+			std::vector<std::string> chunks(rows, row);
+
+			return fmt::format("{} VALUES {}", base, Strings::Implode(",", chunks));
+		}
+
+		template<typename R, typename E>
+		std::vector<E> FetchAll(mysql::PreparedStmt &stmt, const std::vector<param_t> &args)
+		{
+			std::vector<E> entries;
+
+			auto res = stmt.Execute(args);
+			entries.reserve(res.RowCount());
+
+			for (auto row = stmt.Fetch(); row; row = stmt.Fetch()) {
+				E e = R::NewEntity();
+				R::StmtRead(row, e);
+				entries.push_back(std::move(e));
+			}
+
+			stmt.FreeResult();
+
+			return entries;
+		}
+
+		inline void OnError(Database &db, const std::string &query, const std::exception &ex)
+		{
+			// PreparedStmt has already logged the mysql error; drop the statement so
+			// the next call re-prepares it (the connection may have been re-opened)
+			LogMySQLErrorDetail("Dropping cached statement after [{}]", ex.what());
+			db.ClearPreparedStmt(query);
+		}
+
+		template<typename R, typename E>
+		int ExecuteMany(Database &db, const std::string &base, const std::vector<E> &entries)
+		{
+			const size_t columns = R::Columns().size();
+			const size_t batch   = std::max<size_t>(1, std::min(MAX_BATCH_ROWS, MAX_PARAMS / columns));
+
+			int                  affected = 0;
+			std::vector<param_t> v;
+
+			for (size_t offset = 0; offset < entries.size(); offset += batch) {
+				const size_t rows  = std::min(batch, entries.size() - offset);
+				const auto   query = ValuesQuery<R>(base, rows);
+
+				v.clear();
+				v.reserve(rows * columns);
+				for (size_t i = offset; i < offset + rows; ++i) {
+					R::StmtBind(v, entries[i]);
+				}
+
+				try {
+					affected += static_cast<int>(db.GetPreparedStmt(query).Execute(v).RowsAffected());
+				}
+				catch (const std::exception &ex) {
+					OnError(db, query, ex);
+					return affected;
+				}
+			}
+
+			return affected;
+		}
+	}
+
+	template<typename R, typename E = decltype(R::NewEntity())>
+	E FindOne(Database &db, int id)
+	{
+		static const std::string query = fmt::format(
+			"{} WHERE {} = ? LIMIT 1",
+			R::BaseSelect(),
+			R::PrimaryKey()
+		);
+
+		try {
+			auto entries = detail::FetchAll<R, E>(db.GetPreparedStmt(query), {id});
+			if (entries.size() == 1) {
+				return std::move(entries.front());
+			}
+		}
+		catch (const std::exception &ex) {
+			detail::OnError(db, query, ex);
+		}
+
+		return R::NewEntity();
+	}
+
+	// where_filter uses ? placeholders for each value in params
+	template<typename R, typename E = decltype(R::NewEntity())>
+	std::vector<E> GetWhere(Database &db, const std::string &where_filter, const std::vector<param_t> &params)
+	{
+		const auto query = fmt::format("{} WHERE {}", R::BaseSelect(), where_filter);
+
+		try {
+			return detail::FetchAll<R, E>(db.GetPreparedStmt(query), params);
+		}
+		catch (const std::exception &ex) {
+			detail::OnError(db, query, ex);
+		}
+
+		return {};
+	}
+
+	// every column is set (the primary key to its own value) so the row binds match StmtBind
+	template<typename R, typename E>
+	int UpdateOne(Database &db, const E &e, param_t id)
+	{
+		static const std::string query = [] {
+			auto columns      = R::Columns();
+			auto placeholders = detail::Placeholders<R>();
+
+			std::vector<std::string> v;
+			for (size_t i = 0; i < columns.size(); ++i) {
+				v.push_back(columns[i] + " = " + placeholders[i]);
+			}
+
+			return fmt::format(
+				"UPDATE {} SET {} WHERE {} = ?",
+				R::TableName(),
+				Strings::Implode(", ", v),
+				R::PrimaryKey()
+			);
+		}();
+
+		std::vector<param_t> v;
+		v.reserve(R::Columns().size() + 1);
+		R::StmtBind(v, e);
+		v.push_back(id);
+
+		try {
+			return static_cast<int>(db.GetPreparedStmt(query).Execute(v).RowsAffected());
+		}
+		catch (const std::exception &ex) {
+			detail::OnError(db, query, ex);
+		}
+
+		return 0;
+	}
+
+	// returns the last insert id, nullopt on failure
+	template<typename R, typename E>
+	std::optional<uint64_t> InsertOne(Database &db, const E &e)
+	{
+		static const std::string query = detail::ValuesQuery<R>(R::BaseInsert(), 1);
+
+		std::vector<param_t> v;
+		v.reserve(R::Columns().size());
+		R::StmtBind(v, e);
+
+		try {
+			return db.GetPreparedStmt(query).Execute(v).LastInsertID();
+		}
+		catch (const std::exception &ex) {
+			detail::OnError(db, query, ex);
+		}
+
+		return std::nullopt;
+	}
+
+	template<typename R, typename E>
+	int InsertMany(Database &db, const std::vector<E> &entries)
+	{
+		return detail::ExecuteMany<R>(db, R::BaseInsert(), entries);
+	}
+
+	template<typename R, typename E>
+	int ReplaceMany(Database &db, const std::vector<E> &entries)
+	{
+		return detail::ExecuteMany<R>(db, R::BaseReplace(), entries);
+	}
+}
+
+#endif //EQEMU_REPOSITORY_STMT_H
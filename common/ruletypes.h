@@ -211,6 +211,8 @@ RULE_INT(Character, WhiteModifier, 100, "The experience obtained for white con m
 RULE_INT(Character, YellowModifier, 125, "The experience obtained for yellow con mobs is multiplied by value/100")
 RULE_INT(Character, RedModifier, 150, "The experience obtained for red con mobs is multiplied by value/100")
 RULE_INT(Character, AutosaveIntervalS, 300, "Number of seconds after which a timer is triggered which stores the character data. The value 0 means no periodic automatic saving.")
+RULE_BOOL(Character, SaveOnlyChangedSections, true, "Character saves skip sections (currency, binds, buffs, pet, tribute, experience modifiers) whose contents have not changed since they were last written")
+RULE_INT(Character, SaveCoalesceIntervalMS, 0, "Delayed character saves are coalesced and flushed at most once per this many milliseconds. Camp, zoning, disconnect and shutdown always flush. The value 0 writes every save immediately")
 RULE_INT(Character, HPRegenMultiplier, 100, "The hitpoint regeneration is multiplied by value/100 (up to the caps)")
 RULE_INT(Character, ManaRegenMultiplier, 100, "The mana regeneration is multiplied by value/100 (up to the caps)")
 RULE_INT(Character, EnduranceRegenMultiplier, 100, "The endurance regeneration is multiplied by value/100 (up to the caps)")
@@ -301,6 +303,7 @@ RULE_BOOL(Character, ActiveInvSnapshots, false, "Takes a periodic snapshot of in
 RULE_INT(Character, InvSnapshotMinIntervalM, 180, "Minimum time between inventory snapshots (minutes)")
 RULE_INT(Character, InvSnapshotMinRetryM, 30, "Time to re-attempt an inventory snapshot after a failure  (minutes)")
 RULE_INT(Character, InvSnapshotHistoryD, 30, "Time to keep snapshot entries (days)")
+RULE_INT(Character, InvSnapshotMaxDeltas, 24, "Snapshots stored as changed slots only before a full snapshot is taken again, 0 always takes full snapshots")
 RULE_BOOL(Character, RestrictSpellScribing, false, "Setting whether to restrict spell scribing to allowable races/classes of spell scroll")
 RULE_BOOL(Character, UseStackablePickPocketing, true, "Allows stackable pickpocketed items to stack instead of only being allowed in empty inventory slots")
 RULE_BOOL(Character, AllowMQTarget, false, "Disables putting players in the 'hackers' list for targeting beyond the clip plane or attempting to target something untargetable")
@@ -510,6 +513,7 @@ RULE_BOOL(Zone, AllowCrossZoneSpellsOnBots, false, "Set to true to allow cross z
 RULE_BOOL(Zone, AllowCrossZoneSpellsOnMercs, false, "Set to true to allow cross zone spells (cast/remove) to affect mercenaries")
 RULE_BOOL(Zone, AllowCrossZoneSpellsOnPets, false, "Set to true to allow cross zone spells (cast/remove) to affect pets")
 RULE_BOOL(Zone, ZoneShardQuestMenuOnly, false, "Set to true if you only want quests to show the zone shard menu")
+RULE_BOOL(Zone, ParallelGeometryLoad, true, "Load the zone map, water map and navmesh on worker threads while database content loads during zone boot")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Map)
@@ -797,6 +801,8 @@ RULE_INT(NPC, MinorNPCCorpseDecayTime, 450000, "NPC corpse decay time, if NPC be
 RULE_INT(NPC, MajorNPCCorpseDecayTime, 1500000, "NPC corpse decay time, if NPC equal or greater than level 55 (milliseconds)")
 RULE_INT(NPC, CorpseUnlockTimer, 150000, "Time after which corpses are unlocked for everyone to loot (milliseconds)")
 RULE_INT(NPC, EmptyNPCCorpseDecayTime, 0, "NPC corpse decay time, if no items are left on the corpse (milliseconds)")
+RULE_BOOL(NPC, UseSharedMemoryNPCTypes, false, "Zones copy npc types from the shared_memory npc_types segment instead of querying npc_types, rows missing from the segment still load from the database")
+RULE_BOOL(NPC, UseSharedMemorySpawnContent, false, "Zones read spawn groups, merchant lists and npc faction lists from the shared_memory spawn_groups, merchants and npc_factions segments instead of querying them, ids missing from the segments still load from the database")
 RULE_BOOL(NPC, UseItemBonusesForNonPets, true, "Switch whether item bonuses should be used for NPCs who are not pets")
 RULE_BOOL(NPC, UseBaneDamage, false, "If NPCs can't inherently hit the target we don't add bane/magic dmg which isn't exactly the same as PCs")
 RULE_INT(NPC, SayPauseTimeInSec, 5, "Time span in which an NPC pauses his movement after a Say event without aggro (seconds)")
@@ -827,6 +833,8 @@ RULE_BOOL(NPC, NPCIgnoreLevelBasedHasteCaps, false, "Ignores hard coded level ba
 RULE_INT(NPC, NPCHasteCap, 150, "Haste cap for non-v3(over haste) haste")
 RULE_INT(NPC, NPCHastev3Cap, 25, "Haste cap for v3(over haste) haste")
 RULE_STRING(NPC, ExcludedFaceTargetRaces, "52,72,73,141,233,328,329,372,376,377,378,379,380,381,382,383,404,422,423,424,425,426,428,429,445,449,460,462,463,500,501,502,503,504,505,506,507,508,509,510,511,513,514,515,516,533,534,535,536,537,538,539,540,541,542,543,544,545,546,550,551,552,553,554,555,556,557,567,573,577,586,589,590,591,592,593,595,596,599,601,616,619,621,628,629,630,633,634,635,636,665,683,684,685,691,692,693,694,702,703,705,706,707,710,711,714,720,2250,2254", "Race IDs excluded from facing target when hailed")
+RULE_INT(NPC, AIThinkThreads, 0, "Worker threads for the parallel NPC AI think phase (target selection and combat range), 0 to run all AI on the main thread")
+RULE_INT(NPC, AIThinkMinimumNPCs, 64, "Minimum number of NPCs in the zone before the parallel AI think phase is used")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Aggro)
@@ -1209,6 +1217,13 @@ RULE_BOOL(Logging, WorldGMSayLogging, true, "Relay worldserver logging to zone p
 RULE_BOOL(Logging, PlayerEventsQSProcess, false, "Have query server process player events instead of world. Useful when wanting to use a dedicated server and database for processing player events on separate disk")
 RULE_INT(Logging, BatchPlayerEventProcessIntervalSeconds, 5, "This is the interval in which player events are processed in world or qs")
 RULE_INT(Logging, BatchPlayerEventProcessChunkSize, 10000, "This is the cap of events that can be inserted into the queue before a force flush. This is to keep from hitting MySQL max_allowed_packet and killing the connection")
+RULE_BOOL(Logging, PlayerEventsBinaryEncoding, false, "Store player event payloads in a compact binary encoding (event_data_binary) instead of JSON, use world etl:decode to read or convert them back to JSON")
+RULE_BOOL(Logging, QueryProfiler, false, "Aggregate call counts, latency, rows and bytes for every database query by normalized query fingerprint")
+RULE_INT(Logging, QueryProfilerSummaryIntervalS, 300, "Interval in which the query profile is logged and written to logs/query_profile for database:query-profile, 0 disables the summary")
+RULE_INT(Logging, QueryProfilerSummaryLimit, 10, "Number of fingerprints (by total time) included in the periodic query profile log summary")
+RULE_BOOL(Logging, QuestProfiler, false, "Aggregate call counts, wall time, Lua heap growth and errors for every quest event by package and event, see #questprofile")
+RULE_INT(Logging, QuestProfilerSampleInstructions, 0, "Sample the Lua call stack every this many Lua instructions while the quest profiler is enabled (#questprofile stacks), 0 disables sampling")
+RULE_INT(Logging, QuestProfilerSnapshotIntervalS, 60, "Interval in which each zone writes its quest profile to logs/quest_profile for the sidecar /api/v1/quest-profile, 0 disables the snapshot")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(HotReload)
@@ -1216,6 +1231,8 @@ RULE_BOOL(HotReload, QuestsRepopWithReload, true, "When a hot reload is triggere
 RULE_BOOL(HotReload, QuestsRepopWhenPlayersNotInCombat, true, "When a hot reload is triggered, the zone will repop when no clients are in combat")
 RULE_BOOL(HotReload, QuestsResetTimersWithReload, true, "When a hot reload is triggered, quest timers will be reset")
 RULE_BOOL(HotReload, QuestsAutoReloadGlobalScripts, false, "When a quest, plugin, or global script changes, auto reload.")
+RULE_BOOL(HotReload, QuestsLuaBytecodeCache, true, "Keep compiled Lua scripts in quests/.luacache keyed by contents and interpreter, zones then skip parsing scripts that have not changed")
+RULE_BOOL(HotReload, QuestsWatchFiles, true, "Watch the zone's quest directories (Linux only) and recompile just the scripts that change, plugin and encounter changes queue a full hot reload")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Expansion)
@@ -43,8 +43,13 @@
 #include "repositories/faction_association_repository.h"
 #include "repositories/starting_items_repository.h"
 #include "path_manager.h"
+#include "file.h"
 #include "../zone/client.h"
 #include "repositories/loottable_repository.h"
+#include "repositories/merchantlist_repository.h"
+#include "repositories/npc_faction_repository.h"
+#include "repositories/npc_faction_entries_repository.h"
+#include "repositories/spawngroup_repository.h"
 #include "repositories/character_item_recast_repository.h"
 #include "repositories/character_corpses_repository.h"
 #include "repositories/skill_caps_repository.h"
@@ -1037,12 +1042,9 @@ void SharedDatabase::LoadItems(void *data, uint32 size, int32 items, uint32 max_
 #include "item_fieldlist.h"
 #undef F
 		"updated, minstatus, comment FROM items ORDER BY id";
-	auto results = QueryDatabase(query);
-	if (!results.Success()) {
-		return;
-	}
 
-	for (auto& row = results.begin(); row != results.end(); ++row) {
+	// rows are decoded straight into the shared memory hash as they arrive
+	QueryDatabaseStream(query, [&](MYSQL_ROW row, uint32) -> bool {
 		memset(&item, 0, sizeof(EQ::ItemData));
 
 		// Unique Identifier
@@ -1317,9 +1319,11 @@ void SharedDatabase::LoadItems(void *data, uint32 size, int32 items, uint32 max_
 			hash.insert(item.ID, item);
 		} catch (std::exception &ex) {
 			LogError("Database::LoadItems: {}", ex.what());
-			break;
+			return false;
 		}
-	}
+
+		return true;
+	});
 }
 
 const EQ::ItemData *SharedDatabase::GetItem(uint32 id) const
@@ -1687,23 +1691,22 @@ void SharedDatabase::LoadSpells(void *data, int max_spells) {
 	SPDat_Spell_Struct *sp = reinterpret_cast<SPDat_Spell_Struct*>(static_cast<char*>(data) + sizeof(uint32));
 
 	const std::string query = "SELECT * FROM spells_new ORDER BY id ASC";
-    auto results = QueryDatabase(query);
-    if (!results.Success()) {
-        return;
-    }
 
-    if(results.ColumnCount() <= SPELL_LOAD_FIELD_COUNT) {
-		LogSpells("Fatal error loading spells: Spell field count < SPELL_LOAD_FIELD_COUNT([{}])", SPELL_LOAD_FIELD_COUNT);
-		return;
-    }
+	int  counter           = 0;
+	bool field_count_error = false;
 
-	int counter = 0;
+	// rows are decoded straight into shared memory as they arrive
+	const bool success = QueryDatabaseStream(query, [&](MYSQL_ROW row, uint32 column_count) -> bool {
+		if (column_count <= SPELL_LOAD_FIELD_COUNT) {
+			LogSpells("Fatal error loading spells: Spell field count < SPELL_LOAD_FIELD_COUNT([{}])", SPELL_LOAD_FIELD_COUNT);
+			field_count_error = true;
+			return false;
+		}
 
-    for (auto& row = results.begin(); row != results.end(); ++row) {
 	    const int tempid = Strings::ToInt(row[0]);
         if(tempid >= max_spells) {
 			LogSpells("Non fatal error: spell.id >= max_spells, ignoring");
-			continue;
+			return true;
 		}
 
         ++counter;
@@ -1853,11 +1856,723 @@ void SharedDatabase::LoadSpells(void *data, int max_spells) {
 		sp[tempid].min_range = Strings::ToFloat(row[231]);
 		sp[tempid].no_remove = Strings::ToBool(row[232]);
 		sp[tempid].damage_shield_type = 0;
+
+		return true;
+	});
+
+	if (!success || field_count_error) {
+		return;
 	}
 
 	LoadDamageShieldTypes(sp, max_spells);
 }
 
+void SharedDatabase::GetNPCTypesCount(int32 &npc_type_count, uint32 &max_id)
+{
+	npc_type_count = -1;
+	max_id         = 0;
+
+	auto results = QueryDatabase("SELECT MAX(id), COUNT(*) FROM npc_types");
+	if (!results.Success() || results.RowCount() == 0) {
+		return;
+	}
+
+	auto row = results.begin();
+
+	if (row[0]) {
+		max_id = Strings::ToUnsignedInt(row[0]);
+	}
+
+	if (row[1]) {
+		npc_type_count = Strings::ToInt(row[1]);
+	}
+}
+
+void SharedDatabase::LoadNPCTypes(void *data, uint32 size, int32 npc_types, uint32 max_npc_type_id)
+{
+	auto header = static_cast<SharedSegmentHeader *>(data);
+	header->version   = SHARED_NPC_TYPES_VERSION;
+	header->type_size = sizeof(NPCType);
+
+	EQ::FixedMemoryHashSet<NPCType> hash(
+		static_cast<uint8 *>(data) + sizeof(SharedSegmentHeader),
+		size - sizeof(SharedSegmentHeader),
+		npc_types,
+		max_npc_type_id
+	);
+
+	// tints are resolved once here instead of one query per tinted npc at zone boot
+	std::unordered_map<uint32, NpcTypesTintRepository::NpcTypesTint> tints;
+	for (auto &e: NpcTypesTintRepository::All(*this)) {
+		tints.emplace(e.id, e);
+	}
+
+	for (const auto &n: NpcTypesRepository::All(*this)) {
+		if (n.id > max_npc_type_id) {
+			continue;
+		}
+
+		NPCType t;
+		memset(&t, 0, sizeof t);
+
+		auto tint = tints.find(n.armortint_id);
+		FillNPCType(&t, n, tint != tints.end() ? &tint->second : nullptr);
+
+		try {
+			hash.insert(n.id, t);
+		}
+		catch (std::exception &ex) {
+			LogError("Database::LoadNPCTypes: {}", ex.what());
+			break;
+		}
+	}
+}
+
+std::unique_ptr<EQ::MemoryMappedFile> SharedDatabase::MapSharedSegment(
+	const std::string &prefix,
+	const std::string &name,
+	uint32 version,
+	uint32 type_size
+)
+{
+	const std::string file_name = fmt::format("{}/{}{}", path.GetSharedMemoryPath(), prefix, name);
+	if (!File::Exists(file_name)) {
+		LogInfo("No shared memory [{}] [{}], it loads from the database", name, file_name);
+		return nullptr;
+	}
+
+	EQ::IPCMutex mutex(name);
+	mutex.Lock();
+
+	auto mmf    = std::make_unique<EQ::MemoryMappedFile>(file_name);
+	auto header = static_cast<const SharedSegmentHeader *>(mmf->Get());
+
+	mutex.Unlock();
+
+	if (
+		mmf->Size() < sizeof(SharedSegmentHeader) ||
+		header->version != version ||
+		header->type_size != type_size
+	) {
+		LogWarning("Shared memory [{}] [{}] was baked by a different build, re-run shared_memory", name, file_name);
+		return nullptr;
+	}
+
+	return mmf;
+}
+
+bool SharedDatabase::LoadNPCTypes(const std::string &prefix)
+{
+	npc_types_hash.reset(nullptr);
+	npc_types_mmf.reset(nullptr);
+
+	try {
+		auto mmf = MapSharedSegment(prefix, "npc_types", SHARED_NPC_TYPES_VERSION, sizeof(NPCType));
+		if (!mmf) {
+			return false;
+		}
+
+		npc_types_hash = std::make_unique<EQ::FixedMemoryHashSet<NPCType>>(
+			static_cast<uint8 *>(mmf->Get()) + sizeof(SharedSegmentHeader),
+			mmf->Size() - sizeof(SharedSegmentHeader)
+		);
+		npc_types_mmf  = std::move(mmf);
+
+		LogInfo("Loaded [{}] npc types via shared memory", Strings::Commify(npc_types_hash->size()));
+	} catch (std::exception &ex) {
+		npc_types_hash.reset(nullptr);
+		npc_types_mmf.reset(nullptr);
+		LogError("Error Loading NPC Types: {}", ex.what());
+		return false;
+	}
+
+	return true;
+}
+
+const NPCType *SharedDatabase::GetSharedNPCType(uint32 id) const
+{
+	if (!npc_types_hash || id == 0 || id > npc_types_hash->max_key()) {
+		return nullptr;
+	}
+
+	if (npc_types_hash->exists(id)) {
+		return &(npc_types_hash->at(id));
+	}
+
+	return nullptr;
+}
+
+uint32 SharedDatabase::GetSharedRecordsSize(const SharedRecords &records)
+{
+	const uint32 max_id = records.empty() ? 0 : records.rbegin()->first;
+
+	uint32 size = sizeof(SharedSegmentHeader) + sizeof(uint32) * 3 + sizeof(uint32) * (max_id + 1);
+	for (const auto &[id, r]: records) {
+		size += static_cast<uint32>(r.size());
+	}
+
+	return size;
+}
+
+void SharedDatabase::WriteSharedRecords(
+	void *data,
+	uint32 size,
+	uint32 version,
+	uint32 type_size,
+	const SharedRecords &records
+)
+{
+	auto header = static_cast<SharedSegmentHeader *>(data);
+	header->version   = version;
+	header->type_size = type_size;
+
+	EQ::FixedMemoryVariableHashSet<uint8> hash(
+		static_cast<uint8 *>(data) + sizeof(SharedSegmentHeader),
+		size - sizeof(SharedSegmentHeader),
+		records.empty() ? 0 : records.rbegin()->first
+	);
+
+	for (const auto &[id, r]: records) {
+		hash.insert(id, const_cast<uint8 *>(r.data()), static_cast<uint32>(r.size()));
+	}
+}
+
+void SharedDatabase::GetNPCFactionListsCount(int32 &npc_faction_count, uint32 &max_id)
+{
+	npc_faction_count = -1;
+	max_id            = 0;
+
+	auto results = QueryDatabase("SELECT MAX(id), COUNT(*) FROM npc_faction");
+	if (!results.Success() || results.RowCount() == 0) {
+		return;
+	}
+
+	auto row = results.begin();
+
+	if (row[0]) {
+		max_id = Strings::ToUnsignedInt(row[0]);
+	}
+
+	if (row[1]) {
+		npc_faction_count = Strings::ToInt(row[1]);
+	}
+}
+
+void SharedDatabase::LoadNPCFactionLists(void *data, uint32 size, int32 npc_factions, uint32 max_npc_faction_id)
+{
+	auto header = static_cast<SharedSegmentHeader *>(data);
+	header->version   = SHARED_NPC_FACTIONS_VERSION;
+	header->type_size = sizeof(NPCFactionList);
+
+	EQ::FixedMemoryHashSet<NPCFactionList> hash(
+		static_cast<uint8 *>(data) + sizeof(SharedSegmentHeader),
+		size - sizeof(SharedSegmentHeader),
+		npc_factions,
+		max_npc_faction_id
+	);
+
+	std::unordered_map<uint32, std::vector<NpcFactionEntriesRepository::NpcFactionEntries>> entries;
+	for (auto &e: NpcFactionEntriesRepository::All(*this)) {
+		entries[e.npc_faction_id].emplace_back(e);
+	}
+
+	for (const auto &f: NpcFactionRepository::All(*this)) {
+		if (f.id <= 0 || static_cast<uint32>(f.id) > max_npc_faction_id) {
+			continue;
+		}
+
+		NPCFactionList l;
+		memset(&l, 0, sizeof l);
+
+		l.id                   = f.id;
+		l.primaryfaction       = f.primaryfaction;
+		l.assistprimaryfaction = f.ignore_primary_assist == 0;
+
+		const auto &list = entries[f.id];
+
+		// lists longer than the fixed entry count are left to the zones' database fallback
+		if (list.size() > MAX_NPC_FACTIONS) {
+			LogWarning(
+				"NPC faction [{}] has [{}] entries, more than [{}] fit in shared memory, it loads from the database",
+				f.id,
+				list.size(),
+				MAX_NPC_FACTIONS
+			);
+			continue;
+		}
+
+		for (size_t i = 0; i < list.size(); ++i) {
+			l.factionid[i]       = list[i].faction_id;
+			l.factionvalue[i]    = list[i].value;
+			l.factionnpcvalue[i] = list[i].npc_value;
+			l.factiontemp[i]     = list[i].temp;
+		}
+
+		try {
+			hash.insert(f.id, l);
+		}
+		catch (std::exception &ex) {
+			LogError("Database::LoadNPCFactionLists: {}", ex.what());
+			break;
+		}
+	}
+}
+
+bool SharedDatabase::LoadNPCFactionLists(const std::string &prefix)
+{
+	faction_hash.reset(nullptr);
+	faction_mmf.reset(nullptr);
+
+	try {
+		auto mmf = MapSharedSegment(prefix, "npc_factions", SHARED_NPC_FACTIONS_VERSION, sizeof(NPCFactionList));
+		if (!mmf) {
+			return false;
+		}
+
+		faction_hash = std::make_unique<EQ::FixedMemoryHashSet<NPCFactionList>>(
+			static_cast<uint8 *>(mmf->Get()) + sizeof(SharedSegmentHeader),
+			mmf->Size() - sizeof(SharedSegmentHeader)
+		);
+		faction_mmf  = std::move(mmf);
+
+		LogInfo("Loaded [{}] npc faction lists via shared memory", Strings::Commify(faction_hash->size()));
+	} catch (std::exception &ex) {
+		faction_hash.reset(nullptr);
+		faction_mmf.reset(nullptr);
+		LogError("Error Loading NPC Faction Lists: {}", ex.what());
+		return false;
+	}
+
+	return true;
+}
+
+const NPCFactionList *SharedDatabase::GetSharedNPCFactionList(uint32 id) const
+{
+	if (!faction_hash || id == 0 || id > faction_hash->max_key()) {
+		return nullptr;
+	}
+
+	if (faction_hash->exists(id)) {
+		return &(faction_hash->at(id));
+	}
+
+	return nullptr;
+}
+
+SharedDatabase::SharedRecords SharedDatabase::GetSpawnGroupRecords()
+{
+	SharedRecords records;
+
+	for (const auto &g: SpawngroupRepository::All(*this)) {
+		if (g.id <= 0) {
+			continue;
+		}
+
+		SharedSpawnGroup r;
+		memset(&r, 0, sizeof r);
+
+		r.id            = g.id;
+		r.spawn_limit   = g.spawn_limit;
+		r.dist          = g.dist;
+		r.max_x         = g.max_x;
+		r.min_x         = g.min_x;
+		r.max_y         = g.max_y;
+		r.min_y         = g.min_y;
+		r.delay         = g.delay;
+		r.despawn       = g.despawn;
+		r.despawn_timer = g.despawn_timer;
+		r.min_delay     = g.mindelay;
+		r.wp_spawns     = g.wp_spawns;
+		strn0cpy(r.name, g.name.c_str(), sizeof(r.name));
+
+		auto &record = records[g.id];
+		record.resize(sizeof r);
+		memcpy(record.data(), &r, sizeof r);
+	}
+
+	// npc_types.spawn_limit is cached on the entry the same way the zone query joins it
+	auto results = QueryDatabase(
+		SQL(
+			SELECT
+			spawnentry.spawngroupID,
+			spawnentry.npcID,
+			spawnentry.chance,
+			spawnentry.condition_value_filter,
+			npc_types.spawn_limit,
+			spawnentry.min_time,
+			spawnentry.max_time,
+			spawnentry.min_expansion,
+			spawnentry.max_expansion,
+			spawnentry.content_flags,
+			spawnentry.content_flags_disabled
+			FROM
+			spawnentry
+			INNER JOIN npc_types ON spawnentry.npcID = npc_types.id
+			ORDER BY
+			spawnentry.spawngroupID,
+			spawnentry.npcID
+		)
+	);
+
+	for (auto row: results) {
+		auto record = records.find(Strings::ToUnsignedInt(row[0]));
+		if (record == records.end()) {
+			continue;
+		}
+
+		SharedSpawnEntry e;
+		memset(&e, 0, sizeof e);
+
+		e.npc_id                 = Strings::ToUnsignedInt(row[1]);
+		e.chance                 = Strings::ToInt(row[2]);
+		e.condition_value_filter = Strings::ToUnsignedInt(row[3]);
+		e.npc_spawn_limit        = row[4] ? Strings::ToUnsignedInt(row[4]) : 0;
+		e.min_time               = Strings::ToInt(row[5]);
+		e.max_time               = Strings::ToInt(row[6]);
+		e.min_expansion          = static_cast<int16>(Strings::ToInt(row[7]));
+		e.max_expansion          = static_cast<int16>(Strings::ToInt(row[8]));
+		strn0cpy(e.content_flags, row[9] ? row[9] : "", sizeof(e.content_flags));
+		strn0cpy(e.content_flags_disabled, row[10] ? row[10] : "", sizeof(e.content_flags_disabled));
+
+		auto &bytes = record->second;
+		reinterpret_cast<SharedSpawnGroup *>(bytes.data())->entry_count++;
+
+		const size_t offset = bytes.size();
+		bytes.resize(offset + sizeof e);
+		memcpy(bytes.data() + offset, &e, sizeof e);
+	}
+
+	return records;
+}
+
+bool SharedDatabase::LoadSharedSpawnGroups(const std::string &prefix)
+{
+	spawn_groups_hash.reset(nullptr);
+	spawn_groups_mmf.reset(nullptr);
+
+	try {
+		auto mmf = MapSharedSegment(
+			prefix,
+			"spawn_groups",
+			SHARED_SPAWN_GROUPS_VERSION,
+			sizeof(SharedSpawnGroup) + sizeof(SharedSpawnEntry)
+		);
+		if (!mmf) {
+			return false;
+		}
+
+		spawn_groups_hash = std::make_unique<EQ::FixedMemoryVariableHashSet<SharedSpawnGroup>>(
+			static_cast<uint8 *>(mmf->Get()) + sizeof(SharedSegmentHeader),
+			mmf->Size() - sizeof(SharedSegmentHeader)
+		);
+		spawn_groups_mmf  = std::move(mmf);
+
+		LogInfo("Loaded spawn groups via shared memory [{}] bytes", Strings::Commify(spawn_groups_hash->size()));
+	} catch (std::exception &ex) {
+		spawn_groups_hash.reset(nullptr);
+		spawn_groups_mmf.reset(nullptr);
+		LogError("Error Loading Spawn Groups: {}", ex.what());
+		return false;
+	}
+
+	return true;
+}
+
+const SharedDatabase::SharedSpawnGroup *SharedDatabase::GetSharedSpawnGroup(uint32 id) const
+{
+	if (!spawn_groups_hash || id == 0 || !spawn_groups_hash->exists(id)) {
+		return nullptr;
+	}
+
+	return &(spawn_groups_hash->at(id));
+}
+
+SharedDatabase::SharedRecords SharedDatabase::GetMerchantListRecords()
+{
+	SharedRecords records;
+
+	for (const auto &m: MerchantlistRepository::GetWhere(*this, "merchantid > 0 ORDER BY merchantid, slot")) {
+		auto &bytes = records[m.merchantid];
+		if (bytes.empty()) {
+			SharedMerchantList l;
+			memset(&l, 0, sizeof l);
+			l.id = m.merchantid;
+
+			bytes.resize(sizeof l);
+			memcpy(bytes.data(), &l, sizeof l);
+		}
+
+		SharedMerchantItem e;
+		memset(&e, 0, sizeof e);
+
+		e.slot              = m.slot;
+		e.item              = m.item;
+		e.faction_required  = m.faction_required;
+		e.level_required    = static_cast<int8>(m.level_required);
+		e.min_status        = m.min_status;
+		e.max_status        = m.max_status;
+		e.probability       = static_cast<uint8>(m.probability);
+		e.bucket_comparison = m.bucket_comparison;
+		e.alt_currency_cost = m.alt_currency_cost;
+		e.classes_required  = m.classes_required;
+		e.min_expansion     = m.min_expansion;
+		e.max_expansion     = m.max_expansion;
+		strn0cpy(e.bucket_name, m.bucket_name.c_str(), sizeof(e.bucket_name));
+		strn0cpy(e.bucket_value, m.bucket_value.c_str(), sizeof(e.bucket_value));
+		strn0cpy(e.content_flags, m.content_flags.c_str(), sizeof(e.content_flags));
+		strn0cpy(e.content_flags_disabled, m.content_flags_disabled.c_str(), sizeof(e.content_flags_disabled));
+
+		reinterpret_cast<SharedMerchantList *>(bytes.data())->item_count++;
+
+		const size_t offset = bytes.size();
+		bytes.resize(offset + sizeof e);
+		memcpy(bytes.data() + offset, &e, sizeof e);
+	}
+
+	return records;
+}
+
+bool SharedDatabase::LoadMerchantLists(const std::string &prefix)
+{
+	merchants_hash.reset(nullptr);
+	merchants_mmf.reset(nullptr);
+
+	try {
+		auto mmf = MapSharedSegment(
+			prefix,
+			"merchants",
+			SHARED_MERCHANTS_VERSION,
+			sizeof(SharedMerchantList) + sizeof(SharedMerchantItem)
+		);
+		if (!mmf) {
+			return false;
+		}
+
+		merchants_hash = std::make_unique<EQ::FixedMemoryVariableHashSet<SharedMerchantList>>(
+			static_cast<uint8 *>(mmf->Get()) + sizeof(SharedSegmentHeader),
+			mmf->Size() - sizeof(SharedSegmentHeader)
+		);
+		merchants_mmf  = std::move(mmf);
+
+		LogInfo("Loaded merchant lists via shared memory [{}] bytes", Strings::Commify(merchants_hash->size()));
+	} catch (std::exception &ex) {
+		merchants_hash.reset(nullptr);
+		merchants_mmf.reset(nullptr);
+		LogError("Error Loading Merchant Lists: {}", ex.what());
+		return false;
+	}
+
+	return true;
+}
+
+const SharedDatabase::SharedMerchantList *SharedDatabase::GetSharedMerchantList(uint32 id) const
+{
+	if (!merchants_hash || id == 0 || !merchants_hash->exists(id)) {
+		return nullptr;
+	}
+
+	return &(merchants_hash->at(id));
+}
+
+void SharedDatabase::FillNPCType(
+	NPCType *t,
+	const NpcTypesRepository::NpcTypes &n,
+	const NpcTypesTintRepository::NpcTypesTint *tint
+)
+{
+	t->npc_id = n.id;
+
+	strn0cpy(t->name, n.name.c_str(), 50);
+
+	t->level              = n.level;
+	t->race               = n.race;
+	t->class_             = n.class_;
+	t->max_hp             = n.hp;
+	t->current_hp         = n.hp;
+	t->Mana               = n.mana;
+	t->gender             = n.gender;
+	t->texture            = n.texture;
+	t->helmtexture        = n.helmtexture;
+	t->herosforgemodel    = n.herosforgemodel;
+	t->size               = n.size;
+	t->loottable_id       = n.loottable_id;
+	t->merchanttype       = n.merchant_id;
+	t->alt_currency_type  = n.alt_currency_id;
+	t->adventure_template = n.adventure_template_id;
+	t->trap_template      = n.trap_template;
+	t->attack_speed       = n.attack_speed;
+	t->STR                = n.STR;
+	t->STA                = n.STA;
+	t->DEX                = n.DEX;
+	t->AGI                = n.AGI;
+	t->INT                = n._INT;
+	t->WIS                = n.WIS;
+	t->CHA                = n.CHA;
+	t->MR                 = n.MR;
+	t->CR                 = n.CR;
+	t->DR                 = n.DR;
+	t->FR                 = n.FR;
+	t->PR                 = n.PR;
+	t->Corrup             = n.Corrup;
+	t->PhR                = n.PhR;
+	t->min_dmg            = n.mindmg;
+	t->max_dmg            = n.maxdmg;
+	t->attack_count       = n.attack_count;
+	t->is_parcel_merchant = n.is_parcel_merchant ? true : false;
+	t->greed              = n.greed;
+
+	if (!n.special_abilities.empty()) {
+		strn0cpy(t->special_abilities, n.special_abilities.c_str(), 512);
+	}
+	else {
+		t->special_abilities[0] = '\0';
+	}
+
+	t->npc_spells_id         = n.npc_spells_id;
+	t->npc_spells_effects_id = n.npc_spells_effects_id;
+	t->d_melee_texture1      = n.d_melee_texture1;
+	t->d_melee_texture2      = n.d_melee_texture2;
+	strn0cpy(t->ammo_idfile, n.ammo_idfile.c_str(), 30);
+	t->prim_melee_type = n.prim_melee_type;
+	t->sec_melee_type  = n.sec_melee_type;
+	t->ranged_type     = n.ranged_type;
+	t->runspeed        = n.runspeed;
+	t->findable        = n.findable != 0;
+	t->is_quest_npc    = n.isquest != 0;
+	t->trackable       = n.trackable != 0;
+	t->hp_regen        = n.hp_regen_rate;
+	t->mana_regen      = n.mana_regen_rate;
+
+	// set default value for aggroradius
+	t->aggroradius = (int32) n.aggroradius;
+	if (t->aggroradius <= 0) {
+		t->aggroradius = 70;
+	}
+
+	t->assistradius = (int32) n.assistradius;
+	if (t->assistradius <= 0) {
+		t->assistradius = t->aggroradius;
+	}
+
+	if (n.bodytype > 0) {
+		t->bodytype = n.bodytype;
+	}
+	else {
+		t->bodytype = 0;
+	}
+
+	// facial features
+	t->npc_faction_id   = n.npc_faction_id;
+	t->luclinface       = n.face;
+	t->hairstyle        = n.luclin_hairstyle;
+	t->haircolor        = n.luclin_haircolor;
+	t->eyecolor1        = n.luclin_eyecolor;
+	t->eyecolor2        = n.luclin_eyecolor2;
+	t->beardcolor       = n.luclin_beardcolor;
+	t->beard            = n.luclin_beard;
+	t->drakkin_heritage = n.drakkin_heritage;
+	t->drakkin_tattoo   = n.drakkin_tattoo;
+	t->drakkin_details  = n.drakkin_details;
+
+	// armor tint
+	uint32 armor_tint_id = n.armortint_id;
+	t->armor_tint.Head.Color = (n.armortint_red & 0xFF) << 16;
+	t->armor_tint.Head.Color |= (n.armortint_green & 0xFF) << 8;
+	t->armor_tint.Head.Color |= (n.armortint_blue & 0xFF);
+	t->armor_tint.Head.Color |= (t->armor_tint.Head.Color) ? (0xFF << 24) : 0;
+
+	if (armor_tint_id != 0 && tint) {
+		const uint8 colors[EQ::textures::materialCount][3] = {
+			{tint->red1h, tint->grn1h, tint->blu1h},
+			{tint->red2c, tint->grn2c, tint->blu2c},
+			{tint->red3a, tint->grn3a, tint->blu3a},
+			{tint->red4b, tint->grn4b, tint->blu4b},
+			{tint->red5g, tint->grn5g, tint->blu5g},
+			{tint->red6l, tint->grn6l, tint->blu6l},
+			{tint->red7f, tint->grn7f, tint->blu7f},
+			{tint->red8x, tint->grn8x, tint->blu8x},
+			{tint->red9x, tint->grn9x, tint->blu9x},
+		};
+
+		for (int index = EQ::textures::textureBegin; index <= EQ::textures::LastTexture; index++) {
+			t->armor_tint.Slot[index].Color = colors[index][0] << 16;
+			t->armor_tint.Slot[index].Color |= colors[index][1] << 8;
+			t->armor_tint.Slot[index].Color |= colors[index][2];
+			t->armor_tint.Slot[index].Color |= (t->armor_tint.Slot[index].Color)
+				? (0xFF << 24) : 0;
+		}
+	}
+	else {
+		armor_tint_id = 0;
+	}
+
+	// Try loading npc_types tint fields if armor tint is 0 or query failed to get results
+	if (armor_tint_id == 0) {
+		for (int index = EQ::textures::armorChest; index < EQ::textures::materialCount; index++) {
+			t->armor_tint.Slot[index].Color = t->armor_tint.Slot[0].Color; // odd way to 'zero-out' the array...
+		}
+	}
+
+	t->see_invis        = n.see_invis;
+	t->see_invis_undead = n.see_invis_undead != 0;    // Set see_invis_undead flag
+
+	// NPC:DisableLastNames is applied by the zone so baked types do not depend on rules
+	if (!n.lastname.empty()) {
+		strn0cpy(t->lastname, n.lastname.c_str(), sizeof(t->lastname));
+	}
+
+	t->qglobal                = n.qglobal != 0;    // qglobal
+	t->AC                     = n.AC;
+	t->npc_aggro              = n.npc_aggro != 0;
+	t->spawn_limit            = n.spawn_limit;
+	t->see_hide               = n.see_hide != 0;
+	t->see_improved_hide      = n.see_improved_hide != 0;
+	t->ATK                    = n.ATK;
+	t->accuracy_rating        = n.Accuracy;
+	t->avoidance_rating       = n.Avoidance;
+	t->slow_mitigation        = n.slow_mitigation;
+	t->maxlevel               = n.maxlevel;
+	t->scalerate              = n.scalerate;
+	t->private_corpse         = n.private_corpse != 0;
+	t->unique_spawn_by_name   = n.unique_spawn_by_name != 0;
+	t->underwater             = n.underwater != 0;
+	t->emoteid                = n.emoteid;
+	t->spellscale             = n.spellscale;
+	t->healscale              = n.healscale;
+	t->no_target_hotkey       = n.no_target_hotkey != 0;
+	t->raid_target            = n.raid_target != 0;
+	t->attack_delay           = n.attack_delay * 100; // TODO: fix DB
+	t->light                  = (n.light & 0x0F);
+	t->armtexture             = n.armtexture;
+	t->bracertexture          = n.bracertexture;
+	t->handtexture            = n.handtexture;
+	t->legtexture             = n.legtexture;
+	t->feettexture            = n.feettexture;
+	t->ignore_despawn         = n.ignore_despawn != 0;
+	t->show_name              = n.show_name != 0;
+	t->untargetable           = n.untargetable != 0;
+	t->charm_ac               = n.charm_ac;
+	t->charm_min_dmg          = n.charm_min_dmg;
+	t->charm_max_dmg          = n.charm_max_dmg;
+	t->charm_attack_delay     = n.charm_attack_delay * 100; // TODO: fix DB
+	t->charm_accuracy_rating  = n.charm_accuracy_rating;
+	t->charm_avoidance_rating = n.charm_avoidance_rating;
+	t->charm_atk              = n.charm_atk;
+	t->skip_global_loot       = n.skip_global_loot != 0;
+	t->rare_spawn             = n.rare_spawn != 0;
+	t->stuck_behavior         = n.stuck_behavior;
+	t->use_model              = n.model;
+	t->flymode                = n.flymode;
+	t->always_aggro           = n.always_aggro != 0;
+	t->exp_mod                = n.exp_mod;
+	t->skip_auto_scale        = false; // hardcoded here for now
+	t->hp_regen_per_second    = n.hp_regen_per_second;
+	t->heroic_strikethrough   = n.heroic_strikethrough;
+	t->faction_amount         = n.faction_amount;
+	t->keeps_sold_items       = n.keeps_sold_items;
+	t->multiquest_enabled     = n.multiquest_enabled != 0;
+}
+
 void SharedDatabase::LoadCharacterInspectMessage(uint32 character_id, InspectMessage_Struct* message) {
 	const std::string query = StringFormat("SELECT `inspect_message` FROM `character_inspect_messages` WHERE `id` = %u LIMIT 1", character_id);
 	auto results = QueryDatabase(query);
@@ -29,17 +29,21 @@
 #include "say_link.h"
 #include "repositories/command_subsettings_repository.h"
 #include "repositories/items_evolving_details_repository.h"
+#include "repositories/npc_types_repository.h"
+#include "repositories/npc_types_tint_repository.h"
 #include "../common/repositories/character_evolving_items_repository.h"
 
 #include <list>
 #include <map>
 #include <memory>
+#include <vector>
 
 class EvolveInfo;
 struct InspectMessage_Struct;
 struct PlayerProfile_Struct;
 struct SPDat_Spell_Struct;
 struct NPCFactionList;
+struct NPCType;
 struct FactionAssociations;
 
 
@@ -177,6 +181,122 @@ public:
 	uint32 GetSharedSpellsCount() { return m_shared_spells_count; }
 	uint32 GetSpellsCount();
 
+	/**
+	 * npc types
+	 */
+	// prefixed to the npc content segments, zones ignore segments baked for a different layout
+	struct SharedSegmentHeader {
+		uint32 version;
+		uint32 type_size;
+	};
+
+	static constexpr uint32 SHARED_NPC_TYPES_VERSION = 1;
+
+	void GetNPCTypesCount(int32 &npc_type_count, uint32 &max_id);
+	void LoadNPCTypes(void *data, uint32 size, int32 npc_types, uint32 max_npc_type_id);
+	bool LoadNPCTypes(const std::string &prefix);
+	bool HasSharedNPCTypes() const { return npc_types_hash != nullptr; }
+	const NPCType *GetSharedNPCType(uint32 id) const;
+	static void FillNPCType(
+		NPCType *t,
+		const NpcTypesRepository::NpcTypes &n,
+		const NpcTypesTintRepository::NpcTypesTint *tint
+	);
+
+	/**
+	 * npc faction lists, spawn groups and merchant lists
+	 */
+	// content filter columns are kept so zones filter against their own expansion and flags
+	struct SharedSpawnEntry {
+		uint32 npc_id;
+		int32  chance;
+		uint32 condition_value_filter;
+		uint32 npc_spawn_limit;
+		int32  min_time;
+		int32  max_time;
+		int16  min_expansion;
+		int16  max_expansion;
+		char   content_flags[101];
+		char   content_flags_disabled[101];
+	};
+
+	struct SharedSpawnGroup {
+		uint32 id;
+		char   name[120];
+		int32  spawn_limit;
+		float  dist;
+		float  max_x;
+		float  min_x;
+		float  max_y;
+		float  min_y;
+		int32  delay;
+		int32  despawn;
+		int32  despawn_timer;
+		int32  min_delay;
+		uint32 wp_spawns;
+		uint32 entry_count; // followed by entry_count SharedSpawnEntry
+
+		const SharedSpawnEntry *Entries() const { return reinterpret_cast<const SharedSpawnEntry *>(this + 1); }
+	};
+
+	struct SharedMerchantItem {
+		uint32 slot;
+		uint32 item;
+		int16  faction_required;
+		int8   level_required;
+		uint8  min_status;
+		uint8  max_status;
+		uint8  probability;
+		uint8  bucket_comparison;
+		uint16 alt_currency_cost;
+		uint32 classes_required;
+		int16  min_expansion;
+		int16  max_expansion;
+		char   bucket_name[101];
+		char   bucket_value[101];
+		char   content_flags[101];
+		char   content_flags_disabled[101];
+	};
+
+	struct SharedMerchantList {
+		uint32 id;
+		uint32 item_count; // followed by item_count SharedMerchantItem, in slot order
+
+		const SharedMerchantItem *Items() const { return reinterpret_cast<const SharedMerchantItem *>(this + 1); }
+	};
+
+	static constexpr uint32 SHARED_NPC_FACTIONS_VERSION = 1;
+	static constexpr uint32 SHARED_SPAWN_GROUPS_VERSION = 1;
+	static constexpr uint32 SHARED_MERCHANTS_VERSION    = 1;
+
+	// baked variable length records by id, a record followed by its entries
+	using SharedRecords = std::map<uint32, std::vector<uint8>>;
+
+	static uint32 GetSharedRecordsSize(const SharedRecords &records);
+	static void WriteSharedRecords(
+		void *data,
+		uint32 size,
+		uint32 version,
+		uint32 type_size,
+		const SharedRecords &records
+	);
+
+	void GetNPCFactionListsCount(int32 &npc_faction_count, uint32 &max_id);
+	void LoadNPCFactionLists(void *data, uint32 size, int32 npc_factions, uint32 max_npc_faction_id);
+	bool LoadNPCFactionLists(const std::string &prefix);
+	bool HasSharedNPCFactionLists() const { return faction_hash != nullptr; }
+	const NPCFactionList *GetSharedNPCFactionList(uint32 id) const;
+
+	SharedRecords GetSpawnGroupRecords();
+	bool LoadSharedSpawnGroups(const std::string &prefix);
+	bool HasSharedSpawnGroups() const { return spawn_groups_hash != nullptr; }
+	const SharedSpawnGroup *GetSharedSpawnGroup(uint32 id) const;
+
+	SharedRecords GetMerchantListRecords();
+	bool LoadMerchantLists(const std::string &prefix);
+	bool HasSharedMerchantLists() const { return merchants_hash != nullptr; }
+	const SharedMerchantList *GetSharedMerchantList(uint32 id) const;
+
 	std::string CreateItemLink(uint32 item_id) const
 	{
 		EQ::SayLinkEngine linker;
@@ -188,14 +308,28 @@ public:
 
 protected:
 
-	std::unique_ptr<EQ::MemoryMappedFile>                        skill_caps_mmf;
-	std::unique_ptr<EQ::MemoryMappedFile>                        items_mmf;
-	std::unique_ptr<EQ::FixedMemoryHashSet<EQ::ItemData>>        items_hash;
-	std::unique_ptr<EQ::MemoryMappedFile>                        faction_mmf;
-	std::unique_ptr<EQ::FixedMemoryHashSet<NPCFactionList>>      faction_hash;
-	std::unique_ptr<EQ::MemoryMappedFile>                        faction_associations_mmf;
-	std::unique_ptr<EQ::FixedMemoryHashSet<FactionAssociations>> faction_associations_hash;
-	std::unique_ptr<EQ::MemoryMappedFile>                        spells_mmf;
+	std::unique_ptr<EQ::MemoryMappedFile>                                skill_caps_mmf;
+	std::unique_ptr<EQ::MemoryMappedFile>                                items_mmf;
+	std::unique_ptr<EQ::FixedMemoryHashSet<EQ::ItemData>>                items_hash;
+	std::unique_ptr<EQ::MemoryMappedFile>                                faction_mmf;
+	std::unique_ptr<EQ::FixedMemoryHashSet<NPCFactionList>>              faction_hash;
+	std::unique_ptr<EQ::MemoryMappedFile>                                faction_associations_mmf;
+	std::unique_ptr<EQ::FixedMemoryHashSet<FactionAssociations>>         faction_associations_hash;
+	std::unique_ptr<EQ::MemoryMappedFile>                                spells_mmf;
+	std::unique_ptr<EQ::MemoryMappedFile>                                npc_types_mmf;
+	std::unique_ptr<EQ::FixedMemoryHashSet<NPCType>>                     npc_types_hash;
+	std::unique_ptr<EQ::MemoryMappedFile>                                spawn_groups_mmf;
+	std::unique_ptr<EQ::FixedMemoryVariableHashSet<SharedSpawnGroup>>    spawn_groups_hash;
+	std::unique_ptr<EQ::MemoryMappedFile>                                merchants_mmf;
+	std::unique_ptr<EQ::FixedMemoryVariableHashSet<SharedMerchantList>>  merchants_hash;
+
+	// maps a baked segment, nullptr when it is missing or was baked by a different build
+	std::unique_ptr<EQ::MemoryMappedFile> MapSharedSegment(
+		const std::string &prefix,
+		const std::string &name,
+		uint32 version,
+		uint32 type_size
+	);
 
 public:
 	void SetSharedItemsCount(uint32 shared_items_count);
@@ -5,6 +5,7 @@
 #include "serialize_buffer.h"
 #include <algorithm>
 #include <array>
+#include <unordered_set>
 
 #define MAXTASKSETS 1000
 #define MAXACTIVEQUESTS 19 // The Client has a hard cap of 19 active quests, 29 in SoD+
@@ -49,6 +50,43 @@ enum class TaskTimerType
 	Request
 };
 
+// '|' delimited match list compiled at load, matches exactly like the string list it came from
+struct TaskMatchList {
+	std::unordered_set<uint32_t> ids;   // entries spelled exactly like an id
+	std::vector<std::string>     names; // every entry lower cased, matched as a substring
+
+	void Compile(const std::string& match_list)
+	{
+		ids.clear();
+		names.clear();
+
+		for (auto& s : Strings::Split(match_list, '|'))
+		{
+			// only the canonical spelling compared equal to std::to_string(id)
+			const bool is_id = !s.empty() && s.size() <= 10 && (s[0] != '0' || s.size() == 1) &&
+				std::all_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; });
+
+			if (is_id && std::stoull(s) <= UINT32_MAX)
+			{
+				ids.insert(static_cast<uint32_t>(std::stoull(s)));
+			}
+
+			names.push_back(Strings::ToLower(s));
+		}
+	}
+
+	bool HasId(uint32_t id) const
+	{
+		return ids.find(id) != ids.end();
+	}
+
+	bool MatchesName(const std::string& lower_name) const
+	{
+		return std::any_of(names.begin(), names.end(),
+			[&lower_name](const std::string& n) { return lower_name.find(n) != std::string::npos; });
+	}
+};
+
 struct ActivityInformation {
 	int              req_activity_id;
 	int              step;
@@ -77,6 +115,8 @@ struct ActivityInformation {
 	bool             optional;
 	uint8_t          list_group; // element group in window list (groups separated by dividers), valid values are 0-19
 	bool             has_area; // non-database field
+	TaskMatchList    npc_matcher; // non-database field, compiled npc_match_list
+	TaskMatchList    item_matcher; // non-database field, compiled item_id_list
 
 	inline bool CheckZone(int zone_id, int version) const
 	{
@@ -412,6 +452,7 @@ namespace Tasks {
 		return result;
 	}
 
+	// uncompiled forms of TaskMatchList
 	static bool IsInMatchList(const std::string& match_list, const std::string& entry)
 	{
 		for (auto &s: Strings::Split(match_list, '|')) {
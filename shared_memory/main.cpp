@@ -28,6 +28,10 @@
 #include "../common/eqemu_exception.h"
 #include "../common/strings.h"
 #include "items.h"
+#include "merchants.h"
+#include "npc_factions.h"
+#include "npc_types.h"
+#include "spawn_groups.h"
 #include "spells.h"
 #include "../common/content/world_content_service.h"
 #include "../common/zone_store.h"
@@ -183,10 +187,14 @@ int main(int argc, char **argv)
 
 	std::string hotfix_name = "";
 
-	bool load_all        = true;
-	bool load_items      = false;
-	bool load_loot       = false;
-	bool load_spells     = false;
+	bool load_all          = true;
+	bool load_items        = false;
+	bool load_loot         = false;
+	bool load_merchants    = false;
+	bool load_npc_factions = false;
+	bool load_npc_types    = false;
+	bool load_spawn_groups = false;
+	bool load_spells       = false;
 
 	if (argc > 1) {
 		for (int i = 1; i < argc; ++i) {
@@ -198,11 +206,33 @@ int main(int argc, char **argv)
 					}
 					break;
 
+				case 'm':
+					if (strcasecmp("merchants", argv[i]) == 0) {
+						load_merchants = true;
+						load_all       = false;
+					}
+					break;
+
+				case 'n':
+					if (strcasecmp("npc_types", argv[i]) == 0) {
+						load_npc_types = true;
+						load_all       = false;
+					}
+					else if (strcasecmp("npc_factions", argv[i]) == 0) {
+						load_npc_factions = true;
+						load_all          = false;
+					}
+					break;
+
 				case 's':
 					if (strcasecmp("spells", argv[i]) == 0) {
 						load_spells = true;
 						load_all    = false;
 					}
+					else if (strcasecmp("spawn_groups", argv[i]) == 0) {
+						load_spawn_groups = true;
+						load_all          = false;
+					}
 					break;
 				case '-': {
 					auto split = Strings::Split(argv[i], '=');
@@ -244,6 +274,49 @@ int main(int argc, char **argv)
 		}
 	}
 
+	// only baked for a full load when zones are configured to map it
+	if (load_npc_types || (load_all && RuleB(NPC, UseSharedMemoryNPCTypes))) {
+		LogInfo("Loading npc types");
+		try {
+			LoadNPCTypes(&content_db, hotfix_name);
+		} catch (std::exception &ex) {
+			LogError("{}", ex.what());
+			return 1;
+		}
+	}
+
+	const bool load_spawn_content = load_all && RuleB(NPC, UseSharedMemorySpawnContent);
+
+	if (load_npc_factions || load_spawn_content) {
+		LogInfo("Loading npc factions");
+		try {
+			LoadNPCFactionLists(&content_db, hotfix_name);
+		} catch (std::exception &ex) {
+			LogError("{}", ex.what());
+			return 1;
+		}
+	}
+
+	if (load_spawn_groups || load_spawn_content) {
+		LogInfo("Loading spawn groups");
+		try {
+			LoadSpawnGroups(&content_db, hotfix_name);
+		} catch (std::exception &ex) {
+			LogError("{}", ex.what());
+			return 1;
+		}
+	}
+
+	if (load_merchants || load_spawn_content) {
+		LogInfo("Loading merchants");
+		try {
+			LoadMerchantLists(&content_db, hotfix_name);
+		} catch (std::exception &ex) {
+			LogError("{}", ex.what());
+			return 1;
+		}
+	}
+
 	LogSys.CloseFileLogs();
 	return 0;
 }
@@ -32,6 +32,11 @@
 #include "data_verification_test.h"
 #include "skills_util_test.h"
 #include "task_state_test.h"
+#include "task_match_list_test.h"
+#include "player_event_codec_test.h"
+#include "region_grid_test.h"
+#include "spawn_timer_queue_test.h"
+#include "query_profiler_test.h"
 
 const EQEmuConfig *Config;
 EQEmuLogSys       LogSys;
@@ -58,6 +63,11 @@ int main()
 		tests.add(new DataVerificationTest());
 		tests.add(new SkillsUtilsTest());
 		tests.add(new TaskStateTest());
+		tests.add(new TaskMatchListTest());
+		tests.add(new PlayerEventCodecTest());
+		tests.add(new RegionGridTest());
+		tests.add(new SpawnTimerQueueTest());
+		tests.add(new QueryProfilerTest());
 		tests.run(*output, true);
 	}
 	catch (std::exception &ex) {
@@ -0,0 +1,155 @@
+#ifndef __EQEMU_TESTS_PLAYER_EVENT_CODEC_H
+#define __EQEMU_TESTS_PLAYER_EVENT_CODEC_H
+
+#include "cppunit/cpptest.h"
+#include "../common/events/player_event_codec.h"
+
+class PlayerEventCodecTest : public Test::Suite {
+	typedef void(PlayerEventCodecTest::*TestFunction)(void);
+public:
+	PlayerEventCodecTest() {
+		TEST_ADD(PlayerEventCodecTest::BinaryRoundTripTest);
+		TEST_ADD(PlayerEventCodecTest::JsonRoundTripTest);
+		TEST_ADD(PlayerEventCodecTest::ConvertBetweenEncodingsTest);
+		TEST_ADD(PlayerEventCodecTest::BadMagicTest);
+		TEST_ADD(PlayerEventCodecTest::BadVersionTest);
+		TEST_ADD(PlayerEventCodecTest::TruncatedTest);
+	}
+
+	~PlayerEventCodecTest() {
+	}
+
+	private:
+	PlayerEvent::LootItemEvent GetLootEvent() {
+		PlayerEvent::LootItemEvent e{};
+		e.item_id      = 1001;
+		e.item_name    = "Cloth Cap";
+		e.charges      = -1;
+		e.augment_1_id = 0;
+		e.augment_2_id = 2;
+		e.augment_3_id = 0;
+		e.augment_4_id = 0;
+		e.augment_5_id = 0;
+		e.augment_6_id = 4294967295u;
+		e.npc_id       = 54321;
+		e.corpse_name  = "a_gnoll's corpse";
+		return e;
+	}
+
+	PlayerEventLogsRepository::PlayerEventLogs GetBinaryRow() {
+		auto e = GetLootEvent();
+
+		PlayerEventLogsRepository::PlayerEventLogs r{};
+		r.id                = 1;
+		r.event_type_id     = PlayerEvent::LOOT_ITEM;
+		r.event_data        = "{}";
+		r.event_data_binary = PlayerEventCodec::EncodeBinary(r.event_type_id, e);
+		return r;
+	}
+
+	void AssertLootEqual(const PlayerEvent::LootItemEvent &a, const PlayerEvent::LootItemEvent &b) {
+		TEST_ASSERT_EQUALS(a.item_id, b.item_id);
+		TEST_ASSERT(a.item_name == b.item_name);
+		TEST_ASSERT_EQUALS(a.charges, b.charges);
+		TEST_ASSERT_EQUALS(a.augment_1_id, b.augment_1_id);
+		TEST_ASSERT_EQUALS(a.augment_2_id, b.augment_2_id);
+		TEST_ASSERT_EQUALS(a.augment_3_id, b.augment_3_id);
+		TEST_ASSERT_EQUALS(a.augment_4_id, b.augment_4_id);
+		TEST_ASSERT_EQUALS(a.augment_5_id, b.augment_5_id);
+		TEST_ASSERT_EQUALS(a.augment_6_id, b.augment_6_id);
+		TEST_ASSERT_EQUALS(a.npc_id, b.npc_id);
+		TEST_ASSERT(a.corpse_name == b.corpse_name);
+	}
+
+	void BinaryRoundTripTest() {
+		auto r = GetBinaryRow();
+
+		TEST_ASSERT(r.event_data_binary.size() > PlayerEventCodec::HEADER_SIZE);
+		TEST_ASSERT_EQUALS(static_cast<uint8>(r.event_data_binary[0]), PlayerEventCodec::MAGIC);
+		TEST_ASSERT_EQUALS(
+			static_cast<uint8>(r.event_data_binary[1]),
+			PlayerEventCodec::GetSchemaVersion(PlayerEvent::LOOT_ITEM)
+		);
+		TEST_ASSERT(PlayerEventCodec::IsReadable(r));
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(PlayerEventCodec::Decode(r, out));
+		AssertLootEqual(GetLootEvent(), out);
+	}
+
+	void JsonRoundTripTest() {
+		auto e = GetLootEvent();
+
+		PlayerEventLogsRepository::PlayerEventLogs r{};
+		r.event_type_id = PlayerEvent::LOOT_ITEM;
+		r.event_data    = PlayerEventCodec::EncodeJson(e);
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(PlayerEventCodec::Decode(r, out));
+		AssertLootEqual(e, out);
+	}
+
+	void ConvertBetweenEncodingsTest() {
+		auto binary = GetBinaryRow();
+
+		// binary -> json keeps every field
+		PlayerEventLogsRepository::PlayerEventLogs json_row{};
+		json_row.event_type_id = PlayerEvent::LOOT_ITEM;
+		json_row.event_data    = PlayerEventCodec::ToJson(binary);
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(PlayerEventCodec::Decode(json_row, out));
+		AssertLootEqual(GetLootEvent(), out);
+
+		// and json -> binary lands on the same bytes
+		TEST_ASSERT(PlayerEventCodec::ToBinary(json_row) == binary.event_data_binary);
+
+		// rows that are already binary are passed through
+		TEST_ASSERT(PlayerEventCodec::ToBinary(binary) == binary.event_data_binary);
+
+		// events without a payload have nothing to encode
+		PlayerEventLogsRepository::PlayerEventLogs empty{};
+		empty.event_type_id = PlayerEvent::LOOT_ITEM;
+		empty.event_data    = "{}";
+		TEST_ASSERT(PlayerEventCodec::ToBinary(empty).empty());
+	}
+
+	void BadMagicTest() {
+		auto r = GetBinaryRow();
+		r.event_data_binary[0] = static_cast<char>(PlayerEventCodec::MAGIC ^ 0xFF);
+
+		TEST_ASSERT(!PlayerEventCodec::IsReadable(r));
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(!PlayerEventCodec::Decode(r, out));
+		TEST_ASSERT(PlayerEventCodec::ToJson(r) == "{}");
+	}
+
+	void BadVersionTest() {
+		auto r = GetBinaryRow();
+		r.event_data_binary[1] = static_cast<char>(PlayerEventCodec::GetSchemaVersion(r.event_type_id) + 1);
+
+		TEST_ASSERT(!PlayerEventCodec::IsReadable(r));
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(!PlayerEventCodec::Decode(r, out));
+		TEST_ASSERT(PlayerEventCodec::ToJson(r) == "{}");
+	}
+
+	void TruncatedTest() {
+		auto r = GetBinaryRow();
+
+		// header only
+		r.event_data_binary.resize(1);
+		TEST_ASSERT(!PlayerEventCodec::IsReadable(r));
+
+		// header intact, payload cut short
+		r = GetBinaryRow();
+		r.event_data_binary.resize(r.event_data_binary.size() - 4);
+
+		PlayerEvent::LootItemEvent out{};
+		TEST_ASSERT(!PlayerEventCodec::Decode(r, out));
+	}
+};
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef __EQEMU_TESTS_QUERY_PROFILER_H
+#define __EQEMU_TESTS_QUERY_PROFILER_H
+
+#include "cppunit/cpptest.h"
+#include "../common/query_profiler.h"
+
+class QueryProfilerTest : public Test::Suite {
+	typedef void(QueryProfilerTest::*TestFunction)(void);
+public:
+	QueryProfilerTest() {
+		TEST_ADD(QueryProfilerTest::LiteralsTest);
+		TEST_ADD(QueryProfilerTest::SignTest);
+		TEST_ADD(QueryProfilerTest::ValueListTest);
+		TEST_ADD(QueryProfilerTest::RowGroupTest);
+		TEST_ADD(QueryProfilerTest::WhitespaceAndCommentsTest);
+		TEST_ADD(QueryProfilerTest::IdentifiersTest);
+		TEST_ADD(QueryProfilerTest::RecordTest);
+	}
+
+	~QueryProfilerTest() {
+	}
+
+	private:
+	std::string F(std::string_view q) {
+		return QueryProfiler::Fingerprint(q);
+	}
+
+	void LiteralsTest() {
+		TEST_ASSERT(F("SELECT * FROM npc_types WHERE id = 1001") == "select * from npc_types where id = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE name = 'Fippy'") == "select * from a where name = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE name = \"Fippy\"") == "select * from a where name = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE name = 'it''s' AND b = 'a\\'b'") == "select * from a where name = ? and b = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE x = 1.5 AND y = .5 AND z = 1e10 AND w = 0x1F") ==
+			"select * from a where x = ? and y = ? and z = ? and w = ?");
+		TEST_ASSERT(F("SELECT 1") == F("SELECT 2"));
+	}
+
+	void SignTest() {
+		// unary signs belong to the literal
+		TEST_ASSERT(F("SELECT * FROM a WHERE id = -1") == "select * from a where id = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE id IN (-1, +2)") == "select * from a where id in (?+)");
+		TEST_ASSERT(F("SELECT * FROM a WHERE x > -1 AND y < -2.5") == "select * from a where x > ? and y < ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE x BETWEEN -5 AND -1") == "select * from a where x between ? and ?");
+		TEST_ASSERT(F("SELECT -1") == "select ?");
+
+		// binary operators are kept, only the literal is replaced
+		TEST_ASSERT(F("UPDATE a SET hp = hp - 1") == "update a set hp = hp - ?");
+		TEST_ASSERT(F("UPDATE a SET hp = hp -1") == "update a set hp = hp -?");
+		TEST_ASSERT(F("UPDATE a SET hp = hp+1") == "update a set hp = hp+?");
+		TEST_ASSERT(F("SELECT (a) -1 FROM b") == "select (a) -? from b");
+		TEST_ASSERT(F("SELECT a.b -1 FROM a") == "select a.b -? from a");
+		TEST_ASSERT(F("SELECT `x` -1 FROM a") == "select `x` -? from a");
+		TEST_ASSERT(F("SELECT 5 -1") == "select ? -?");
+		TEST_ASSERT(F("SELECT x * -1 FROM a") == "select x * ? from a");
+		TEST_ASSERT(F("UPDATE a SET hp = hp - 1") != F("UPDATE a SET hp = hp + 1"));
+	}
+
+	void ValueListTest() {
+		TEST_ASSERT(F("SELECT * FROM a WHERE id IN (1, 2, 3)") == "select * from a where id in (?+)");
+		TEST_ASSERT(F("SELECT * FROM a WHERE id IN (1)") == "select * from a where id in (?)");
+		TEST_ASSERT(F("SELECT * FROM a WHERE id IN ('a','b',3)") == "select * from a where id in (?+)");
+		TEST_ASSERT(F("SELECT * FROM a WHERE id IN (1,2)") == F("SELECT * FROM a WHERE id IN (7, 8, 9, 10, 11)"));
+	}
+
+	void RowGroupTest() {
+		TEST_ASSERT(F("INSERT INTO a (x, y) VALUES (1, 'a'), (2, 'b'), (3, 'c')") == "insert into a (x, y) values (?+)");
+		TEST_ASSERT(F("INSERT INTO a (x) VALUES (1)") == F("INSERT INTO a (x) VALUES (1),(2),(3)"));
+
+		// groups that differ are kept
+		TEST_ASSERT(F("INSERT INTO a VALUES (1, NOW()), (2, 3)") == "insert into a values (?, now()), (?+)");
+	}
+
+	void WhitespaceAndCommentsTest() {
+		TEST_ASSERT(F("  SELECT\n\t*   FROM a\r\n WHERE id = 1  ") == "select * from a where id = ?");
+		TEST_ASSERT(F("SELECT /* hint */ * FROM a") == "select * from a");
+		TEST_ASSERT(F("SELECT * FROM a -- trailing\n WHERE id = 1") == "select * from a where id = ?");
+		TEST_ASSERT(F("SELECT * FROM a # trailing\n WHERE id = 1") == "select * from a where id = ?");
+		TEST_ASSERT(F("SELECT * FROM a WHERE id = 1 --1") == "select * from a where id = ? -?");
+	}
+
+	void IdentifiersTest() {
+		// digits inside identifiers are not literals
+		TEST_ASSERT(F("SELECT * FROM spawn2 WHERE spawn2.id = 1") == "select * from spawn2 where spawn2.id = ?");
+		TEST_ASSERT(F("SELECT augment_1_id FROM a") == "select augment_1_id from a");
+		TEST_ASSERT(F("SELECT `Mixed Case 1` FROM a") == "select `Mixed Case 1` from a");
+		TEST_ASSERT(F("SELECT * FROM a WHERE b = ?") == "select * from a where b = ?");
+	}
+
+	void RecordTest() {
+		auto p = QueryProfiler::Instance();
+		p->Reset();
+
+		p->Record("SELECT * FROM a WHERE id = 1", 100, 1, 50);
+		p->Record("SELECT * FROM a WHERE id = 2", 300, 2, 70);
+		p->Record("SELECT * FROM a WHERE id = ?", 200, 1, std::nullopt);
+		p->Record("SELECT * FROM b", 1000, 5, 500);
+
+		auto entries = p->Snapshot();
+		TEST_ASSERT(entries.size() == 2);
+
+		// sorted by total time
+		TEST_ASSERT(entries[0].fingerprint == "select * from b");
+		TEST_ASSERT(entries[1].fingerprint == "select * from a where id = ?");
+
+		const auto &a = entries[1].stats;
+		TEST_ASSERT(a.count == 3);
+		TEST_ASSERT(a.total_us == 600);
+		TEST_ASSERT(a.max_us == 300);
+		TEST_ASSERT(a.rows == 4);
+
+		// the prepared statement call stays out of the byte totals
+		TEST_ASSERT(a.bytes == 120);
+		TEST_ASSERT(a.bytes_count == 2);
+
+		TEST_ASSERT(p->Snapshot(1).size() == 1);
+
+		p->Reset();
+		TEST_ASSERT(p->Snapshot().empty());
+	}
+};
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef __EQEMU_TESTS_REGION_GRID_H
+#define __EQEMU_TESTS_REGION_GRID_H
+
+#include "cppunit/cpptest.h"
+#include "../zone/region_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+class RegionGridTest : public Test::Suite {
+	typedef void(RegionGridTest::*TestFunction)(void);
+public:
+	RegionGridTest() {
+		TEST_ADD(RegionGridTest::EmptyGridTest);
+		TEST_ADD(RegionGridTest::CellBoundaryTest);
+		TEST_ADD(RegionGridTest::NegativeCoordinateTest);
+		TEST_ADD(RegionGridTest::OversizedBoxTest);
+		TEST_ADD(RegionGridTest::InvertedBoxTest);
+		TEST_ADD(RegionGridTest::DedupAndOrderTest);
+		TEST_ADD(RegionGridTest::NonFiniteTest);
+		TEST_ADD(RegionGridTest::RebuildTest);
+		TEST_ADD(RegionGridTest::SupersetOfContainsTest);
+	}
+
+	~RegionGridTest() {
+	}
+
+	private:
+	RegionGrid::Box MakeBox(float min_x, float max_x, float min_y, float max_y) {
+		return RegionGrid::Box{min_x, max_x, min_y, max_y, -100.0f, 100.0f};
+	}
+
+	bool Has(const std::vector<uint32> &v, uint32 i) {
+		return std::find(v.begin(), v.end(), i) != v.end();
+	}
+
+	void EmptyGridTest() {
+		RegionGrid g;
+		g.Build({});
+
+		std::vector<uint32> out = {1, 2, 3};
+		g.Query(glm::vec3(0.0f, 0.0f, 0.0f), out);
+
+		TEST_ASSERT(g.Empty());
+		TEST_ASSERT(out.empty());
+	}
+
+	void CellBoundaryTest() {
+		RegionGrid g;
+		g.Build(
+			{
+				MakeBox(0.0f, 128.0f, 0.0f, 10.0f),   // ends exactly on the next cell
+				MakeBox(0.0f, 127.5f, 0.0f, 10.0f),   // stays in the first cell
+				MakeBox(128.0f, 200.0f, 0.0f, 10.0f), // starts exactly on the next cell
+			}
+		);
+
+		std::vector<uint32> out;
+
+		g.Query(glm::vec3(127.9f, 5.0f, 0.0f), out);
+		TEST_ASSERT(Has(out, 0));
+		TEST_ASSERT(Has(out, 1));
+		TEST_ASSERT(!Has(out, 2));
+
+		g.Query(glm::vec3(128.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(Has(out, 0));
+		TEST_ASSERT(!Has(out, 1));
+		TEST_ASSERT(Has(out, 2));
+
+		g.Query(glm::vec3(256.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(out.empty());
+
+		// y is bucketed the same way, z is not bucketed at all
+		g.Query(glm::vec3(5.0f, 128.0f, 0.0f), out);
+		TEST_ASSERT(out.empty());
+
+		g.Query(glm::vec3(5.0f, 5.0f, 5000.0f), out);
+		TEST_ASSERT(out.size() == 2);
+	}
+
+	void NegativeCoordinateTest() {
+		RegionGrid g;
+		g.Build({MakeBox(-10.0f, -1.0f, -10.0f, -1.0f)});
+
+		std::vector<uint32> out;
+
+		// -0.5 floors into cell -1, not cell 0
+		g.Query(glm::vec3(-0.5f, -0.5f, 0.0f), out);
+		TEST_ASSERT(Has(out, 0));
+
+		g.Query(glm::vec3(0.5f, 0.5f, 0.0f), out);
+		TEST_ASSERT(out.empty());
+
+		g.Query(glm::vec3(-128.0f, -128.0f, 0.0f), out);
+		TEST_ASSERT(Has(out, 0));
+
+		g.Query(glm::vec3(-128.5f, -5.0f, 0.0f), out);
+		TEST_ASSERT(out.empty());
+	}
+
+	void OversizedBoxTest() {
+		RegionGrid g;
+		g.Build(
+			{
+				MakeBox(0.0f, 10.0f, 0.0f, 10.0f),
+				MakeBox(-5000.0f, 5000.0f, -5000.0f, 5000.0f), // zone wide
+				MakeBox(0.0f, 16 * 128.0f - 1.0f, 0.0f, 16 * 128.0f - 1.0f), // 16x16 cells, still indexed
+			}
+		);
+
+		std::vector<uint32> out;
+
+		// oversized boxes come back for any point, even ones they do not contain
+		g.Query(glm::vec3(100000.0f, 100000.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 1);
+		TEST_ASSERT(Has(out, 1));
+
+		g.Query(glm::vec3(5.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 3);
+
+		g.Query(glm::vec3(2000.0f, 2000.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 2);
+		TEST_ASSERT(Has(out, 1));
+		TEST_ASSERT(Has(out, 2));
+	}
+
+	void InvertedBoxTest() {
+		RegionGrid g;
+		g.Build(
+			{
+				MakeBox(500.0f, 0.0f, 0.0f, 10.0f),
+				MakeBox(0.0f, 10.0f, 500.0f, 0.0f),
+				MakeBox(0.0f, 10.0f, 0.0f, 10.0f),
+			}
+		);
+
+		// they still take their slot so later indexes line up with the caller's vector
+		TEST_ASSERT(g.Size() == 3);
+
+		std::vector<uint32> out;
+		g.Query(glm::vec3(5.0f, 5.0f, 0.0f), glm::vec3(250.0f, 250.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 1);
+		TEST_ASSERT(Has(out, 2));
+	}
+
+	void DedupAndOrderTest() {
+		RegionGrid g;
+		g.Build(
+			{
+				MakeBox(1000.0f, 1010.0f, 0.0f, 10.0f),             // only around b
+				MakeBox(0.0f, 1010.0f, 0.0f, 10.0f),                // holds both points
+				MakeBox(-50000.0f, 50000.0f, -50000.0f, 50000.0f), // oversized
+				MakeBox(0.0f, 10.0f, 0.0f, 10.0f),                  // only around a
+			}
+		);
+
+		std::vector<uint32> out;
+		g.Query(glm::vec3(5.0f, 5.0f, 0.0f), glm::vec3(1005.0f, 5.0f, 0.0f), out);
+
+		TEST_ASSERT(out.size() == 4);
+		TEST_ASSERT(std::is_sorted(out.begin(), out.end()));
+		TEST_ASSERT(std::adjacent_find(out.begin(), out.end()) == out.end());
+
+		// the same point twice
+		g.Query(glm::vec3(5.0f, 5.0f, 0.0f), glm::vec3(5.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 3);
+		TEST_ASSERT(out[0] == 1 && out[1] == 2 && out[2] == 3);
+	}
+
+	void NonFiniteTest() {
+		RegionGrid g;
+		g.Build(
+			{
+				MakeBox(0.0f, 10.0f, 0.0f, 10.0f),
+				MakeBox(-std::numeric_limits<float>::infinity(), 0.0f, 0.0f, 10.0f),
+			}
+		);
+
+		// an infinite edge spans far too many cells, so that box is kept as oversized
+		std::vector<uint32> out;
+
+		g.Query(glm::vec3(std::nanf(""), 5.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 1 && out[0] == 1);
+
+		g.Query(glm::vec3(1.0e30f, 1.0e30f, 0.0f), out);
+		TEST_ASSERT(out.size() == 1 && out[0] == 1);
+	}
+
+	void RebuildTest() {
+		RegionGrid g;
+		g.Build({MakeBox(0.0f, 10.0f, 0.0f, 10.0f), MakeBox(-5000.0f, 5000.0f, -5000.0f, 5000.0f)});
+		g.Build({MakeBox(200.0f, 210.0f, 0.0f, 10.0f)});
+
+		std::vector<uint32> out;
+
+		g.Query(glm::vec3(5.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(out.empty());
+
+		g.Query(glm::vec3(205.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(out.size() == 1 && out[0] == 0);
+
+		g.Clear();
+		g.Query(glm::vec3(205.0f, 5.0f, 0.0f), out);
+		TEST_ASSERT(g.Empty());
+		TEST_ASSERT(out.empty());
+	}
+
+	// callers run Contains on the results, so every box holding a point has to be returned for it
+	void SupersetOfContainsTest() {
+		std::vector<RegionGrid::Box> boxes;
+		for (int i = 0; i < 12; ++i) {
+			const float x = -400.0f + i * 73.0f;
+			const float y = 300.0f - i * 61.0f;
+			boxes.push_back(MakeBox(x, x + 40.0f * (i % 5) + 1.0f, y, y + 90.0f * (i % 3) + 1.0f));
+		}
+
+		RegionGrid g;
+		g.Build(boxes);
+
+		std::vector<uint32> out;
+		for (float x = -512.0f; x <= 512.0f; x += 16.0f) {
+			for (float y = -512.0f; y <= 512.0f; y += 16.0f) {
+				const glm::vec3 p(x, y, 0.0f);
+				g.Query(p, out);
+
+				for (uint32 i = 0; i < boxes.size(); ++i) {
+					if (RegionGrid::Contains(boxes[i], p)) {
+						TEST_ASSERT(Has(out, i));
+					}
+				}
+			}
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef __EQEMU_TESTS_SPAWN_TIMER_QUEUE_H
+#define __EQEMU_TESTS_SPAWN_TIMER_QUEUE_H
+
+#include "cppunit/cpptest.h"
+#include "../zone/spawn_timer_queue.h"
+
+class SpawnTimerQueueTest : public Test::Suite {
+	typedef void(SpawnTimerQueueTest::*TestFunction)(void);
+public:
+	SpawnTimerQueueTest() {
+		TEST_ADD(SpawnTimerQueueTest::DueOrderTest);
+		TEST_ADD(SpawnTimerQueueTest::DueBoundaryTest);
+		TEST_ADD(SpawnTimerQueueTest::TieOrderTest);
+		TEST_ADD(SpawnTimerQueueTest::RescheduleTest);
+		TEST_ADD(SpawnTimerQueueTest::DisabledTest);
+		TEST_ADD(SpawnTimerQueueTest::UnregisterTest);
+		TEST_ADD(SpawnTimerQueueTest::ConditionIndexTest);
+	}
+
+	~SpawnTimerQueueTest() {
+	}
+
+	private:
+	// stands in for Spawn2, only what the queue reads
+	struct MockSpawn {
+		uint16 condition_id = 0;
+		bool   enabled      = true;
+		Timer  timer;
+
+		MockSpawn(uint32 duration, uint16 in_condition_id = 0) : condition_id(in_condition_id), timer(duration) {}
+
+		uint32 GetSpawnCondition() { return condition_id; }
+		bool Enabled() { return enabled; }
+	};
+
+	typedef BasicSpawnTimerQueue<MockSpawn>             Queue;
+	typedef std::vector<std::pair<MockSpawn *, uint64>> Due;
+
+	void DueOrderTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(3000), b(1000), c(2000);
+
+		Queue q;
+		q.Register(&a);
+		q.Register(&b);
+		q.Register(&c);
+		TEST_ASSERT(q.GetQueuedCount() == 3);
+
+		Due due;
+		q.PopDue(now + 5000, due);
+
+		TEST_ASSERT(due.size() == 3);
+		TEST_ASSERT(due[0].first == &b);
+		TEST_ASSERT(due[1].first == &c);
+		TEST_ASSERT(due[2].first == &a);
+		TEST_ASSERT(q.GetQueuedCount() == 0);
+
+		for (auto &e : due) {
+			TEST_ASSERT(q.IsCurrent(e.first, e.second));
+		}
+	}
+
+	void DueBoundaryTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(1000);
+
+		Queue q;
+		q.Register(&a);
+
+		// Timer::Check only passes once more than the duration has elapsed
+		Due due;
+		q.PopDue(now + 1000, due);
+		TEST_ASSERT(due.empty());
+
+		q.PopDue(now + 1001, due);
+		TEST_ASSERT(due.size() == 1);
+		TEST_ASSERT(due[0].first == &a);
+	}
+
+	void TieOrderTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(500), b(500), c(500);
+
+		Queue q;
+		q.Register(&c);
+		q.Register(&a);
+		q.Register(&b);
+
+		// same due time comes back in the order it was scheduled
+		Due due;
+		q.PopDue(now + 501, due);
+		TEST_ASSERT(due.size() == 3);
+		TEST_ASSERT(due[0].first == &c);
+		TEST_ASSERT(due[1].first == &a);
+		TEST_ASSERT(due[2].first == &b);
+	}
+
+	void RescheduleTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(1000);
+
+		Queue q;
+		q.Register(&a);
+
+		Due due;
+		q.PopDue(now + 1001, due);
+		TEST_ASSERT(due.size() == 1);
+		const uint64 first_ticket = due[0].second;
+
+		// a pushed back timer leaves the old entry stale instead of firing twice
+		MockSpawn b(1000);
+		q.Register(&b);
+		b.timer.Start(5000);
+		q.Schedule(&b);
+		TEST_ASSERT(q.GetQueuedCount() == 2);
+
+		due.clear();
+		q.PopDue(now + 1001, due);
+		TEST_ASSERT(due.empty());
+		TEST_ASSERT(q.GetQueuedCount() == 1);
+
+		q.PopDue(now + 5001, due);
+		TEST_ASSERT(due.size() == 1);
+		TEST_ASSERT(due[0].first == &b);
+
+		// rescheduling also invalidates a ticket already handed out
+		q.Schedule(&a);
+		TEST_ASSERT(!q.IsCurrent(&a, first_ticket));
+	}
+
+	void DisabledTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(1000), b(1000);
+		a.enabled = false;
+		b.timer.Disable();
+
+		Queue q;
+		q.Register(&a);
+		q.Register(&b);
+		TEST_ASSERT(q.GetQueuedCount() == 0);
+
+		// disabling after the fact drops the queued entry on the next pop
+		MockSpawn c(1000);
+		q.Register(&c);
+		c.timer.Disable();
+		q.Schedule(&c);
+
+		Due due;
+		q.PopDue(now + 100000, due);
+		TEST_ASSERT(due.empty());
+		TEST_ASSERT(q.GetQueuedCount() == 0);
+
+		a.enabled = true;
+		q.Schedule(&a);
+		q.PopDue(now + 1001, due);
+		TEST_ASSERT(due.size() == 1);
+		TEST_ASSERT(due[0].first == &a);
+	}
+
+	void UnregisterTest() {
+		const uint32 now = Timer::GetCurrentTime();
+
+		MockSpawn a(1000, 7), b(1000);
+
+		Queue q;
+		q.Register(&a);
+		q.Register(&b);
+		q.Unregister(&a);
+
+		Due due;
+		q.PopDue(now + 1001, due);
+		TEST_ASSERT(due.size() == 1);
+		TEST_ASSERT(due[0].first == &b);
+		TEST_ASSERT(q.GetByCondition(7).empty());
+
+		// unknown spawn points are ignored
+		q.Schedule(&a);
+		TEST_ASSERT(q.GetQueuedCount() == 0);
+		TEST_ASSERT(!q.IsCurrent(&a, 0));
+	}
+
+	void ConditionIndexTest() {
+		MockSpawn a(1000, 3), b(1000, 3), c(1000, 4), d(1000, 0);
+
+		Queue q;
+		q.Register(&a);
+		q.Register(&b);
+		q.Register(&c);
+		q.Register(&d);
+
+		auto three = q.GetByCondition(3);
+		TEST_ASSERT(three.size() == 2);
+		TEST_ASSERT(three[0] == &a && three[1] == &b);
+		TEST_ASSERT(q.GetByCondition(4).size() == 1);
+		TEST_ASSERT(q.GetByCondition(5).empty());
+
+		// always enabled spawn points never wait on a condition
+		TEST_ASSERT(q.GetByCondition(0).empty());
+
+		q.Unregister(&a);
+		three = q.GetByCondition(3);
+		TEST_ASSERT(three.size() == 1 && three[0] == &b);
+	}
+};
+
+#endif
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "cppunit/cpptest.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/tasks.h"
+
+class TaskMatchListTest: public Test::Suite
+{
+public:
+	TaskMatchListTest()
+	{
+		TEST_ADD(TaskMatchListTest::TestIds);
+		TEST_ADD(TaskMatchListTest::TestLeadingZeros);
+		TEST_ADD(TaskMatchListTest::TestOutOfRangeIds);
+		TEST_ADD(TaskMatchListTest::TestNames);
+		TEST_ADD(TaskMatchListTest::TestEmptyEntries);
+		TEST_ADD(TaskMatchListTest::TestRecompile);
+		TEST_ADD(TaskMatchListTest::TestMatchesLegacy);
+	}
+
+private:
+	void TestIds();
+	void TestLeadingZeros();
+	void TestOutOfRangeIds();
+	void TestNames();
+	void TestEmptyEntries();
+	void TestRecompile();
+	void TestMatchesLegacy();
+
+	// the compiled list has to answer exactly like the per-call split it replaced
+	bool SameAsLegacyId(const std::string& match_list, uint32_t id)
+	{
+		TaskMatchList m;
+		m.Compile(match_list);
+		return m.HasId(id) == Tasks::IsInMatchList(match_list, std::to_string(id));
+	}
+
+	bool SameAsLegacyName(const std::string& match_list, const std::string& name)
+	{
+		TaskMatchList m;
+		m.Compile(match_list);
+		return m.MatchesName(Strings::ToLower(name)) == Tasks::IsInMatchListPartial(match_list, name);
+	}
+};
+
+void TaskMatchListTest::TestIds()
+{
+	TaskMatchList m;
+	m.Compile("1001|0|4294967295|a_gnoll");
+
+	TEST_ASSERT(m.HasId(1001));
+	TEST_ASSERT(m.HasId(0));
+	TEST_ASSERT(m.HasId(4294967295u));
+	TEST_ASSERT(!m.HasId(100));
+	TEST_ASSERT(!m.HasId(10010));
+	TEST_ASSERT(m.ids.size() == 3);
+}
+
+void TaskMatchListTest::TestLeadingZeros()
+{
+	// "01001" never equalled std::to_string(1001), so it is only a name fragment
+	TaskMatchList m;
+	m.Compile("01001|00");
+
+	TEST_ASSERT(!m.HasId(1001));
+	TEST_ASSERT(!m.HasId(0));
+	TEST_ASSERT(m.ids.empty());
+	TEST_ASSERT(m.names.size() == 2);
+
+	TEST_ASSERT(SameAsLegacyId("01001|00", 1001));
+	TEST_ASSERT(SameAsLegacyId("01001|00", 0));
+}
+
+void TaskMatchListTest::TestOutOfRangeIds()
+{
+	TaskMatchList m;
+	m.Compile("4294967296|99999999999|+5|-5| 5");
+
+	TEST_ASSERT(m.ids.empty());
+	TEST_ASSERT(!m.HasId(0));
+	TEST_ASSERT(!m.HasId(5));
+
+	TEST_ASSERT(SameAsLegacyId("4294967296|99999999999|+5|-5| 5", 5));
+	TEST_ASSERT(SameAsLegacyId("4294967296|99999999999|+5|-5| 5", 0));
+}
+
+void TaskMatchListTest::TestNames()
+{
+	TaskMatchList m;
+	m.Compile("Gnoll|ORC pawn");
+
+	TEST_ASSERT(m.MatchesName("a_gnoll"));
+	TEST_ASSERT(m.MatchesName("a gnoll pup"));
+	TEST_ASSERT(m.MatchesName("an orc pawn"));
+	TEST_ASSERT(!m.MatchesName("an orc centurion"));
+	TEST_ASSERT(!m.MatchesName("a_gnol"));
+
+	// names are expected lower cased by the caller
+	TEST_ASSERT(SameAsLegacyName("Gnoll|ORC pawn", "A_Gnoll"));
+	TEST_ASSERT(SameAsLegacyName("Gnoll|ORC pawn", "An Orc Pawn"));
+	TEST_ASSERT(SameAsLegacyName("Gnoll|ORC pawn", "an orc centurion"));
+}
+
+void TaskMatchListTest::TestEmptyEntries()
+{
+	// an empty entry is a substring of every name, same as before
+	TaskMatchList m;
+	m.Compile("a_gnoll||1001");
+
+	TEST_ASSERT(m.MatchesName("anything"));
+	TEST_ASSERT(m.HasId(1001));
+	TEST_ASSERT(!m.HasId(0));
+
+	TEST_ASSERT(SameAsLegacyName("a_gnoll||1001", "anything"));
+	TEST_ASSERT(SameAsLegacyId("a_gnoll||1001", 0));
+	TEST_ASSERT(SameAsLegacyName("", "anything"));
+	TEST_ASSERT(SameAsLegacyId("", 0));
+	TEST_ASSERT(SameAsLegacyName("|", "a_gnoll"));
+	TEST_ASSERT(SameAsLegacyName("a_gnoll|", "an_orc"));
+}
+
+void TaskMatchListTest::TestRecompile()
+{
+	TaskMatchList m;
+	m.Compile("1001|a_gnoll");
+	m.Compile("2002|an_orc");
+
+	TEST_ASSERT(!m.HasId(1001));
+	TEST_ASSERT(m.HasId(2002));
+	TEST_ASSERT(!m.MatchesName("a_gnoll"));
+	TEST_ASSERT(m.MatchesName("an_orc_pawn"));
+}
+
+void TaskMatchListTest::TestMatchesLegacy()
+{
+	const std::vector<std::string> lists = {
+		"",
+		"|",
+		"1001",
+		"1001|2002|3003",
+		"01001|1001",
+		"0|00|000",
+		"a_gnoll|1001",
+		"Gnoll||Orc",
+		"gnoll pup|1001|",
+		"4294967295|4294967296",
+		"12abc|abc12|1 2",
+	};
+
+	const std::vector<uint32_t> ids = { 0, 1, 12, 1001, 2002, 3003, 10010, 4294967295u };
+
+	const std::vector<std::string> names = {
+		"",
+		"a_gnoll",
+		"a_gnoll_pup",
+		"A Gnoll Pup",
+		"an_orc_pawn",
+		"1001",
+		"x1001x",
+		"abc12",
+		"Fippy Darkpaw",
+	};
+
+	for (const auto& l : lists)
+	{
+		for (const auto& id : ids)
+		{
+			TEST_ASSERT_MSG(SameAsLegacyId(l, id), fmt::format("list [{}] id [{}]", l, id).c_str());
+		}
+
+		for (const auto& n : names)
+		{
+			TEST_ASSERT_MSG(SameAsLegacyName(l, n), fmt::format("list [{}] name [{}]", l, n).c_str());
+		}
+	}
+}
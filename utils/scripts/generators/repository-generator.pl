@@ -223,6 +223,8 @@ foreach my $table_to_generate (@tables) {
     my $cereal_columns             = "";
     my $update_one_entries         = "";
     my $all_entries                = "";
+    my $stmt_bind_entries          = "";
+    my $stmt_read_entries          = "";
     my $index                      = 0;
     my %table_data                 = ();
     my %table_primary_key          = ();
@@ -289,6 +291,19 @@ foreach my $table_to_generate (@tables) {
             $select_column_names_quoted .= sprintf("\t\t\t\"%s\",\n", format_column_name_for_mysql($column_name));
         }
 
+        # prepared statement binds / reads (binary protocol, column order)
+        if ($data_type =~ /datetime|timestamp/) {
+            $stmt_bind_entries .= sprintf("\t\tv.emplace_back(RepositoryStmt::DateTime(e.%s));\n", $column_name_formatted);
+        }
+        elsif ($struct_data_type eq "std::string") {
+            $stmt_bind_entries .= sprintf("\t\tv.emplace_back(std::string_view(e.%s));\n", $column_name_formatted);
+        }
+        else {
+            $stmt_bind_entries .= sprintf("\t\tv.emplace_back(e.%s);\n", $column_name_formatted);
+        }
+
+        $stmt_read_entries .= sprintf("\t\tRepositoryStmt::Read(row, %s, e.%s);\n", $index, $column_name_formatted);
+
         # update one
         if ($extra ne "auto_increment") {
             my $query_value = sprintf('\'" + Strings::Escape(e.%s) + "\'");', $column_name_formatted);
@@ -448,6 +463,8 @@ foreach my $table_to_generate (@tables) {
     chomp($insert_one_entries);
     chomp($insert_many_entries);
     chomp($all_entries);
+    chomp($stmt_bind_entries);
+    chomp($stmt_read_entries);
 
     use POSIX qw(strftime);
     my $generated_date = strftime "%b%e, %Y", localtime;
@@ -474,6 +491,8 @@ foreach my $table_to_generate (@tables) {
     $new_base_repository =~ s/\{\{INSERT_ONE_ENTRIES}}/$insert_one_entries/g;
     $new_base_repository =~ s/\{\{INSERT_MANY_ENTRIES}}/$insert_many_entries/g;
     $new_base_repository =~ s/\{\{ALL_ENTRIES}}/$all_entries/g;
+    $new_base_repository =~ s/\{\{STMT_BIND_ENTRIES}}/$stmt_bind_entries/g;
+    $new_base_repository =~ s/\{\{STMT_READ_ENTRIES}}/$stmt_read_entries/g;
     $new_base_repository =~ s/\{\{GENERATED_DATE}}/$generated_date/g;
     $new_base_repository =~ s/\{\{ADDITIONAL_INCLUDES}}\n/$additional_includes/g;
 
@@ -0,0 +1,528 @@
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <thread>
+#include "../../common/eqemu_config.h"
+#include "../../common/events/player_events.h"
+#include "../../common/json/json.h"
+#include "../../common/timer.h"
+#include "../../common/repositories/character_bind_repository.h"
+#include "../../common/repositories/character_buffs_repository.h"
+#include "../../common/repositories/character_currency_repository.h"
+#include "../../common/repositories/character_data_repository.h"
+#include "../../common/repositories/data_buckets_repository.h"
+#include "../../common/repositories/player_event_logs_repository.h"
+
+namespace DBBenchmark {
+	// every row the benchmark writes uses a character id from here up and is removed when it finishes
+	constexpr uint32 ID_BASE = 2000000000;
+
+	struct Options {
+		uint32 concurrency;
+		uint32 rows;
+		uint32 ops;
+		uint32 batch;
+		uint32 read_ratio;
+		bool   prepared;
+	};
+
+	struct Result {
+		std::string         name;
+		uint64              ops     = 0;
+		uint64              errors  = 0;
+		double              elapsed = 0;
+		std::vector<uint32> latency_us;
+	};
+
+	// called once per operation with the worker's own connection, returns false on failure
+	using Op = std::function<bool(Database &db, uint32 worker, uint32 iteration, std::mt19937 &rng)>;
+
+	Result Run(const std::string &name, std::vector<std::unique_ptr<Database>> &connections, const Options &o, const Op &op)
+	{
+		const uint32 workers    = connections.size();
+		const uint32 per_worker = std::max<uint32>(1, o.ops / workers);
+
+		std::vector<std::vector<uint32>> latency(workers);
+		std::atomic<uint64>              errors{0};
+		std::vector<std::thread>         threads;
+
+		BenchTimer timer;
+
+		for (uint32 w = 0; w < workers; ++w) {
+			threads.emplace_back(
+				[&, w] {
+					std::mt19937 rng(w + 1);
+
+					auto &l = latency[w];
+					l.reserve(per_worker);
+
+					for (uint32 i = 0; i < per_worker; ++i) {
+						BenchTimer t;
+						if (!op(*connections[w], w, i, rng)) {
+							errors++;
+						}
+
+						l.push_back(static_cast<uint32>(t.elapsedMicroseconds()));
+					}
+				}
+			);
+		}
+
+		for (auto &t: threads) {
+			t.join();
+		}
+
+		Result r;
+		r.name    = name;
+		r.elapsed = timer.elapsed();
+		r.errors  = errors;
+
+		for (auto &l: latency) {
+			r.latency_us.insert(r.latency_us.end(), l.begin(), l.end());
+		}
+
+		std::sort(r.latency_us.begin(), r.latency_us.end());
+		r.ops = r.latency_us.size();
+
+		return r;
+	}
+
+	// nearest rank on sorted samples
+	uint32 Percentile(const std::vector<uint32> &sorted, double p)
+	{
+		if (sorted.empty()) {
+			return 0;
+		}
+
+		const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+
+		return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+	}
+
+	Json::Value ToJson(const Result &r)
+	{
+		uint64 total = 0;
+		for (auto l: r.latency_us) {
+			total += l;
+		}
+
+		Json::Value v;
+		v["name"]        = r.name;
+		v["ops"]         = static_cast<Json::UInt64>(r.ops);
+		v["errors"]      = static_cast<Json::UInt64>(r.errors);
+		v["elapsed_ms"]  = r.elapsed * 1000.0;
+		v["ops_per_sec"] = r.elapsed > 0 ? r.ops / r.elapsed : 0;
+
+		auto &l = v["latency_us"];
+		l["min"]  = r.latency_us.empty() ? 0 : r.latency_us.front();
+		l["mean"] = r.ops ? static_cast<double>(total) / r.ops : 0;
+		l["p50"]  = Percentile(r.latency_us, 50);
+		l["p90"]  = Percentile(r.latency_us, 90);
+		l["p95"]  = Percentile(r.latency_us, 95);
+		l["p99"]  = Percentile(r.latency_us, 99);
+		l["max"]  = r.latency_us.empty() ? 0 : r.latency_us.back();
+
+		return v;
+	}
+
+	CharacterDataRepository::CharacterData NewCharacter(uint32 id)
+	{
+		auto e = CharacterDataRepository::NewEntity();
+		e.id         = id;
+		e.account_id = id;
+		e.name       = fmt::format("Benchmark{}", id);
+		e.level      = 50;
+		e.zone_id    = 202;
+		e.cur_hp     = 1000;
+		e.mana       = 1000;
+
+		return e;
+	}
+
+	void Cleanup(Database &db)
+	{
+		CharacterDataRepository::DeleteWhere(db, fmt::format("`id` >= {}", ID_BASE));
+		CharacterCurrencyRepository::DeleteWhere(db, fmt::format("`id` >= {}", ID_BASE));
+		CharacterBindRepository::DeleteWhere(db, fmt::format("`id` >= {}", ID_BASE));
+		CharacterBuffsRepository::DeleteWhere(db, fmt::format("`character_id` >= {}", ID_BASE));
+		DataBucketsRepository::DeleteWhere(db, fmt::format("`character_id` >= {}", ID_BASE));
+		PlayerEventLogsRepository::DeleteWhere(db, fmt::format("`character_id` >= {}", ID_BASE));
+	}
+
+	bool Seed(Database &db, const Options &o)
+	{
+		std::vector<CharacterDataRepository::CharacterData> characters;
+		std::vector<DataBucketsRepository::DataBuckets>     buckets;
+
+		for (uint32 i = 0; i < o.rows; ++i) {
+			characters.emplace_back(NewCharacter(ID_BASE + i));
+
+			auto b = DataBucketsRepository::NewEntity();
+			b.key_         = fmt::format("benchmark-{}", i);
+			b.value        = std::to_string(i);
+			b.character_id = ID_BASE + i;
+			buckets.emplace_back(b);
+
+			if (characters.size() == 500 || i + 1 == o.rows) {
+				if (CharacterDataRepository::InsertMany(db, characters) != static_cast<int>(characters.size()) ||
+					DataBucketsRepository::InsertMany(db, buckets) != static_cast<int>(buckets.size())) {
+					return false;
+				}
+
+				characters.clear();
+				buckets.clear();
+			}
+		}
+
+		return true;
+	}
+
+	// first id written by InsertMany, clear of the seeded rows and of every other worker
+	uint32 InsertManyId(const Options &o, uint32 worker, uint32 iteration)
+	{
+		const uint32 per_worker = std::max<uint32>(1, o.ops / o.concurrency);
+
+		return ID_BASE + o.rows + (worker * per_worker + iteration) * o.batch;
+	}
+}
+
+void WorldserverCLI::DatabaseBenchmark(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmarks repository and transaction throughput against the configured database, "
+		"writes and removes rows with character ids from 2000000000 up so only run it against a scratch database "
+		"[--suites=find-one,get-where,insert-many,update-one,client-save,data-buckets,player-events] "
+		"[--concurrency=4] [--rows=10000] [--ops=20000] [--batch=100] [--read-ratio=90] [--prepared] "
+		"[--output=file.json] [--baseline=file.json] [--max-regression=10]";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	using namespace DBBenchmark;
+
+	Options o{};
+	o.concurrency = std::max<uint32>(1, Strings::ToUnsignedInt(cmd("--concurrency").str(), 4));
+	o.rows        = std::max<uint32>(1, Strings::ToUnsignedInt(cmd("--rows").str(), 10000));
+	o.ops         = std::max<uint32>(1, Strings::ToUnsignedInt(cmd("--ops").str(), 20000));
+	o.batch       = std::max<uint32>(1, Strings::ToUnsignedInt(cmd("--batch").str(), 100));
+	o.read_ratio  = std::min<uint32>(100, Strings::ToUnsignedInt(cmd("--read-ratio").str(), 90));
+	o.prepared    = cmd[{"--prepared"}];
+
+	auto suites = Strings::Split(
+		cmd("--suites").str().empty()
+			? "find-one,get-where,insert-many,update-one,client-save,data-buckets,player-events"
+			: cmd("--suites").str(),
+		','
+	);
+
+	// one connection per worker so workers never serialize on a connection mutex
+	auto c = EQEmuConfig::get();
+
+	std::vector<std::unique_ptr<Database>> connections;
+	for (uint32 i = 0; i < o.concurrency; ++i) {
+		auto db = std::make_unique<Database>();
+		if (!db->Connect(
+			c->DatabaseHost,
+			c->DatabaseUsername,
+			c->DatabasePassword,
+			c->DatabaseDB,
+			c->DatabasePort,
+			fmt::format("benchmark-{}", i)
+		)) {
+			LogError("Failed to open benchmark connection [{}]", i);
+			return;
+		}
+
+		connections.emplace_back(std::move(db));
+	}
+
+	LogInfo(
+		"Benchmarking [{}] suite(s) concurrency [{}] rows [{}] ops [{}] batch [{}]{}",
+		suites.size(),
+		o.concurrency,
+		o.rows,
+		o.ops,
+		o.batch,
+		o.prepared ? " (prepared)" : ""
+	);
+
+	// leftovers from an interrupted run
+	Cleanup(database);
+
+	if (!Seed(database, o)) {
+		LogError("Failed to seed benchmark rows");
+		Cleanup(database);
+		return;
+	}
+
+	auto random_id = [&o](std::mt19937 &rng) {
+		return ID_BASE + static_cast<uint32>(rng() % o.rows);
+	};
+
+	std::map<std::string, Op> ops = {
+		{
+			"find-one", [&](Database &db, uint32, uint32, std::mt19937 &rng) {
+				const auto id = random_id(rng);
+				const auto e  = o.prepared
+					? CharacterDataRepository::FindOnePrepared(db, id)
+					: CharacterDataRepository::FindOne(db, id);
+
+				return e.id == id;
+			}
+		},
+		{
+			"get-where", [&](Database &db, uint32, uint32, std::mt19937 &rng) {
+				const uint32 id = random_id(rng);
+				const auto   v  = o.prepared
+					? CharacterDataRepository::GetWherePrepared(db, "`id` >= ? AND `id` < ?", {id, id + 10})
+					: CharacterDataRepository::GetWhere(db, fmt::format("`id` >= {} AND `id` < {}", id, id + 10));
+
+				return !v.empty();
+			}
+		},
+		{
+			"insert-many", [&](Database &db, uint32 worker, uint32 iteration, std::mt19937 &) {
+				const uint32 first = InsertManyId(o, worker, iteration);
+
+				std::vector<CharacterDataRepository::CharacterData> v;
+				v.reserve(o.batch);
+				for (uint32 i = 0; i < o.batch; ++i) {
+					v.emplace_back(NewCharacter(first + i));
+				}
+
+				const int inserted = o.prepared
+					? CharacterDataRepository::InsertManyPrepared(db, v)
+					: CharacterDataRepository::InsertMany(db, v);
+
+				return inserted == static_cast<int>(v.size());
+			}
+		},
+		{
+			"update-one", [&](Database &db, uint32, uint32, std::mt19937 &rng) {
+				auto e = NewCharacter(random_id(rng));
+				e.exp  = rng();
+
+				const int updated = o.prepared
+					? CharacterDataRepository::UpdateOnePrepared(db, e)
+					: CharacterDataRepository::UpdateOne(db, e);
+
+				return updated == 1;
+			}
+		},
+		{
+			// shaped like Client::Save: profile, currency, binds and buffs written in one transaction
+			"client-save", [&](Database &db, uint32, uint32 iteration, std::mt19937 &rng) {
+				const uint32 id = random_id(rng);
+
+				auto e = NewCharacter(id);
+				e.exp = iteration;
+
+				auto currency = CharacterCurrencyRepository::NewEntity();
+				currency.id       = id;
+				currency.platinum = iteration;
+
+				std::vector<CharacterBindRepository::CharacterBind> binds;
+				for (int slot = 0; slot < 5; ++slot) {
+					auto b = CharacterBindRepository::NewEntity();
+					b.id      = id;
+					b.slot    = slot;
+					b.zone_id = 202;
+					binds.emplace_back(b);
+				}
+
+				std::vector<CharacterBuffsRepository::CharacterBuffs> buffs;
+				for (uint8 slot = 0; slot < 15; ++slot) {
+					auto b = CharacterBuffsRepository::NewEntity();
+					b.character_id  = id;
+					b.slot_id       = slot;
+					b.spell_id      = 1000 + slot;
+					b.caster_level  = 50;
+					b.caster_name   = e.name;
+					b.ticsremaining = 100;
+					buffs.emplace_back(b);
+				}
+
+				db.TransactionBegin();
+
+				bool success = CharacterDataRepository::ReplaceOne(db, e) > 0 &&
+					CharacterCurrencyRepository::ReplaceOne(db, currency) > 0 &&
+					CharacterBindRepository::ReplaceMany(db, binds) > 0;
+
+				CharacterBuffsRepository::DeleteWhere(db, fmt::format("`character_id` = {}", id));
+				success = success && CharacterBuffsRepository::InsertMany(db, buffs) == static_cast<int>(buffs.size());
+
+				if (success) {
+					db.TransactionCommit();
+				}
+				else {
+					db.TransactionRollback();
+				}
+
+				return success;
+			}
+		},
+		{
+			"data-buckets", [&](Database &db, uint32, uint32 iteration, std::mt19937 &rng) {
+				const uint32 i = static_cast<uint32>(rng() % o.rows);
+
+				if (rng() % 100 < o.read_ratio) {
+					const auto v = DataBucketsRepository::GetWhere(
+						db,
+						fmt::format(
+							"`key` = '{}' AND `character_id` = {} AND `npc_id` = 0 AND `bot_id` = 0 LIMIT 1",
+							fmt::format("benchmark-{}", i),
+							ID_BASE + i
+						)
+					);
+
+					return !v.empty();
+				}
+
+				auto results = db.QueryDatabase(
+					fmt::format(
+						"UPDATE `data_buckets` SET `value` = '{}' WHERE `key` = '{}' AND `character_id` = {}",
+						iteration,
+						fmt::format("benchmark-{}", i),
+						ID_BASE + i
+					)
+				);
+
+				return results.Success();
+			}
+		},
+		{
+			"player-events", [&](Database &db, uint32, uint32 iteration, std::mt19937 &rng) {
+				std::vector<PlayerEventLogsRepository::PlayerEventLogs> v;
+				v.reserve(o.batch);
+				for (uint32 i = 0; i < o.batch; ++i) {
+					auto e = PlayerEventLogsRepository::NewEntity();
+					e.account_id      = random_id(rng);
+					e.character_id    = e.account_id;
+					e.zone_id         = 202;
+					e.event_type_id   = PlayerEvent::SAY;
+					e.event_type_name = PlayerEvent::EventName[PlayerEvent::SAY];
+					e.event_data      = fmt::format("{{\"message\":\"benchmark {}\",\"target\":\"\"}}", iteration);
+					e.created_at      = std::time(nullptr);
+					v.emplace_back(e);
+				}
+
+				const int inserted = o.prepared
+					? PlayerEventLogsRepository::InsertManyPrepared(db, v)
+					: PlayerEventLogsRepository::InsertMany(db, v);
+
+				return inserted == static_cast<int>(v.size());
+			}
+		},
+	};
+
+	Json::Value root;
+	root["concurrency"] = o.concurrency;
+	root["rows"]        = o.rows;
+	root["ops"]         = o.ops;
+	root["batch"]       = o.batch;
+	root["read_ratio"]  = o.read_ratio;
+	root["prepared"]    = o.prepared;
+	root["started_at"]  = static_cast<Json::Int64>(std::time(nullptr));
+	root["suites"]      = Json::arrayValue;
+
+	for (auto &s: suites) {
+		auto op = ops.find(Strings::Trim(s));
+		if (op == ops.end()) {
+			LogWarning("Unknown benchmark suite [{}]", s);
+			continue;
+		}
+
+		auto r = Run(op->first, connections, o, op->second);
+		auto v = ToJson(r);
+
+		LogInfo(
+			"{:<14} ops [{}] errors [{}] ops/sec [{:.1f}] p50 [{}us] p95 [{}us] p99 [{}us] max [{}us]",
+			r.name,
+			r.ops,
+			r.errors,
+			v["ops_per_sec"].asDouble(),
+			v["latency_us"]["p50"].asUInt(),
+			v["latency_us"]["p95"].asUInt(),
+			v["latency_us"]["p99"].asUInt(),
+			v["latency_us"]["max"].asUInt()
+		);
+
+		root["suites"].append(v);
+	}
+
+	Cleanup(database);
+
+	std::stringstream payload;
+	payload << root;
+
+	if (!cmd("--output").str().empty()) {
+		std::ofstream f(cmd("--output").str(), std::ios::trunc);
+		f << payload.str() << std::endl;
+	}
+	else {
+		std::cout << payload.str() << std::endl;
+	}
+
+	// a suite that hit errors fails the run whether or not there is a baseline to compare against
+	bool errored = false;
+	for (auto &r: root["suites"]) {
+		if (r["errors"].asUInt64() > 0) {
+			LogError("Suite [{}] had errors [{}]", r["name"].asString(), r["errors"].asUInt64());
+			errored = true;
+		}
+	}
+
+	if (errored) {
+		std::exit(1);
+	}
+
+	// regression gate, any suite slower than the baseline by more than max-regression percent fails the run
+	if (cmd("--baseline").str().empty()) {
+		return;
+	}
+
+	Json::Value   baseline;
+	std::ifstream ifs(cmd("--baseline").str());
+	try {
+		ifs >> baseline;
+	}
+	catch (std::exception &) {
+		LogError("Failed to parse baseline [{}]", cmd("--baseline").str());
+		std::exit(1);
+	}
+
+	const double max_regression = Strings::ToFloat(cmd("--max-regression").str(), 10);
+
+	bool failed = false;
+	for (auto &b: baseline["suites"]) {
+		for (auto &r: root["suites"]) {
+			if (r["name"] != b["name"]) {
+				continue;
+			}
+
+			const double before = b["ops_per_sec"].asDouble();
+			const double after  = r["ops_per_sec"].asDouble();
+			const double change = before > 0 ? (after - before) / before * 100.0 : 0;
+
+			if (change < -max_regression) {
+				LogError(
+					"Suite [{}] regressed ops/sec [{:.1f}] -> [{:.1f}] ({:+.1f}%)",
+					r["name"].asString(),
+					before,
+					after,
+					change
+				);
+				failed = true;
+			}
+		}
+	}
+
+	if (failed) {
+		std::exit(1);
+	}
+
+	LogInfo("No suite regressed more than [{}%] against [{}]", max_regression, cmd("--baseline").str());
+}
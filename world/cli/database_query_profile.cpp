@@ -0,0 +1,145 @@
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include "../../common/json/json.h"
+#include "../../common/path_manager.h"
+#include "../../common/query_profiler.h"
+
+void WorldserverCLI::DatabaseQueryProfile(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Shows the query profile (Logging:QueryProfiler) merged across running processes "
+		"[--limit=25] [--sort=total|count|max|avg|rows|bytes] [--process=zone] [--max-age=seconds] [--json]";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	const auto limit   = Strings::ToUnsignedInt(cmd("--limit").str(), 25);
+	const auto sort    = cmd("--sort").str().empty() ? "total" : cmd("--sort").str();
+	const auto process = Strings::ToLower(cmd("--process").str());
+
+	// snapshots from processes that stopped writing are ignored, 0 reads everything
+	const auto max_age = Strings::ToUnsignedInt(
+		cmd("--max-age").str(),
+		std::max(600, RuleI(Logging, QueryProfilerSummaryIntervalS) * 3)
+	);
+
+	const auto directory = fmt::format("{}/query_profile", path.GetLogPath());
+	if (!std::filesystem::is_directory(directory)) {
+		LogInfo("No query profiles found in [{}], is [Logging:QueryProfiler] enabled?", directory);
+		return;
+	}
+
+	std::map<std::string, QueryProfiler::Stats> merged;
+
+	uint32 files = 0;
+	for (const auto &f: std::filesystem::directory_iterator(directory)) {
+		if (f.path().extension() != ".json") {
+			continue;
+		}
+
+		Json::Value   root;
+		std::ifstream ifs(f.path());
+		try {
+			ifs >> root;
+		}
+		catch (std::exception &) {
+			LogWarning("Failed to parse query profile [{}]", f.path().string());
+			continue;
+		}
+
+		if (!process.empty() && root["process"].asString() != process) {
+			continue;
+		}
+
+		if (max_age > 0 && std::time(nullptr) - root["updated_at"].asInt64() > max_age) {
+			continue;
+		}
+
+		for (const auto &q: root["queries"]) {
+			QueryProfiler::Stats s;
+			s.count    = q["count"].asUInt64();
+			s.total_us = q["total_us"].asUInt64();
+			s.max_us   = q["max_us"].asUInt64();
+			s.rows     = q["rows"].asUInt64();
+			s.bytes    = q["bytes"].asUInt64();
+
+			s.bytes_count = q.isMember("bytes_count") ? q["bytes_count"].asUInt64() : s.count;
+
+			merged[q["fingerprint"].asString()].Merge(s);
+		}
+
+		files++;
+	}
+
+	std::vector<QueryProfiler::Entry> entries;
+	entries.reserve(merged.size());
+	for (auto &[fingerprint, stats]: merged) {
+		entries.push_back(QueryProfiler::Entry{fingerprint, stats});
+	}
+
+	auto key = [&sort](const QueryProfiler::Stats &s) -> double {
+		if (sort == "count") { return s.count; }
+		if (sort == "max") { return s.max_us; }
+		if (sort == "avg") { return s.count ? static_cast<double>(s.total_us) / s.count : 0; }
+		if (sort == "rows") { return s.rows; }
+		if (sort == "bytes") { return s.bytes; }
+		return s.total_us;
+	};
+
+	std::sort(
+		entries.begin(), entries.end(), [&key](const auto &a, const auto &b) {
+			return key(a.stats) > key(b.stats);
+		}
+	);
+
+	if (limit > 0 && entries.size() > limit) {
+		entries.resize(limit);
+	}
+
+	if (cmd[{"--json"}]) {
+		Json::Value v = Json::arrayValue;
+		for (auto &e: entries) {
+			Json::Value q;
+			q["fingerprint"] = e.fingerprint;
+			q["count"]       = static_cast<Json::UInt64>(e.stats.count);
+			q["total_us"]    = static_cast<Json::UInt64>(e.stats.total_us);
+			q["max_us"]      = static_cast<Json::UInt64>(e.stats.max_us);
+			q["rows"]        = static_cast<Json::UInt64>(e.stats.rows);
+			q["bytes"]       = static_cast<Json::UInt64>(e.stats.bytes);
+			q["bytes_count"] = static_cast<Json::UInt64>(e.stats.bytes_count);
+			v.append(q);
+		}
+
+		std::stringstream payload;
+		payload << v;
+		std::cout << payload.str() << std::endl;
+		return;
+	}
+
+	LogInfo("Merged [{}] query profile(s) from [{}] sorted by [{}]", files, directory, sort);
+
+	std::cout << fmt::format(
+		"{:>10} {:>12} {:>10} {:>10} {:>12} {:>14}  {}\n",
+		"calls",
+		"total (s)",
+		"avg (ms)",
+		"max (ms)",
+		"rows",
+		"bytes",
+		"query"
+	);
+
+	for (auto &e: entries) {
+		std::cout << fmt::format(
+			"{:>10} {:>12.3f} {:>10.3f} {:>10.3f} {:>12} {:>14}  {}\n",
+			e.stats.count,
+			e.stats.total_us / 1000000.0,
+			e.stats.count ? e.stats.total_us / 1000.0 / e.stats.count : 0,
+			e.stats.max_us / 1000.0,
+			e.stats.rows,
+			e.stats.bytes,
+			e.fingerprint
+		);
+	}
+}
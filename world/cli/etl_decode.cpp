@@ -0,0 +1,137 @@
+#include "../../common/events/player_event_codec.h"
+#include "../../common/json/json.h"
+
+void WorldserverCLI::EtlDecode(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Decodes binary player event payloads (Logging:PlayerEventsBinaryEncoding) as JSON "
+		"[--id=event_id] [--limit=100] [--rewrite (binary rows back to JSON)] [--encode (JSON rows to binary)]";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	constexpr uint32 batch_size = 1000;
+
+	// converts rows in place in id order, one batch at a time
+	auto convert = [](const std::string &filter, auto &&update) {
+		int64  last_id   = 0;
+		uint64 converted = 0;
+
+		while (true) {
+			auto rows = PlayerEventLogsRepository::GetWherePrepared(
+				database,
+				fmt::format("{} AND id > ? ORDER BY id LIMIT {}", filter, batch_size),
+				{last_id}
+			);
+
+			for (auto &r: rows) {
+				last_id = r.id;
+				if (update(r)) {
+					converted++;
+				}
+			}
+
+			if (rows.size() < batch_size) {
+				break;
+			}
+
+			LogInfo("Converted [{}] events up to id [{}]", Strings::Commify(converted), last_id);
+		}
+
+		return converted;
+	};
+
+	if (cmd[{"--rewrite"}]) {
+		auto converted = convert(
+			"event_data_binary != ''", [](const PlayerEventLogsRepository::PlayerEventLogs &r) {
+				if (!PlayerEventCodec::IsReadable(r)) {
+					return false;
+				}
+
+				auto results = database.QueryDatabase(
+					fmt::format(
+						"UPDATE player_event_logs SET event_data = '{}', event_data_binary = NULL WHERE id = {}",
+						Strings::Escape(PlayerEventCodec::ToJson(r)),
+						r.id
+					)
+				);
+
+				return results.Success();
+			}
+		);
+
+		LogInfo("Rewrote [{}] binary events as JSON", Strings::Commify(converted));
+		return;
+	}
+
+	if (cmd[{"--encode"}]) {
+		const std::string query = "UPDATE player_event_logs SET event_data = '{}', event_data_binary = ? WHERE id = ?";
+
+		auto converted = convert(
+			"(event_data_binary IS NULL OR event_data_binary = '') AND event_data != '{}'",
+			[&query](const PlayerEventLogsRepository::PlayerEventLogs &r) {
+				auto binary = PlayerEventCodec::ToBinary(r);
+				if (binary.empty()) {
+					return false;
+				}
+
+				try {
+					database.GetPreparedStmt(query).Execute({std::string_view(binary), r.id});
+				}
+				catch (std::exception &ex) {
+					LogError("Failed to encode event [{}] [{}]", r.id, ex.what());
+					database.ClearPreparedStmt(query);
+					return false;
+				}
+
+				return true;
+			}
+		);
+
+		LogInfo("Encoded [{}] JSON events as binary", Strings::Commify(converted));
+		return;
+	}
+
+	std::vector<PlayerEventLogsRepository::PlayerEventLogs> rows;
+	if (!cmd("--id").str().empty()) {
+		rows = PlayerEventLogsRepository::GetWherePrepared(
+			database,
+			"id = ?",
+			{Strings::ToBigInt(cmd("--id").str())}
+		);
+	}
+	else {
+		rows = PlayerEventLogsRepository::GetWherePrepared(
+			database,
+			fmt::format(
+				"event_data_binary != '' ORDER BY id DESC LIMIT {}",
+				Strings::ToUnsignedInt(cmd("--limit").str(), 100)
+			)
+		);
+	}
+
+	Json::Value v = Json::arrayValue;
+	for (auto &r: rows) {
+		Json::Value e;
+		e["id"]              = static_cast<Json::Int64>(r.id);
+		e["character_id"]    = static_cast<Json::Int64>(r.character_id);
+		e["event_type_id"]   = r.event_type_id;
+		e["event_type_name"] = r.event_type_name;
+		e["created_at"]      = static_cast<Json::Int64>(r.created_at);
+		e["encoding"]        = r.event_data_binary.empty() ? "json" : "binary";
+
+		std::stringstream ss(PlayerEventCodec::ToJson(r));
+		try {
+			ss >> e["event_data"];
+		}
+		catch (std::exception &) {
+			e["event_data"] = Json::objectValue;
+		}
+
+		v.append(e);
+	}
+
+	std::stringstream payload;
+	payload << v;
+	std::cout << payload.str() << std::endl;
+}
@@ -0,0 +1,16 @@
+#include "../../common/events/player_event_logs.h"
+
+void WorldserverCLI::EtlPartition(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Converts player_event_logs to daily partitions so retention drops whole days instead of "
+		"deleting rows (rebuilds the table, run during downtime)";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	player_event_logs.SetDatabase(&database);
+	if (!player_event_logs.PartitionEventLogTable()) {
+		LogError("Failed to partition player_event_logs");
+	}
+}
@@ -89,6 +89,7 @@
 #include "../common/events/player_event_logs.h"
 #include "../common/skill_caps.h"
 #include "../common/repositories/character_parcels_repository.h"
+#include "../common/query_profiler.h"
 
 SkillCaps           skill_caps;
 ZoneStore           zone_store;
@@ -443,7 +444,7 @@ int main(int argc, char **argv)
 		}
 
 		if (player_event_process_timer.Check()) {
-			std::jthread event_thread(&PlayerEventLogs::Process, &player_event_logs);
+			player_event_logs.Process();
 		}
 
 		if (PurgeInstanceTimer.Check()) {
@@ -477,6 +478,8 @@ int main(int argc, char **argv)
 		shared_task_manager.Process();
 		dynamic_zone_manager.Process();
 
+		QueryProfiler::Instance()->Process();
+
 		if (InterserverTimer.Check()) {
 			InterserverTimer.Start();
 			database.ping();
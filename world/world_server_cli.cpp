@@ -27,6 +27,8 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 	function_map["database:schema"]             = &WorldserverCLI::DatabaseGetSchema;
 	function_map["database:dump"]               = &WorldserverCLI::DatabaseDump;
 	function_map["database:updates"]            = &WorldserverCLI::DatabaseUpdates;
+	function_map["database:query-profile"]      = &WorldserverCLI::DatabaseQueryProfile;
+	function_map["database:benchmark"]          = &WorldserverCLI::DatabaseBenchmark;
 	function_map["test:test"]                   = &WorldserverCLI::TestCommand;
 	function_map["test:colors"]                 = &WorldserverCLI::TestColors;
 	function_map["test:expansion"]              = &WorldserverCLI::ExpansionTestCommand;
@@ -35,6 +37,8 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 	function_map["test:db-concurrency"]         = &WorldserverCLI::TestDatabaseConcurrency;
 	function_map["test:string-benchmark"]       = &WorldserverCLI::TestStringBenchmarkCommand;
 	function_map["etl:settings"]                = &WorldserverCLI::EtlGetSettings;
+	function_map["etl:decode"]                  = &WorldserverCLI::EtlDecode;
+	function_map["etl:partition"]               = &WorldserverCLI::EtlPartition;
 
 	EQEmuCommand::HandleMenu(function_map, cmd, argc, argv);
 }
@@ -48,6 +52,8 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 #include "cli/database_updates.cpp"
 #include "cli/database_dump.cpp"
 #include "cli/database_get_schema.cpp"
+#include "cli/database_query_profile.cpp"
+#include "cli/database_benchmark.cpp"
 #include "cli/database_set_account_status.cpp"
 #include "cli/database_version.cpp"
 #include "cli/test.cpp"
@@ -58,3 +64,5 @@ void WorldserverCLI::CommandHandler(int argc, char **argv)
 #include "cli/test_string_benchmark.cpp"
 #include "cli/version.cpp"
 #include "cli/etl_get_settings.cpp"
+#include "cli/etl_decode.cpp"
+#include "cli/etl_partition.cpp"
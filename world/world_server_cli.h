@@ -18,6 +18,8 @@ public:
 	static void DatabaseGetSchema(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void DatabaseDump(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void DatabaseUpdates(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void DatabaseQueryProfile(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void DatabaseBenchmark(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestCommand(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestColors(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void ExpansionTestCommand(int argc, char **argv, argh::parser &cmd, std::string &description);
@@ -26,6 +28,8 @@ public:
 	static void TestDatabaseConcurrency(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestStringBenchmarkCommand(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void EtlGetSettings(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void EtlDecode(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void EtlPartition(int argc, char **argv, argh::parser &cmd, std::string &description);
 };
 
 
@@ -1593,6 +1593,7 @@ void Mob::AddFeignMemory(Mob* attacker) {
 
 	if (attacker) {
 		feign_memory_list.insert(attacker->GetID());
+		attacker->AddFeignRememberedBy(this);
 	}
 }
 
@@ -1603,6 +1604,7 @@ void Mob::RemoveFromFeignMemory(Mob* attacker) {
 	}
 
 	feign_memory_list.erase(attacker->GetID());
+	attacker->RemoveFeignRememberedBy(this);
 	if (feign_memory_list.empty() && AI_feign_remember_timer != nullptr) {
 		AI_feign_remember_timer->Disable();
 	}
@@ -1621,6 +1623,10 @@ void Mob::ClearFeignMemory() {
 	while (remembered_feigned_mobid != feign_memory_list.end())
 	{
 		Mob* remembered_mob = entity_list.GetMob(*remembered_feigned_mobid);
+		if (remembered_mob) {
+			remembered_mob->RemoveFeignRememberedBy(this);
+		}
+
 		if (remembered_mob && remembered_mob->IsClient()) { //Still in zone
 			remembered_mob->CastToClient()->RemoveXTarget(this, false);
 		}
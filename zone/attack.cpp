@@ -4183,7 +4183,8 @@ void Mob::CommonDamage(Mob* attacker, int64 &damage, const uint16 spell_id, cons
 
 		int64 damage_override = 0;
 
-		if (attacker) {
+		// runs on every hit, only build the event arguments when a script listens
+		if (attacker && parse->MobHasQuestSub(attacker, EVENT_DAMAGE_GIVEN)) {
 			args = { this };
 
 			parse->EventMob(EVENT_DAMAGE_GIVEN, attacker, this,
@@ -4205,25 +4206,27 @@ void Mob::CommonDamage(Mob* attacker, int64 &damage, const uint16 spell_id, cons
 			);
 		}
 
-		args = { attacker };
+		if (parse->MobHasQuestSub(this, EVENT_DAMAGE_TAKEN)) {
+			args = { attacker };
 
-		damage_override = parse->EventMob(EVENT_DAMAGE_TAKEN, this, attacker,
-			[&]() {
-				return fmt::format(
-					"{} {} {} {} {} {} {} {} {}",
-					attacker ? attacker->GetID() : 0,
-					damage,
-					spell_id,
-					static_cast<int>(skill_used),
-					FromDamageShield ? 1 : 0,
-					avoidable ? 1 : 0,
-					buffslot,
-					iBuffTic ? 1 : 0,
-					static_cast<int>(special)
-				);
-			},
-			0, &args
-		);
+			damage_override = parse->EventMob(EVENT_DAMAGE_TAKEN, this, attacker,
+				[&]() {
+					return fmt::format(
+						"{} {} {} {} {} {} {} {} {}",
+						attacker ? attacker->GetID() : 0,
+						damage,
+						spell_id,
+						static_cast<int>(skill_used),
+						FromDamageShield ? 1 : 0,
+						avoidable ? 1 : 0,
+						buffslot,
+						iBuffTic ? 1 : 0,
+						static_cast<int>(special)
+					);
+				},
+				0, &args
+			);
+		}
 
 		if (damage_override > 0) {
 			damage = damage_override;
@@ -7520,6 +7520,7 @@ void EntityList::AddBot(Bot *new_bot, bool send_spawn_packet, bool dont_queue) {
 		new_bot->SetID(GetFreeID());
 		bot_list.emplace(std::pair<uint16, Bot*>(new_bot->GetID(), new_bot));
 		mob_list.emplace(std::pair<uint16, Mob*>(new_bot->GetID(), new_bot));
+		IndexMob(new_bot);
 
 		if (parse->BotHasQuestSub(EVENT_SPAWN)) {
 			parse->EventBot(EVENT_SPAWN, new_bot, nullptr, "", 0);
@@ -822,6 +822,9 @@ Client::~Client() {
 	}
 
 	UninitializeBuffSlots();
+
+	// after the final save, the next zone in starts the session over
+	database.EndSession(CharacterID());
 }
 
 void Client::SendZoneInPackets()
@@ -983,10 +986,72 @@ void Client::RemoveExpendedAA(int aa_id)
 	);
 }
 
+// FNV-1a over the values a save section is written from, only used to tell
+// whether the section changed since it was last written
+class SaveSectionHash {
+public:
+	SaveSectionHash &Add(const void *data, size_t size)
+	{
+		auto p = static_cast<const uint8 *>(data);
+		for (size_t i = 0; i < size; ++i) {
+			m_hash = (m_hash ^ p[i]) * 1099511628211ULL;
+		}
+
+		return *this;
+	}
+
+	template<typename T>
+	SaveSectionHash &Add(const T &v)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "save section values must be trivially copyable");
+		return Add(&v, sizeof(T));
+	}
+
+	SaveSectionHash &Add(std::string_view v)
+	{
+		return Add(v.data(), v.size());
+	}
+
+	uint64 Get() const { return m_hash; }
+
+private:
+	uint64 m_hash = 14695981039346656037ULL;
+};
+
+bool Client::IsSaveSectionDirty(SaveSection section, uint64 hash)
+{
+	if (!RuleB(Character, SaveOnlyChangedSections)) {
+		return true;
+	}
+
+	if (m_save_section_hash[section] == hash) {
+		return false;
+	}
+
+	m_save_section_hash[section] = hash;
+
+	return true;
+}
+
 bool Client::Save(uint8 iCommitNow) {
 	if(!ClientDataLoaded())
 		return false;
 
+	// delayed saves inside the coalesce window are left for the write-behind flush in Client::Process
+	const uint32 coalesce_interval = RuleI(Character, SaveCoalesceIntervalMS);
+	if (iCommitNow == 0 && coalesce_interval > 0 && m_save_flush_timer.Enabled() && !m_save_flush_timer.Check(false)) {
+		m_save_pending = true;
+		return true;
+	}
+
+	m_save_pending = false;
+	if (coalesce_interval > 0) {
+		m_save_flush_timer.Start(coalesce_interval);
+	}
+
+	// marks this character's session as written so its reads stay on the primary until replicas catch up
+	DBcore::ReadSession read_session(database, CharacterID());
+
 	/* Wrote current basics to PP for saves */
 	if (!m_lock_save_position) {
 		m_pp.x       = m_Position.x;
@@ -1015,15 +1080,42 @@ bool Client::Save(uint8 iCommitNow) {
 	}
 
 	/* Save Character Currency */
-	database.SaveCharacterCurrency(CharacterID(), &m_pp);
+	const uint64 currency_hash = SaveSectionHash()
+		.Add(m_pp.platinum).Add(m_pp.gold).Add(m_pp.silver).Add(m_pp.copper)
+		.Add(m_pp.platinum_bank).Add(m_pp.gold_bank).Add(m_pp.silver_bank).Add(m_pp.copper_bank)
+		.Add(m_pp.platinum_cursor).Add(m_pp.gold_cursor).Add(m_pp.silver_cursor).Add(m_pp.copper_cursor)
+		.Add(m_pp.currentRadCrystals).Add(m_pp.careerRadCrystals)
+		.Add(m_pp.currentEbonCrystals).Add(m_pp.careerEbonCrystals)
+		.Get();
+
+	if (IsSaveSectionDirty(SaveSectionCurrency, currency_hash)) {
+		database.SaveCharacterCurrency(CharacterID(), &m_pp);
+	}
 
 	// save character binds
 	// this may not need to be called in Save() but it's here for now
 	// to maintain the current behavior
-	database.SaveCharacterBinds(this);
+	if (IsSaveSectionDirty(SaveSectionBinds, SaveSectionHash().Add(m_pp.binds).Get())) {
+		database.SaveCharacterBinds(this);
+	}
 
 	/* Save Character Buffs */
-	database.SaveBuffs(this);
+	SaveSectionHash buff_hash;
+	for (int slot_id = 0; slot_id < GetMaxBuffSlots(); slot_id++) {
+		const auto &b = buffs[slot_id];
+		if (!IsValidSpell(b.spellid)) {
+			continue;
+		}
+
+		buff_hash.Add(slot_id).Add(b.spellid).Add(b.casterlevel).Add(std::string_view(b.caster_name, strnlen(b.caster_name, sizeof(b.caster_name))))
+			.Add(b.ticsremaining).Add(b.counters).Add(b.hit_number).Add(b.melee_rune).Add(b.magic_rune)
+			.Add(b.persistant_buff).Add(b.dot_rune).Add(b.caston_x).Add(b.caston_y).Add(b.caston_z)
+			.Add(b.ExtraDIChance).Add(b.instrument_mod);
+	}
+
+	if (IsSaveSectionDirty(SaveSectionBuffs, buff_hash.Get())) {
+		database.SaveBuffs(this);
+	}
 
 	/* Total Time Played */
 	TotalSecondsPlayed += (time(nullptr) - m_pp.lastlogin);
@@ -1057,7 +1149,10 @@ bool Client::Save(uint8 iCommitNow) {
 	} else {
 		memset(&m_petinfo, 0, sizeof(struct PetInfo));
 	}
-	database.SavePetInfo(this);
+
+	if (IsSaveSectionDirty(SaveSectionPetInfo, SaveSectionHash().Add(m_petinfo).Add(m_suspendedminion).Get())) {
+		database.SavePetInfo(this);
+	}
 
 	if(tribute_timer.Enabled()) {
 		m_pp.tribute_time_remaining = tribute_timer.GetRemainingTime();
@@ -1074,7 +1169,10 @@ bool Client::Save(uint8 iCommitNow) {
 
 	p_timers.Store(&database);
 
-	database.SaveCharacterTribute(this);
+	if (IsSaveSectionDirty(SaveSectionTribute, SaveSectionHash().Add(m_pp.tributes).Get())) {
+		database.SaveCharacterTribute(this);
+	}
+
 	SaveTaskState(); /* Save Character Task */
 
 	LogFood("Client::Save - hunger_level: [{}] thirst_level: [{}]", m_pp.hunger_level, m_pp.thirst_level);
@@ -1091,7 +1189,18 @@ bool Client::Save(uint8 iCommitNow) {
 
 	database.SaveCharacterData(this, &m_pp, &m_epp); /* Save Character Data */
 
-	database.SaveCharacterEXPModifier(this);
+	if (zone) {
+		const auto &m = zone->exp_modifiers[CharacterID()];
+
+		const uint64 exp_modifier_hash = SaveSectionHash()
+			.Add(zone->GetZoneID()).Add(zone->GetInstanceVersion())
+			.Add(m.aa_modifier).Add(m.exp_modifier)
+			.Get();
+
+		if (IsSaveSectionDirty(SaveSectionEXPModifier, exp_modifier_hash)) {
+			database.SaveCharacterEXPModifier(this);
+		}
+	}
 
 	if (RuleB(Bots, Enabled)) {
 		database.botdb.SaveBotSettings(this);
@@ -2562,7 +2671,7 @@ bool Client::ChangeFirstName(const char* in_firstname, const char* gmname)
 	// update pp
 	memset(m_pp.name, 0, sizeof(m_pp.name));
 	snprintf(m_pp.name, sizeof(m_pp.name), "%s", in_firstname);
-	strcpy(name, m_pp.name);
+	SetName(m_pp.name);
 	Save();
 
 	// send name update packet
@@ -89,6 +89,7 @@ namespace EQ
 #include <memory>
 #include <deque>
 #include <ctime>
+#include <array>
 
 
 #define CLIENT_LD_TIMEOUT 30000 // length of time client stays in zone after LDing
@@ -2162,6 +2163,23 @@ private:
 	Timer autosave_timer;
 	Timer tribute_timer;
 
+	// write-behind persistence, see Client::Save
+	enum SaveSection : uint8 {
+		SaveSectionCurrency,
+		SaveSectionBinds,
+		SaveSectionBuffs,
+		SaveSectionPetInfo,
+		SaveSectionTribute,
+		SaveSectionEXPModifier,
+		SaveSectionCount
+	};
+
+	bool IsSaveSectionDirty(SaveSection section, uint64 hash);
+
+	std::array<uint64, SaveSectionCount> m_save_section_hash{};
+	Timer m_save_flush_timer;
+	bool  m_save_pending = false;
+
 	Timer proximity_timer;
 	Timer TaskPeriodic_Timer;
 	Timer charm_update_timer;
@@ -511,6 +511,9 @@ int Client::HandlePacket(const EQApplicationPacket *app)
 			break;
 		}
 
+		// reads for this character may be served by a replica once it has our writes
+		DBcore::ReadSession read_session(database, CharacterID());
+
 		//call the processing routine
 		(this->*p)(app);
 		break;
@@ -1258,7 +1261,7 @@ void Client::Handle_Connect_OP_ZoneEntry(const EQApplicationPacket *app)
 		return;
 	}
 
-	strcpy(name, cze->char_name);
+	SetName(cze->char_name);
 	/* Check for Client Spoofing */
 	if (client != 0) {
 		struct in_addr ghost_addr;
@@ -1278,6 +1281,9 @@ void Client::Handle_Connect_OP_ZoneEntry(const EQApplicationPacket *app)
 	uint32 cid = CharacterID();
 	character_id = cid; /* Global character_id reference */
 
+	/* Replica reads for this character wait until a replica has anything written before we zoned in */
+	database.MarkSessionWrite(cid);
+
 	/* Flush and reload factions */
 	database.RemoveTempFactions(this);
 	database.LoadCharacterFactionValues(cid, factionvalues);
@@ -1393,7 +1399,7 @@ void Client::Handle_Connect_OP_ZoneEntry(const EQApplicationPacket *app)
 	if (!RuleB(Character, MaintainIntoxicationAcrossZones))
 		SetIntoxication(0);
 
-	strcpy(name, m_pp.name);
+	SetName(m_pp.name);
 	strcpy(lastname, m_pp.last_name);
 	/* If PP is set to weird coordinates */
 	if ((m_pp.x == -1 && m_pp.y == -1 && m_pp.z == -1) || (m_pp.x == -2 && m_pp.y == -2 && m_pp.z == -2)) {
@@ -136,7 +136,7 @@ bool Client::Process() {
 			m_pp.x = m_pp.binds[0].x;
 			m_pp.y = m_pp.binds[0].y;
 			m_pp.z = m_pp.binds[0].z;
-			Save();
+			Save(1);
 
 			Group *mygroup = GetGroup();
 			if (mygroup)
@@ -167,7 +167,7 @@ bool Client::Process() {
 
 		if (linkdead_timer.Check()) {
 			LeaveGroup();
-			Save();
+			Save(1);
 			if (GetMerc()) {
 				GetMerc()->Save();
 				GetMerc()->Depop();
@@ -205,7 +205,7 @@ bool Client::Process() {
 				myraid->MemberZoned(this);
 			}
 			LeaveGroup();
-			Save();
+			Save(1);
 			if (IsInAGuild()) {
 				guild_mgr.UpdateDbMemberOnline(CharacterID(), false);
 				guild_mgr.SendGuildMemberUpdateToWorld(GetName(), GuildID(), 0, time(nullptr));
@@ -548,6 +548,13 @@ bool Client::Process() {
 				Save(0);
 			}
 
+			// write-behind flush of saves coalesced since the last write, one transaction per flush
+			if (m_save_pending && m_save_flush_timer.Check(false)) {
+				database.TransactionBegin();
+				Save(1);
+				database.TransactionCommit();
+			}
+
 			if (GetIntoxication() > 0)
 			{
 				SetIntoxication(GetIntoxication()-1);
@@ -562,7 +569,7 @@ bool Client::Process() {
 	}
 
 	if (client_state == CLIENT_KICKED) {
-		Save();
+		Save(1);
 		OnDisconnect(true);
 		std::cout << "Client disconnected (cs=k): " << GetName() << std::endl;
 		return false;
@@ -625,7 +632,7 @@ bool Client::Process() {
 		//client logged out or errored out
 		//ResetTrade();
 		if (client_state != CLIENT_KICKED && !bZoning && !instalog) {
-			Save();
+			Save(1);
 		}
 
 		client_state = CLIENT_LINKDEAD;
@@ -692,6 +699,11 @@ bool Client::Process() {
 
 /* Just a set of actions preformed all over in Client::Process */
 void Client::OnDisconnect(bool hard_disconnect) {
+	// never drop a coalesced save on the way out
+	if (m_save_pending) {
+		Save(1);
+	}
+
 	if (hard_disconnect) {
 		LeaveGroup();
 
@@ -27,8 +27,10 @@
 #include "embparser.h"
 #include "questmgr.h"
 #include "qglobals.h"
+#include "quest_profiler.h"
 #include "zone.h"
 #include <algorithm>
+#include <optional>
 #include <sstream>
 
 extern Zone* zone;
@@ -270,6 +272,48 @@ void PerlembParser::ReloadQuests()
 	spell_quest_status_.clear();
 }
 
+void PerlembParser::UnloadScript(const std::string& package_name)
+{
+	if (!perl) {
+		return;
+	}
+
+	auto id = [&](const std::string& prefix) -> std::optional<uint32> {
+		if (!Strings::BeginsWith(package_name, prefix)) {
+			return std::nullopt;
+		}
+
+		return Strings::ToUnsignedInt(package_name.substr(prefix.size()));
+	};
+
+	if (package_name == "global_npc") {
+		global_npc_quest_status_ = questUnloaded;
+	} else if (package_name == "player") {
+		player_quest_status_ = questUnloaded;
+	} else if (package_name == "global_player") {
+		global_player_quest_status_ = questUnloaded;
+	} else if (package_name == "bot") {
+		bot_quest_status_ = questUnloaded;
+	} else if (package_name == "global_bot") {
+		global_bot_quest_status_ = questUnloaded;
+	} else if (package_name == "merc") {
+		merc_quest_status_ = questUnloaded;
+	} else if (package_name == "global_merc") {
+		global_merc_quest_status_ = questUnloaded;
+	} else if (auto npc_id = id("npc_")) {
+		npc_quest_status_.erase(*npc_id);
+	} else if (auto item_id = id("item_")) {
+		item_quest_status_.erase(*item_id);
+	} else if (auto spell_id = id("spell_")) {
+		spell_quest_status_.erase(*spell_id);
+	} else {
+		return;
+	}
+
+	// subs removed from the file must not linger in the package
+	perl->eval(fmt::format("delete_package('qst_{}');", package_name).c_str());
+}
+
 int PerlembParser::EventCommon(
 	QuestEventID event_id,
 	uint32 object_id,
@@ -341,6 +385,8 @@ int PerlembParser::EventCommon(
 		return 0;
 	}
 
+	QuestProfiler::Scope profile(package_name, event_id, QuestEventSubroutines[event_id]);
+
 	int char_id = 0;
 
 	ExportCharID(package_name, char_id, npc_mob, mob);
@@ -426,7 +472,7 @@ int PerlembParser::EventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -449,7 +495,7 @@ int PerlembParser::EventGlobalNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -471,7 +517,7 @@ int PerlembParser::EventGlobalNPC(
 int PerlembParser::EventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -493,7 +539,7 @@ int PerlembParser::EventPlayer(
 int PerlembParser::EventGlobalPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -517,7 +563,7 @@ int PerlembParser::EventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -545,7 +591,7 @@ int PerlembParser::EventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2633,7 +2679,7 @@ int PerlembParser::EventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2656,7 +2702,7 @@ int PerlembParser::EventGlobalBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2753,7 +2799,7 @@ int PerlembParser::EventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2776,7 +2822,7 @@ int PerlembParser::EventGlobalMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
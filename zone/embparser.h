@@ -50,7 +50,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -59,7 +59,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -67,7 +67,7 @@ public:
 	virtual int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -75,7 +75,7 @@ public:
 	virtual int EventGlobalPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -85,7 +85,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* item,
 		Mob* mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -95,7 +95,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -104,7 +104,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -113,7 +113,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -122,7 +122,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -131,7 +131,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -162,6 +162,7 @@ public:
 	virtual std::string GetVar(std::string name);
 	virtual void Init() override;
 	virtual void ReloadQuests();
+	virtual void UnloadScript(const std::string& package_name);
 	virtual uint32 GetIdentifier() { return 0xf8b05c11; }
 
 private:
@@ -200,6 +200,8 @@ void Embperl::init_eval_file(void)
 		"if(defined $Cache{$package}{mtime}&&$Cache{$package}{mtime} <= $mtime && !($package eq 'plugin')){"
 		"	return;"
 		"} else {"
+		// scripts unloaded on their own are required again, not answered from %INC
+		"	delete $INC{\"./$filename\"};"
 		// we 'my' $filename,$mtime,$package,$sub to prevent them from changing our state up here.
 		"	eval(\"package $package; my(\\$filename,\\$mtime,\\$package,\\$sub); \\$isloaded = 1; require './$filename'; \");"
 		" print $@ if $@;"
@@ -50,6 +50,7 @@
 #endif
 
 #include "bot.h"
+#include "../common/event/task_scheduler.h"
 
 extern Zone *zone;
 extern volatile bool is_zone_loaded;
@@ -331,6 +332,7 @@ void EntityList::AddClient(Client *client)
 	client->SetID(GetFreeID());
 	client_list.emplace(std::pair<uint16, Client *>(client->GetID(), client));
 	mob_list.emplace(std::pair<uint16, Mob *>(client->GetID(), client));
+	IndexMob(client);
 }
 
 
@@ -462,6 +464,7 @@ void EntityList::CorpseProcess()
 	auto it = corpse_list.begin();
 	while (it != corpse_list.end()) {
 		if (!it->second->Process()) {
+			UnindexMob(it->second, it->first);
 			safe_delete(it->second);
 			free_ids.push(it->first);
 			it = corpse_list.erase(it);
@@ -471,6 +474,65 @@ void EntityList::CorpseProcess()
 	}
 }
 
+/**
+ * Parallel think phase, runs the read-only part of NPC AI (who to attack and whether
+ * they are in melee range) on worker threads ahead of MobProcess. The main thread
+ * blocks until every intent is written, AI_Process then applies them serially and
+ * recomputes anything whose inputs changed in between.
+ */
+void EntityList::AIThinkProcess()
+{
+	static std::unique_ptr<EQ::Event::TaskScheduler> think_pool;
+	static int                                       think_pool_threads = 0;
+
+	const int threads = RuleI(NPC, AIThinkThreads);
+	if (threads <= 0 || npc_list.size() < static_cast<size_t>(RuleI(NPC, AIThinkMinimumNPCs))) {
+		return;
+	}
+
+	if (!think_pool || think_pool_threads != threads) {
+		think_pool         = std::make_unique<EQ::Event::TaskScheduler>(threads);
+		think_pool_threads = threads;
+	}
+
+	std::vector<Mob *> thinkers;
+	thinkers.reserve(npc_list.size());
+
+	for (const auto &e : npc_list) {
+		if (e.second->CanAIThinkInParallel()) {
+			thinkers.push_back(e.second);
+		}
+	}
+
+	if (thinkers.empty()) {
+		return;
+	}
+
+	// small batches on the shared queue keep idle workers pulling work when hate lists are uneven
+	const size_t batches    = static_cast<size_t>(threads) * 4;
+	const size_t batch_size = std::max<size_t>(1, (thinkers.size() + batches - 1) / batches);
+
+	std::vector<std::future<void>> work;
+	work.reserve(batches);
+
+	for (size_t begin = 0; begin < thinkers.size(); begin += batch_size) {
+		const size_t end = std::min(begin + batch_size, thinkers.size());
+		work.emplace_back(
+			think_pool->Enqueue(
+				[&thinkers, begin, end]() {
+					for (size_t i = begin; i < end; ++i) {
+						thinkers[i]->AI_Think();
+					}
+				}
+			)
+		);
+	}
+
+	for (auto &w : work) {
+		w.get();
+	}
+}
+
 void EntityList::MobProcess()
 {
 	bool mob_dead;
@@ -675,6 +737,7 @@ void EntityList::AddCorpse(Corpse *corpse, uint32 in_id)
 
 	corpse->CalcCorpseName();
 	corpse_list.emplace(std::pair<uint16, Corpse *>(corpse->GetID(), corpse));
+	IndexMob(corpse);
 
 	if (!corpse_timer.Enabled())
 		corpse_timer.Start();
@@ -695,6 +758,7 @@ void EntityList::AddNPC(NPC *npc, bool send_spawn_packet, bool dont_queue)
 
 	npc_list.emplace(std::pair<uint16, NPC *>(npc->GetID(), npc));
 	mob_list.emplace(std::pair<uint16, Mob *>(npc->GetID(), npc));
+	IndexMob(npc);
 
 	entity_list.ScanCloseMobs(npc);
 
@@ -776,6 +840,7 @@ void EntityList::AddMerc(Merc *merc, bool SendSpawnPacket, bool dontqueue)
 
 		merc_list.emplace(std::pair<uint16, Merc *>(merc->GetID(), merc));
 		mob_list.emplace(std::pair<uint16, Mob *>(merc->GetID(), merc));
+		IndexMob(merc);
 
 		if (parse->MercHasQuestSub(EVENT_SPAWN)) {
 			parse->EventMerc(EVENT_SPAWN, merc, nullptr, "", 0);
@@ -1129,14 +1194,9 @@ NPC *EntityList::GetNPCByNPCTypeID(uint32 npc_id)
 	if (npc_id == 0 || npc_list.empty())
 		return nullptr;
 
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (it->second->GetNPCTypeID() == npc_id)
-			return it->second;
-		++it;
-	}
+	const auto &v = GetIndexedNPCsByNPCTypeID(npc_id);
 
-	return nullptr;
+	return v.empty() ? nullptr : v.front();
 }
 
 NPC *EntityList::GetNPCBySpawnID(uint32 spawn_id)
@@ -1172,17 +1232,29 @@ Mob *EntityList::GetMob(uint16 get_id)
 
 Mob *EntityList::GetMob(const char *name)
 {
-	Entity* ent = nullptr;
-
 	if (name == 0)
 		return nullptr;
 
-	if ((ent = entity_list.GetEntityMob(name)))
-		return ent->CastToMob();
-	else if ((ent = entity_list.GetEntityCorpse(name)))
-		return ent->CastToMob();
+	Mob *corpse = nullptr;
 
-	return nullptr;
+	// live mobs win over corpses sharing the name
+	auto range = name_index.equal_range(Strings::ToLower(name));
+	for (auto it = range.first; it != range.second;) {
+		auto m = mob_list.find(it->second);
+		if (m != mob_list.end() && m->second && strcasecmp(m->second->GetName(), name) == 0)
+			return m->second;
+
+		auto c = corpse_list.find(it->second);
+		if (c != corpse_list.end() && c->second && strcasecmp(c->second->GetName(), name) == 0) {
+			corpse = c->second;
+			++it;
+			continue;
+		}
+
+		it = name_index.erase(it);
+	}
+
+	return corpse;
 }
 
 Mob *EntityList::GetMobByNpcTypeID(uint32 get_id)
@@ -1204,12 +1276,10 @@ bool EntityList::IsMobSpawnedByNpcTypeID(uint32 get_id)
 	if (get_id == 0 || npc_list.empty())
 		return false;
 
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
+	for (auto npc : GetIndexedNPCsByNPCTypeID(get_id)) {
 		// Mobs will have a 0 as their GetID() if they're dead
-		if (it->second->GetNPCTypeID() == get_id && it->second->GetID() != 0)
+		if (npc->GetID() != 0)
 			return true;
-		++it;
 	}
 
 	return false;
@@ -1227,16 +1297,14 @@ uint32 EntityList::CountSpawnedNPCs(std::vector<uint32> npc_ids)
 		return npc_count;
 	}
 
-	for (auto current_npc : npc_list) {
-		if (
-			std::find(
-				npc_ids.begin(),
-				npc_ids.end(),
-				current_npc.second->GetNPCTypeID()
-			) != npc_ids.end() &&
-			current_npc.second->GetID() != 0
-		) {
-			npc_count++;
+	std::sort(npc_ids.begin(), npc_ids.end());
+	npc_ids.erase(std::unique(npc_ids.begin(), npc_ids.end()), npc_ids.end());
+
+	for (const auto& npc_id : npc_ids) {
+		for (auto npc : GetIndexedNPCsByNPCTypeID(npc_id)) {
+			if (npc->GetID() != 0) {
+				npc_count++;
+			}
 		}
 	}
 
@@ -1489,7 +1557,7 @@ void EntityList::Save()
 {
 	auto it = client_list.begin();
 	while (it != client_list.end()) {
-		it->second->Save();
+		it->second->Save(1);
 		++it;
 	}
 }
@@ -1834,10 +1902,29 @@ void EntityList::DuelMessage(Mob *winner, Mob *loser, bool flee)
 
 Client *EntityList::GetClientByName(const char* name)
 {
-	for (const auto& e : client_list) {
-		if (e.second && Strings::EqualFold(e.second->GetName(), name)) {
-			return e.second;
+	if (!name) {
+		return nullptr;
+	}
+
+	auto range = name_index.equal_range(Strings::ToLower(name));
+	for (auto it = range.first; it != range.second;) {
+		auto c = client_list.find(it->second);
+		if (c != client_list.end() && c->second && Strings::EqualFold(c->second->GetName(), name)) {
+			return c->second;
 		}
+
+		// the entity may be a corpse or another mob sharing the name, only prune ids that stopped matching
+		auto m = mob_list.find(it->second);
+		auto o = corpse_list.find(it->second);
+		if (
+			(m != mob_list.end() && m->second && Strings::EqualFold(m->second->GetName(), name)) ||
+			(o != corpse_list.end() && o->second && Strings::EqualFold(o->second->GetName(), name))
+		) {
+			++it;
+			continue;
+		}
+
+		it = name_index.erase(it);
 	}
 
 	return nullptr;
@@ -1845,25 +1932,120 @@ Client *EntityList::GetClientByName(const char* name)
 
 Client *EntityList::GetClientByCharID(uint32 iCharID)
 {
-	auto it = client_list.begin();
-	while (it != client_list.end()) {
-		if (it->second->CharacterID() == iCharID)
-			return it->second;
-		++it;
-	}
+	auto it = character_id_index.find(iCharID);
+	if (it == character_id_index.end())
+		return nullptr;
+
+	auto c = client_list.find(it->second);
+	if (c != client_list.end() && c->second->CharacterID() == iCharID)
+		return c->second;
+
+	character_id_index.erase(it);
 	return nullptr;
 }
 
 Client *EntityList::GetClientByWID(uint32 iWID)
 {
-	auto it = client_list.begin();
-	while (it != client_list.end()) {
-		if (it->second->GetWID() == iWID) {
-			return it->second;
+	auto it = wid_index.find(iWID);
+	if (it == wid_index.end()) {
+		return nullptr;
+	}
+
+	auto c = client_list.find(it->second);
+	if (c != client_list.end() && c->second->GetWID() == iWID) {
+		return c->second;
+	}
+
+	wid_index.erase(it);
+	return nullptr;
+}
+
+void EntityList::IndexMob(Mob *mob)
+{
+	if (!mob || !mob->GetID()) {
+		return;
+	}
+
+	const uint16 id = mob->GetID();
+
+	auto index = [id](auto &m, const auto &key) {
+		auto range = m.equal_range(key);
+		for (auto it = range.first; it != range.second; ++it) {
+			if (it->second == id) {
+				return;
+			}
+		}
+
+		m.emplace(key, id);
+	};
+
+	index(name_index, Strings::ToLower(mob->GetName()));
+
+	if (mob->IsNPC()) {
+		index(npc_type_index, mob->GetNPCTypeID());
+	}
+
+	if (mob->IsClient()) {
+		if (mob->CastToClient()->CharacterID()) {
+			character_id_index[mob->CastToClient()->CharacterID()] = id;
+		}
+
+		if (mob->CastToClient()->GetWID()) {
+			wid_index[mob->CastToClient()->GetWID()] = id;
+		}
+	}
+}
+
+void EntityList::UnindexMob(Mob *mob, uint16 entity_id)
+{
+	if (!mob || !entity_id) {
+		return;
+	}
+
+	auto unindex = [entity_id](auto &m, const auto &key) {
+		auto range = m.equal_range(key);
+		for (auto it = range.first; it != range.second;) {
+			it = it->second == entity_id ? m.erase(it) : std::next(it);
 		}
+	};
+
+	unindex(name_index, Strings::ToLower(mob->GetName()));
+
+	if (mob->IsNPC()) {
+		unindex(npc_type_index, mob->GetNPCTypeID());
+	}
+
+	if (mob->IsClient()) {
+		unindex(character_id_index, mob->CastToClient()->CharacterID());
+		unindex(wid_index, mob->CastToClient()->GetWID());
+	}
+}
+
+std::vector<NPC *> EntityList::GetIndexedNPCsByNPCTypeID(uint32 npc_type_id)
+{
+	std::vector<NPC *> v;
+
+	auto range = npc_type_index.equal_range(npc_type_id);
+	for (auto it = range.first; it != range.second;) {
+		auto n = npc_list.find(it->second);
+		if (n == npc_list.end() || !n->second || n->second->GetNPCTypeID() != npc_type_id) {
+			it = npc_type_index.erase(it);
+			continue;
+		}
+
+		v.emplace_back(n->second);
 		++it;
 	}
-	return nullptr;
+
+	return v;
+}
+
+void EntityList::ClearIndexes()
+{
+	npc_type_index.clear();
+	character_id_index.clear();
+	wid_index.clear();
+	name_index.clear();
 }
 
 Client *EntityList::GetClientByLSID(uint32 iLSID)
@@ -2069,6 +2251,7 @@ void EntityList::RemoveAllCorpsesByCharID(uint32 charid)
 	auto it = corpse_list.begin();
 	while (it != corpse_list.end()) {
 		if (it->second->GetCharID() == charid) {
+			UnindexMob(it->second, it->first);
 			safe_delete(it->second);
 			free_ids.push(it->first);
 			it = corpse_list.erase(it);
@@ -2083,6 +2266,7 @@ void EntityList::RemoveCorpseByDBID(uint32 dbid)
 	auto it = corpse_list.begin();
 	while (it != corpse_list.end()) {
 		if (it->second->GetCorpseDBID() == dbid) {
+			UnindexMob(it->second, it->first);
 			safe_delete(it->second);
 			free_ids.push(it->first);
 			it = corpse_list.erase(it);
@@ -2661,6 +2845,7 @@ void EntityList::RemoveAllMobs()
 			++it;
 			continue;
 		}
+		UnindexMob(it->second, it->first);
 		safe_delete(it->second);
 		free_ids.push(it->first);
 		it = mob_list.erase(it);
@@ -2749,6 +2934,7 @@ void EntityList::RemoveAllCorpses()
 {
 	auto it = corpse_list.begin();
 	while (it != corpse_list.end()) {
+		UnindexMob(it->second, it->first);
 		safe_delete(it->second);
 		free_ids.push(it->first);
 		it = corpse_list.erase(it);
@@ -2807,6 +2993,7 @@ bool EntityList::RemoveMob(uint16 delete_id)
 		else if (client_list.count(delete_id)) {
 			entity_list.RemoveClient(delete_id);
 		}
+		UnindexMob(it->second, delete_id);
 		safe_delete(it->second);
 		if (!corpse_list.count(delete_id)) {
 			free_ids.push(it->first);
@@ -3043,6 +3230,7 @@ bool EntityList::RemoveCorpse(uint16 delete_id)
 {
 	auto it = corpse_list.find(delete_id);
 	if (it != corpse_list.end()) {
+		UnindexMob(it->second, delete_id);
 		safe_delete(it->second);
 		free_ids.push(it->first);
 		corpse_list.erase(it);
@@ -3081,6 +3269,7 @@ void EntityList::Clear()
 	entity_list.RemoveAllObjects();
 	entity_list.RemoveAllRaids();
 	entity_list.RemoveAllLocalities();
+	ClearIndexes();
 }
 
 void EntityList::UpdateWho(bool iSendFullUpdate)
@@ -3201,20 +3390,21 @@ void EntityList::SendTraders(Client *client)
 
 void EntityList::RemoveFromHateLists(Mob *mob, bool settoone)
 {
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (it->second->CheckAggro(mob)) {
-			if (!settoone) {
-				it->second->RemoveFromHateList(mob);
-				it->second->RemoveFromRampageList(mob);
-				if (mob->IsClient()) {
-					mob->CastToClient()->RemoveXTarget(it->second, false); // gotta do book keeping
-				}
-			} else {
-				it->second->SetHateAmountOnEnt(mob, 1);
+	for (auto id : mob->GetHatedByIDs()) {
+		NPC *n = GetNPCByID(id);
+		if (!n || !n->CheckAggro(mob)) {
+			continue;
+		}
+
+		if (!settoone) {
+			n->RemoveFromHateList(mob);
+			n->RemoveFromRampageList(mob);
+			if (mob->IsClient()) {
+				mob->CastToClient()->RemoveXTarget(n, false); // gotta do book keeping
 			}
+		} else {
+			n->SetHateAmountOnEnt(mob, 1);
 		}
-		++it;
 	}
 }
 
@@ -3564,26 +3754,31 @@ void EntityList::ClearAggro(Mob* targ, bool clear_caster_id)
 		c = targ->CastToClient();
 	}
 
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (clear_caster_id) {
-			it->second->BuffDetachCaster(targ);
+	if (clear_caster_id) {
+		for (auto &e : npc_list) {
+			e.second->BuffDetachCaster(targ);
+		}
+	}
+
+	for (auto id : targ->GetHatedByIDs(true)) {
+		NPC *n = GetNPCByID(id);
+		if (!n) {
+			continue;
 		}
 
-		if (it->second->CheckAggro(targ)) {
+		if (n->CheckAggro(targ)) {
 			if (c) {
-				c->RemoveXTarget(it->second, false);
+				c->RemoveXTarget(n, false);
 			}
 
-			it->second->RemoveFromHateList(targ);
-			it->second->RemoveFromRampageList(targ, true);
+			n->RemoveFromHateList(targ);
+			n->RemoveFromRampageList(targ, true);
 		}
 
-		if (c && it->second->IsOnFeignMemory(c)) {
-			it->second->RemoveFromFeignMemory(c); //just in case we feigned
-			c->RemoveXTarget(it->second, false);
+		if (c && n->IsOnFeignMemory(c)) {
+			n->RemoveFromFeignMemory(c); //just in case we feigned
+			c->RemoveXTarget(n, false);
 		}
-		++it;
 	}
 }
 
@@ -3616,58 +3811,58 @@ void EntityList::ClearWaterAggro(Mob* targ)
 
 void EntityList::ClearFeignAggro(Mob *targ)
 {
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
+	for (auto id : targ->GetHatedByIDs(true)) {
+		NPC *n = GetNPCByID(id);
+		if (!n) {
+			continue;
+		}
+
 		// add Feign Memory check because sometimes weird stuff happens
-		if (it->second->CheckAggro(targ) || (targ->IsClient() && it->second->IsOnFeignMemory(targ))) {
-			if (it->second->GetSpecialAbility(SpecialAbility::FeignDeathImmunity)) {
-				++it;
+		if (n->CheckAggro(targ) || (targ->IsClient() && n->IsOnFeignMemory(targ))) {
+			if (n->GetSpecialAbility(SpecialAbility::FeignDeathImmunity)) {
 				continue;
 			}
 
 			if (targ->IsClient()) {
 				if (parse->PlayerHasQuestSub(EVENT_FEIGN_DEATH)) {
-					std::vector<std::any> args = { it->second };
+					std::vector<std::any> args = { n };
 
 					int i = parse->EventPlayer(EVENT_FEIGN_DEATH, targ->CastToClient(), "", 0, &args);
 					if (i != 0) {
-						++it;
 						continue;
 					}
 				}
 
-				if (it->second->IsNPC()) {
-					if (parse->HasQuestSub(it->second->GetNPCTypeID(), EVENT_FEIGN_DEATH)) {
-						int i = parse->EventNPC(EVENT_FEIGN_DEATH, it->second->CastToNPC(), targ, "", 0);
+				if (n->IsNPC()) {
+					if (parse->HasQuestSub(n->GetNPCTypeID(), EVENT_FEIGN_DEATH)) {
+						int i = parse->EventNPC(EVENT_FEIGN_DEATH, n->CastToNPC(), targ, "", 0);
 						if (i != 0) {
-							++it;
 							continue;
 						}
 					}
 				}
 			}
 
-			it->second->RemoveFromHateList(targ);
+			n->RemoveFromHateList(targ);
 
-			if (it->second->GetSpecialAbility(SpecialAbility::Rampage)) {
-				it->second->RemoveFromRampageList(targ, true);
+			if (n->GetSpecialAbility(SpecialAbility::Rampage)) {
+				n->RemoveFromRampageList(targ, true);
 			}
 
 			if (targ->IsClient()) {
-				if (it->second->GetLevel() >= 35 && zone->random.Roll(60)) {
-					it->second->AddFeignMemory(targ);
+				if (n->GetLevel() >= 35 && zone->random.Roll(60)) {
+					n->AddFeignMemory(targ);
 				}
 				else {
-					targ->CastToClient()->RemoveXTarget(it->second, false);
+					targ->CastToClient()->RemoveXTarget(n, false);
 				}
 			}
 			else if (targ->IsPet()){
-				if (it->second->GetLevel() >= 35 && zone->random.Roll(60)) {
-					it->second->AddFeignMemory(targ);
+				if (n->GetLevel() >= 35 && zone->random.Roll(60)) {
+					n->AddFeignMemory(targ);
 				}
 			}
 		}
-		++it;
 	}
 }
 
@@ -3695,13 +3890,8 @@ void EntityList::AggroZone(Mob *who, int64 hate)
 // Signal Quest command function
 void EntityList::SignalMobsByNPCID(uint32 snpc, int signal_id)
 {
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		NPC *pit = it->second;
-		if (pit->GetNPCTypeID() == snpc)
-			pit->SignalNPC(signal_id);
-		++it;
-	}
+	for (auto npc : GetIndexedNPCsByNPCTypeID(snpc))
+		npc->SignalNPC(signal_id);
 }
 
 bool EntityList::MakeTrackPacket(Client *client)
@@ -3869,6 +4059,9 @@ void EntityList::AddProximity(NPC *proximity_for)
 	proximity_list.push_back(proximity_for);
 
 	proximity_for->proximity = new NPCProximity; // deleted in NPC::~NPC
+
+	// the caller fills in the box after this returns, the grid is built on the next move
+	m_locality_grid_dirty = true;
 }
 
 bool EntityList::RemoveProximity(uint16 delete_npc_id)
@@ -3879,12 +4072,47 @@ bool EntityList::RemoveProximity(uint16 delete_npc_id)
 		return false;
 
 	proximity_list.erase(it);
+	m_locality_grid_dirty = true;
 	return true;
 }
 
 void EntityList::RemoveAllLocalities()
 {
 	proximity_list.clear();
+	m_locality_grid_dirty = true;
+}
+
+void EntityList::BuildLocalityGrid()
+{
+	m_locality_npcs.clear();
+	m_locality_areas.clear();
+
+	std::vector<RegionGrid::Box> boxes;
+	boxes.reserve(proximity_list.size() + area_list.size());
+
+	for (const auto& n : proximity_list) {
+		auto* p = n->proximity;
+		if (!p) {
+			continue;
+		}
+
+		m_locality_npcs.emplace_back(n);
+		boxes.push_back({ p->min_x, p->max_x, p->min_y, p->max_y, p->min_z, p->max_z });
+	}
+
+	for (const auto& a : area_list) {
+		m_locality_areas.emplace_back(&a);
+		boxes.push_back({ a.min_x, a.max_x, a.min_y, a.max_y, a.min_z, a.max_z });
+	}
+
+	m_locality_grid.Build(boxes);
+	m_locality_grid_dirty = false;
+
+	LogDebug(
+		"Built locality grid with [{}] proximities and [{}] areas",
+		m_locality_npcs.size(),
+		m_locality_areas.size()
+	);
 }
 
 struct quest_proximity_event {
@@ -3897,66 +4125,60 @@ struct quest_proximity_event {
 
 void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 {
-	float last_x = c->ProximityX();
-	float last_y = c->ProximityY();
-	float last_z = c->ProximityZ();
+	if (m_locality_grid_dirty) {
+		BuildLocalityGrid();
+	}
+
+	if (m_locality_grid.Empty()) {
+		return;
+	}
+
+	const glm::vec3 last(c->ProximityX(), c->ProximityY(), c->ProximityZ());
+
+	// only boxes holding the old or new position can be entered or left
+	m_locality_grid.Query(last, location, m_locality_candidates);
 
 	std::list<quest_proximity_event> events;
-	for (auto iter = proximity_list.begin(); iter != proximity_list.end(); ++iter) {
-		NPC *d = (*iter);
-		NPCProximity *l = d->proximity;
-		if (l == nullptr)
-			continue;
+	for (const auto& i : m_locality_candidates) {
+		if (i < m_locality_npcs.size()) {
+			NPC *d = m_locality_npcs[i];
+			NPCProximity *l = d->proximity;
+			if (l == nullptr)
+				continue;
 
-		//check both bounding boxes, if either coords pairs
-		//cross a boundary, send the event.
-		bool old_in = true;
-		bool new_in = true;
-		if (last_x < l->min_x || last_x > l->max_x ||
-				last_y < l->min_y || last_y > l->max_y ||
-				last_z < l->min_z || last_z > l->max_z) {
-			old_in = false;
-		}
-		if (location.x < l->min_x || location.x > l->max_x ||
-				location.y < l->min_y || location.y > l->max_y ||
-				location.z < l->min_z || location.z > l->max_z) {
-			new_in = false;
-		}
+			//check both bounding boxes, if either coords pairs
+			//cross a boundary, send the event.
+			const RegionGrid::Box box = { l->min_x, l->max_x, l->min_y, l->max_y, l->min_z, l->max_z };
+
+			bool old_in = RegionGrid::Contains(box, last);
+			bool new_in = RegionGrid::Contains(box, location);
+
+			if (old_in && !new_in) {
+				quest_proximity_event evt;
+				evt.event_id = EVENT_EXIT;
+				evt.client = c;
+				evt.npc = d;
+				evt.area_id = 0;
+				evt.area_type = 0;
+				events.push_back(evt);
+			} else if (new_in && !old_in) {
+				quest_proximity_event evt;
+				evt.event_id = EVENT_ENTER;
+				evt.client = c;
+				evt.npc = d;
+				evt.area_id = 0;
+				evt.area_type = 0;
+				events.push_back(evt);
+			}
 
-		if (old_in && !new_in) {
-			quest_proximity_event evt;
-			evt.event_id = EVENT_EXIT;
-			evt.client = c;
-			evt.npc = d;
-			evt.area_id = 0;
-			evt.area_type = 0;
-			events.push_back(evt);
-		} else if (new_in && !old_in) {
-			quest_proximity_event evt;
-			evt.event_id = EVENT_ENTER;
-			evt.client = c;
-			evt.npc = d;
-			evt.area_id = 0;
-			evt.area_type = 0;
-			events.push_back(evt);
+			continue;
 		}
-	}
 
-	for (auto iter = area_list.begin(); iter != area_list.end(); ++iter) {
-		Area& a = (*iter);
-		bool old_in = true;
-		bool new_in = true;
-		if (last_x < a.min_x || last_x > a.max_x ||
-				last_y < a.min_y || last_y > a.max_y ||
-				last_z < a.min_z || last_z > a.max_z) {
-			old_in = false;
-		}
+		const Area& a = *m_locality_areas[i - m_locality_npcs.size()];
+		const RegionGrid::Box box = { a.min_x, a.max_x, a.min_y, a.max_y, a.min_z, a.max_z };
 
-		if (location.x < a.min_x || location.x > a.max_x ||
-				location.y < a.min_y || location.y > a.max_y ||
-				location.z < a.min_z || location.z > a.max_z ) {
-			new_in = false;
-		}
+		bool old_in = RegionGrid::Contains(box, last);
+		bool new_in = RegionGrid::Contains(box, location);
 
 		if (old_in && !new_in) {
 			//were in but are no longer.
@@ -4025,13 +4247,30 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 }
 
 void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
+	if (m_locality_grid_dirty) {
+		BuildLocalityGrid();
+	}
+
+	if (m_locality_areas.empty()) {
+		return;
+	}
+
 	float last_x = n->GetX();
 	float last_y = n->GetY();
 	float last_z = n->GetZ();
 
+	m_locality_grid.Query(glm::vec3(last_x, last_y, last_z), glm::vec3(x, y, z), m_locality_candidates);
+
 	std::list<quest_proximity_event> events;
 
-	for (const auto& a : area_list) {
+	for (const auto& i : m_locality_candidates) {
+		// npcs only trigger areas
+		if (i < m_locality_npcs.size()) {
+			continue;
+		}
+
+		const Area& a = *m_locality_areas[i - m_locality_npcs.size()];
+
 		bool old_in = true;
 		bool new_in = true;
 		if (
@@ -4127,6 +4366,7 @@ void EntityList::AddArea(int id, int type, float min_x, float max_x, float min_y
 	}
 
 	area_list.push_back(a);
+	m_locality_grid_dirty = true;
 }
 
 void EntityList::RemoveArea(int id)
@@ -4137,11 +4377,13 @@ void EntityList::RemoveArea(int id)
 		return;
 
 	area_list.erase(it);
+	m_locality_grid_dirty = true;
 }
 
 void EntityList::ClearAreas()
 {
 	area_list.clear();
+	m_locality_grid_dirty = true;
 }
 
 void EntityList::ProcessProximitySay(const char *message, Client *c, uint8 language)
@@ -4150,7 +4392,25 @@ void EntityList::ProcessProximitySay(const char *message, Client *c, uint8 langu
 		return;
 	}
 
-	for (const auto& n : proximity_list) {
+	if (m_locality_grid_dirty) {
+		BuildLocalityGrid();
+	}
+
+	if (m_locality_npcs.empty()) {
+		return;
+	}
+
+	m_locality_grid.Query(glm::vec3(c->GetX(), c->GetY(), c->GetZ()), m_locality_candidates);
+
+	// copied out, a proximity say may add or clear proximities and rebuild the grid
+	std::vector<NPC *> npcs;
+	for (const auto& i : m_locality_candidates) {
+		if (i < m_locality_npcs.size()) {
+			npcs.emplace_back(m_locality_npcs[i]);
+		}
+	}
+
+	for (const auto& n : npcs) {
 		auto* p = n->proximity;
 		if (!p || !p->say) {
 			continue;
@@ -5795,6 +6055,7 @@ int EntityList::MovePlayerCorpsesToGraveyard(bool force_move_from_instance)
 
 		if (moved)
 		{
+			UnindexMob(it->second, it->first);
 			safe_delete(it->second);
 			free_ids.push(it->first);
 			it = corpse_list.erase(it);
@@ -5933,6 +6194,15 @@ std::vector<NPC*> EntityList::GetNPCsByIDs(std::vector<uint32> npc_ids)
 	return v;
 }
 
+std::vector<NPC*> EntityList::GetNPCsByNPCTypeID(uint32 npc_type_id)
+{
+	if (npc_type_id == 0 || npc_list.empty()) {
+		return {};
+	}
+
+	return GetIndexedNPCsByNPCTypeID(npc_type_id);
+}
+
 std::vector<NPC*> EntityList::GetExcludedNPCsByIDs(std::vector<uint32> npc_ids)
 {
 	std::vector<NPC*> v;
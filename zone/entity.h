@@ -29,6 +29,7 @@
 #include "../common/emu_constants.h"
 
 #include "position.h"
+#include "region_grid.h"
 #include "zonedump.h"
 #include "common.h"
 
@@ -187,6 +188,11 @@ public:
 	Client *GetClientByWID(uint32 iWID);
 	Client *GetClientByLSID(uint32 iLSID);
 
+	// npc type id, character id, world id and name lookups go through secondary indexes keyed to entity ids,
+	// IndexMob must be called again when any of those change after the mob was added
+	void IndexMob(Mob *mob);
+	void UnindexMob(Mob *mob, uint16 entity_id);
+
 	Bot* GetRandomBot(const glm::vec3& location = glm::vec3(0.f), float distance = 0, Bot* exclude_bot = nullptr);
 	Client* GetRandomClient(const glm::vec3& location = glm::vec3(0.f), float distance = 0, Client* exclude_client = nullptr);
 	NPC* GetRandomNPC(const glm::vec3& location = glm::vec3(0.f), float distance = 0, NPC* exclude_npc = nullptr);
@@ -267,6 +273,7 @@ public:
 	void	DoorProcess();
 	void	ObjectProcess();
 	void	CorpseProcess();
+	void	AIThinkProcess();
 	void	MobProcess();
 	void	TrapProcess();
 	void	BeaconProcess();
@@ -562,6 +569,7 @@ public:
 
 	std::vector<NPC*> GetNPCsByIDs(std::vector<uint32> npc_ids);
 	std::vector<NPC*> GetExcludedNPCsByIDs(std::vector<uint32> npc_ids);
+	std::vector<NPC*> GetNPCsByNPCTypeID(uint32 npc_type_id);
 
 	void	DepopAll(int NPCTypeID, bool StartSpawnTimer = true);
 
@@ -589,6 +597,11 @@ private:
 	void	AddToSpawnQueue(uint16 entityid, NewSpawn_Struct** app);
 	void	CheckSpawnQueue();
 
+	std::vector<NPC *> GetIndexedNPCsByNPCTypeID(uint32 npc_type_id);
+	void ClearIndexes();
+
+	void BuildLocalityGrid();
+
 	//used for limiting spawns
 	class SpawnLimitRecord { public: uint32 spawngroup_id; uint32 npc_type; };
 	std::map<uint16, SpawnLimitRecord> npc_limit_list;		//entity id -> npc type
@@ -613,6 +626,19 @@ private:
 	std::list<Area> area_list;
 	std::queue<uint16> free_ids;
 
+	// entries are verified against the entity lists on lookup, ones that no longer match are pruned there
+	std::unordered_multimap<uint32, uint16> npc_type_index;
+	std::unordered_map<uint32, uint16> character_id_index;
+	std::unordered_map<uint32, uint16> wid_index;
+	std::unordered_multimap<std::string, uint16> name_index;
+
+	// npc proximities followed by areas, rebuilt on the next move after either list changes
+	RegionGrid                m_locality_grid;
+	std::vector<NPC *>        m_locality_npcs;
+	std::vector<const Area *> m_locality_areas;
+	std::vector<uint32>       m_locality_candidates;
+	bool                      m_locality_grid_dirty = true;
+
 	Timer object_timer;
 	Timer door_timer;
 	Timer corpse_timer;
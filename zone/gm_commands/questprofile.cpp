@@ -0,0 +1,84 @@
+#include "../client.h"
+#include "../quest_profiler.h"
+#include "../../common/path_manager.h"
+
+void command_questprofile(Client *c, const Seperator *sep)
+{
+	auto profiler  = QuestProfiler::Instance();
+	int  arguments = sep->argnum;
+
+	const bool is_reset  = arguments && !strcasecmp(sep->arg[1], "reset");
+	const bool is_stacks = arguments && !strcasecmp(sep->arg[1], "stacks");
+	const bool is_show   = !arguments || !strcasecmp(sep->arg[1], "show");
+
+	if (!is_reset && !is_stacks && !is_show) {
+		c->Message(Chat::White, "Usage: #questprofile show [Limit] [total|count|max|avg|alloc|errors]");
+		c->Message(Chat::White, "Usage: #questprofile stacks - Writes sampled Lua call stacks in collapsed (flamegraph) format");
+		c->Message(Chat::White, "Usage: #questprofile reset");
+		return;
+	}
+
+	if (!profiler->IsEnabled()) {
+		c->Message(Chat::White, "The quest profiler is disabled, enable it with the rule [Logging:QuestProfiler].");
+		return;
+	}
+
+	if (is_reset) {
+		profiler->Reset();
+		c->Message(Chat::White, "Quest profile has been reset.");
+		return;
+	}
+
+	if (is_stacks) {
+		if (!profiler->GetSampleInstructions()) {
+			c->Message(
+				Chat::White,
+				"Stack sampling is disabled, set the rule [Logging:QuestProfilerSampleInstructions] (e.g. 1000)."
+			);
+			return;
+		}
+
+		const auto file_name = fmt::format(
+			"{}/quest_profile/{}_{}.folded",
+			path.GetLogPath(),
+			zone->GetShortName(),
+			zone->GetInstanceID()
+		);
+
+		if (!profiler->WriteCollapsedStacks(file_name)) {
+			c->Message(Chat::White, fmt::format("Failed to write [{}].", file_name).c_str());
+			return;
+		}
+
+		c->Message(Chat::White, fmt::format("Collapsed stacks written to [{}].", file_name).c_str());
+		return;
+	}
+
+	const auto limit = arguments >= 2 && sep->IsNumber(2) ? Strings::ToUnsignedInt(sep->arg[2]) : 10;
+	const auto sort  = arguments >= 3 ? Strings::ToLower(sep->arg[3]) : "total";
+
+	const auto &entries = profiler->Snapshot(sort, limit);
+	if (entries.empty()) {
+		c->Message(Chat::White, "No quest events have been profiled yet.");
+		return;
+	}
+
+	c->Message(Chat::White, fmt::format("Quest profile top [{}] by [{}]", entries.size(), sort).c_str());
+
+	for (const auto &e: entries) {
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"[{}] [{}] calls [{}] total [{:.3f}s] avg [{:.3f}ms] max [{:.3f}ms] alloc [{} bytes] errors [{}]",
+				e.package_name,
+				e.event_name,
+				e.stats.count,
+				e.stats.total_us / 1000000.0,
+				e.stats.total_us / 1000.0 / std::max<uint64>(1, e.stats.count),
+				e.stats.max_us / 1000.0,
+				Strings::Commify(e.stats.alloc_bytes),
+				e.stats.errors
+			).c_str()
+		);
+	}
+}
@@ -29,47 +29,97 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "zone.h"
 #include "water_map.h"
 
-#include <list>
+#include <algorithm>
 
 extern Zone *zone;
 
 HateList::HateList()
 {
-	hate_owner = nullptr;
+	hate_owner   = nullptr;
+	m_generation = 0;
 }
 
 HateList::~HateList()
 {
+	for (auto e : list) {
+		if (e->entity_on_hatelist) {
+			e->entity_on_hatelist->RemoveHatedBy(hate_owner);
+		}
+
+		delete e;
+	}
+
+	list.clear();
+}
+
+// removes the entry from the list and the reverse index, quest events fired before this
+// may have changed the list so the entry is looked up again rather than trusting an index
+bool HateList::ReleaseEntry(struct_HateList *entry)
+{
+	auto it = std::find(list.begin(), list.end(), entry);
+	if (it == list.end()) {
+		return false;
+	}
+
+	list.erase(it);
+
+	if (entry->entity_on_hatelist) {
+		entry->entity_on_hatelist->RemoveHatedBy(hate_owner);
+	}
+
+	delete entry;
+
+	return true;
+}
+
+void HateList::SetEntOnEntry(struct_HateList *entry, Mob *in_entity)
+{
+	if (!entry || entry->entity_on_hatelist == in_entity) {
+		return;
+	}
+
+	if (entry->entity_on_hatelist) {
+		entry->entity_on_hatelist->RemoveHatedBy(entry->hate_owner);
+	}
+
+	entry->entity_on_hatelist = in_entity;
+
+	if (in_entity) {
+		in_entity->AddHatedBy(entry->hate_owner);
+	}
 }
 
 void HateList::WipeHateList(bool npc_only) {
-	auto iterator = list.begin();
-	while (iterator != list.end()) {
-		Mob *m = (*iterator)->entity_on_hatelist;
+	m_generation++;
+
+	size_t i = 0;
+	while (i < list.size()) {
+		struct_HateList *e = list[i];
+		Mob             *m = e->entity_on_hatelist;
 		if (
-			m &&
+			!m ||
 			(
-				m->IsOfClientBotMerc() ||
-				(m->IsPet() && m->GetOwner() && m->GetOwner()->IsOfClientBotMerc())
-			) &&
-			npc_only
+				(
+					m->IsOfClientBotMerc() ||
+					(m->IsPet() && m->GetOwner() && m->GetOwner()->IsOfClientBotMerc())
+				) &&
+				npc_only
+			)
 		) {
-			iterator++;
-		} else {
-			if (m) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
-				}
+			i++;
+			continue;
+		}
 
-				if (m->IsClient()) {
-					m->CastToClient()->DecrementAggroCount();
-					m->CastToClient()->RemoveXTarget(hate_owner, true);
-				}
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
+		}
 
-				delete (*iterator);
-				iterator = list.erase(iterator);
-			}
+		if (m->IsClient()) {
+			m->CastToClient()->DecrementAggroCount();
+			m->CastToClient()->RemoveXTarget(hate_owner, true);
 		}
+
+		ReleaseEntry(e);
 	}
 }
 
@@ -98,6 +148,8 @@ void HateList::SetHateAmountOnEnt(Mob* other, int64 in_hate, uint64 in_damage)
 	struct_HateList *entity = Find(other);
 	if (entity)
 	{
+		m_generation++;
+
 		if (in_damage > 0)
 			entity->hatelist_damage = in_damage;
 		if (in_hate > 0)
@@ -220,6 +272,8 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 
 	struct_HateList *entity = Find(in_entity);
 	if (entity) {
+		m_generation++;
+
 		entity->hatelist_damage += (in_damage >= 0) ? in_damage : 0;
 		entity->stored_hate_amount += in_hate;
 		entity->is_entity_frenzy = in_is_entity_frenzied;
@@ -235,14 +289,18 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 			entity->hatelist_damage
 		);
 	} else if (iAddIfNotExist) {
+		m_generation++;
+
 		entity = new struct_HateList;
 		entity->entity_on_hatelist = in_entity;
+		entity->hate_owner = hate_owner;
 		entity->hatelist_damage = (in_damage >= 0) ? in_damage : 0;
 		entity->stored_hate_amount = in_hate;
 		entity->is_entity_frenzy = in_is_entity_frenzied;
 		entity->oor_count = 0;
 		entity->last_modified = Timer::GetCurrentTime();
 		list.push_back(entity);
+		in_entity->AddHatedBy(hate_owner);
 
 		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
 			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "1", 0);
@@ -261,28 +319,31 @@ bool HateList::RemoveEntFromHateList(Mob *in_entity)
 	}
 
 	bool is_found = false;
-	auto iterator = list.begin();
 
-	while (iterator != list.end()) {
-		if ((*iterator)->entity_on_hatelist == in_entity) {
-			is_found = true;
+	std::vector<struct_HateList *> entries;
+	for (auto e : list) {
+		if (e->entity_on_hatelist == in_entity) {
+			entries.push_back(e);
+		}
+	}
 
-			if (in_entity && in_entity->IsClient()) {
-				in_entity->CastToClient()->DecrementAggroCount();
-			}
+	for (auto e : entries) {
+		if (!ReleaseEntry(e)) {
+			continue;
+		}
 
-			delete (*iterator);
-			iterator = list.erase(iterator);
+		is_found = true;
+		m_generation++;
 
-			if (in_entity) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
-				}
-			}
-		} else {
-			++iterator;
+		if (in_entity->IsClient()) {
+			in_entity->CastToClient()->DecrementAggroCount();
+		}
+
+		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
 		}
 	}
+
 	return is_found;
 }
 
@@ -855,31 +916,33 @@ void HateList::SpellCast(Mob *caster, uint32 spell_id, float range, Mob* ae_cent
 
 void HateList::RemoveStaleEntries(int time_ms, float dist)
 {
-	auto it = list.begin();
-
 	auto cur_time = Timer::GetCurrentTime();
 
 	auto dist2 = dist * dist;
 
-	while (it != list.end()) {
-		auto m = (*it)->entity_on_hatelist;
+	size_t i = 0;
+	while (i < list.size()) {
+		struct_HateList *e = list[i];
+		auto             m = e->entity_on_hatelist;
 		if (m) {
 			bool remove = false;
 
-			if (cur_time - (*it)->last_modified > time_ms) {
+			if (cur_time - e->last_modified > time_ms) {
 				remove = true;
 			}
 
 			if (!remove && DistanceSquaredNoZ(hate_owner->GetPosition(), m->GetPosition()) > dist2) {
-				(*it)->oor_count++;
-				if ((*it)->oor_count == 2) {
+				e->oor_count++;
+				if (e->oor_count == 2) {
 					remove = true;
 				}
-			} else if ((*it)->oor_count != 0) {
-				(*it)->oor_count = 0;
+			} else if (e->oor_count != 0) {
+				e->oor_count = 0;
 			}
 
 			if (remove) {
+				m_generation++;
+
 				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
 					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), m, "0", 0);
 				}
@@ -889,12 +952,11 @@ void HateList::RemoveStaleEntries(int time_ms, float dist)
 					m->CastToClient()->RemoveXTarget(hate_owner, true);
 				}
 
-				delete (*it);
-				it = list.erase(it);
+				ReleaseEntry(e);
 				continue;
 			}
 		}
-		++it;
+		++i;
 	}
 }
 
@@ -917,9 +979,10 @@ void HateList::DamageHateList(int64 damage, uint32 distance, EntityFilterType fi
 	}
 }
 
-std::list<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
+std::vector<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
 {
-	std::list<struct_HateList*> l;
+	std::vector<struct_HateList*> l;
+	l.reserve(list.size());
 	const auto squared_distance = (distance * distance);
 	for (auto h : list) {
 		auto e = h->entity_on_hatelist;
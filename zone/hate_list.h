@@ -21,6 +21,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include "../common/emu_constants.h"
 
+#include <vector>
+
 class Client;
 class Group;
 class Mob;
@@ -29,6 +31,7 @@ struct ExtraAttackOptions;
 
 struct struct_HateList {
 	Mob    *entity_on_hatelist;
+	Mob    *hate_owner;
 	int64  hatelist_damage;
 	int64  stored_hate_amount;
 	bool   is_entity_frenzy;
@@ -66,9 +69,12 @@ public:
 
 	int64 GetEntHateAmount(Mob *ent, bool in_damage = false);
 
-	std::list<struct_HateList *> &GetHateList() { return list; }
+	// bumped on every add, remove or hate change so cached AI decisions can be validated
+	inline uint32 GetGeneration() const { return m_generation; }
+
+	std::vector<struct_HateList *> &GetHateList() { return list; }
 
-	std::list<struct_HateList *> GetFilteredHateList(
+	std::vector<struct_HateList *> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	);
@@ -95,12 +101,18 @@ public:
 	void WipeHateList(bool npc_only = false);
 	void RemoveStaleEntries(int time_ms, float dist);
 
+	static void SetEntOnEntry(struct_HateList *entry, Mob *in_entity);
+
 
 protected:
 	struct_HateList* Find(Mob* m);
+	bool ReleaseEntry(struct_HateList *entry);
 private:
-	std::list<struct_HateList *> list;
+	// entries stay heap allocated since script HateEntry handles point at them,
+	// the vector keeps the per-tick scans over a single contiguous array
+	std::vector<struct_HateList *> list;
 	Mob                          *hate_owner;
+	uint32                       m_generation;
 };
 
 #endif
@@ -0,0 +1,162 @@
+#ifdef LUA_EQEMU
+
+#include "lua.hpp"
+
+#include "lua_bytecode_cache.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/md5.h"
+#include "../common/path_manager.h"
+#include "../common/rulesys.h"
+
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WINDOWS
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+	bool ReadFile(const std::string &file_name, std::string &out)
+	{
+		std::ifstream f(file_name, std::ios::binary);
+		if (!f.is_open()) {
+			return false;
+		}
+
+		std::ostringstream ss;
+		ss << f.rdbuf();
+		out = ss.str();
+
+		return true;
+	}
+
+	int WriteChunk(lua_State *L, const void *p, size_t size, void *ud)
+	{
+		static_cast<std::string *>(ud)->append(static_cast<const char *>(p), size);
+		return 0;
+	}
+
+	// bytecode is only portable between identical interpreters
+	const std::string &GetInterpreterTag()
+	{
+		static const std::string tag = [] {
+#ifdef LUAJIT_VERSION
+			std::string t = fmt::format("{}-{}", LUAJIT_VERSION, sizeof(void *) * 8);
+#else
+			std::string t = fmt::format("{}-{}", LUA_RELEASE, sizeof(void *) * 8);
+#endif
+			for (auto &c: t) {
+				if (!isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-') {
+					c = '_';
+				}
+			}
+
+			return t;
+		}();
+
+		return tag;
+	}
+
+	std::string GetCacheKey(const std::string &file_name, const std::string &source)
+	{
+		MD5::MD5Context ctx;
+		uint8           digest[16];
+
+		// the path is part of the key, chunks carry it for error messages and tracebacks
+		MD5::Init(&ctx);
+		MD5::Update(&ctx, reinterpret_cast<const uint8 *>(file_name.data()), file_name.size());
+		MD5::Update(&ctx, reinterpret_cast<const uint8 *>("\0"), 1);
+		MD5::Update(&ctx, reinterpret_cast<const uint8 *>(source.data()), source.size());
+		MD5::Final(digest, &ctx);
+
+		MD5 md5(digest);
+
+		return static_cast<const char *>(md5);
+	}
+}
+
+std::string LuaBytecodeCache::GetDirectory()
+{
+	return fmt::format("{}/.luacache", path.GetQuestsPath());
+}
+
+int LuaBytecodeCache::LoadFile(lua_State *L, const std::string &file_name)
+{
+	if (!RuleB(HotReload, QuestsLuaBytecodeCache)) {
+		return luaL_loadfile(L, file_name.c_str());
+	}
+
+	std::string source;
+	if (!ReadFile(file_name, source)) {
+		// let lua report the error
+		return luaL_loadfile(L, file_name.c_str());
+	}
+
+	const std::string chunk_name = "@" + file_name;
+	const std::string cache_file = fmt::format(
+		"{}/{}.{}.luac",
+		GetDirectory(),
+		GetCacheKey(file_name, source),
+		GetInterpreterTag()
+	);
+
+	std::string bytecode;
+	if (ReadFile(cache_file, bytecode) && !bytecode.empty()) {
+		if (luaL_loadbuffer(L, bytecode.data(), bytecode.size(), chunk_name.c_str()) == 0) {
+			LogQuestsDetail("Loaded [{}] from bytecode cache", file_name);
+			return 0;
+		}
+
+		LogQuests("Discarding unloadable bytecode cache entry [{}] [{}]", cache_file, lua_tostring(L, -1));
+		lua_pop(L, 1);
+	}
+
+	// luaL_loadfile skips a leading #! line, blank it so line numbers still match
+	if (!source.empty() && source[0] == '#') {
+		const auto eol = source.find('\n');
+		source.replace(0, eol == std::string::npos ? source.size() : eol, "");
+	}
+
+	const int status = luaL_loadbuffer(L, source.data(), source.size(), chunk_name.c_str());
+	if (status != 0) {
+		return status;
+	}
+
+	bytecode.clear();
+	if (lua_dump(L, WriteChunk, &bytecode) != 0 || bytecode.empty()) {
+		return 0;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(GetDirectory(), ec);
+
+	// other zones may be reading the same entry, write then rename so they never see a partial file
+	const std::string tmp = fmt::format("{}.{}.tmp", cache_file, getpid());
+	{
+		std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+		if (!f.good()) {
+			LogQuestsDetail("Unable to write bytecode cache entry [{}]", tmp);
+			return 0;
+		}
+
+		f.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+	}
+
+	std::filesystem::rename(tmp, cache_file, ec);
+	if (ec) {
+		std::filesystem::remove(tmp, ec);
+	}
+
+	return 0;
+}
+
+int LuaBytecodeCache::DoFile(lua_State *L, const std::string &file_name)
+{
+	return LoadFile(L, file_name) || lua_pcall(L, 0, LUA_MULTRET, 0);
+}
+
+#endif
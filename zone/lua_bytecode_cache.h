@@ -0,0 +1,29 @@
+#ifndef EQEMU_LUA_BYTECODE_CACHE_H
+#define EQEMU_LUA_BYTECODE_CACHE_H
+#ifdef LUA_EQEMU
+
+#include <string>
+
+struct lua_State;
+
+/**
+ * Compiled Lua chunks shared by every zone process, stored under <quests>/.luacache
+ *
+ * Entries are named after the MD5 of the script's path and contents plus the interpreter
+ * (Lua 5.1 or LuaJIT version and pointer size), so an edited script or a different build
+ * simply misses and is recompiled. Entries that fail to load are recompiled and replaced,
+ * the directory can be deleted at any time (HotReload:QuestsLuaBytecodeCache)
+ */
+class LuaBytecodeCache {
+public:
+	// luaL_loadfile, served from the cache when the contents have been compiled before
+	static int LoadFile(lua_State *L, const std::string &file_name);
+
+	// luaL_dofile on top of LoadFile
+	static int DoFile(lua_State *L, const std::string &file_name);
+
+	static std::string GetDirectory();
+};
+
+#endif
+#endif //EQEMU_LUA_BYTECODE_CACHE_H
@@ -50,6 +50,42 @@ struct Lua_Spawn_List {
 	std::vector<Lua_Spawn> entries;
 };
 
+namespace {
+	// matches are gathered here first so the result table can be created at its final size
+	std::vector<Mob *> query_matches;
+
+	template<typename T>
+	void GatherWithinRadius(const std::unordered_map<uint16, T *> &list, const glm::vec3 &center, float distance)
+	{
+		query_matches.clear();
+
+		const float distance_squared = distance * distance;
+		for (const auto &e: list) {
+			if (e.second && DistanceSquared(glm::vec3(e.second->GetPosition()), center) <= distance_squared) {
+				query_matches.emplace_back(e.second);
+			}
+		}
+	}
+
+	template<typename LuaType, typename NativeType>
+	luabind::object MatchesToTable(lua_State *L)
+	{
+		lua_createtable(L, static_cast<int>(query_matches.size()), 0);
+		luabind::object lua_table(luabind::from_stack(L, -1));
+		lua_pop(L, 1);
+
+		int index = 1;
+		for (const auto &e: query_matches) {
+			lua_table[index] = LuaType(static_cast<NativeType *>(e));
+			index++;
+		}
+
+		query_matches.clear();
+
+		return lua_table;
+	}
+}
+
 Lua_Mob Lua_EntityList::GetMobID(int id) {
 	Lua_Safe_Call_Class(Lua_Mob);
 	return Lua_Mob(self->GetMobID(id));
@@ -345,6 +381,7 @@ Lua_Mob_List Lua_EntityList::GetMobList() {
 	Lua_Safe_Call_Class(Lua_Mob_List);
 	Lua_Mob_List ret;
 	auto &t_list = self->GetMobList();
+	ret.entries.reserve(t_list.size());
 
 	auto iter = t_list.begin();
 	while(iter != t_list.end()) {
@@ -359,6 +396,7 @@ Lua_Client_List Lua_EntityList::GetClientList() {
 	Lua_Safe_Call_Class(Lua_Client_List);
 	Lua_Client_List ret;
 	auto &t_list = self->GetClientList();
+	ret.entries.reserve(t_list.size());
 
 	auto iter = t_list.begin();
 	while(iter != t_list.end()) {
@@ -484,6 +522,7 @@ Lua_Client_List Lua_EntityList::GetShuffledClientList() {
 	Lua_Safe_Call_Class(Lua_Client_List);
 	Lua_Client_List ret;
 	auto &t_list = self->GetClientList();
+	ret.entries.reserve(t_list.size());
 
 	auto iter = t_list.begin();
 	while(iter != t_list.end()) {
@@ -500,6 +539,7 @@ Lua_NPC_List Lua_EntityList::GetNPCList() {
 	Lua_Safe_Call_Class(Lua_NPC_List);
 	Lua_NPC_List ret;
 	auto &t_list = self->GetNPCList();
+	ret.entries.reserve(t_list.size());
 
 	auto iter = t_list.begin();
 	while(iter != t_list.end()) {
@@ -826,6 +866,208 @@ Lua_NPC_List Lua_EntityList::GetNPCsByIDs(luabind::adl::object table)
 	return ret;
 }
 
+luabind::object Lua_EntityList::GetClientsWithinRadius(lua_State* L, float x, float y, float z, float distance)
+{
+	if (!d_) {
+		return luabind::newtable(L);
+	}
+
+	auto self = reinterpret_cast<NativeType*>(d_);
+	GatherWithinRadius(self->GetClientList(), glm::vec3(x, y, z), distance);
+
+	return MatchesToTable<Lua_Client, Client>(L);
+}
+
+luabind::object Lua_EntityList::GetClientsWithinRadius(lua_State* L, Lua_Mob center, float distance)
+{
+	if (center.Null()) {
+		return luabind::newtable(L);
+	}
+
+	return GetClientsWithinRadius(L, center.GetX(), center.GetY(), center.GetZ(), distance);
+}
+
+luabind::object Lua_EntityList::GetMobsWithinRadius(lua_State* L, float x, float y, float z, float distance)
+{
+	if (!d_) {
+		return luabind::newtable(L);
+	}
+
+	auto self = reinterpret_cast<NativeType*>(d_);
+	GatherWithinRadius(self->GetMobList(), glm::vec3(x, y, z), distance);
+
+	return MatchesToTable<Lua_Mob, Mob>(L);
+}
+
+luabind::object Lua_EntityList::GetMobsWithinRadius(lua_State* L, Lua_Mob center, float distance)
+{
+	if (center.Null()) {
+		return luabind::newtable(L);
+	}
+
+	return GetMobsWithinRadius(L, center.GetX(), center.GetY(), center.GetZ(), distance);
+}
+
+luabind::object Lua_EntityList::GetNPCsWithinRadius(lua_State* L, float x, float y, float z, float distance)
+{
+	if (!d_) {
+		return luabind::newtable(L);
+	}
+
+	auto self = reinterpret_cast<NativeType*>(d_);
+	GatherWithinRadius(self->GetNPCList(), glm::vec3(x, y, z), distance);
+
+	return MatchesToTable<Lua_NPC, NPC>(L);
+}
+
+luabind::object Lua_EntityList::GetNPCsWithinRadius(lua_State* L, Lua_Mob center, float distance)
+{
+	if (center.Null()) {
+		return luabind::newtable(L);
+	}
+
+	return GetNPCsWithinRadius(L, center.GetX(), center.GetY(), center.GetZ(), distance);
+}
+
+luabind::object Lua_EntityList::GetNPCsByNPCTypeID(lua_State* L, uint32 npc_type_id)
+{
+	if (!d_) {
+		return luabind::newtable(L);
+	}
+
+	auto self = reinterpret_cast<NativeType*>(d_);
+
+	query_matches.clear();
+	for (const auto& e : self->GetNPCsByNPCTypeID(npc_type_id)) {
+		query_matches.emplace_back(e);
+	}
+
+	return MatchesToTable<Lua_NPC, NPC>(L);
+}
+
+/**
+ * filter keys, all optional:
+ *   center (mob) or x, y, z with distance - only mobs within distance
+ *   npc_type_id                           - only npcs of this type, answered from the npc type index
+ *   is_client, is_npc, is_bot             - only mobs of that kind
+ *   min_level, max_level
+ *   exclude (mob)                         - skip this mob, usually the caller
+ *   limit                                 - stop after this many matches
+ */
+luabind::object Lua_EntityList::GetMobsByFilter(lua_State* L, luabind::adl::object filter)
+{
+	if (!d_ || luabind::type(filter) != LUA_TTABLE) {
+		return luabind::newtable(L);
+	}
+
+	auto self = reinterpret_cast<NativeType*>(d_);
+
+	auto has = [&](const char* key) {
+		return luabind::type(filter[key]) != LUA_TNIL;
+	};
+
+	auto get_bool = [&](const char* key) {
+		return has(key) && luabind::object_cast<bool>(filter[key]);
+	};
+
+	glm::vec3 center(0.0f);
+	bool      use_distance     = false;
+	float     distance_squared = 0.0f;
+
+	if (has("distance")) {
+		const float distance = luabind::object_cast<float>(filter["distance"]);
+
+		if (has("center")) {
+			Mob* m = luabind::object_cast<Lua_Mob>(filter["center"]);
+			if (!m) {
+				return luabind::newtable(L);
+			}
+
+			center = glm::vec3(m->GetPosition());
+		}
+		else {
+			center = glm::vec3(
+				has("x") ? luabind::object_cast<float>(filter["x"]) : 0.0f,
+				has("y") ? luabind::object_cast<float>(filter["y"]) : 0.0f,
+				has("z") ? luabind::object_cast<float>(filter["z"]) : 0.0f
+			);
+		}
+
+		use_distance     = true;
+		distance_squared = distance * distance;
+	}
+
+	const uint32 npc_type_id = has("npc_type_id") ? luabind::object_cast<uint32>(filter["npc_type_id"]) : 0;
+	const bool   is_client   = get_bool("is_client");
+	const bool   is_npc      = get_bool("is_npc");
+	const bool   is_bot      = get_bool("is_bot");
+	const int    min_level   = has("min_level") ? luabind::object_cast<int>(filter["min_level"]) : 0;
+	const int    max_level   = has("max_level") ? luabind::object_cast<int>(filter["max_level"]) : INT32_MAX;
+	const size_t limit       = has("limit") ? luabind::object_cast<uint32>(filter["limit"]) : SIZE_MAX;
+
+	Mob* exclude = nullptr;
+	if (has("exclude")) {
+		exclude = luabind::object_cast<Lua_Mob>(filter["exclude"]);
+	}
+
+	auto matches = [&](Mob* m) {
+		if (!m || m == exclude) {
+			return false;
+		}
+
+		if ((is_client && !m->IsClient()) || (is_npc && !m->IsNPC()) || (is_bot && !m->IsBot())) {
+			return false;
+		}
+
+		if (m->GetLevel() < min_level || m->GetLevel() > max_level) {
+			return false;
+		}
+
+		return !use_distance || DistanceSquared(glm::vec3(m->GetPosition()), center) <= distance_squared;
+	};
+
+	auto gather = [&](const auto& list) {
+		for (const auto& e : list) {
+			if (query_matches.size() >= limit) {
+				break;
+			}
+
+			if (matches(e.second)) {
+				query_matches.emplace_back(e.second);
+			}
+		}
+	};
+
+	query_matches.clear();
+
+	// walk the narrowest list that can hold every match
+	if (npc_type_id) {
+		for (const auto& e : self->GetNPCsByNPCTypeID(npc_type_id)) {
+			if (query_matches.size() >= limit) {
+				break;
+			}
+
+			if (matches(e)) {
+				query_matches.emplace_back(e);
+			}
+		}
+	}
+	else if (is_client) {
+		gather(self->GetClientList());
+	}
+	else if (is_npc) {
+		gather(self->GetNPCList());
+	}
+	else if (is_bot) {
+		gather(self->GetBotList());
+	}
+	else {
+		gather(self->GetMobList());
+	}
+
+	return MatchesToTable<Lua_Mob, Mob>(L);
+}
+
 luabind::scope lua_register_entity_list() {
 	return luabind::class_<Lua_EntityList>("EntityList")
 	.def(luabind::constructor<>())
@@ -868,6 +1110,8 @@ luabind::scope lua_register_entity_list() {
 	.def("GetClientByName", (Lua_Client(Lua_EntityList::*)(const char*))&Lua_EntityList::GetClientByName)
 	.def("GetClientByWID", (Lua_Client(Lua_EntityList::*)(uint32))&Lua_EntityList::GetClientByWID)
 	.def("GetClientList", (Lua_Client_List(Lua_EntityList::*)(void))&Lua_EntityList::GetClientList)
+	.def("GetClientsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,float,float,float,float))&Lua_EntityList::GetClientsWithinRadius)
+	.def("GetClientsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,Lua_Mob,float))&Lua_EntityList::GetClientsWithinRadius)
 	.def("GetCloseMobList", (Lua_Mob_List(Lua_EntityList::*)(Lua_Mob))&Lua_EntityList::GetCloseMobList)
 	.def("GetCloseMobList", (Lua_Mob_List(Lua_EntityList::*)(Lua_Mob,float))&Lua_EntityList::GetCloseMobList)
 	.def("GetCorpseByID", (Lua_Corpse(Lua_EntityList::*)(int))&Lua_EntityList::GetCorpseByID)
@@ -887,12 +1131,18 @@ luabind::scope lua_register_entity_list() {
 	.def("GetMobByNpcTypeID", (Lua_Mob(Lua_EntityList::*)(int))&Lua_EntityList::GetMobByNpcTypeID)
 	.def("GetMobID", (Lua_Mob(Lua_EntityList::*)(int))&Lua_EntityList::GetMobID)
 	.def("GetMobList", (Lua_Mob_List(Lua_EntityList::*)(void))&Lua_EntityList::GetMobList)
+	.def("GetMobsByFilter", (luabind::object(Lua_EntityList::*)(lua_State*,luabind::adl::object))&Lua_EntityList::GetMobsByFilter)
+	.def("GetMobsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,float,float,float,float))&Lua_EntityList::GetMobsWithinRadius)
+	.def("GetMobsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,Lua_Mob,float))&Lua_EntityList::GetMobsWithinRadius)
 	.def("GetNPCByID", (Lua_NPC(Lua_EntityList::*)(int))&Lua_EntityList::GetNPCByID)
 	.def("GetNPCByNPCTypeID", (Lua_NPC(Lua_EntityList::*)(int))&Lua_EntityList::GetNPCByNPCTypeID)
 	.def("GetNPCBySpawnID", (Lua_NPC(Lua_EntityList::*)(int))&Lua_EntityList::GetNPCBySpawnID)
 	.def("GetNPCList", (Lua_NPC_List(Lua_EntityList::*)(void))&Lua_EntityList::GetNPCList)
 	.def("GetNPCsByExcludedIDs", (Lua_NPC_List(Lua_EntityList::*)(luabind::adl::object))&Lua_EntityList::GetNPCsByExcludedIDs)
 	.def("GetNPCsByIDs", (Lua_NPC_List(Lua_EntityList::*)(luabind::adl::object))&Lua_EntityList::GetNPCsByIDs)
+	.def("GetNPCsByNPCTypeID", (luabind::object(Lua_EntityList::*)(lua_State*,uint32))&Lua_EntityList::GetNPCsByNPCTypeID)
+	.def("GetNPCsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,float,float,float,float))&Lua_EntityList::GetNPCsWithinRadius)
+	.def("GetNPCsWithinRadius", (luabind::object(Lua_EntityList::*)(lua_State*,Lua_Mob,float))&Lua_EntityList::GetNPCsWithinRadius)
 	.def("GetObjectByDBID", (Lua_Object(Lua_EntityList::*)(uint32))&Lua_EntityList::GetObjectByDBID)
 	.def("GetObjectByID", (Lua_Object(Lua_EntityList::*)(int))&Lua_EntityList::GetObjectByID)
 	.def("GetObjectList", (Lua_Object_List(Lua_EntityList::*)(void))&Lua_EntityList::GetObjectList)
@@ -159,6 +159,16 @@ public:
 	void MassGroupBuff(Lua_Mob caster, Lua_Mob center, uint16 spell_id, bool affect_caster);
 	Lua_NPC_List GetNPCsByIDs(luabind::adl::object npc_ids);
 	Lua_NPC_List GetNPCsByExcludedIDs(luabind::adl::object npc_ids);
+
+	// filtered queries answered from the entity lists, returned as pre-sized arrays of matches only
+	luabind::object GetClientsWithinRadius(lua_State* L, float x, float y, float z, float distance);
+	luabind::object GetClientsWithinRadius(lua_State* L, Lua_Mob center, float distance);
+	luabind::object GetMobsWithinRadius(lua_State* L, float x, float y, float z, float distance);
+	luabind::object GetMobsWithinRadius(lua_State* L, Lua_Mob center, float distance);
+	luabind::object GetNPCsWithinRadius(lua_State* L, float x, float y, float z, float distance);
+	luabind::object GetNPCsWithinRadius(lua_State* L, Lua_Mob center, float distance);
+	luabind::object GetNPCsByNPCTypeID(lua_State* L, uint32 npc_type_id);
+	luabind::object GetMobsByFilter(lua_State* L, luabind::adl::object filter);
 };
 
 #endif
@@ -0,0 +1,243 @@
+#ifdef LUA_EQEMU
+
+#include "lua.hpp"
+
+#include <cstring>
+
+#include "masterentity.h"
+#include "lua_ffi.h"
+
+namespace {
+	template<typename T>
+	int CopyEntityIds(const std::unordered_map<uint16, T *> &list, uint16_t *out, int capacity)
+	{
+		if (out && capacity > 0) {
+			int i = 0;
+			for (const auto &e: list) {
+				if (i >= capacity) {
+					break;
+				}
+
+				out[i++] = e.first;
+			}
+		}
+
+		return static_cast<int>(list.size());
+	}
+
+#ifdef LUAJIT_VERSION
+	const char *ffi_prelude = R"lua(
+local ffi = require("ffi")
+
+ffi.cdef[[
+typedef struct { float x, y, z, heading; } eqemu_ffi_position;
+
+int eqemu_ffi_mob_exists(uint16_t entity_id);
+int eqemu_ffi_mob_get_position(uint16_t entity_id, eqemu_ffi_position *out);
+float eqemu_ffi_mob_get_x(uint16_t entity_id);
+float eqemu_ffi_mob_get_y(uint16_t entity_id);
+float eqemu_ffi_mob_get_z(uint16_t entity_id);
+float eqemu_ffi_mob_get_heading(uint16_t entity_id);
+int64_t eqemu_ffi_mob_get_hp(uint16_t entity_id);
+int64_t eqemu_ffi_mob_get_max_hp(uint16_t entity_id);
+float eqemu_ffi_mob_get_hp_ratio(uint16_t entity_id);
+int eqemu_ffi_mob_get_level(uint16_t entity_id);
+uint32_t eqemu_ffi_mob_get_npc_type_id(uint16_t entity_id);
+int eqemu_ffi_mob_is_client(uint16_t entity_id);
+int eqemu_ffi_mob_is_npc(uint16_t entity_id);
+float eqemu_ffi_mob_distance_squared(uint16_t entity_id, uint16_t other_id);
+
+int eqemu_ffi_entity_list_get_client_ids(uint16_t *out, int capacity);
+int eqemu_ffi_entity_list_get_npc_ids(uint16_t *out, int capacity);
+int eqemu_ffi_entity_list_get_mob_ids(uint16_t *out, int capacity);
+]]
+
+local C = ffi.C
+local M = {}
+
+-- every accessor takes an entity id (mob:GetID()), eq.get_entity_list():GetMobID(id) returns the full object
+function M.exists(id) return C.eqemu_ffi_mob_exists(id) ~= 0 end
+function M.x(id) return C.eqemu_ffi_mob_get_x(id) end
+function M.y(id) return C.eqemu_ffi_mob_get_y(id) end
+function M.z(id) return C.eqemu_ffi_mob_get_z(id) end
+function M.heading(id) return C.eqemu_ffi_mob_get_heading(id) end
+function M.hp(id) return tonumber(C.eqemu_ffi_mob_get_hp(id)) end
+function M.max_hp(id) return tonumber(C.eqemu_ffi_mob_get_max_hp(id)) end
+function M.hp_ratio(id) return C.eqemu_ffi_mob_get_hp_ratio(id) end
+function M.level(id) return C.eqemu_ffi_mob_get_level(id) end
+function M.npc_type_id(id) return C.eqemu_ffi_mob_get_npc_type_id(id) end
+function M.is_client(id) return C.eqemu_ffi_mob_is_client(id) ~= 0 end
+function M.is_npc(id) return C.eqemu_ffi_mob_is_npc(id) ~= 0 end
+
+-- negative when either entity is gone
+function M.distance_squared(id, other_id) return C.eqemu_ffi_mob_distance_squared(id, other_id) end
+
+local position = ffi.new("eqemu_ffi_position")
+
+-- x, y, z, heading or nil
+function M.position(id)
+	if C.eqemu_ffi_mob_get_position(id, position) == 0 then
+		return nil
+	end
+
+	return position.x, position.y, position.z, position.heading
+end
+
+-- iterators over entity ids, one id buffer per traversal instead of a wrapper object per entity
+local function ids(get_ids)
+	return function()
+		local count  = get_ids(nil, 0)
+		local buffer = ffi.new("uint16_t[?]", count)
+		count = math.min(get_ids(buffer, count), count)
+
+		local i = -1
+		return function()
+			i = i + 1
+			if i < count then
+				return buffer[i]
+			end
+		end
+	end
+end
+
+M.client_ids = ids(C.eqemu_ffi_entity_list_get_client_ids)
+M.npc_ids    = ids(C.eqemu_ffi_entity_list_get_npc_ids)
+M.mob_ids    = ids(C.eqemu_ffi_entity_list_get_mob_ids)
+
+return M
+)lua";
+#endif
+}
+
+int eqemu_ffi_mob_exists(uint16_t entity_id)
+{
+	return entity_list.GetMob(entity_id) ? 1 : 0;
+}
+
+int eqemu_ffi_mob_get_position(uint16_t entity_id, eqemu_ffi_position *out)
+{
+	auto m = entity_list.GetMob(entity_id);
+	if (!m || !out) {
+		return 0;
+	}
+
+	const auto &p = m->GetPosition();
+
+	out->x       = p.x;
+	out->y       = p.y;
+	out->z       = p.z;
+	out->heading = p.w;
+
+	return 1;
+}
+
+float eqemu_ffi_mob_get_x(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetX() : 0.0f;
+}
+
+float eqemu_ffi_mob_get_y(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetY() : 0.0f;
+}
+
+float eqemu_ffi_mob_get_z(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetZ() : 0.0f;
+}
+
+float eqemu_ffi_mob_get_heading(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetHeading() : 0.0f;
+}
+
+int64_t eqemu_ffi_mob_get_hp(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetHP() : 0;
+}
+
+int64_t eqemu_ffi_mob_get_max_hp(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetMaxHP() : 0;
+}
+
+float eqemu_ffi_mob_get_hp_ratio(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetHPRatio() : 0.0f;
+}
+
+int eqemu_ffi_mob_get_level(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetLevel() : 0;
+}
+
+uint32_t eqemu_ffi_mob_get_npc_type_id(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m ? m->GetNPCTypeID() : 0;
+}
+
+int eqemu_ffi_mob_is_client(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m && m->IsClient() ? 1 : 0;
+}
+
+int eqemu_ffi_mob_is_npc(uint16_t entity_id)
+{
+	auto m = entity_list.GetMob(entity_id);
+	return m && m->IsNPC() ? 1 : 0;
+}
+
+float eqemu_ffi_mob_distance_squared(uint16_t entity_id, uint16_t other_id)
+{
+	auto m     = entity_list.GetMob(entity_id);
+	auto other = entity_list.GetMob(other_id);
+	if (!m || !other) {
+		return -1.0f;
+	}
+
+	return DistanceSquared(m->GetPosition(), other->GetPosition());
+}
+
+int eqemu_ffi_entity_list_get_client_ids(uint16_t *out, int capacity)
+{
+	return CopyEntityIds(entity_list.GetClientList(), out, capacity);
+}
+
+int eqemu_ffi_entity_list_get_npc_ids(uint16_t *out, int capacity)
+{
+	return CopyEntityIds(entity_list.GetNPCList(), out, capacity);
+}
+
+int eqemu_ffi_entity_list_get_mob_ids(uint16_t *out, int capacity)
+{
+	return CopyEntityIds(entity_list.GetMobList(), out, capacity);
+}
+
+void lua_register_ffi_prelude(lua_State *L)
+{
+#ifdef LUAJIT_VERSION
+	lua_getglobal(L, "package");
+	lua_getfield(L, -1, "preload");
+
+	if (luaL_loadbuffer(L, ffi_prelude, strlen(ffi_prelude), "=eqemu_ffi") == 0) {
+		lua_setfield(L, -2, "eqemu_ffi");
+	} else {
+		LogQuests("Failed to load the eqemu_ffi prelude [{}]", lua_tostring(L, -1));
+		lua_pop(L, 1);
+	}
+
+	lua_pop(L, 2);
+#endif
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef EQEMU_LUA_FFI_H
+#define EQEMU_LUA_FFI_H
+#ifdef LUA_EQEMU
+
+#include <stdint.h>
+
+/**
+ * C entry points for the LuaJIT FFI fast path
+ *
+ * Scripts opt in with require("eqemu_ffi") (LuaJIT builds only), the prelude declares these
+ * with ffi.cdef and calls them directly, skipping luabind's userdata and overload resolution.
+ * Entities are addressed by entity id, a stale id reads as missing rather than a dangling pointer
+ *
+ * Keep the declarations in the prelude (lua_ffi.cpp) in sync with this header and export
+ * new symbols with the eqemu_ffi_ prefix, lua_ffi.dynlist exports that prefix from the zone binary
+ */
+
+#ifdef _WINDOWS
+#define EQEMU_FFI_EXPORT extern "C" __declspec(dllexport)
+#else
+#define EQEMU_FFI_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+struct eqemu_ffi_position {
+	float x;
+	float y;
+	float z;
+	float heading;
+};
+
+EQEMU_FFI_EXPORT int eqemu_ffi_mob_exists(uint16_t entity_id);
+EQEMU_FFI_EXPORT int eqemu_ffi_mob_get_position(uint16_t entity_id, eqemu_ffi_position *out);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_get_x(uint16_t entity_id);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_get_y(uint16_t entity_id);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_get_z(uint16_t entity_id);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_get_heading(uint16_t entity_id);
+EQEMU_FFI_EXPORT int64_t eqemu_ffi_mob_get_hp(uint16_t entity_id);
+EQEMU_FFI_EXPORT int64_t eqemu_ffi_mob_get_max_hp(uint16_t entity_id);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_get_hp_ratio(uint16_t entity_id);
+EQEMU_FFI_EXPORT int eqemu_ffi_mob_get_level(uint16_t entity_id);
+EQEMU_FFI_EXPORT uint32_t eqemu_ffi_mob_get_npc_type_id(uint16_t entity_id);
+EQEMU_FFI_EXPORT int eqemu_ffi_mob_is_client(uint16_t entity_id);
+EQEMU_FFI_EXPORT int eqemu_ffi_mob_is_npc(uint16_t entity_id);
+EQEMU_FFI_EXPORT float eqemu_ffi_mob_distance_squared(uint16_t entity_id, uint16_t other_id);
+
+// fill out with up to capacity entity ids and return how many there are in total,
+// call with capacity 0 to size the buffer
+EQEMU_FFI_EXPORT int eqemu_ffi_entity_list_get_client_ids(uint16_t *out, int capacity);
+EQEMU_FFI_EXPORT int eqemu_ffi_entity_list_get_npc_ids(uint16_t *out, int capacity);
+EQEMU_FFI_EXPORT int eqemu_ffi_entity_list_get_mob_ids(uint16_t *out, int capacity);
+
+struct lua_State;
+
+// makes require("eqemu_ffi") available, a no-op unless built against LuaJIT
+void lua_register_ffi_prelude(lua_State *L);
+
+#endif
+#endif
@@ -14,7 +14,7 @@ Lua_Mob Lua_HateEntry::GetEnt() {
 
 void Lua_HateEntry::SetEnt(Lua_Mob e) {
 	Lua_Safe_Call_Void();
-	self->entity_on_hatelist = e;
+	HateList::SetEntOnEntry(self, e);
 }
 
 int64 Lua_HateEntry::GetDamage() {
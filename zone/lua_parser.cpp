@@ -13,18 +13,21 @@
 #include "../common/spdat.h"
 #include "masterentity.h"
 #include "questmgr.h"
+#include "quest_profiler.h"
 #include "zone.h"
 #include "zone_config.h"
 
 #include "lua_bit.h"
 #include "lua_bot.h"
 #include "lua_buff.h"
+#include "lua_bytecode_cache.h"
 #include "lua_client.h"
 #include "lua_corpse.h"
 #include "lua_door.h"
 #include "lua_encounter.h"
 #include "lua_entity.h"
 #include "lua_entity_list.h"
+#include "lua_ffi.h"
 #include "lua_expedition.h"
 #include "lua_general.h"
 #include "lua_group.h"
@@ -211,6 +214,64 @@ static void PushErrorHandler(lua_State* L)
 	lua_remove(L, -2);
 }
 
+static size_t GetLuaHeapBytes(lua_State* L)
+{
+	return static_cast<size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+}
+
+// instruction count hook feeding the quest profiler's collapsed stacks, LuaJIT only counts interpreted code
+static void LuaProfilerHook(lua_State* L, lua_Debug* ar)
+{
+	if (ar->event != LUA_HOOKCOUNT) {
+		return;
+	}
+
+	std::vector<std::string> frames;
+
+	lua_Debug frame;
+	for (int level = 0; lua_getstack(L, level, &frame); ++level) {
+		lua_getinfo(L, "Sn", &frame);
+		frames.emplace_back(fmt::format("{}@{}:{}", frame.name ? frame.name : "?", frame.short_src, frame.linedefined));
+	}
+
+	std::reverse(frames.begin(), frames.end());
+
+	QuestProfiler::Instance()->AddStackSample(frames);
+}
+
+// profiles one event, Lua heap growth across the call stands in for its allocations
+class LuaProfileScope : public QuestProfiler::Scope {
+public:
+	LuaProfileScope(lua_State* L, const std::string& package_name, QuestEventID evt, const char* sub_name)
+		: QuestProfiler::Scope(package_name, evt, sub_name), L(L)
+	{
+		const uint32 sample_instructions = QuestProfiler::Instance()->GetSampleInstructions();
+		const bool   hooked              = lua_gethook(L) == LuaProfilerHook;
+
+		if (sample_instructions && (!hooked || static_cast<uint32>(lua_gethookcount(L)) != sample_instructions)) {
+			lua_sethook(L, LuaProfilerHook, LUA_MASKCOUNT, sample_instructions);
+		} else if (!sample_instructions && hooked) {
+			lua_sethook(L, nullptr, 0, 0);
+		}
+
+		if (IsActive()) {
+			heap_bytes = GetLuaHeapBytes(L);
+		}
+	}
+
+	~LuaProfileScope()
+	{
+		if (IsActive()) {
+			const size_t after = GetLuaHeapBytes(L);
+			SetAllocBytes(after > heap_bytes ? after - heap_bytes : 0);
+		}
+	}
+
+private:
+	lua_State* L;
+	size_t heap_bytes = 0;
+};
+
 LuaParser::LuaParser() {
 	for (int i = 0; i < _LargestEventID; ++i) {
 		NPCArgumentDispatch[i]       = handle_npc_null;
@@ -423,7 +484,7 @@ LuaParser::~LuaParser() {
 	}
 }
 
-int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string& data, uint32 extra_data,
 						std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -442,7 +503,7 @@ int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data,
 	return _EventNPC(package_name, evt, npc, init, data, extra_data, extra_pointers);
 }
 
-int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string& data, uint32 extra_data,
 							  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -460,11 +521,12 @@ int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string
 	return _EventNPC("global_npc", evt, npc, init, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, const std::string& data, uint32 extra_data,
 						 std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -519,7 +581,7 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 	return 0;
 }
 
-int LuaParser::EventPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::EventPlayer(QuestEventID evt, Client *client, const std::string& data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -537,7 +599,7 @@ int LuaParser::EventPlayer(QuestEventID evt, Client *client, std::string data, u
 	return _EventPlayer("player", evt, client, data, extra_data, extra_pointers);
 }
 
-int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, const std::string& data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -555,10 +617,11 @@ int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string d
 	return _EventPlayer("global_player", evt, client, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, const std::string& data, uint32 extra_data,
 							std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -612,7 +675,7 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 	return 0;
 }
 
-int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data, uint32 extra_data,
+int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, const std::string& data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -633,10 +696,11 @@ int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *ite
 }
 
 int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
-						  std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+						  const std::string& data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -697,7 +761,7 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 	return 0;
 }
 
-int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string& data, uint32 extra_data,
 						  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -713,11 +777,12 @@ int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spe
 	return _EventSpell(package_name, evt, mob, client, spell_id, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string& data, uint32 extra_data,
 						   std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -778,7 +843,7 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 	return 0;
 }
 
-int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers) {
+int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, const std::string& data, uint32 extra_data, std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
 		return 0;
@@ -793,11 +858,12 @@ int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std:
 	return _EventEncounter(package_name, evt, encounter_name, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
+int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, const std::string& data, uint32 extra_data,
 							   std::vector<std::any> *extra_pointers) {
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		PushErrorHandler(L);
@@ -1090,6 +1156,7 @@ void LuaParser::ReloadQuests() {
 	lua_pop(L, 1);
 
 	MapFunctions(L);
+	lua_register_ffi_prelude(L);
 
 	// load init
 	std::string filename = fmt::format("{}/{}/script_init.lua", path.GetQuestsPath(), QUEST_GLOBAL_DIRECTORY);
@@ -1098,7 +1165,7 @@ void LuaParser::ReloadQuests() {
 	if(f) {
 		fclose(f);
 
-		if(luaL_dofile(L, filename.c_str())) {
+		if(LuaBytecodeCache::DoFile(L, filename)) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 		}
@@ -1117,7 +1184,7 @@ void LuaParser::ReloadQuests() {
 		if(f) {
 			fclose(f);
 
-			if(luaL_dofile(L, zone_script.c_str())) {
+			if(LuaBytecodeCache::DoFile(L, zone_script)) {
 				std::string error = lua_tostring(L, -1);
 				AddError(error);
 			}
@@ -1129,7 +1196,7 @@ void LuaParser::ReloadQuests() {
 			if (f) {
 				fclose(f);
 
-				if (luaL_dofile(L, zone_script.c_str())) {
+				if (LuaBytecodeCache::DoFile(L, zone_script)) {
 					std::string error = lua_tostring(L, -1);
 					AddError(error);
 				}
@@ -1163,6 +1230,15 @@ void LuaParser::ReloadQuests() {
 	}
 }
 
+void LuaParser::UnloadScript(const std::string &package_name) {
+	loaded_.erase(package_name);
+
+	if(L) {
+		lua_pushnil(L);
+		lua_setfield(L, LUA_REGISTRYINDEX, package_name.c_str());
+	}
+}
+
 /*
  * This function is intended only to clean up lua_encounters when the Encounter object is
  * about to be destroyed. It won't clean up memory else where, since the caller of this
@@ -1181,7 +1257,7 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 
 	auto top = lua_gettop(L);
 	PushErrorHandler(L);
-	if(luaL_loadfile(L, filename.c_str())) {
+	if(LuaBytecodeCache::LoadFile(L, filename)) {
 		std::string error = lua_tostring(L, -1);
 		AddError(error);
 		lua_pop(L, 2);
@@ -1330,7 +1406,7 @@ void LuaParser::MapFunctions(lua_State *L) {
 	}
 }
 
-int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string& data, uint32 extra_data,
 								 std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1376,7 +1452,7 @@ int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, std::stri
     return ret;
 }
 
-int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, const std::string& data, uint32 extra_data,
 									std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1405,7 +1481,7 @@ int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, std::string
     return ret;
 }
 
-int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, const std::string& data, uint32 extra_data,
 								  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1451,7 +1527,7 @@ int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInsta
     return ret;
 }
 
-int LuaParser::DispatchEventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string& data, uint32 extra_data,
 								   std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1677,7 +1753,7 @@ int LuaParser::EventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1701,7 +1777,7 @@ int LuaParser::EventGlobalBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1726,13 +1802,14 @@ int LuaParser::_EventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
 ) {
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -1791,7 +1868,7 @@ int LuaParser::DispatchEventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1856,7 +1933,7 @@ int LuaParser::EventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1880,7 +1957,7 @@ int LuaParser::EventGlobalMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1905,13 +1982,14 @@ int LuaParser::_EventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
 ) {
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
+	LuaProfileScope profile(L, package_name, evt, sub_name);
 
 	try {
 		int npop = 2;
@@ -1978,7 +2056,7 @@ int LuaParser::DispatchEventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -42,7 +42,7 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -50,21 +50,21 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventGlobalPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -73,7 +73,7 @@ public:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -82,14 +82,14 @@ public:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventEncounter(
 		QuestEventID evt,
 		std::string encounter_name,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -97,7 +97,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -105,7 +105,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -113,7 +113,7 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -121,7 +121,7 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -155,6 +155,7 @@ public:
 	virtual std::string GetVar(std::string name);
 	virtual void Init();
 	virtual void ReloadQuests();
+	virtual void UnloadScript(const std::string& package_name);
 	virtual void RemoveEncounter(const std::string &name);
     virtual uint32 GetIdentifier() { return 0xb0712acc; }
 
@@ -162,14 +163,14 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int DispatchEventPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -178,7 +179,7 @@ public:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -187,7 +188,7 @@ public:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -195,7 +196,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -203,7 +204,7 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -244,7 +245,7 @@ private:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -253,7 +254,7 @@ private:
 		std::string package_name,
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -264,7 +265,7 @@ private:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -275,7 +276,7 @@ private:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -284,7 +285,7 @@ private:
 		std::string package_name,
 		QuestEventID evt,
 		std::string encounter_name,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -293,7 +294,7 @@ private:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -303,7 +304,7 @@ private:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers,
 		luabind::adl::object* l_func = nullptr
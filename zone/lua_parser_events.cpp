@@ -29,7 +29,7 @@ void handle_npc_event_say(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -52,7 +52,7 @@ void handle_npc_event_trade(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -123,7 +123,7 @@ void handle_npc_event_hp(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -147,7 +147,7 @@ void handle_npc_single_mob(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -162,7 +162,7 @@ void handle_npc_single_client(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -177,7 +177,7 @@ void handle_npc_task_accepted(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -195,7 +195,7 @@ void handle_npc_popup(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -213,7 +213,7 @@ void handle_npc_waypoint(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -231,7 +231,7 @@ void handle_npc_hate(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -250,7 +250,7 @@ void handle_npc_signal(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -263,7 +263,7 @@ void handle_npc_payload(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -281,7 +281,7 @@ void handle_npc_timer(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -294,7 +294,7 @@ void handle_npc_death(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -362,7 +362,7 @@ void handle_npc_cast(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -396,7 +396,7 @@ void handle_npc_area(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -412,7 +412,7 @@ void handle_npc_null(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -423,7 +423,7 @@ void handle_npc_loot_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -448,7 +448,7 @@ void handle_npc_spawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -463,7 +463,7 @@ void handle_npc_despawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -478,7 +478,7 @@ void handle_npc_damage(
 	lua_State* L,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -522,7 +522,7 @@ void handle_npc_loot_added(
 	lua_State* L,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -579,7 +579,7 @@ void handle_npc_timer_pause_resume_start(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -597,7 +597,7 @@ void handle_npc_timer_stop(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -610,7 +610,7 @@ void handle_npc_entity_variable(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -640,7 +640,7 @@ void handle_npc_spell_blocked(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -673,7 +673,7 @@ void handle_player_say(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -688,7 +688,7 @@ void handle_player_environmental_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -707,7 +707,7 @@ void handle_player_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -761,7 +761,7 @@ void handle_player_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -773,7 +773,7 @@ void handle_player_discover_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -795,7 +795,7 @@ void handle_player_fish_forage_success(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -809,7 +809,7 @@ void handle_player_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -823,7 +823,7 @@ void handle_player_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -837,7 +837,7 @@ void handle_player_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -849,7 +849,7 @@ void handle_player_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -866,7 +866,7 @@ void handle_player_popup_response(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -878,7 +878,7 @@ void handle_player_pick_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -892,7 +892,7 @@ void handle_player_cast(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -932,7 +932,7 @@ void handle_player_task_fail(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -944,7 +944,7 @@ void handle_player_zone(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -973,7 +973,7 @@ void handle_player_duel_win(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -987,7 +987,7 @@ void handle_player_duel_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1001,7 +1001,7 @@ void handle_player_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1020,7 +1020,7 @@ void handle_player_task_stage_complete(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1036,7 +1036,7 @@ void handle_player_task_accepted(
 	QuestInterface* parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 ) {
@@ -1048,7 +1048,7 @@ void handle_player_task_update(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1067,7 +1067,7 @@ void handle_player_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1092,7 +1092,7 @@ void handle_player_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1107,7 +1107,7 @@ void handle_player_feign(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1121,7 +1121,7 @@ void handle_player_area(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1136,7 +1136,7 @@ void handle_player_respawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1151,7 +1151,7 @@ void handle_player_packet(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1168,7 +1168,7 @@ void handle_player_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1178,7 +1178,7 @@ void handle_player_use_skill(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1194,7 +1194,7 @@ void handle_test_buff(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1204,7 +1204,7 @@ void handle_player_combine_validate(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1235,7 +1235,7 @@ void handle_player_bot_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1260,7 +1260,7 @@ void handle_player_warp(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1279,7 +1279,7 @@ void handle_player_quest_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1291,7 +1291,7 @@ void handle_player_consider(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1310,7 +1310,7 @@ void handle_player_consider_corpse(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1329,7 +1329,7 @@ void handle_player_inspect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1343,7 +1343,7 @@ void handle_player_aa_buy(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1365,7 +1365,7 @@ void handle_player_aa_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1377,7 +1377,7 @@ void handle_player_aa_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1389,7 +1389,7 @@ void handle_player_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1401,7 +1401,7 @@ void handle_player_level_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1413,7 +1413,7 @@ void handle_player_level_down(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1425,7 +1425,7 @@ void handle_player_gm_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1437,7 +1437,7 @@ void handle_player_bot_create(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1462,7 +1462,7 @@ void handle_player_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1507,7 +1507,7 @@ void handle_player_item_click(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1535,7 +1535,7 @@ void handle_player_destroy_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1561,7 +1561,7 @@ void handle_player_drop_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1594,7 +1594,7 @@ void handle_player_target_change(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1610,7 +1610,7 @@ void handle_player_memorize_scribe_spell(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1639,7 +1639,7 @@ void handle_player_ldon_points_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1656,7 +1656,7 @@ void handle_player_crystal_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1676,7 +1676,7 @@ void handle_player_alt_currency_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1696,7 +1696,7 @@ void handle_player_entity_variable(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1725,7 +1725,7 @@ void handle_player_aa_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1738,7 +1738,7 @@ void handle_player_spell_blocked(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1770,7 +1770,7 @@ void handle_player_read_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1816,7 +1816,7 @@ void handle_item_click(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1830,7 +1830,7 @@ void handle_item_timer(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1844,7 +1844,7 @@ void handle_item_proc(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1872,7 +1872,7 @@ void handle_item_loot(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1895,7 +1895,7 @@ void handle_item_equip(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1909,7 +1909,7 @@ void handle_item_augment(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1928,7 +1928,7 @@ void handle_item_augment_insert(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1947,7 +1947,7 @@ void handle_item_augment_remove(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1969,7 +1969,7 @@ void handle_item_null(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1981,7 +1981,7 @@ void handle_item_timer_pause_resume_start(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2000,7 +2000,7 @@ void handle_item_timer_stop(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2015,7 +2015,7 @@ void handle_spell_event(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2064,7 +2064,7 @@ void handle_translocate_finish(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2089,7 +2089,7 @@ void handle_player_equip_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2116,7 +2116,7 @@ void handle_spell_null(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2126,7 +2126,7 @@ void handle_encounter_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2138,7 +2138,7 @@ void handle_encounter_load(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2159,7 +2159,7 @@ void handle_encounter_unload(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2174,7 +2174,7 @@ void handle_encounter_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2184,7 +2184,7 @@ void handle_player_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2206,7 +2206,7 @@ void handle_player_language_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2225,7 +2225,7 @@ void handle_player_alt_currency_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2250,7 +2250,7 @@ void handle_player_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2275,7 +2275,7 @@ void handle_player_augment_insert(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2307,7 +2307,7 @@ void handle_player_augment_remove(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2342,7 +2342,7 @@ void handle_player_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2359,7 +2359,7 @@ void handle_player_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2374,7 +2374,7 @@ void handle_bot_null(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2385,7 +2385,7 @@ void handle_bot_cast(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2419,7 +2419,7 @@ void handle_bot_combat(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2437,7 +2437,7 @@ void handle_bot_death(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2480,7 +2480,7 @@ void handle_bot_popup_response(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2498,7 +2498,7 @@ void handle_bot_say(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2519,7 +2519,7 @@ void handle_bot_signal(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2532,7 +2532,7 @@ void handle_bot_payload(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2550,7 +2550,7 @@ void handle_bot_slay(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2565,7 +2565,7 @@ void handle_bot_target_change(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2580,7 +2580,7 @@ void handle_bot_timer(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2593,7 +2593,7 @@ void handle_bot_trade(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2651,7 +2651,7 @@ void handle_bot_use_skill(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2668,7 +2668,7 @@ void handle_bot_equip_item(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2694,7 +2694,7 @@ void handle_bot_damage(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2738,7 +2738,7 @@ void handle_bot_level_up(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2751,7 +2751,7 @@ void handle_bot_level_down(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2764,7 +2764,7 @@ void handle_bot_timer_pause_resume_start(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2782,7 +2782,7 @@ void handle_bot_timer_stop(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2795,7 +2795,7 @@ void handle_bot_entity_variable(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -2825,7 +2825,7 @@ void handle_bot_spell_blocked(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -2,13 +2,13 @@
 #define _EQE_LUA_PARSER_EVENTS_H
 #ifdef LUA_EQEMU
 
-typedef void(*NPCArgumentHandler)(QuestInterface*, lua_State*, NPC*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*PlayerArgumentHandler)(QuestInterface*, lua_State*, Client*, std::string, uint32, std::vector<std::any>*);
-typedef void(*ItemArgumentHandler)(QuestInterface*, lua_State*, Client*, EQ::ItemInstance*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*SpellArgumentHandler)(QuestInterface*, lua_State*, Mob*, Client*, uint32, std::string, uint32, std::vector<std::any>*);
-typedef void(*EncounterArgumentHandler)(QuestInterface*, lua_State*, Encounter* encounter, std::string, uint32, std::vector<std::any>*);
-typedef void(*BotArgumentHandler)(QuestInterface*, lua_State*, Bot*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*MercArgumentHandler)(QuestInterface*, lua_State*, Merc*, Mob*, std::string, uint32, std::vector<std::any>*);
+typedef void(*NPCArgumentHandler)(QuestInterface*, lua_State*, NPC*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*PlayerArgumentHandler)(QuestInterface*, lua_State*, Client*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*ItemArgumentHandler)(QuestInterface*, lua_State*, Client*, EQ::ItemInstance*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*SpellArgumentHandler)(QuestInterface*, lua_State*, Mob*, Client*, uint32, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*EncounterArgumentHandler)(QuestInterface*, lua_State*, Encounter* encounter, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*BotArgumentHandler)(QuestInterface*, lua_State*, Bot*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*MercArgumentHandler)(QuestInterface*, lua_State*, Merc*, Mob*, const std::string&, uint32, std::vector<std::any>*);
 
 // NPC
 void handle_npc_event_say(
@@ -16,7 +16,7 @@ void handle_npc_event_say(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -26,7 +26,7 @@ void handle_npc_event_trade(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -36,7 +36,7 @@ void handle_npc_event_hp(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -46,7 +46,7 @@ void handle_npc_single_mob(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -56,7 +56,7 @@ void handle_npc_single_client(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -66,7 +66,7 @@ void handle_npc_task_accepted(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -76,7 +76,7 @@ void handle_npc_popup(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -86,7 +86,7 @@ void handle_npc_waypoint(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -96,7 +96,7 @@ void handle_npc_hate(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -106,7 +106,7 @@ void handle_npc_signal(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -116,7 +116,7 @@ void handle_npc_timer(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -126,7 +126,7 @@ void handle_npc_death(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -136,7 +136,7 @@ void handle_npc_cast(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -146,7 +146,7 @@ void handle_npc_area(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -156,7 +156,7 @@ void handle_npc_null(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -166,7 +166,7 @@ void handle_npc_loot_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -176,7 +176,7 @@ void handle_npc_spawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -186,7 +186,7 @@ void handle_npc_payload(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -196,7 +196,7 @@ void handle_npc_despawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -206,7 +206,7 @@ void handle_npc_damage(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -216,7 +216,7 @@ void handle_npc_loot_added(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -226,7 +226,7 @@ void handle_npc_timer_pause_resume_start(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -236,7 +236,7 @@ void handle_npc_timer_stop(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -246,7 +246,7 @@ void handle_npc_entity_variable(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -256,7 +256,7 @@ void handle_npc_spell_blocked(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -266,7 +266,7 @@ void handle_player_say(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -275,7 +275,7 @@ void handle_player_environmental_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -284,7 +284,7 @@ void handle_player_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -293,7 +293,7 @@ void handle_player_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -302,7 +302,7 @@ void handle_player_discover_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -311,7 +311,7 @@ void handle_player_fish_forage_success(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -320,7 +320,7 @@ void handle_player_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -329,7 +329,7 @@ void handle_player_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -338,7 +338,7 @@ void handle_player_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -347,7 +347,7 @@ void handle_player_popup_response(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -356,7 +356,7 @@ void handle_player_pick_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -365,7 +365,7 @@ void handle_player_cast(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -374,7 +374,7 @@ void handle_player_task_fail(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -383,7 +383,7 @@ void handle_player_zone(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -392,7 +392,7 @@ void handle_player_duel_win(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -401,7 +401,7 @@ void handle_player_duel_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -410,7 +410,7 @@ void handle_player_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -419,7 +419,7 @@ void handle_player_task_stage_complete(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -428,7 +428,7 @@ void handle_player_task_accepted(
 	QuestInterface* parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 );
@@ -437,7 +437,7 @@ void handle_player_task_update(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -446,7 +446,7 @@ void handle_player_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -455,7 +455,7 @@ void handle_player_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -464,7 +464,7 @@ void handle_player_feign(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -473,7 +473,7 @@ void handle_player_area(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -482,7 +482,7 @@ void handle_player_respawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -491,7 +491,7 @@ void handle_player_packet(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -500,7 +500,7 @@ void handle_player_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -509,7 +509,7 @@ void handle_player_use_skill(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -518,7 +518,7 @@ void handle_test_buff(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -527,7 +527,7 @@ void handle_player_combine_validate(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -536,7 +536,7 @@ void handle_player_bot_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -545,7 +545,7 @@ void handle_player_warp(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -554,7 +554,7 @@ void handle_player_quest_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -563,7 +563,7 @@ void handle_player_consider(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -572,7 +572,7 @@ void handle_player_consider_corpse(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -581,7 +581,7 @@ void handle_player_equip_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -590,7 +590,7 @@ void handle_player_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -599,7 +599,7 @@ void handle_player_language_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -608,7 +608,7 @@ void handle_player_alt_currency_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -617,7 +617,7 @@ void handle_player_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -626,7 +626,7 @@ void handle_player_inspect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -635,7 +635,7 @@ void handle_player_aa_buy(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -644,7 +644,7 @@ void handle_player_aa_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -653,7 +653,7 @@ void handle_player_aa_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -662,7 +662,7 @@ void handle_player_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -671,7 +671,7 @@ void handle_player_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -680,7 +680,7 @@ void handle_player_level_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -689,7 +689,7 @@ void handle_player_level_down(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -698,7 +698,7 @@ void handle_player_gm_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -707,7 +707,7 @@ void handle_player_bot_create(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -716,7 +716,7 @@ void handle_player_augment_insert(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -725,7 +725,7 @@ void handle_player_augment_remove(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -734,7 +734,7 @@ void handle_player_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -743,7 +743,7 @@ void handle_player_item_click(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -752,7 +752,7 @@ void handle_player_destroy_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -761,7 +761,7 @@ void handle_player_target_change(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -770,7 +770,7 @@ void handle_player_drop_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -779,7 +779,7 @@ void handle_player_memorize_scribe_spell(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -788,7 +788,7 @@ void handle_player_ldon_points_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -797,7 +797,7 @@ void handle_player_alt_currency_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -806,7 +806,7 @@ void handle_player_crystal_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -815,7 +815,7 @@ void handle_player_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -824,7 +824,7 @@ void handle_player_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -833,7 +833,7 @@ void handle_player_entity_variable(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -842,7 +842,7 @@ void handle_player_aa_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -851,7 +851,7 @@ void handle_player_spell_blocked(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -860,7 +860,7 @@ void handle_player_read_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -872,7 +872,7 @@ void handle_item_click(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -883,7 +883,7 @@ void handle_item_timer(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -894,7 +894,7 @@ void handle_item_proc(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -905,7 +905,7 @@ void handle_item_loot(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -916,7 +916,7 @@ void handle_item_equip(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -927,7 +927,7 @@ void handle_item_augment(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -938,7 +938,7 @@ void handle_item_augment_insert(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -949,7 +949,7 @@ void handle_item_augment_remove(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -960,7 +960,7 @@ void handle_item_null(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -971,7 +971,7 @@ void handle_item_timer_pause_resume_start(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -982,7 +982,7 @@ void handle_item_timer_stop(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -994,7 +994,7 @@ void handle_spell_event(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1005,7 +1005,7 @@ void handle_translocate_finish(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1016,7 +1016,7 @@ void handle_spell_null(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1026,7 +1026,7 @@ void handle_encounter_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1035,7 +1035,7 @@ void handle_encounter_load(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1044,7 +1044,7 @@ void handle_encounter_unload(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1053,7 +1053,7 @@ void handle_encounter_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1064,7 +1064,7 @@ void handle_bot_null(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1074,7 +1074,7 @@ void handle_bot_cast(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1084,7 +1084,7 @@ void handle_bot_combat(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1094,7 +1094,7 @@ void handle_bot_death(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1104,7 +1104,7 @@ void handle_bot_popup_response(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1114,7 +1114,7 @@ void handle_bot_say(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1124,7 +1124,7 @@ void handle_bot_signal(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1134,7 +1134,7 @@ void handle_bot_slay(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1144,7 +1144,7 @@ void handle_bot_target_change(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1154,7 +1154,7 @@ void handle_bot_timer(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1164,7 +1164,7 @@ void handle_bot_trade(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1174,7 +1174,7 @@ void handle_bot_use_skill(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1184,7 +1184,7 @@ void handle_bot_payload(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1194,7 +1194,7 @@ void handle_bot_equip_item(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1204,7 +1204,7 @@ void handle_bot_damage(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1214,7 +1214,7 @@ void handle_bot_level_up(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1224,7 +1224,7 @@ void handle_bot_level_down(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1234,7 +1234,7 @@ void handle_bot_timer_pause_resume_start(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1244,7 +1244,7 @@ void handle_bot_timer_stop(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1254,7 +1254,7 @@ void handle_bot_entity_variable(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1264,7 +1264,7 @@ void handle_bot_spell_blocked(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -90,6 +90,8 @@ extern volatile bool is_zone_loaded;
 #include "../common/skill_caps.h"
 #include "zone_event_scheduler.h"
 #include "zone_cli.h"
+#include "../common/query_profiler.h"
+#include "quest_profiler.h"
 
 EntityList  entity_list;
 WorldServer worldserver;
@@ -280,6 +282,19 @@ int main(int argc, char **argv)
 		content_db.SetMutex(mutex);
 	}
 
+	// content reads are served by replicas, character reads only inside client read sessions
+	database.ConnectReadReplicas(
+		Config->DatabaseReplicas,
+		DBcore::ReplicaReads::Sessions,
+		Config->DatabaseReplicaMaxLag
+	);
+	content_db.ConnectReadReplicas(
+		Config->ContentDbReplicas,
+		DBcore::ReplicaReads::All,
+		Config->DatabaseReplicaMaxLag,
+		"content"
+	);
+
 	//rules:
 	{
 		std::string tmp;
@@ -384,6 +399,17 @@ int main(int argc, char **argv)
 		LogError("Failed. But ignoring error and going on..");
 	}
 
+	// falls back to querying npc_types when the segment is missing or stale
+	if (RuleB(NPC, UseSharedMemoryNPCTypes)) {
+		content_db.LoadNPCTypes(hotfix_name);
+	}
+
+	if (RuleB(NPC, UseSharedMemorySpawnContent)) {
+		content_db.LoadNPCFactionLists(hotfix_name);
+		content_db.LoadSharedSpawnGroups(hotfix_name);
+		content_db.LoadMerchantLists(hotfix_name);
+	}
+
 	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
 		LogError("Loading spells failed!");
 		return 1;
@@ -619,6 +645,7 @@ int main(int argc, char **argv)
 				entity_list.TrapProcess();
 				entity_list.RaidProcess();
 				entity_list.Process();
+				entity_list.AIThinkProcess();
 				entity_list.MobProcess();
 				entity_list.BeaconProcess();
 				entity_list.EncounterProcess();
@@ -637,6 +664,8 @@ int main(int argc, char **argv)
 		}
 
 		QServ->CheckForConnectState();
+		QueryProfiler::Instance()->Process();
+		QuestProfiler::Instance()->Process();
 
 		if (InterserverTimer.Check()) {
 			InterserverTimer.Start();
@@ -8,6 +8,9 @@
 #include "zone.h"
 #include "../common/file.h"
 #include "../common/memory/ksm.hpp"
+#ifdef USE_MAP_MMFS
+#include "../common/read_only_mapped_file.h"
+#endif /*USE_MAP_MMFS*/
 
 #include <algorithm>
 #include <map>
@@ -291,6 +294,9 @@ bool Map::Load(std::string filename, bool force_mmf_overwrite)
 		LogInfo("Loaded .MMF Map File in place of [{}]", filename.c_str());
 		return true;
 	}
+
+	// a missing, outdated or damaged baked file is rebuilt from the map below
+	force_mmf_overwrite = true;
 #else
 
 /**
@@ -1017,78 +1023,26 @@ bool Map::LoadMMF(const std::string& map_file_name, bool force_mmf_overwrite)
 		return false;
 	}
 
-	FILE *f = fopen(mmf_file_name.c_str(), "rb");
-	if (!f) {
-		LogInfo("Failed to load Map MMF file: [{}] - could not open file", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 file_version;
-	if (fread(&file_version, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - f@file_version", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 rm_buffer_size;
-	if (fread(&rm_buffer_size, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - f@rm_buffer_size", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 rm_buffer_crc32;
-	if (fread(&rm_buffer_crc32, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - f@rm_buffer_crc32", mmf_file_name.c_str());
-		return false;
-	}
-	if (rm_buffer_crc32 != /*crc32_check*/ 0) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - bad rm_buffer checksum", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 mmf_buffer_size;
-	if (fread(&mmf_buffer_size, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - f@mmf_buffer_size", mmf_file_name.c_str());
+	auto file = std::make_unique<EQ::ReadOnlyMappedFile>();
+	if (!file->Open(mmf_file_name)) {
+		LogInfo("Failed to load Map MMF file: [{}] - could not map file", mmf_file_name.c_str());
 		return false;
 	}
 
-	std::vector<char> mmf_buffer(mmf_buffer_size);
-	if (fread(mmf_buffer.data(), mmf_buffer_size, 1, f) != 1) {
-		fclose(f);
-		LogInfo("Failed to load Map MMF file: [{}] - f@mmf_buffer", mmf_file_name.c_str());
+	auto rm = mapRaycastMesh(std::move(file));
+	if (!rm) {
+		LogInfo("Failed to load Map MMF file: [{}] - invalid or outdated baked mesh", mmf_file_name.c_str());
 		return false;
 	}
 
-	fclose(f);
-
-	std::vector<char> rm_buffer(rm_buffer_size);
-	uint32 v = EQ::InflateData(mmf_buffer.data(), mmf_buffer_size, rm_buffer.data(), rm_buffer_size);
-
 	if (imp) {
 		imp->rm->release();
-		imp->rm = nullptr;
 	}
 	else {
 		imp = new impl;
 	}
 
-	bool load_success = false;
-	imp->rm = loadRaycastMesh(rm_buffer, load_success);
-	if (imp->rm && !load_success) {
-		imp->rm->release();
-		imp->rm = nullptr;
-	}
-
-	if (!imp->rm) {
-		delete imp;
-		imp = nullptr;
-		LogInfo("Failed to load Map MMF file: [{}] - null RaycastMesh", mmf_file_name.c_str());
-		return false;
-	}
+	imp->rm = rm;
 
 	return true;
 }
@@ -1107,76 +1061,23 @@ bool Map::SaveMMF(const std::string& map_file_name, bool force_mmf_overwrite)
 		return false;
 	}
 
-	FILE* f = fopen(mmf_file_name.c_str(), "rb");
-	if (f) {
-		fclose(f);
-		if (!force_mmf_overwrite)
-			return true;
+	if (File::Exists(mmf_file_name) && !force_mmf_overwrite) {
+		return true;
 	}
 
-	std::vector<char> rm_buffer; // size set in MyRaycastMesh::serialize()
-	serializeRaycastMesh(imp->rm, rm_buffer);
-	if (rm_buffer.empty()) {
+	std::vector<char> mmf_buffer;
+	bakeRaycastMesh(imp->rm, mmf_buffer);
+	if (mmf_buffer.empty()) {
 		LogInfo("Failed to save Map MMF file: [{}] - empty RaycastMesh buffer", mmf_file_name.c_str());
 		return false;
 	}
 
-	uint32 rm_buffer_size = rm_buffer.size();
-	uint32 mmf_buffer_size = EQ::EstimateDeflateBuffer(rm_buffer.size());
-
-	std::vector<char> mmf_buffer(mmf_buffer_size);
-
-	mmf_buffer_size = EQ::DeflateData(rm_buffer.data(), rm_buffer.size(), mmf_buffer.data(), mmf_buffer.size());
-	if (!mmf_buffer_size) {
-		LogInfo("Failed to save Map MMF file: [{}] - null MMF buffer size", mmf_file_name.c_str());
-		return false;
-	}
-
-	f = fopen(mmf_file_name.c_str(), "wb");
-	if (!f) {
-		LogInfo("Failed to save Map MMF file: [{}] - could not open file", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 file_version = 0;
-	if (fwrite(&file_version, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		std::remove(mmf_file_name.c_str());
-		LogInfo("Failed to save Map MMF file: [{}] - f@file_version", mmf_file_name.c_str());
+	// other zone processes may have the previous file mapped; replace it rather than writing over it
+	if (!EQ::ReadOnlyMappedFile::WriteAtomic(mmf_file_name, mmf_buffer.data(), mmf_buffer.size())) {
+		LogInfo("Failed to save Map MMF file: [{}] - could not write file", mmf_file_name.c_str());
 		return false;
 	}
 
-	if (fwrite(&rm_buffer_size, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		std::remove(mmf_file_name.c_str());
-		LogInfo("Failed to save Map MMF file: [{}] - f@rm_buffer_size", mmf_file_name.c_str());
-		return false;
-	}
-
-	uint32 rm_buffer_crc32 = 0;
-	if (fwrite(&rm_buffer_crc32, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		std::remove(mmf_file_name.c_str());
-		LogInfo("Failed to save Map MMF file: [{}] - f@rm_buffer_crc32", mmf_file_name.c_str());
-		return false;
-	}
-
-	if (fwrite(&mmf_buffer_size, sizeof(uint32), 1, f) != 1) {
-		fclose(f);
-		std::remove(mmf_file_name.c_str());
-		LogInfo("Failed to save Map MMF file: [{}] - f@mmf_buffer_size", mmf_file_name.c_str());
-		return false;
-	}
-
-	if (fwrite(mmf_buffer.data(), mmf_buffer_size, 1, f) != 1) {
-		fclose(f);
-		std::remove(mmf_file_name.c_str());
-		LogInfo("Failed to save Map MMF file: [{}] - f@mmf_buffer", mmf_file_name.c_str());
-		return false;
-	}
-
-	fclose(f);
-
 	return true;
 }
 
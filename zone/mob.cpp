@@ -555,6 +555,18 @@ Mob::~Mob()
 
 	entity_list.RemoveFromTargets(this, true);
 
+	// anything not reached through the entity list must still let go of this mob
+	for (auto hater : GetHatedBy()) {
+		hater->RemoveFromHateList(this);
+	}
+
+	for (auto remembered_id : feign_memory_list) {
+		Mob *remembered_mob = entity_list.GetMob(remembered_id);
+		if (remembered_mob) {
+			remembered_mob->RemoveFeignRememberedBy(this);
+		}
+	}
+
 	if (trade) {
 		Mob *with = trade->With();
 		if (with && with->IsClient()) {
@@ -4578,6 +4590,26 @@ void Mob::TempName(const char *newname)
 	SetName(temp_name);
 }
 
+void Mob::SetName(const char *new_name)
+{
+	if (!new_name) {
+		return;
+	}
+
+	// the entity list indexes mobs by name
+	entity_list.UnindexMob(this, GetID());
+	strn0cpy(name, new_name, 64);
+	entity_list.IndexMob(this);
+}
+
+void Mob::SetNPCTypeID(uint32 npctypeid)
+{
+	// the entity list indexes npcs by type id
+	entity_list.UnindexMob(this, GetID());
+	npctype_id = npctypeid;
+	entity_list.IndexMob(this);
+}
+
 void Mob::SetTargetable(bool on) {
 	if(m_targetable != on) {
 		m_targetable = on;
@@ -5664,9 +5696,11 @@ void Mob::SetTarget(Mob *mob)
 		DisplayInfo(mob);
 	}
 
-	std::vector<std::any> args = { mob };
+	if (parse->MobHasQuestSub(this, EVENT_TARGET_CHANGE)) {
+		std::vector<std::any> args = { mob };
 
-	parse->EventMob(EVENT_TARGET_CHANGE, this, mob, [&]() { return ""; }, 0, &args);
+		parse->EventMob(EVENT_TARGET_CHANGE, this, mob, [&]() { return ""; }, 0, &args);
+	}
 
 	if (IsPet() && GetOwner() && GetOwner()->IsClient()) {
 		GetOwner()->CastToClient()->UpdateXTargetType(MyPetTarget, mob);
@@ -5839,10 +5873,12 @@ bool Mob::ClearEntityVariables()
 		return false;
 	}
 
-	for (const auto& e : m_EntityVariables) {
-		std::vector<std::any> args = { e.first, e.second };
+	if (parse->MobHasQuestSub(this, EVENT_ENTITY_VARIABLE_DELETE)) {
+		for (const auto& e : m_EntityVariables) {
+			std::vector<std::any> args = { e.first, e.second };
 
-		parse->EventMob(EVENT_ENTITY_VARIABLE_DELETE, this, nullptr, [&]() { return ""; }, 0, &args);
+			parse->EventMob(EVENT_ENTITY_VARIABLE_DELETE, this, nullptr, [&]() { return ""; }, 0, &args);
+		}
 	}
 
 	m_EntityVariables.clear();
@@ -5860,8 +5896,10 @@ bool Mob::DeleteEntityVariable(std::string variable_name)
 		return false;
 	}
 
-	std::vector<std::any> args = { v->first, v->second };
-	parse->EventMob(EVENT_ENTITY_VARIABLE_DELETE, this, nullptr, [&]() { return ""; }, 0, &args);
+	if (parse->MobHasQuestSub(this, EVENT_ENTITY_VARIABLE_DELETE)) {
+		std::vector<std::any> args = { v->first, v->second };
+		parse->EventMob(EVENT_ENTITY_VARIABLE_DELETE, this, nullptr, [&]() { return ""; }, 0, &args);
+	}
 
 	m_EntityVariables.erase(v);
 
@@ -5914,10 +5952,12 @@ void Mob::SetEntityVariable(std::string variable_name, std::string variable_valu
 	std::vector<std::any> args;
 
 	if (!EntityVariableExists(variable_name)) {
-		args = { variable_name, variable_value };
+		if (parse->MobHasQuestSub(this, EVENT_ENTITY_VARIABLE_SET)) {
+			args = { variable_name, variable_value };
 
-		parse->EventMob(EVENT_ENTITY_VARIABLE_SET, this, nullptr, [&]() { return ""; }, 0, &args);
-	} else {
+			parse->EventMob(EVENT_ENTITY_VARIABLE_SET, this, nullptr, [&]() { return ""; }, 0, &args);
+		}
+	} else if (parse->MobHasQuestSub(this, EVENT_ENTITY_VARIABLE_UPDATE)) {
 		args = { variable_name, GetEntityVariable(variable_name), variable_value };
 
 		parse->EventMob(EVENT_ENTITY_VARIABLE_UPDATE, this, nullptr, [&]() { return ""; }, 0, &args);
@@ -8534,6 +8574,51 @@ void Mob::CloneAppearance(Mob* other, bool clone_name)
 	}
 }
 
+void Mob::RemoveHatedBy(Mob *hater)
+{
+	auto e = m_hated_by.find(hater);
+	if (e == m_hated_by.end()) {
+		return;
+	}
+
+	if (--e->second == 0) {
+		m_hated_by.erase(e);
+	}
+}
+
+std::vector<Mob *> Mob::GetHatedBy() const
+{
+	std::vector<Mob *> haters;
+	haters.reserve(m_hated_by.size());
+
+	for (const auto &e : m_hated_by) {
+		haters.push_back(e.first);
+	}
+
+	return haters;
+}
+
+// entity ids rather than pointers, callers fire quest events that can depop haters
+std::vector<uint16> Mob::GetHatedByIDs(bool include_feign_memory) const
+{
+	std::vector<uint16> ids;
+	ids.reserve(m_hated_by.size() + (include_feign_memory ? m_feign_remembered_by.size() : 0));
+
+	for (const auto &e : m_hated_by) {
+		ids.push_back(e.first->GetID());
+	}
+
+	if (include_feign_memory) {
+		for (auto m : m_feign_remembered_by) {
+			if (!m_hated_by.contains(m)) {
+				ids.push_back(m->GetID());
+			}
+		}
+	}
+
+	return ids;
+}
+
 void Mob::CopyHateList(Mob* to) {
 	if (hate_list.IsHateListEmpty() || !to || to->IsClient()) {
 		return;
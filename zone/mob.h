@@ -34,6 +34,7 @@
 
 #include <any>
 #include <set>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -93,6 +94,20 @@ struct AppearanceStruct {
 	uint8  texture          = UINT8_MAX;
 };
 
+// Result of the read-only AI think phase (EntityList::AIThinkProcess), consumed by
+// Mob::AI_Process in the same tick if nothing it was derived from has changed
+struct AIThinkIntent {
+	bool      valid           = false;
+	uint32    think_time      = 0;
+	Mob       *top_hate       = nullptr;
+	uint16    top_hate_id     = 0;
+	Mob       *prior_target   = nullptr;
+	uint32    hate_generation = 0;
+	bool      in_combat_range = false;
+	glm::vec4 self_position;
+	glm::vec4 top_hate_position;
+};
+
 class DataBucketKey;
 class Mob : public Entity {
 public:
@@ -605,8 +620,7 @@ public:
 	inline const char* GetLastName() const { return lastname; }
 	inline const eStandingPetOrder GetPreviousPetOrder() const { return m_previous_pet_order; }
 	const char *GetCleanName();
-	virtual void SetName(const char *new_name = nullptr) { new_name ? strn0cpy(name, new_name, 64) :
-		strn0cpy(name, GetName(), 64); return; };
+	virtual void SetName(const char *new_name = nullptr);
 	inline Mob* GetTarget() const { return target; }
 	std::string GetTargetDescription(Mob* target, uint8 description_type = TargetDescriptionType::LCSelf, uint16 entity_id_override = 0);
 	virtual void SetTarget(Mob* mob);
@@ -680,7 +694,7 @@ public:
 		((static_cast<float>(current_mana) / max_mana) * 100); }
 	virtual int64 CalcMaxMana();
 	uint32 GetNPCTypeID() const { return npctype_id; }
-	void SetNPCTypeID(uint32 npctypeid) { npctype_id = npctypeid; }
+	void SetNPCTypeID(uint32 npctypeid);
 	inline const glm::vec4& GetPosition() const { return m_Position; }
 	inline void SetPosition(const float x, const float y, const float z) { m_Position.x = x; m_Position.y = y; m_Position.z = z; }
 	inline const float GetX() const { return m_Position.x; }
@@ -799,8 +813,16 @@ public:
 	void RemoveFromFeignMemory(Mob* attacker);
 	void ClearFeignMemory();
 	bool IsOnFeignMemory(Mob *attacker) const;
+
+	// reverse indexes of the hate lists and feign memories that reference this mob
+	inline void AddHatedBy(Mob *hater) { ++m_hated_by[hater]; }
+	void RemoveHatedBy(Mob *hater);
+	std::vector<Mob *> GetHatedBy() const;
+	inline void AddFeignRememberedBy(Mob *npc) { m_feign_remembered_by.insert(npc); }
+	inline void RemoveFeignRememberedBy(Mob *npc) { m_feign_remembered_by.erase(npc); }
+	std::vector<uint16> GetHatedByIDs(bool include_feign_memory = false) const;
 	void PrintHateListToClient(Client *who) { hate_list.PrintHateListToClient(who); }
-	std::list<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
+	std::vector<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
 	bool CheckLosFN(Mob* other);
 	bool CheckLosFN(float posX, float posY, float posZ, float mobSize);
 	static bool CheckLosFN(glm::vec3 posWatcher, float sizeWatcher, glm::vec3 posTarget, float sizeTarget);
@@ -813,7 +835,7 @@ public:
 	inline bool CheckLastLosState() const { return last_los_check; }
 	std::string GetMobDescription();
 
-	std::list<struct_HateList*> GetFilteredHateList(
+	std::vector<struct_HateList*> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	) {
@@ -1196,6 +1218,8 @@ public:
 	virtual void AI_Stop();
 	virtual void AI_ShutDown();
 	virtual void AI_Process();
+	bool CanAIThinkInParallel();
+	void AI_Think();
 
 	bool ClearEntityVariables();
 	bool DeleteEntityVariable(std::string variable_name);
@@ -1846,6 +1870,11 @@ protected:
 	std::unique_ptr<Timer> AI_scan_door_open_timer;
 	uint32 time_until_can_move;
 	HateList hate_list;
+	std::unordered_map<Mob *, uint32> m_hated_by; // hater -> entries on its hate list
+	std::unordered_set<Mob *> m_feign_remembered_by;
+	AIThinkIntent m_ai_think_intent;
+	Mob* AI_GetThinkTopHate();
+	bool AI_GetThinkCombatRange(Mob* other);
 	std::set<uint32> feign_memory_list;
 	// This is to keep track of the current (one only) faction mod (alliance)
 	uint32 current_alliance_faction;
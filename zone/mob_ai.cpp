@@ -848,6 +848,7 @@ void Client::AI_Process()
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 				} else if (!remembered_mob->GetFeigned()) {
 					AddToHateList(remembered_mob,1);
+					remembered_mob->RemoveFeignRememberedBy(this);
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 					break;
 				} else {
@@ -1077,12 +1078,12 @@ void Mob::AI_Process() {
 
 				if (IsFocused()) {
 					if (!target) {
-						SetTarget(hate_list.GetMobWithMostHateOnList(this));
+						SetTarget(AI_GetThinkTopHate());
 					}
 				}
 				else {
 					if (!ImprovedTaunt())
-						SetTarget(hate_list.GetMobWithMostHateOnList(this));
+						SetTarget(AI_GetThinkTopHate());
 				}
 
 			}
@@ -1148,7 +1149,7 @@ void Mob::AI_Process() {
 
 		StartEnrage();
 
-		bool is_combat_range = CombatRange(target);
+		bool is_combat_range = AI_GetThinkCombatRange(target);
 
 		if (is_combat_range) {
 			if (IsMoving()) {
@@ -1377,6 +1378,7 @@ void Mob::AI_Process() {
 				}
 				else if (!remembered_mob->GetFeigned()) {
 					AddToHateList(remembered_mob, 1);
+					remembered_mob->RemoveFeignRememberedBy(this);
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 					break;
 				}
@@ -1545,6 +1547,96 @@ void Mob::AI_Process() {
 	}
 }
 
+// Think phase eligibility; everything AI_Think touches must be free of side effects
+bool Mob::CanAIThinkInParallel()
+{
+	if (!IsNPC() || !IsAIControlled() || IsCasting() || !IsEngaged()) {
+		return false;
+	}
+
+	if (!zone->CanDoCombat() || IsPetStop() || IsPetRegroup() || currently_fleeing) {
+		return false;
+	}
+
+	// root and blind target selection happens on every think, focused mobs keep their target
+	if ((IsRooted() && !GetSpecialAbility(SpecialAbility::IgnoreRootAggroRules)) || IsBlind() || IsFocused()) {
+		return false;
+	}
+
+	// CombatRange toggles pseudo root for chase distance mobs
+	if (GetSpecialAbility(SpecialAbility::NPCChaseDistance)) {
+		return false;
+	}
+
+	return (
+		(AI_think_timer->Check(false) || attack_timer.Check(false)) &&
+		AI_target_check_timer->Check(false)
+	);
+}
+
+// Runs on an AI think worker while the main thread waits, must only read zone state
+void Mob::AI_Think()
+{
+	auto &intent = m_ai_think_intent;
+
+	intent.valid           = false;
+	intent.think_time      = Timer::GetCurrentTime();
+	intent.prior_target    = target;
+	intent.hate_generation = hate_list.GetGeneration();
+	intent.self_position   = m_Position;
+	intent.top_hate        = hate_list.GetMobWithMostHateOnList(this);
+	intent.top_hate_id     = intent.top_hate ? intent.top_hate->GetID() : 0;
+	intent.in_combat_range = false;
+
+	if (intent.top_hate) {
+		intent.top_hate_position = intent.top_hate->GetPosition();
+		intent.in_combat_range   = CombatRange(intent.top_hate);
+	}
+
+	intent.valid = true;
+}
+
+Mob *Mob::AI_GetThinkTopHate()
+{
+	auto &intent = m_ai_think_intent;
+	if (!intent.valid) {
+		return hate_list.GetMobWithMostHateOnList(this);
+	}
+
+	// consumed once, a stale intent is recomputed rather than trusted
+	intent.valid = false;
+
+	if (
+		intent.think_time != Timer::GetCurrentTime() ||
+		intent.hate_generation != hate_list.GetGeneration() ||
+		intent.prior_target != target ||
+		intent.self_position != m_Position ||
+		(intent.top_hate && entity_list.GetMob(intent.top_hate_id) != intent.top_hate)
+	) {
+		intent.top_hate = nullptr;
+		return hate_list.GetMobWithMostHateOnList(this);
+	}
+
+	return intent.top_hate;
+}
+
+bool Mob::AI_GetThinkCombatRange(Mob *other)
+{
+	auto &intent = m_ai_think_intent;
+	if (
+		other &&
+		other == intent.top_hate &&
+		intent.think_time == Timer::GetCurrentTime() &&
+		intent.self_position == m_Position &&
+		intent.top_hate_position == other->GetPosition()
+	) {
+		intent.top_hate = nullptr;
+		return intent.in_combat_range;
+	}
+
+	return CombatRange(other);
+}
+
 void NPC::AI_DoMovement() {
 
 	float move_speed = GetMovespeed();
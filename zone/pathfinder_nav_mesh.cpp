@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <memory>
 #include <stdio.h>
 #include <vector>
@@ -9,6 +10,9 @@
 #include "water_map.h"
 #include "client.h"
 #include "../common/compression.h"
+#ifdef USE_MAP_MMFS
+#include "../common/read_only_mapped_file.h"
+#endif /*USE_MAP_MMFS*/
 
 extern Zone *zone;
 
@@ -16,6 +20,10 @@ struct PathfinderNavmesh::Implementation
 {
 	dtNavMesh *nav_mesh;
 	dtNavMeshQuery *query;
+#ifdef USE_MAP_MMFS
+	// tiles added from a baked file point into this mapping and must not outlive it
+	std::unique_ptr<EQ::ReadOnlyMappedFile> mapped;
+#endif /*USE_MAP_MMFS*/
 };
 
 PathfinderNavmesh::PathfinderNavmesh(const std::string &path)
@@ -375,17 +383,31 @@ void PathfinderNavmesh::Clear()
 {
 	if (m_impl->nav_mesh) {
 		dtFreeNavMesh(m_impl->nav_mesh);
+		m_impl->nav_mesh = nullptr;
 	}
 
 	if (m_impl->query) {
 		dtFreeNavMeshQuery(m_impl->query);
+		m_impl->query = nullptr;
 	}
+
+#ifdef USE_MAP_MMFS
+	m_impl->mapped.reset();
+#endif /*USE_MAP_MMFS*/
 }
 
 void PathfinderNavmesh::Load(const std::string &path)
 {
 	Clear();
 
+#ifdef USE_MAP_MMFS
+	if (LoadMMF(path)) {
+		return;
+	}
+
+	std::vector<std::tuple<uint32_t, const char *, uint32_t>> baked_tiles;
+#endif /*USE_MAP_MMFS*/
+
 	FILE *f = fopen(path.c_str(), "rb");
 	if (f) {
 		char magic[9] = { 0 };
@@ -468,14 +490,176 @@ void PathfinderNavmesh::Load(const std::string &path)
 
 			unsigned char* data = (unsigned char*)dtAlloc(data_size, DT_ALLOC_PERM);
 			memcpy(data, buf, data_size);
+#ifdef USE_MAP_MMFS
+			baked_tiles.emplace_back(tile_ref, buf, data_size);
+#endif /*USE_MAP_MMFS*/
 			buf += data_size;
 
 			m_impl->nav_mesh->addTile(data, data_size, DT_TILE_FREE_DATA, tile_ref, 0);
 		}
 
 		LogInfo("Loaded Navmesh V[{}] file [{}]", version, path.c_str());
+
+#ifdef USE_MAP_MMFS
+		SaveMMF(path, params, baked_tiles);
+#endif /*USE_MAP_MMFS*/
+	}
+}
+
+#ifdef USE_MAP_MMFS
+/**
+ * Baked navmesh: the inflated tiles of a .nav file laid out so each tile can be handed to Detour
+ * straight from a copy on write mapping. Detour patches links into the tiles it is given, so only
+ * those pages become private to a zone process; vertices, detail meshes and BV trees stay shared.
+ */
+#define NAV_MMF_MAGIC "EQNAVMMF"
+#define NAV_MMF_VERSION 2
+#define NAV_MMF_TILE_ALIGNMENT 16
+
+struct NavMMFHeader {
+	char            magic[8];
+	uint32_t        version;
+	uint32_t        header_size;
+	uint32_t        tile_count;
+	uint32_t        reserved;
+	uint64_t        file_size;
+	uint64_t        source_size;
+	int64_t         source_mtime;
+	dtNavMeshParams params;
+};
+
+struct NavMMFTile {
+	uint32_t tile_ref;
+	uint32_t data_size;
+	uint64_t data_offset;
+};
+
+static std::string GetNavMMFPath(const std::string &path)
+{
+	return path + ".mmf";
+}
+
+// size and modification time of the .nav a baked navmesh was made from, so a replaced .nav gets rebaked
+static bool GetNavSourceStamp(const std::string &path, uint64_t &size, int64_t &mtime)
+{
+	std::error_code ec;
+	size = std::filesystem::file_size(path, ec);
+	if (ec) {
+		return false;
+	}
+
+	auto t = std::filesystem::last_write_time(path, ec);
+	if (ec) {
+		return false;
+	}
+
+	mtime = (int64_t) t.time_since_epoch().count();
+	return true;
+}
+
+bool PathfinderNavmesh::LoadMMF(const std::string &path)
+{
+	auto file = std::make_unique<EQ::ReadOnlyMappedFile>();
+	if (!file->Open(GetNavMMFPath(path), true)) {
+		return false;
+	}
+
+	char *data = file->MutableData();
+	const uint64_t file_size = file->Size();
+	if (file_size < sizeof(NavMMFHeader)) {
+		return false;
+	}
+
+	auto header = reinterpret_cast<const NavMMFHeader *>(data);
+	if (memcmp(header->magic, NAV_MMF_MAGIC, sizeof(header->magic)) != 0 ||
+		header->version != NAV_MMF_VERSION ||
+		header->header_size != sizeof(NavMMFHeader) ||
+		header->file_size != file_size ||
+		header->tile_count > (file_size - sizeof(NavMMFHeader)) / sizeof(NavMMFTile)) {
+		LogInfo("Ignoring outdated or damaged baked navmesh [{}]", GetNavMMFPath(path));
+		return false;
+	}
+
+	uint64_t source_size  = 0;
+	int64_t  source_mtime = 0;
+	if (!GetNavSourceStamp(path, source_size, source_mtime) ||
+		header->source_size != source_size ||
+		header->source_mtime != source_mtime) {
+		LogInfo("Ignoring stale baked navmesh [{}], source [{}] has changed", GetNavMMFPath(path), path);
+		return false;
+	}
+
+	m_impl->nav_mesh = dtAllocNavMesh();
+	if (dtStatusFailed(m_impl->nav_mesh->init(&header->params))) {
+		dtFreeNavMesh(m_impl->nav_mesh);
+		m_impl->nav_mesh = nullptr;
+		return false;
+	}
+
+	auto tiles = reinterpret_cast<const NavMMFTile *>(data + sizeof(NavMMFHeader));
+	for (uint32_t i = 0; i < header->tile_count; ++i) {
+		const auto &t = tiles[i];
+		if (t.data_offset % NAV_MMF_TILE_ALIGNMENT != 0 ||
+			t.data_offset > file_size ||
+			t.data_size > file_size - t.data_offset ||
+			dtStatusFailed(m_impl->nav_mesh->addTile((unsigned char *) data + t.data_offset, t.data_size, 0, t.tile_ref, 0))) {
+			dtFreeNavMesh(m_impl->nav_mesh);
+			m_impl->nav_mesh = nullptr;
+			return false;
+		}
+	}
+
+	m_impl->mapped = std::move(file);
+
+	LogInfo("Loaded baked Navmesh file [{}] tiles [{}]", GetNavMMFPath(path), header->tile_count);
+
+	return true;
+}
+
+void PathfinderNavmesh::SaveMMF(const std::string &path, const dtNavMeshParams &params, const std::vector<std::tuple<uint32_t, const char *, uint32_t>> &tiles)
+{
+	NavMMFHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, NAV_MMF_MAGIC, sizeof(header.magic));
+	header.version     = NAV_MMF_VERSION;
+	header.header_size = sizeof(NavMMFHeader);
+	header.tile_count  = (uint32_t) tiles.size();
+	header.params      = params;
+
+	if (!GetNavSourceStamp(path, header.source_size, header.source_mtime)) {
+		return;
+	}
+
+	std::vector<NavMMFTile> table(tiles.size());
+
+	uint64_t offset = sizeof(NavMMFHeader) + sizeof(NavMMFTile) * table.size();
+	for (size_t i = 0; i < tiles.size(); ++i) {
+		offset = (offset + NAV_MMF_TILE_ALIGNMENT - 1) & ~(uint64_t) (NAV_MMF_TILE_ALIGNMENT - 1);
+
+		table[i].tile_ref    = std::get<0>(tiles[i]);
+		table[i].data_size   = std::get<2>(tiles[i]);
+		table[i].data_offset = offset;
+
+		offset += table[i].data_size;
+	}
+
+	header.file_size = offset;
+
+	std::vector<char> buffer(offset, 0);
+	memcpy(&buffer[0], &header, sizeof(header));
+	if (!table.empty()) {
+		memcpy(&buffer[sizeof(NavMMFHeader)], table.data(), sizeof(NavMMFTile) * table.size());
+	}
+
+	for (size_t i = 0; i < tiles.size(); ++i) {
+		memcpy(&buffer[table[i].data_offset], std::get<1>(tiles[i]), table[i].data_size);
+	}
+
+	if (!EQ::ReadOnlyMappedFile::WriteAtomic(GetNavMMFPath(path), buffer.data(), buffer.size())) {
+		LogInfo("Failed to save baked Navmesh file [{}]", GetNavMMFPath(path));
 	}
 }
+#endif /*USE_MAP_MMFS*/
 
 void PathfinderNavmesh::ShowPath(Client * c, const glm::vec3 &start, const glm::vec3 &end)
 {
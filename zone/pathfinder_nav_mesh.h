@@ -2,6 +2,8 @@
 
 #include "pathfinder_interface.h"
 #include <string>
+#include <tuple>
+#include <vector>
 #include <DetourNavMesh.h>
 
 class PathfinderNavmesh : public IPathfinder
@@ -18,6 +20,10 @@ public:
 private:
 	void Clear();
 	void Load(const std::string &path);
+#ifdef USE_MAP_MMFS
+	bool LoadMMF(const std::string &path);
+	void SaveMMF(const std::string &path, const dtNavMeshParams &params, const std::vector<std::tuple<uint32_t, const char *, uint32_t>> &tiles);
+#endif /*USE_MAP_MMFS*/
 	void ShowPath(Client *c, const glm::vec3 &start, const glm::vec3 &end);
 	dtStatus GetPolyHeightNoConnections(dtPolyRef ref, const float *pos, float *height) const;
 	dtStatus GetPolyHeightOnPath(const dtPolyRef *path, const int path_len, const glm::vec3 &pos, float *h) const;
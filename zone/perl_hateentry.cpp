@@ -34,7 +34,7 @@ void Perl_HateEntry_SetDamage(struct_HateList* self, int64 value) // @categories
 
 void Perl_HateEntry_SetEnt(struct_HateList* self, Mob* mob) // @categories Script Utility, Hate and Aggro
 {
-	self->entity_on_hatelist = mob;
+	HateList::SetEntOnEntry(self, mob);
 }
 
 void Perl_HateEntry_SetFrenzy(struct_HateList* self, bool is_frenzy) // @categories Script Utility, Hate and Aggro
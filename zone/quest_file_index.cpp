@@ -0,0 +1,241 @@
+#include "quest_file_index.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/strings.h"
+
+#include <filesystem>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace fs = std::filesystem;
+
+// the filesystems on Windows and macOS ignore case, so the index has to as well
+static std::string GetIndexKey(const fs::path &file_name)
+{
+#if defined(_WINDOWS) || defined(__APPLE__)
+	return Strings::ToLower(file_name.generic_string());
+#else
+	return file_name.generic_string();
+#endif
+}
+
+QuestFileIndex::~QuestFileIndex()
+{
+	Clear();
+}
+
+void QuestFileIndex::Build(const std::vector<std::string> &roots, bool watch)
+{
+	Clear();
+
+	m_roots = roots;
+
+#ifdef __linux__
+	if (watch) {
+		m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_inotify_fd < 0) {
+			LogWarning("Failed to watch quest directories, inotify_init1 errno [{}]", errno);
+		}
+	}
+#endif
+
+	for (const auto &r: m_roots) {
+		Walk(r);
+	}
+
+	m_built = true;
+
+	LogQuestsDetail("Indexed [{}] quest file(s) across [{}] director(ies)", m_files.size(), m_roots.size());
+}
+
+void QuestFileIndex::Clear()
+{
+#ifdef __linux__
+	if (m_inotify_fd >= 0) {
+		close(m_inotify_fd);
+		m_inotify_fd = -1;
+	}
+
+	m_watches.clear();
+#endif
+
+	m_files.clear();
+	m_roots.clear();
+	m_built = false;
+}
+
+bool QuestFileIndex::IsWatching() const
+{
+#ifdef __linux__
+	return m_inotify_fd >= 0;
+#else
+	return false;
+#endif
+}
+
+bool QuestFileIndex::Exists(const std::string &file_name) const
+{
+	return m_files.find(GetIndexKey(file_name)) != m_files.end();
+}
+
+void QuestFileIndex::Walk(const std::string &directory)
+{
+	std::error_code ec;
+	if (!fs::is_directory(directory, ec)) {
+		return;
+	}
+
+#ifdef __linux__
+	Watch(directory);
+#endif
+
+	const auto options = fs::directory_options::follow_directory_symlink | fs::directory_options::skip_permission_denied;
+
+	for (auto it = fs::recursive_directory_iterator(directory, options, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+		if (it->is_directory(ec)) {
+#ifdef __linux__
+			Watch(it->path().generic_string());
+#endif
+			continue;
+		}
+
+		m_files.insert(GetIndexKey(it->path()));
+	}
+}
+
+#ifdef __linux__
+void QuestFileIndex::Watch(const std::string &directory)
+{
+	if (m_inotify_fd < 0) {
+		return;
+	}
+
+	const int wd = inotify_add_watch(
+		m_inotify_fd,
+		directory.c_str(),
+		IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE
+	);
+
+	if (wd < 0) {
+		LogWarning("Failed to watch quest directory [{}] errno [{}]", directory, errno);
+		return;
+	}
+
+	m_watches[wd] = directory;
+}
+#endif
+
+bool QuestFileIndex::Poll(std::vector<std::string> &changed)
+{
+	changed.clear();
+
+#ifdef __linux__
+	if (m_inotify_fd < 0) {
+		return true;
+	}
+
+	std::unordered_set<std::string> seen;
+	bool                            overflowed = false;
+
+	auto report = [&](const std::string &file_name) {
+		if (seen.insert(file_name).second) {
+			changed.push_back(file_name);
+		}
+	};
+
+	alignas(inotify_event) char buffer[16384];
+
+	for (;;) {
+		const ssize_t length = read(m_inotify_fd, buffer, sizeof(buffer));
+		if (length <= 0) {
+			break;
+		}
+
+		for (ssize_t offset = 0; offset < length;) {
+			const auto *e = reinterpret_cast<const inotify_event *>(buffer + offset);
+			offset += sizeof(inotify_event) + e->len;
+
+			if (e->mask & IN_Q_OVERFLOW) {
+				overflowed = true;
+				continue;
+			}
+
+			if (e->mask & IN_IGNORED) {
+				m_watches.erase(e->wd);
+				continue;
+			}
+
+			auto w = m_watches.find(e->wd);
+			if (w == m_watches.end() || e->len == 0) {
+				continue;
+			}
+
+			const std::string file_name = fmt::format("{}/{}", w->second, e->name);
+
+			if (e->mask & IN_ISDIR) {
+				if (e->mask & (IN_CREATE | IN_MOVED_TO)) {
+					const auto before = m_files.size();
+					Walk(file_name);
+
+					// a directory moved in arrives with its contents, those are new files too
+					if (m_files.size() != before) {
+						const std::string prefix = file_name + "/";
+						for (const auto &f: m_files) {
+							if (f.rfind(prefix, 0) == 0) {
+								report(f);
+							}
+						}
+					}
+				}
+				else if (e->mask & (IN_DELETE | IN_MOVED_FROM)) {
+					const std::string prefix = file_name + "/";
+					for (auto it = m_files.begin(); it != m_files.end();) {
+						if (it->rfind(prefix, 0) == 0) {
+							report(*it);
+							it = m_files.erase(it);
+						}
+						else {
+							++it;
+						}
+					}
+
+					for (auto it = m_watches.begin(); it != m_watches.end();) {
+						if (it->second == file_name || it->second.rfind(prefix, 0) == 0) {
+							inotify_rm_watch(m_inotify_fd, it->first);
+							it = m_watches.erase(it);
+						}
+						else {
+							++it;
+						}
+					}
+				}
+
+				continue;
+			}
+
+			if (e->mask & (IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO)) {
+				m_files.insert(file_name);
+				report(file_name);
+			}
+			else if (e->mask & (IN_DELETE | IN_MOVED_FROM)) {
+				m_files.erase(file_name);
+				report(file_name);
+			}
+		}
+	}
+
+	if (overflowed) {
+		LogQuests("Quest directory watch overflowed, re-indexing");
+
+		auto roots = m_roots;
+		Build(roots, true);
+
+		return false;
+	}
+#endif
+
+	return true;
+}
@@ -0,0 +1,54 @@
+#ifndef EQEMU_QUEST_FILE_INDEX_H
+#define EQEMU_QUEST_FILE_INDEX_H
+
+#include "../common/types.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * In-memory listing of the quest directories a zone resolves scripts from
+ *
+ * Script lookups probe many candidate paths per NPC type, item, spell and encounter,
+ * the index answers those from memory instead of a stat() each. It is walked once
+ * per (re)load and, where inotify is available, kept current by Poll() so that
+ * changed files can be reported back to the parser collection
+ */
+class QuestFileIndex {
+public:
+	QuestFileIndex() = default;
+	~QuestFileIndex();
+
+	QuestFileIndex(const QuestFileIndex &) = delete;
+	QuestFileIndex &operator=(const QuestFileIndex &) = delete;
+
+	// walks every root recursively, watching them as well when watch is set
+	void Build(const std::vector<std::string> &roots, bool watch);
+	void Clear();
+
+	bool IsBuilt() const { return m_built; }
+	bool IsWatching() const;
+	bool Exists(const std::string &file_name) const;
+
+	// files created, written, moved or removed since the last call, false when the
+	// kernel dropped events and the caller can no longer trust what it has loaded
+	bool Poll(std::vector<std::string> &changed);
+
+private:
+	void Walk(const std::string &directory);
+
+	bool                            m_built = false;
+	std::vector<std::string>        m_roots;
+	std::unordered_set<std::string> m_files;
+
+#ifdef __linux__
+	void Watch(const std::string &directory);
+
+	int                                  m_inotify_fd = -1;
+	std::unordered_map<int, std::string> m_watches;
+#endif
+};
+
+#endif //EQEMU_QUEST_FILE_INDEX_H
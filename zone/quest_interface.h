@@ -21,6 +21,7 @@
 
 #include "../common/types.h"
 #include "event_codes.h"
+#include "quest_profiler.h"
 #include <any>
 
 class Client;
@@ -36,7 +37,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -48,7 +49,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -59,7 +60,7 @@ public:
 	virtual int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -70,7 +71,7 @@ public:
 	virtual int EventGlobalPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -83,7 +84,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -96,7 +97,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -107,7 +108,7 @@ public:
 	virtual int EventEncounter(
 		QuestEventID event_id,
 		std::string encounter_name,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -119,7 +120,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -131,7 +132,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -143,7 +144,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -155,7 +156,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -239,7 +240,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -250,7 +251,7 @@ public:
 	virtual int DispatchEventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -263,7 +264,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -276,7 +277,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -288,7 +289,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -300,7 +301,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -315,6 +316,9 @@ public:
 	}
 	virtual void Init() { }
 	virtual void ReloadQuests() { }
+	// forgets a loaded script so the next Load*Script call compiles it again, packages are named
+	// npc_<id>, item_<id>, spell_<id>, player, bot, merc and global_npc/player/bot/merc
+	virtual void UnloadScript(const std::string& package_name) { }
 	virtual uint32 GetIdentifier() = 0;
 	virtual void RemoveEncounter(const std::string& name) { }
 
@@ -330,6 +334,8 @@ public:
 
 		errors_.push_back(error);
 
+		QuestProfiler::Instance()->SetError();
+
 		if (errors_.size() > RuleI(World, MaximumQuestErrors)) {
 			errors_.pop_front();
 		}
@@ -27,8 +27,9 @@
 #include "questmgr.h"
 #include "../common/path_manager.h"
 #include "../common/repositories/perl_event_export_settings_repository.h"
-#include "../common/file.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <stdio.h>
 
 // an encounter can register events before the object is loaded
@@ -49,6 +50,8 @@ QuestParserCollection::QuestParserCollection()
 	_global_bot_quest_status    = QuestUnloaded;
 	_merc_quest_status          = QuestUnloaded;
 	_global_merc_quest_status   = QuestUnloaded;
+
+	_quest_files_timer.Start(1000);
 }
 
 QuestParserCollection::~QuestParserCollection() { }
@@ -103,6 +106,23 @@ void QuestParserCollection::ReloadQuests(bool reset_timers)
 	_item_quest_status.clear();
 	_encounter_quest_status.clear();
 
+	_npc_quest_names.clear();
+	_item_quest_scripts.clear();
+
+	_npc_quest_subs.clear();
+	_global_npc_quest_subs    = {};
+	_player_quest_subs        = {};
+	_global_player_quest_subs = {};
+	_bot_quest_subs           = {};
+	_global_bot_quest_subs    = {};
+	_merc_quest_subs          = {};
+	_global_merc_quest_subs   = {};
+	_spell_quest_subs.clear();
+	_item_quest_subs.clear();
+
+	// re-indexed on the next lookup
+	_quest_files.Clear();
+
 	for (const auto& e: _load_precedence) {
 		e->ReloadQuests();
 	}
@@ -126,6 +146,10 @@ bool QuestParserCollection::HasQuestSub(uint32 npc_id, QuestEventID event_id)
 
 bool QuestParserCollection::NPCHasEncounterSub(uint32 npc_id, QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	return HasEncounterSub(event_id, fmt::format("npc_{}", npc_id)) || HasEncounterSub(event_id, "npc_" + ENCOUNTER_NO_ENTITY_ID);
 }
 
@@ -136,7 +160,7 @@ bool QuestParserCollection::HasQuestSubLocal(uint32 npc_id, QuestEventID event_i
 	if (iter != _npc_quest_status.end()) {
 		if (iter->second != QuestFailedToLoad) { //loaded or failed to load
 			auto qiter = _interfaces.find(iter->second);
-			if (qiter->second->HasQuestSub(npc_id, event_id)) {
+			if (_npc_quest_subs[npc_id].Has(event_id, [&]() { return qiter->second->HasQuestSub(npc_id, event_id); })) {
 				return true;
 			}
 		}
@@ -148,7 +172,7 @@ bool QuestParserCollection::HasQuestSubLocal(uint32 npc_id, QuestEventID event_i
 			_npc_quest_status[npc_id] = qi->GetIdentifier();
 
 			qi->LoadNPCScript(filename, npc_id);
-			if (qi->HasQuestSub(npc_id, event_id)) {
+			if (_npc_quest_subs[npc_id].Has(event_id, [&]() { return qi->HasQuestSub(npc_id, event_id); })) {
 				return true;
 			}
 		} else {
@@ -168,14 +192,16 @@ bool QuestParserCollection::HasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			qi->LoadGlobalNPCScript(filename);
 			_global_npc_quest_status = qi->GetIdentifier();
-			if (qi->HasGlobalQuestSub(event_id)) {
+			if (_global_npc_quest_subs.Has(event_id, [&]() { return qi->HasGlobalQuestSub(event_id); })) {
 				return true;
 			}
+		} else if (zone && zone->IsLoaded()) {
+			_global_npc_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_global_npc_quest_status != QuestFailedToLoad) {
 			auto qiter = _interfaces.find(_global_npc_quest_status);
-			if (qiter->second->HasGlobalQuestSub(event_id)) {
+			if (_global_npc_quest_subs.Has(event_id, [&]() { return qiter->second->HasGlobalQuestSub(event_id); })) {
 				return true;
 			}
 		}
@@ -207,11 +233,13 @@ bool QuestParserCollection::PlayerHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_player_quest_status = qi->GetIdentifier();
 			qi->LoadPlayerScript(filename);
-			return qi->PlayerHasQuestSub(event_id);
+			return _player_quest_subs.Has(event_id, [&]() { return qi->PlayerHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_player_quest_status = QuestFailedToLoad;
 		}
 	} else if (_player_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_player_quest_status);
-		return iter->second->PlayerHasQuestSub(event_id);
+		return _player_quest_subs.Has(event_id, [&]() { return iter->second->PlayerHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -226,11 +254,13 @@ bool QuestParserCollection::PlayerHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_player_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalPlayerScript(filename);
-			return qi->GlobalPlayerHasQuestSub(event_id);
+			return _global_player_quest_subs.Has(event_id, [&]() { return qi->GlobalPlayerHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_global_player_quest_status = QuestFailedToLoad;
 		}
 	} else if (_global_player_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_global_player_quest_status);
-		return iter->second->GlobalPlayerHasQuestSub(event_id);
+		return _global_player_quest_subs.Has(event_id, [&]() { return iter->second->GlobalPlayerHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -238,6 +268,10 @@ bool QuestParserCollection::PlayerHasQuestSubGlobal(QuestEventID event_id)
 
 bool QuestParserCollection::SpellHasEncounterSub(uint32 spell_id, QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	return HasEncounterSub(event_id, fmt::format("spell_{}", spell_id)) ||
 		   HasEncounterSub(event_id, "spell_" + ENCOUNTER_NO_ENTITY_ID);
 }
@@ -253,7 +287,7 @@ bool QuestParserCollection::SpellHasQuestSub(uint32 spell_id, QuestEventID event
 		//loaded or failed to load
 		if (iter->second != QuestFailedToLoad) {
 			auto qiter = _interfaces.find(iter->second);
-			return qiter->second->SpellHasQuestSub(spell_id, event_id);
+			return _spell_quest_subs[spell_id].Has(event_id, [&]() { return qiter->second->SpellHasQuestSub(spell_id, event_id); });
 		}
 	} else if (_spell_quest_status[spell_id] != QuestFailedToLoad) {
 		std::string filename;
@@ -262,7 +296,7 @@ bool QuestParserCollection::SpellHasQuestSub(uint32 spell_id, QuestEventID event
 		if (qi) {
 			_spell_quest_status[spell_id] = qi->GetIdentifier();
 			qi->LoadSpellScript(filename, spell_id);
-			return qi->SpellHasQuestSub(spell_id, event_id);
+			return _spell_quest_subs[spell_id].Has(event_id, [&]() { return qi->SpellHasQuestSub(spell_id, event_id); });
 		} else {
 			_spell_quest_status[spell_id] = QuestFailedToLoad;
 		}
@@ -273,6 +307,10 @@ bool QuestParserCollection::SpellHasQuestSub(uint32 spell_id, QuestEventID event
 
 bool QuestParserCollection::ItemHasEncounterSub(EQ::ItemInstance *inst, QuestEventID event_id)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	if (inst) {
 		return HasEncounterSub(event_id, fmt::format("item_{}", inst->GetID())) ||
 			   HasEncounterSub(event_id, "item_" + ENCOUNTER_NO_ENTITY_ID);
@@ -291,33 +329,25 @@ bool QuestParserCollection::ItemHasQuestSub(EQ::ItemInstance* inst, QuestEventID
 		return true;
 	}
 
-	std::string item_script;
-	if (inst->GetItem()->ScriptFileID != 0) {
-		item_script = fmt::format(
-			"script_{}",
-			inst->GetItem()->ScriptFileID
-		);
-	} else if (strlen(inst->GetItem()->CharmFile) > 0) {
-		item_script = inst->GetItem()->CharmFile;
-	} else {
-		item_script = std::to_string(inst->GetID());
-	}
-
 	uint32 item_id = inst->GetID();
 	auto   iter    = _item_quest_status.find(item_id);
 	if (iter != _item_quest_status.end()) {
 		//loaded or failed to load
 		if (iter->second != QuestFailedToLoad) {
 			auto qiter = _interfaces.find(iter->second);
-			return qiter->second->ItemHasQuestSub(inst, event_id);
+			return _item_quest_subs[item_id].Has(event_id, [&]() { return qiter->second->ItemHasQuestSub(inst, event_id); });
 		}
 	} else {
+		const auto item_script = GetItemScriptName(inst);
+
 		std::string filename;
 		auto        qi = GetQIByItemQuest(item_script, filename);
+
+		_item_quest_scripts[item_id] = item_script;
 		if (qi) {
 			_item_quest_status[item_id] = qi->GetIdentifier();
 			qi->LoadItemScript(filename, inst);
-			return qi->ItemHasQuestSub(inst, event_id);
+			return _item_quest_subs[item_id].Has(event_id, [&]() { return qi->ItemHasQuestSub(inst, event_id); });
 		} else {
 			_item_quest_status[item_id] = QuestFailedToLoad;
 		}
@@ -328,6 +358,10 @@ bool QuestParserCollection::ItemHasQuestSub(EQ::ItemInstance* inst, QuestEventID
 
 bool QuestParserCollection::HasEncounterSub(QuestEventID event_id, const std::string& package_name)
 {
+	if (_encounter_quest_status.empty()) {
+		return false;
+	}
+
 	for (auto it = _encounter_quest_status.begin(); it != _encounter_quest_status.end(); ++it) {
 		if (it->second != QuestFailedToLoad) {
 			auto qit = _interfaces.find(it->second);
@@ -349,11 +383,13 @@ bool QuestParserCollection::BotHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_bot_quest_status = qi->GetIdentifier();
 			qi->LoadBotScript(filename);
-			return qi->BotHasQuestSub(event_id);
+			return _bot_quest_subs.Has(event_id, [&]() { return qi->BotHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_bot_quest_status = QuestFailedToLoad;
 		}
 	} else if (_bot_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_bot_quest_status);
-		return iter->second->BotHasQuestSub(event_id);
+		return _bot_quest_subs.Has(event_id, [&]() { return iter->second->BotHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -368,11 +404,13 @@ bool QuestParserCollection::BotHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_bot_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalBotScript(filename);
-			return qi->GlobalBotHasQuestSub(event_id);
+			return _global_bot_quest_subs.Has(event_id, [&]() { return qi->GlobalBotHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_global_bot_quest_status = QuestFailedToLoad;
 		}
 	} else if (_global_bot_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_global_bot_quest_status);
-		return iter->second->GlobalBotHasQuestSub(event_id);
+		return _global_bot_quest_subs.Has(event_id, [&]() { return iter->second->GlobalBotHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -392,11 +430,13 @@ bool QuestParserCollection::MercHasQuestSubLocal(QuestEventID event_id)
 		if (qi) {
 			_merc_quest_status = qi->GetIdentifier();
 			qi->LoadMercScript(filename);
-			return qi->MercHasQuestSub(event_id);
+			return _merc_quest_subs.Has(event_id, [&]() { return qi->MercHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_merc_quest_status = QuestFailedToLoad;
 		}
 	} else if (_merc_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_merc_quest_status);
-		return iter->second->MercHasQuestSub(event_id);
+		return _merc_quest_subs.Has(event_id, [&]() { return iter->second->MercHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -411,11 +451,13 @@ bool QuestParserCollection::MercHasQuestSubGlobal(QuestEventID event_id)
 		if (qi) {
 			_global_merc_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalMercScript(filename);
-			return qi->GlobalMercHasQuestSub(event_id);
+			return _global_merc_quest_subs.Has(event_id, [&]() { return qi->GlobalMercHasQuestSub(event_id); });
+		} else if (zone && zone->IsLoaded()) {
+			_global_merc_quest_status = QuestFailedToLoad;
 		}
 	} else if (_global_merc_quest_status != QuestFailedToLoad) {
 		auto iter = _interfaces.find(_global_merc_quest_status);
-		return iter->second->GlobalMercHasQuestSub(event_id);
+		return _global_merc_quest_subs.Has(event_id, [&]() { return iter->second->GlobalMercHasQuestSub(event_id); });
 	}
 
 	return false;
@@ -426,15 +468,40 @@ bool QuestParserCollection::MercHasQuestSub(QuestEventID event_id)
 	return MercHasQuestSubLocal(event_id) || MercHasQuestSubGlobal(event_id);
 }
 
+// same dispatch as EventMob, lets callers skip building event arguments nobody will read
+bool QuestParserCollection::MobHasQuestSub(Mob* e, QuestEventID event_id)
+{
+	if (!e) {
+		return false;
+	}
+
+	if (e->IsClient()) {
+		return PlayerHasQuestSub(event_id);
+	} else if (e->IsBot()) {
+		return BotHasQuestSub(event_id);
+	} else if (e->IsMerc()) {
+		return MercHasQuestSub(event_id);
+	} else if (e->IsNPC()) {
+		return HasQuestSub(e->GetNPCTypeID(), event_id);
+	}
+
+	return false;
+}
+
 int QuestParserCollection::EventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	// unsubscribed events stop at the cached subscription bits, before any dispatch
+	if (!HasQuestSub(npc->GetNPCTypeID(), event_id)) {
+		return 0;
+	}
+
 	const int local_return   = EventNPCLocal(event_id, npc, init, data, extra_data, extra_pointers);
 	const int global_return  = EventNPCGlobal(event_id, npc, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventNPC(event_id, npc, init, data, extra_data, extra_pointers);
@@ -454,7 +521,7 @@ int QuestParserCollection::EventNPCLocal(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -486,7 +553,7 @@ int QuestParserCollection::EventNPCGlobal(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -502,7 +569,7 @@ int QuestParserCollection::EventNPCGlobal(
 			_global_npc_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalNPCScript(filename);
 			return qi->EventGlobalNPC(event_id, npc, init, data, extra_data, extra_pointers);
-		} else {
+		} else if (zone && zone->IsLoaded()) {
 			_global_npc_quest_status = QuestFailedToLoad;
 		}
 	}
@@ -513,11 +580,15 @@ int QuestParserCollection::EventNPCGlobal(
 int QuestParserCollection::EventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (!PlayerHasQuestSub(event_id)) {
+		return 0;
+	}
+
 	const int local_return   = EventPlayerLocal(event_id, client, data, extra_data, extra_pointers);
 	const int global_return  = EventPlayerGlobal(event_id, client, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventPlayer(event_id, client, data, extra_data, extra_pointers);
@@ -536,7 +607,7 @@ int QuestParserCollection::EventPlayer(
 int QuestParserCollection::EventPlayerLocal(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -549,6 +620,8 @@ int QuestParserCollection::EventPlayerLocal(
 			_player_quest_status = qi->GetIdentifier();
 			qi->LoadPlayerScript(filename);
 			return qi->EventPlayer(event_id, client, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_player_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_player_quest_status != QuestFailedToLoad) {
@@ -563,7 +636,7 @@ int QuestParserCollection::EventPlayerLocal(
 int QuestParserCollection::EventPlayerGlobal(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -576,6 +649,8 @@ int QuestParserCollection::EventPlayerGlobal(
 			_global_player_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalPlayerScript(filename);
 			return qi->EventGlobalPlayer(event_id, client, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_global_player_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_global_player_quest_status != QuestFailedToLoad) {
@@ -592,27 +667,15 @@ int QuestParserCollection::EventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
-	if (!inst) {
+	if (!inst || !ItemHasQuestSub(inst, event_id)) {
 		return 0;
 	}
 
-	std::string item_script;
-	if (inst->GetItem()->ScriptFileID != 0) {
-		item_script = fmt::format(
-			"script_{}",
-			inst->GetItem()->ScriptFileID
-		);
-	} else if (strlen(inst->GetItem()->CharmFile) > 0) {
-		item_script = inst->GetItem()->CharmFile;
-	} else {
-		item_script = std::to_string(inst->GetID());
-	}
-
 	uint32 item_id = inst->GetID();
 	auto   iter    = _item_quest_status.find(item_id);
 	if (iter != _item_quest_status.end()) {
@@ -630,9 +693,13 @@ int QuestParserCollection::EventItem(
 
 		return DispatchEventItem(event_id, client, inst, mob, data, extra_data, extra_pointers);
 	} else if (_item_quest_status[item_id] != QuestFailedToLoad) {
+		const auto item_script = GetItemScriptName(inst);
+
 		std::string filename;
 		auto        qi = GetQIByItemQuest(item_script, filename);
 
+		_item_quest_scripts[item_id] = item_script;
+
 		if (qi) {
 			_item_quest_status[item_id] = qi->GetIdentifier();
 
@@ -668,11 +735,15 @@ int QuestParserCollection::EventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (!SpellHasQuestSub(spell_id, event_id)) {
+		return 0;
+	}
+
 	auto iter = _spell_quest_status.find(spell_id);
 	if (iter != _spell_quest_status.end()) {
 		//loaded or failed to load
@@ -733,7 +804,7 @@ int QuestParserCollection::EventSpell(
 int QuestParserCollection::EventEncounter(
 	QuestEventID event_id,
 	std::string encounter_name,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -764,11 +835,15 @@ int QuestParserCollection::EventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (!BotHasQuestSub(event_id) && !HasEncounterSub(event_id, "bot")) {
+		return 0;
+	}
+
 	const int local_return   = EventBotLocal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int global_return  = EventBotGlobal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventBot(event_id, bot, init, data, extra_data, extra_pointers);
@@ -788,7 +863,7 @@ int QuestParserCollection::EventBotLocal(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -801,6 +876,8 @@ int QuestParserCollection::EventBotLocal(
 			_bot_quest_status = qi->GetIdentifier();
 			qi->LoadBotScript(filename);
 			return qi->EventBot(event_id, bot, init, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_bot_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_bot_quest_status != QuestFailedToLoad) {
@@ -816,7 +893,7 @@ int QuestParserCollection::EventBotGlobal(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -829,6 +906,8 @@ int QuestParserCollection::EventBotGlobal(
 			_global_bot_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalBotScript(filename);
 			return qi->EventGlobalBot(event_id, bot, init, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_global_bot_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_global_bot_quest_status != QuestFailedToLoad) {
@@ -844,11 +923,15 @@ int QuestParserCollection::EventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	if (!MercHasQuestSub(event_id) && !HasEncounterSub(event_id, "merc")) {
+		return 0;
+	}
+
 	const int local_return   = EventMercLocal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int global_return  = EventMercGlobal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventMerc(event_id, merc, init, data, extra_data, extra_pointers);
@@ -868,7 +951,7 @@ int QuestParserCollection::EventMercLocal(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -881,6 +964,8 @@ int QuestParserCollection::EventMercLocal(
 			_merc_quest_status = qi->GetIdentifier();
 			qi->LoadMercScript(filename);
 			return qi->EventMerc(event_id, merc, init, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_merc_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_merc_quest_status != QuestFailedToLoad) {
@@ -896,7 +981,7 @@ int QuestParserCollection::EventMercGlobal(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -909,6 +994,8 @@ int QuestParserCollection::EventMercGlobal(
 			_global_merc_quest_status = qi->GetIdentifier();
 			qi->LoadGlobalMercScript(filename);
 			return qi->EventGlobalMerc(event_id, merc, init, data, extra_data, extra_pointers);
+		} else if (zone && zone->IsLoaded()) {
+			_global_merc_quest_status = QuestFailedToLoad;
 		}
 	} else {
 		if (_global_merc_quest_status != QuestFailedToLoad) {
@@ -935,6 +1022,8 @@ QuestInterface* QuestParserCollection::GetQIByNPCQuest(uint32 npc_id, std::strin
 
 	Strings::FindReplace(npc_name, "`", "-");
 
+	_npc_quest_names[npc_id] = npc_name;
+
 	const std::string& global_path = fmt::format(
 		"{}/{}",
 		path.GetQuestsPath(),
@@ -976,7 +1065,7 @@ QuestInterface* QuestParserCollection::GetQIByNPCQuest(uint32 npc_id, std::strin
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1027,7 +1116,7 @@ QuestInterface* QuestParserCollection::GetQIByPlayerQuest(std::string& filename)
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1053,7 +1142,7 @@ QuestInterface* QuestParserCollection::GetQIByGlobalNPCQuest(std::string& filena
 			_extensions.find(e->GetIdentifier())->second
 		);
 
-		if (File::Exists(file_name)) {
+		if (QuestFileExists(file_name)) {
 			filename = file_name;
 			return e;
 		}
@@ -1077,7 +1166,7 @@ QuestInterface* QuestParserCollection::GetQIByGlobalPlayerQuest(std::string& fil
 			_extensions.find(e->GetIdentifier())->second
 		);
 
-		if (File::Exists(file_name)) {
+		if (QuestFileExists(file_name)) {
 			filename = file_name;
 			return e;
 		}
@@ -1128,7 +1217,7 @@ QuestInterface* QuestParserCollection::GetQIBySpellQuest(uint32 spell_id, std::s
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1180,7 +1269,7 @@ QuestInterface* QuestParserCollection::GetQIByItemQuest(std::string item_script,
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1230,7 +1319,7 @@ QuestInterface* QuestParserCollection::GetQIByEncounterQuest(std::string encount
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1281,7 +1370,7 @@ QuestInterface* QuestParserCollection::GetQIByBotQuest(std::string& filename)
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1306,7 +1395,7 @@ QuestInterface* QuestParserCollection::GetQIByGlobalBotQuest(std::string& filena
 			_extensions.find(e->GetIdentifier())->second
 		);
 
-		if (File::Exists(file_name)) {
+		if (QuestFileExists(file_name)) {
 			filename = file_name;
 			return e;
 		}
@@ -1356,7 +1445,7 @@ QuestInterface* QuestParserCollection::GetQIByMercQuest(std::string& filename)
 				_extensions.find(e->GetIdentifier())->second
 			);
 
-			if (File::Exists(file_name)) {
+			if (QuestFileExists(file_name)) {
 				filename = file_name;
 				return e;
 			}
@@ -1381,7 +1470,7 @@ QuestInterface* QuestParserCollection::GetQIByGlobalMercQuest(std::string& filen
 			_extensions.find(e->GetIdentifier())->second
 		);
 
-		if (File::Exists(file_name)) {
+		if (QuestFileExists(file_name)) {
 			filename = file_name;
 			return e;
 		}
@@ -1390,6 +1479,170 @@ QuestInterface* QuestParserCollection::GetQIByGlobalMercQuest(std::string& filen
 	return nullptr;
 }
 
+std::string QuestParserCollection::GetItemScriptName(EQ::ItemInstance* inst)
+{
+	if (inst->GetItem()->ScriptFileID != 0) {
+		return fmt::format(
+			"script_{}",
+			inst->GetItem()->ScriptFileID
+		);
+	} else if (strlen(inst->GetItem()->CharmFile) > 0) {
+		return inst->GetItem()->CharmFile;
+	}
+
+	return std::to_string(inst->GetID());
+}
+
+bool QuestParserCollection::QuestFileExists(const std::string& file_name)
+{
+	if (!_quest_files.IsBuilt()) {
+		_quest_files.Build(
+			{
+				fmt::format("{}/{}", path.GetQuestsPath(), QUEST_GLOBAL_DIRECTORY),
+				fmt::format("{}/{}", path.GetQuestsPath(), zone->GetShortName()),
+				path.GetPluginsPath(),
+				path.GetLuaModulesPath(),
+				path.GetLuaModsPath()
+			},
+			RuleB(HotReload, QuestsWatchFiles)
+		);
+	}
+
+	return _quest_files.Exists(file_name);
+}
+
+void QuestParserCollection::ProcessQuestFileChanges()
+{
+	if (!zone || !_quest_files.IsWatching() || !_quest_files_timer.Check()) {
+		return;
+	}
+
+	std::vector<std::string> changed;
+	if (!_quest_files.Poll(changed)) {
+		zone->SetQuestHotReloadQueued(true);
+		return;
+	}
+
+	for (const auto& f: changed) {
+		ReloadQuestFile(f);
+	}
+}
+
+void QuestParserCollection::ReloadQuestFile(const std::string& file_name)
+{
+	const std::filesystem::path p(file_name);
+
+	const auto extension = p.extension().string();
+	if (extension.size() < 2) {
+		return;
+	}
+
+	const bool is_script = std::any_of(
+		_extensions.begin(),
+		_extensions.end(),
+		[&](const auto& e) { return e.second == extension.substr(1); }
+	);
+
+	if (!is_script) {
+		return;
+	}
+
+	const auto directory = p.parent_path().generic_string();
+	const auto stem      = p.stem().string();
+
+	auto is_under = [&](const std::string& root) {
+		const auto r = std::filesystem::path(root).generic_string();
+		return directory == r || Strings::BeginsWith(directory, r + "/");
+	};
+
+	// plugins and modules are shared by every script, encounters spawn their own entities
+	if (
+		is_under(path.GetPluginsPath()) ||
+		is_under(path.GetLuaModulesPath()) ||
+		is_under(path.GetLuaModsPath()) ||
+		Strings::EndsWith(directory, "/encounters")
+	) {
+		LogHotReload("[{}] changed, queueing a full quest reload", file_name);
+		zone->SetQuestHotReloadQueued(true);
+		return;
+	}
+
+	LogHotReload("[{}] changed, reloading affected scripts", file_name);
+
+	const bool is_default = stem == "default";
+
+	if (Strings::EndsWith(directory, "/spells")) {
+		for (auto it = _spell_quest_status.begin(); it != _spell_quest_status.end();) {
+			if (is_default || std::to_string(it->first) == stem) {
+				UnloadScript(fmt::format("spell_{}", it->first));
+				_spell_quest_subs.erase(it->first);
+				it = _spell_quest_status.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		return;
+	}
+
+	if (Strings::EndsWith(directory, "/items")) {
+		for (auto it = _item_quest_status.begin(); it != _item_quest_status.end();) {
+			if (is_default || _item_quest_scripts[it->first] == stem) {
+				UnloadScript(fmt::format("item_{}", it->first));
+				_item_quest_subs.erase(it->first);
+				it = _item_quest_status.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		return;
+	}
+
+	const std::vector<std::tuple<std::string, uint32*, QuestSubs*>> singletons = {
+		{"global_npc", &_global_npc_quest_status, &_global_npc_quest_subs},
+		{"global_player", &_global_player_quest_status, &_global_player_quest_subs},
+		{"global_bot", &_global_bot_quest_status, &_global_bot_quest_subs},
+		{"global_merc", &_global_merc_quest_status, &_global_merc_quest_subs},
+		{"player", &_player_quest_status, &_player_quest_subs},
+		{"bot", &_bot_quest_status, &_bot_quest_subs},
+		{"merc", &_merc_quest_status, &_merc_quest_subs},
+	};
+
+	for (const auto& [package_name, status, subs]: singletons) {
+		// player_v1 style names are the instance versioned local scripts
+		const bool is_versioned = (
+			Strings::BeginsWith(stem, package_name + "_v") &&
+			Strings::IsNumber(stem.substr(package_name.size() + 2))
+		);
+
+		if (stem == package_name || is_versioned) {
+			UnloadScript(package_name);
+			*status = QuestUnloaded;
+			*subs   = {};
+			return;
+		}
+	}
+
+	for (auto it = _npc_quest_status.begin(); it != _npc_quest_status.end();) {
+		if (is_default || std::to_string(it->first) == stem || _npc_quest_names[it->first] == stem) {
+			UnloadScript(fmt::format("npc_{}", it->first));
+			_npc_quest_subs.erase(it->first);
+			it = _npc_quest_status.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+void QuestParserCollection::UnloadScript(const std::string& package_name)
+{
+	// a new file may resolve to another interface than the one that loaded the old script
+	for (const auto& e: _load_precedence) {
+		e->UnloadScript(package_name);
+	}
+}
+
 void QuestParserCollection::GetErrors(std::list<std::string>& quest_errors)
 {
 	quest_errors.clear();
@@ -1403,7 +1656,7 @@ int QuestParserCollection::DispatchEventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1423,7 +1676,7 @@ int QuestParserCollection::DispatchEventNPC(
 int QuestParserCollection::DispatchEventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1445,7 +1698,7 @@ int QuestParserCollection::DispatchEventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1467,7 +1720,7 @@ int QuestParserCollection::DispatchEventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1488,7 +1741,7 @@ int QuestParserCollection::DispatchEventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1509,7 +1762,7 @@ int QuestParserCollection::DispatchEventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string& data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
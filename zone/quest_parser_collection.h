@@ -33,9 +33,11 @@
 #include "trap.h"
 
 #include "quest_interface.h"
+#include "quest_file_index.h"
 
 #include "zone_config.h"
 
+#include <bitset>
 #include <list>
 #include <map>
 
@@ -72,12 +74,13 @@ public:
 	bool ItemHasQuestSub(EQ::ItemInstance* inst, QuestEventID event_id);
 	bool BotHasQuestSub(QuestEventID event_id);
 	bool MercHasQuestSub(QuestEventID event_id);
+	bool MobHasQuestSub(Mob* e, QuestEventID event_id);
 
 	int EventNPC(
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -85,7 +88,7 @@ public:
 	int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -95,7 +98,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -105,7 +108,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -113,7 +116,7 @@ public:
 	int EventEncounter(
 		QuestEventID event_id,
 		std::string encounter_name,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -122,7 +125,7 @@ public:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers = nullptr
 	);
@@ -131,7 +134,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers = nullptr
 	);
@@ -174,6 +177,9 @@ public:
 
 	void GetErrors(std::list<std::string> &quest_errors);
 
+	// applies quest files changed on disk, called from the zone loop
+	void ProcessQuestFileChanges();
+
 	/*
 		Internally used memory reference for all Perl Event Export Settings
 		Some exports are very taxing on CPU given how much an event is called.
@@ -196,6 +202,33 @@ public:
 	void LoadPerlEventExportSettings(PerlEventExportSettings* s);
 
 private:
+	// which events a loaded script subscribes to, each event is asked of its interface once
+	struct QuestSubs {
+		std::bitset<_LargestEventID> known;
+		std::bitset<_LargestEventID> subscribed;
+
+		template<typename F>
+		bool Has(QuestEventID event_id, F has_sub)
+		{
+			if (event_id >= _LargestEventID) {
+				return false;
+			}
+
+			if (!known.test(event_id)) {
+				known.set(event_id);
+				subscribed.set(event_id, has_sub());
+			}
+
+			return subscribed.test(event_id);
+		}
+	};
+
+	static std::string GetItemScriptName(EQ::ItemInstance* inst);
+
+	bool QuestFileExists(const std::string& file_name);
+	void ReloadQuestFile(const std::string& file_name);
+	void UnloadScript(const std::string& package_name);
+
 	bool HasQuestSubLocal(uint32 npc_id, QuestEventID event_id);
 	bool HasQuestSubGlobal(QuestEventID event_id);
 	bool NPCHasEncounterSub(uint32 npc_id, QuestEventID event_id);
@@ -214,7 +247,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -223,7 +256,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -231,7 +264,7 @@ private:
 	int EventPlayerLocal(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -239,7 +272,7 @@ private:
 	int EventPlayerGlobal(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -248,7 +281,7 @@ private:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -257,7 +290,7 @@ private:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -266,7 +299,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -275,7 +308,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -296,7 +329,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -304,7 +337,7 @@ private:
 	int DispatchEventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -314,7 +347,7 @@ private:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -324,7 +357,7 @@ private:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -333,7 +366,7 @@ private:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -342,7 +375,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string& data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -362,6 +395,26 @@ private:
 	std::map<uint32, uint32>      _spell_quest_status;
 	std::map<uint32, uint32>      _item_quest_status;
 	std::map<std::string, uint32> _encounter_quest_status;
+
+	// reset together with the statuses above, scripts that were not found stay unloaded
+	// (and are looked up again) until the zone has finished loading
+	std::map<uint32, QuestSubs> _npc_quest_subs;
+	QuestSubs                   _global_npc_quest_subs;
+	QuestSubs                   _player_quest_subs;
+	QuestSubs                   _global_player_quest_subs;
+	QuestSubs                   _bot_quest_subs;
+	QuestSubs                   _global_bot_quest_subs;
+	QuestSubs                   _merc_quest_subs;
+	QuestSubs                   _global_merc_quest_subs;
+	std::map<uint32, QuestSubs> _spell_quest_subs;
+	std::map<uint32, QuestSubs> _item_quest_subs;
+
+	// script names the npc and item statuses were resolved from, to match changed files back to them
+	std::map<uint32, std::string> _npc_quest_names;
+	std::map<uint32, std::string> _item_quest_scripts;
+
+	QuestFileIndex _quest_files;
+	Timer          _quest_files_timer;
 };
 
 extern QuestParserCollection *parse;
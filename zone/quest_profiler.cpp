@@ -0,0 +1,280 @@
+#include "quest_profiler.h"
+#include "zone.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/json/json.h"
+#include "../common/path_manager.h"
+#include "../common/rulesys.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WINDOWS
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+extern Zone *zone;
+
+namespace {
+	// distinct sampled stacks kept before new ones are folded into their package
+	constexpr size_t MAX_COLLAPSED_STACKS = 20000;
+
+	const std::string EMPTY_PACKAGE;
+}
+
+QuestProfiler::Scope::Scope(const std::string &package_name, QuestEventID event_id, const char *event_name)
+	: m_event_id(event_id)
+{
+	auto profiler = QuestProfiler::Instance();
+	if (!profiler->IsEnabled()) {
+		return;
+	}
+
+	m_active       = true;
+	m_package_name = package_name;
+	m_event_name   = event_name;
+	m_start        = std::chrono::steady_clock::now();
+
+	profiler->m_scopes.push_back(this);
+}
+
+QuestProfiler::Scope::~Scope()
+{
+	if (!m_active) {
+		return;
+	}
+
+	const auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - m_start
+	).count();
+
+	auto profiler = QuestProfiler::Instance();
+
+	auto &scopes = profiler->m_scopes;
+	if (!scopes.empty() && scopes.back() == this) {
+		scopes.pop_back();
+	}
+	else {
+		scopes.erase(std::remove(scopes.begin(), scopes.end(), this), scopes.end());
+	}
+
+	// turned off while the event ran
+	if (profiler->IsEnabled()) {
+		profiler->Record(*this, static_cast<uint64>(elapsed_us));
+	}
+}
+
+void QuestProfiler::SetEnabled(bool enabled)
+{
+	if (m_enabled == enabled) {
+		return;
+	}
+
+	m_enabled = enabled;
+
+	LogQuests("Quest profiler [{}]", enabled ? "enabled" : "disabled");
+}
+
+void QuestProfiler::SetError()
+{
+	if (!m_scopes.empty()) {
+		m_scopes.back()->m_error = true;
+	}
+}
+
+const std::string &QuestProfiler::GetCurrentPackage() const
+{
+	return m_scopes.empty() ? EMPTY_PACKAGE : m_scopes.back()->m_package_name;
+}
+
+void QuestProfiler::Record(const Scope &s, uint64 elapsed_us)
+{
+	auto &e = m_packages[s.m_package_name][s.m_event_id];
+
+	e.event_name = s.m_event_name;
+	e.stats.count++;
+	e.stats.total_us += elapsed_us;
+	e.stats.max_us = std::max(e.stats.max_us, elapsed_us);
+	e.stats.alloc_bytes += s.m_alloc_bytes;
+
+	if (s.m_error) {
+		e.stats.errors++;
+	}
+}
+
+void QuestProfiler::AddStackSample(const std::vector<std::string> &frames)
+{
+	if (!m_enabled) {
+		return;
+	}
+
+	const std::string &package_name = GetCurrentPackage().empty() ? "[unknown]" : GetCurrentPackage();
+
+	std::string stack = package_name;
+	for (const auto &f: frames) {
+		stack += ';';
+		stack += f;
+	}
+
+	if (m_stacks.size() >= MAX_COLLAPSED_STACKS && m_stacks.find(stack) == m_stacks.end()) {
+		stack = package_name + ";[truncated]";
+	}
+
+	m_stacks[stack]++;
+}
+
+std::vector<QuestProfiler::Entry> QuestProfiler::Snapshot(const std::string &sort, size_t limit) const
+{
+	std::vector<Entry> entries;
+
+	for (const auto &[package_name, events]: m_packages) {
+		for (const auto &[event_id, e]: events) {
+			entries.push_back(
+				Entry{
+					package_name,
+					static_cast<QuestEventID>(event_id),
+					e.event_name ? e.event_name : std::to_string(event_id),
+					e.stats
+				}
+			);
+		}
+	}
+
+	auto key = [&sort](const Stats &s) -> double {
+		if (sort == "count") { return s.count; }
+		if (sort == "max") { return s.max_us; }
+		if (sort == "avg") { return s.count ? static_cast<double>(s.total_us) / s.count : 0; }
+		if (sort == "alloc") { return s.alloc_bytes; }
+		if (sort == "errors") { return s.errors; }
+		return s.total_us;
+	};
+
+	std::sort(
+		entries.begin(), entries.end(), [&key](const Entry &a, const Entry &b) {
+			return key(a.stats) > key(b.stats);
+		}
+	);
+
+	if (limit > 0 && entries.size() > limit) {
+		entries.resize(limit);
+	}
+
+	return entries;
+}
+
+std::string QuestProfiler::GetCollapsedStacks() const
+{
+	std::vector<std::pair<std::string, uint64>> stacks(m_stacks.begin(), m_stacks.end());
+	std::sort(stacks.begin(), stacks.end());
+
+	std::string out;
+	for (const auto &[stack, count]: stacks) {
+		out += fmt::format("{} {}\n", stack, count);
+	}
+
+	return out;
+}
+
+bool QuestProfiler::WriteCollapsedStacks(const std::string &file_name) const
+{
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(file_name).parent_path(), ec);
+
+	std::ofstream f(file_name, std::ios::trunc);
+	if (!f.good()) {
+		LogError("Failed to write quest profile stacks [{}]", file_name);
+		return false;
+	}
+
+	f << GetCollapsedStacks();
+
+	return true;
+}
+
+bool QuestProfiler::WriteSnapshot(const std::string &file_name) const
+{
+	Json::Value root;
+	root["zone"]        = zone ? zone->GetShortName() : "";
+	root["instance_id"] = zone ? zone->GetInstanceID() : 0;
+	root["pid"]         = static_cast<Json::Int64>(getpid());
+	root["updated_at"]  = static_cast<Json::Int64>(std::time(nullptr));
+	root["events"]      = Json::arrayValue;
+	root["stacks"]      = GetCollapsedStacks();
+
+	for (auto &e: Snapshot()) {
+		Json::Value q;
+		q["package"]     = e.package_name;
+		q["event_id"]    = static_cast<int>(e.event_id);
+		q["event"]       = e.event_name;
+		q["count"]       = static_cast<Json::UInt64>(e.stats.count);
+		q["total_us"]    = static_cast<Json::UInt64>(e.stats.total_us);
+		q["max_us"]      = static_cast<Json::UInt64>(e.stats.max_us);
+		q["alloc_bytes"] = static_cast<Json::UInt64>(e.stats.alloc_bytes);
+		q["errors"]      = static_cast<Json::UInt64>(e.stats.errors);
+		root["events"].append(q);
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(std::filesystem::path(file_name).parent_path(), ec);
+
+	const std::string tmp = fmt::format("{}.{}.tmp", file_name, getpid());
+	{
+		std::ofstream f(tmp, std::ios::trunc);
+		if (!f.good()) {
+			LogError("Failed to write quest profile [{}]", tmp);
+			return false;
+		}
+
+		Json::StreamWriterBuilder builder;
+		builder["indentation"] = "";
+		f << Json::writeString(builder, root);
+	}
+
+	std::filesystem::rename(tmp, file_name, ec);
+	if (ec) {
+		LogError("Failed to write quest profile [{}] [{}]", file_name, ec.message());
+		return false;
+	}
+
+	return true;
+}
+
+void QuestProfiler::Reset()
+{
+	m_packages.clear();
+	m_stacks.clear();
+}
+
+void QuestProfiler::Process()
+{
+	SetEnabled(RuleB(Logging, QuestProfiler));
+
+	m_sample_instructions = static_cast<uint32>(std::max(0, RuleI(Logging, QuestProfilerSampleInstructions)));
+
+	const uint32 interval = std::max(0, RuleI(Logging, QuestProfilerSnapshotIntervalS)) * 1000;
+	if (!IsEnabled() || interval == 0 || !zone) {
+		m_snapshot_timer.Disable();
+		return;
+	}
+
+	if (!m_snapshot_timer.Enabled() || m_snapshot_timer.GetDuration() != interval) {
+		m_snapshot_timer.Start(interval);
+		return;
+	}
+
+	if (!m_snapshot_timer.Check()) {
+		return;
+	}
+
+	WriteSnapshot(
+		fmt::format(
+			"{}/quest_profile/{}_{}.json",
+			path.GetLogPath(),
+			zone->GetShortName(),
+			zone->GetInstanceID()
+		)
+	);
+}
@@ -0,0 +1,122 @@
+#ifndef EQEMU_QUEST_PROFILER_H
+#define EQEMU_QUEST_PROFILER_H
+
+#include "../common/timer.h"
+#include "../common/types.h"
+#include "event_codes.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Aggregates quest event dispatches by package (npc_12345, global_npc, encounter_x...) and event
+ *
+ * The Lua and Perl parsers open a Scope around every event they run while the profiler is
+ * enabled (Logging:QuestProfiler), recording wall time, errors and, for Lua, heap growth.
+ * Lua call stacks can additionally be sampled every Logging:QuestProfilerSampleInstructions
+ * instructions into the collapsed format flamegraph tooling reads
+ *
+ * Every Logging:QuestProfilerSnapshotIntervalS the zone writes its profile to
+ * logs/quest_profile/<zone>_<instance>.json, which is what the sidecar reads since it runs in
+ * its own process
+ *
+ * Quests only run on the zone thread, the profiler is not synchronized
+ */
+class QuestProfiler {
+public:
+	struct Stats {
+		uint64 count       = 0;
+		uint64 total_us    = 0;
+		uint64 max_us      = 0;
+		uint64 alloc_bytes = 0;
+		uint64 errors      = 0;
+	};
+
+	struct Entry {
+		std::string  package_name;
+		QuestEventID event_id;
+		std::string  event_name;
+		Stats        stats;
+	};
+
+	// times one event in one package, nested events (a quest signalling another) get their own scope
+	class Scope {
+	public:
+		Scope(const std::string &package_name, QuestEventID event_id, const char *event_name);
+		~Scope();
+
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+
+		bool IsActive() const { return m_active; }
+		void SetAllocBytes(uint64 bytes) { m_alloc_bytes = bytes; }
+
+	private:
+		friend class QuestProfiler;
+
+		bool                                  m_active       = false;
+		bool                                  m_error        = false;
+		uint64                                m_alloc_bytes  = 0;
+		std::string                           m_package_name;
+		QuestEventID                          m_event_id;
+		const char                           *m_event_name   = nullptr;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+	static QuestProfiler *Instance()
+	{
+		static QuestProfiler instance;
+		return &instance;
+	}
+
+	bool IsEnabled() const { return m_enabled; }
+	void SetEnabled(bool enabled);
+
+	// 0 when the profiler or stack sampling is off
+	uint32 GetSampleInstructions() const { return m_enabled ? m_sample_instructions : 0; }
+
+	// flags the innermost running event as failed, parsers call this where they report script errors
+	void SetError();
+
+	// package of the innermost running event, empty outside of quests
+	const std::string &GetCurrentPackage() const;
+
+	// frames outermost first, the current package is prepended
+	void AddStackSample(const std::vector<std::string> &frames);
+
+	// sort is one of total, count, max, avg, alloc or errors, limit 0 returns everything
+	std::vector<Entry> Snapshot(const std::string &sort = "total", size_t limit = 0) const;
+
+	// one "package;frame;frame count" line per sampled stack
+	std::string GetCollapsedStacks() const;
+	bool WriteCollapsedStacks(const std::string &file_name) const;
+
+	// events and collapsed stacks as json, written then renamed so readers never see a partial file
+	bool WriteSnapshot(const std::string &file_name) const;
+
+	void Reset();
+
+	// called from the zone main loop, applies the rules and writes the periodic snapshot
+	void Process();
+
+private:
+	QuestProfiler() = default;
+
+	void Record(const Scope &s, uint64 elapsed_us);
+
+	struct EventStats {
+		const char *event_name = nullptr;
+		Stats       stats;
+	};
+
+	bool                                                                 m_enabled             = false;
+	uint32                                                               m_sample_instructions = 0;
+	std::vector<Scope *>                                                 m_scopes;
+	std::unordered_map<std::string, std::unordered_map<int, EventStats>> m_packages;
+	std::unordered_map<std::string, uint64>                              m_stacks;
+	Timer                                                                m_snapshot_timer;
+};
+
+#endif //EQEMU_QUEST_PROFILER_H
@@ -84,43 +84,46 @@ QuestManager::~QuestManager() {
 }
 
 void QuestManager::Process() {
-	std::list<QuestTimer>::iterator cur = QTimerList.begin(), end;
-
-	end = QTimerList.end();
-	while (cur != end) {
-		if (cur->Timer_.Enabled() && cur->Timer_.Check()) {
-			if (cur->mob) {
-				if (cur->mob->IsEncounter()) {
-					parse->EventEncounter(EVENT_TIMER, cur->mob->CastToEncounter()->GetEncounterName(), cur->name, 0, nullptr);
-				} else {
-					parse->EventMob(EVENT_TIMER, cur->mob, nullptr, [&]() { return cur->name; }, 0);
-				}
+	const uint64 now = GetTimerClock();
 
-				//we MUST reset our iterator since the quest could have removed/added any
-				//number of timers... worst case we have to check a bunch of timers twice
-				cur = QTimerList.begin();
-				end = QTimerList.end();    //dunno if this is needed, cant hurt...
-			}
-			else {
-				cur = QTimerList.erase(cur);
-			}
+	// take everything that is due up front, timers set while dispatching wait for the next tick
+	std::vector<ScheduledTimer> due;
+	while (!QTimerQueue.empty() && QTimerQueue.top().due <= now) {
+		due.push_back(QTimerQueue.top());
+		QTimerQueue.pop();
+	}
+
+	for (const auto& e : due) {
+		auto t = FindTimer(e.mob, e.name);
+		if (!t || t->generation != e.generation) {
+			continue;
 		}
-		else {
-			++cur;
+
+		const bool fired = t->Timer_.Check();
+
+		// reschedule before dispatching, the quest may stop or restart this timer (or any other)
+		ScheduleTimer(*t);
+
+		if (!fired) {
+			continue;
 		}
-	}
 
-	auto cur_iter = STimerList.begin();
-	while(cur_iter != STimerList.end()) {
-		if(!cur_iter->Timer_.Enabled()) {
-			cur_iter = STimerList.erase(cur_iter);
-		} else if(cur_iter->Timer_.Check()) {
-			entity_list.SignalMobsByNPCID(cur_iter->npc_id, cur_iter->signal_id);
-			cur_iter = STimerList.erase(cur_iter);
+		if (e.mob->IsEncounter()) {
+			parse->EventEncounter(EVENT_TIMER, e.mob->CastToEncounter()->GetEncounterName(), e.name, 0, nullptr);
 		} else {
-			++cur_iter;
+			parse->EventMob(EVENT_TIMER, e.mob, nullptr, [&]() { return e.name; }, 0);
 		}
 	}
+
+	std::vector<ScheduledSignal> signals;
+	while (!STimerQueue.empty() && STimerQueue.top().due <= now) {
+		signals.push_back(STimerQueue.top());
+		STimerQueue.pop();
+	}
+
+	for (const auto& e : signals) {
+		entity_list.SignalMobsByNPCID(e.npc_id, e.signal_id);
+	}
 }
 
 void QuestManager::StartQuest(Mob *_owner, Client *_initiator, EQ::ItemInstance* _questitem, const SPDat_Spell_Struct* _questspell, std::string encounter) {
@@ -138,41 +141,123 @@ void QuestManager::EndQuest() {
 	running_quest run = quests_running_.top();
 	if(run.depop_npc && run.owner->IsNPC()) {
 		//clear out any timers for them...
-		std::list<QuestTimer>::iterator cur = QTimerList.begin(), end;
-
-		end = QTimerList.end();
-		while (cur != end) {
-			if (cur->mob == run.owner)
-				cur = QTimerList.erase(cur);
-			else
-				++cur;
-		}
+		RemoveTimers(run.owner);
 		run.owner->Depop();
 	}
 	quests_running_.pop();
 }
 
 void QuestManager::ClearAllTimers() {
-	QTimerList.clear();
+	QTimers.clear();
+	QTimerQueue = {};
+	timer_count = 0;
 }
 
 void QuestManager::StopNPCTimers() {
-
-	std::list<QuestTimer>::iterator cur = QTimerList.begin(), end;
-
-	end = QTimerList.end();
-	while (cur != end) {
-		if (cur->mob && (cur->mob->IsClient() || cur->mob->IsPetOwnerClient())) {
-			++cur;
+	for (auto it = QTimers.begin(); it != QTimers.end();) {
+		if (it->first && (it->first->IsClient() || it->first->IsPetOwnerClient())) {
+			++it;
 			continue;
 		}
-		else {
-			cur = QTimerList.erase(cur);
+
+		timer_count -= it->second.size();
+		it = QTimers.erase(it);
+	}
+}
+
+uint64 QuestManager::GetTimerClock()
+{
+	// Timer::GetCurrentTime() wraps around, due times are kept on a clock that doesn't
+	const uint32 now = Timer::GetCurrentTime();
+	timer_clock += static_cast<uint32>(now - timer_clock_last);
+	timer_clock_last = now;
+
+	return timer_clock;
+}
+
+QuestManager::QuestTimer* QuestManager::FindTimer(Mob* mob, const std::string& timer_name)
+{
+	auto m = QTimers.find(mob);
+	if (m == QTimers.end()) {
+		return nullptr;
+	}
+
+	auto t = m->second.find(timer_name);
+
+	return t != m->second.end() ? &t->second : nullptr;
+}
+
+QuestManager::QuestTimer& QuestManager::StartTimer(Mob* mob, const std::string& timer_name, uint32 milliseconds)
+{
+	auto& timers = QTimers[mob];
+
+	auto t = timers.find(timer_name);
+	if (t == timers.end()) {
+		t = timers.emplace(timer_name, QuestTimer(milliseconds, mob, timer_name)).first;
+		timer_count++;
+	} else {
+		t->second.Timer_.Start(milliseconds, false);
+	}
+
+	ScheduleTimer(t->second);
+
+	return t->second;
+}
+
+void QuestManager::ScheduleTimer(QuestTimer& t)
+{
+	// any entry already queued for this timer is stale from here on
+	t.generation = ++timer_generation;
+
+	if (!t.Timer_.Enabled()) {
+		return;
+	}
+
+	// Timer::Check() fires once strictly more than the duration has elapsed
+	QTimerQueue.push(ScheduledTimer{GetTimerClock() + t.Timer_.GetRemainingTime() + 1, t.generation, t.mob, t.name});
+
+	// scripts that keep restarting long timers leave stale entries behind, rebuild once they dominate
+	if (QTimerQueue.size() > 64 && QTimerQueue.size() > timer_count * 4) {
+		QTimerQueue = {};
+
+		const uint64 now = GetTimerClock();
+		for (auto& [mob, timers] : QTimers) {
+			for (auto& [name, e] : timers) {
+				if (e.Timer_.Enabled()) {
+					QTimerQueue.push(ScheduledTimer{now + e.Timer_.GetRemainingTime() + 1, e.generation, e.mob, e.name});
+				}
+			}
 		}
-		++cur;
 	}
 }
 
+bool QuestManager::RemoveTimer(Mob* mob, const std::string& timer_name)
+{
+	auto m = QTimers.find(mob);
+	if (m == QTimers.end() || !m->second.erase(timer_name)) {
+		return false;
+	}
+
+	timer_count--;
+
+	if (m->second.empty()) {
+		QTimers.erase(m);
+	}
+
+	return true;
+}
+
+void QuestManager::RemoveTimers(Mob* mob)
+{
+	auto m = QTimers.find(mob);
+	if (m == QTimers.end()) {
+		return;
+	}
+
+	timer_count -= m->second.size();
+	QTimers.erase(m);
+}
+
 //quest perl functions
 void QuestManager::echo(int colour, const char *str) {
 	QuestManagerCurrentQuestVars();
@@ -544,19 +629,7 @@ void QuestManager::settimer(const std::string& timer_name, uint32 seconds, Mob*
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == mob && e.name == timer_name) {
-				e.Timer_.Start(seconds * 1000, false);
-
-				parse->EventMob(EVENT_TIMER_START, mob, nullptr, f);
-
-				return;
-			}
-		}
-	}
-
-	QTimerList.emplace_back(QuestTimer(seconds * 1000, mob, timer_name));
+	StartTimer(mob, timer_name, seconds * 1000);
 
 	parse->EventMob(EVENT_TIMER_START, mob, nullptr, f);
 }
@@ -593,19 +666,7 @@ void QuestManager::settimerMS(const std::string& timer_name, uint32 milliseconds
 		return;
 	}
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == owner && e.name == timer_name) {
-				e.Timer_.Start(milliseconds, false);
-
-				parse->EventMob(EVENT_TIMER_START, owner, nullptr, f);
-
-				return;
-			}
-		}
-	}
-
-	QTimerList.emplace_back(QuestTimer(milliseconds, owner, timer_name));
+	StartTimer(owner, timer_name, milliseconds);
 
 	parse->EventMob(EVENT_TIMER_START, owner, nullptr, f);
 }
@@ -631,19 +692,7 @@ void QuestManager::settimerMS(const std::string& timer_name, uint32 milliseconds
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto& e : QTimerList) {
-			if (e.mob && e.mob == m && e.name == timer_name) {
-				e.Timer_.Start(milliseconds, false);
-
-				parse->EventMob(EVENT_TIMER_START, m, nullptr, f);
-
-				return;
-			}
-		}
-	}
-
-	QTimerList.emplace_back(QuestTimer(milliseconds, m, timer_name));
+	StartTimer(m, timer_name, milliseconds);
 
 	parse->EventMob(EVENT_TIMER_START, m, nullptr, f);
 }
@@ -666,17 +715,8 @@ void QuestManager::stoptimer(const std::string& timer_name)
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
-
-	for (auto e = QTimerList.begin(); e != QTimerList.end(); ++e) {
-		if (e->mob && e->mob == owner && e->name == timer_name) {
-			parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return timer_name; });
-
-			QTimerList.erase(e);
-			break;
-		}
+	if (RemoveTimer(owner, timer_name)) {
+		parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return timer_name; });
 	}
 }
 
@@ -693,17 +733,8 @@ void QuestManager::stoptimer(const std::string& timer_name, Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
-		return;
-	}
-
-	for (auto e = QTimerList.begin(); e != QTimerList.end();) {
-		if (e->mob && e->mob == m) {
-			parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return timer_name; });
-
-			QTimerList.erase(e);
-			break;
-		}
+	if (RemoveTimer(m, timer_name)) {
+		parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return timer_name; });
 	}
 }
 
@@ -734,18 +765,21 @@ void QuestManager::stopalltimers()
 		return;
 	}
 
-	if (QTimerList.empty()) {
+	auto timers = QTimers.find(owner);
+	if (timers == QTimers.end()) {
 		return;
 	}
 
-	for (auto e = QTimerList.begin(); e != QTimerList.end();) {
-		if (e->mob && e->mob == owner) {
-			parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return e->name; });
+	std::vector<std::string> names;
+	names.reserve(timers->second.size());
+	for (const auto& e : timers->second) {
+		names.push_back(e.first);
+	}
 
-			e = QTimerList.erase(e);
-		} else {
-			++e;
-		}
+	RemoveTimers(owner);
+
+	for (const auto& name : names) {
+		parse->EventMob(EVENT_TIMER_STOP, owner, nullptr, [&]() { return name; });
 	}
 }
 
@@ -776,18 +810,21 @@ void QuestManager::stopalltimers(Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
+	auto timers = QTimers.find(m);
+	if (timers == QTimers.end()) {
 		return;
 	}
 
-	for (auto e = QTimerList.begin(); e != QTimerList.end();) {
-		if (e->mob && e->mob == m) {
-			parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return e->name; });
+	std::vector<std::string> names;
+	names.reserve(timers->second.size());
+	for (const auto& e : timers->second) {
+		names.push_back(e.first);
+	}
 
-			e = QTimerList.erase(e);
-		} else {
-			++e;
-		}
+	RemoveTimers(m);
+
+	for (const auto& name : names) {
+		parse->EventMob(EVENT_TIMER_STOP, m, nullptr, [&]() { return name; });
 	}
 }
 
@@ -805,7 +842,7 @@ void QuestManager::pausetimer(const std::string& timer_name, Mob* m)
 		return;
 	}
 
-	if (QTimerList.empty()) {
+	if (QTimers.empty()) {
 		return;
 	}
 
@@ -818,14 +855,9 @@ void QuestManager::pausetimer(const std::string& timer_name, Mob* m)
 
 	uint32 milliseconds = 0;
 
-	if (!QTimerList.empty()) {
-		for (auto e = QTimerList.begin(); e != QTimerList.end(); ++e) {
-			if (e->mob && e->mob == mob && e->name == timer_name) {
-				milliseconds = e->Timer_.GetRemainingTime();
-				QTimerList.erase(e);
-				break;
-			}
-		}
+	if (auto t = FindTimer(mob, timer_name)) {
+		milliseconds = t->Timer_.GetRemainingTime();
+		RemoveTimer(mob, timer_name);
 	}
 
 	PTimerList.emplace_back(
@@ -888,26 +920,21 @@ void QuestManager::resumetimer(const std::string& timer_name, Mob* m)
 		);
 	};
 
-	if (!QTimerList.empty()) {
-		for (auto e : QTimerList) {
-			if (e.mob && e.mob == mob && e.name == timer_name) {
-				e.Timer_.Enable();
-				e.Timer_.Start(milliseconds, false);
-				LogQuests(
-					"Resuming timer [{}] for [{}] with [{}] ms remaining",
-					timer_name,
-					owner->GetName(),
-					milliseconds
-				);
+	if (FindTimer(mob, timer_name)) {
+		StartTimer(mob, timer_name, milliseconds);
+		LogQuests(
+			"Resuming timer [{}] for [{}] with [{}] ms remaining",
+			timer_name,
+			owner->GetName(),
+			milliseconds
+		);
 
-				parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
+		parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
 
-				return;
-			}
-		}
+		return;
 	}
 
-	QTimerList.emplace_back(QuestTimer(milliseconds, m, timer_name));
+	StartTimer(mob, timer_name, milliseconds);
 
 	parse->EventMob(EVENT_TIMER_RESUME, mob, nullptr, f);
 
@@ -959,15 +986,7 @@ bool QuestManager::hastimer(const std::string& timer_name, Mob* m)
 		return false;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
-
-	return e != QTimerList.end();
+	return FindTimer(mob, timer_name) != nullptr;
 }
 
 uint32 QuestManager::getremainingtimeMS(const std::string& timer_name, Mob* m)
@@ -984,15 +1003,9 @@ uint32 QuestManager::getremainingtimeMS(const std::string& timer_name, Mob* m)
 		return 0;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
+	const auto e = FindTimer(mob, timer_name);
 
-	return e != QTimerList.end() ? e->Timer_.GetRemainingTime() : 0;
+	return e ? e->Timer_.GetRemainingTime() : 0;
 }
 
 uint32 QuestManager::gettimerdurationMS(const std::string& timer_name, Mob* m)
@@ -1009,15 +1022,9 @@ uint32 QuestManager::gettimerdurationMS(const std::string& timer_name, Mob* m)
 		return 0;
 	}
 
-	const auto& e = std::find_if(
-		QTimerList.begin(),
-		QTimerList.end(),
-		[&timer_name, &mob](QuestTimer e) {
-			return e.mob && e.mob == mob && e.name == timer_name;
-		}
-	);
+	const auto e = FindTimer(mob, timer_name);
 
-	return e != QTimerList.end() ? e->Timer_.GetDuration() : 0;
+	return e ? e->Timer_.GetDuration() : 0;
 }
 
 void QuestManager::emote(const char *str) {
@@ -1738,13 +1745,15 @@ void QuestManager::itemlink(int item_id) {
 }
 
 void QuestManager::signalwith(int npc_id, int signal_id, int wait_ms) {
-	if(wait_ms > 0) {
-		STimerList.emplace_back(SignalTimer(wait_ms, npc_id, signal_id));
-		return;
-	} else {
-		STimerList.emplace_back(SignalTimer(0, npc_id, signal_id));
-		return;
-	}
+	// delivered on the first tick after wait_ms has elapsed, in the order they were sent
+	STimerQueue.push(
+		ScheduledSignal{
+			GetTimerClock() + std::max(wait_ms, 0) + 1,
+			++signal_sequence,
+			npc_id,
+			signal_id
+		}
+	);
 }
 
 void QuestManager::signal(int npc_id, int wait_ms) {
@@ -22,7 +22,9 @@
 #include "tasks.h"
 
 #include <list>
+#include <queue>
 #include <stack>
+#include <unordered_map>
 
 class Client;
 class Mob;
@@ -394,16 +396,52 @@ private:
 		Mob*   mob;
 		std::string name;
 		Timer Timer_;
+		uint64 generation = 0;
 	};
-	class SignalTimer {
-	public:
-		inline SignalTimer(int duration, int _npc_id, int _signal_id) : npc_id(_npc_id), signal_id(_signal_id), Timer_(duration) { Timer_.Start(duration, false); }
-		int npc_id;
-		int signal_id;
-		Timer Timer_;
+
+	// queue entries are only a schedule, an entry whose generation no longer matches
+	// its timer was stopped or restarted since it was pushed and is dropped when popped
+	struct ScheduledTimer {
+		uint64      due;
+		uint64      generation;
+		Mob*        mob;
+		std::string name;
+
+		bool operator>(const ScheduledTimer& o) const
+		{
+			return due != o.due ? due > o.due : generation > o.generation;
+		}
 	};
-	std::list<QuestTimer>	QTimerList;
-	std::list<SignalTimer>	STimerList;
+
+	struct ScheduledSignal {
+		uint64 due;
+		uint64 sequence;
+		int    npc_id;
+		int    signal_id;
+
+		bool operator>(const ScheduledSignal& o) const
+		{
+			return due != o.due ? due > o.due : sequence > o.sequence;
+		}
+	};
+
+	uint64 GetTimerClock();
+	QuestTimer* FindTimer(Mob* mob, const std::string& timer_name);
+	QuestTimer& StartTimer(Mob* mob, const std::string& timer_name, uint32 milliseconds);
+	void ScheduleTimer(QuestTimer& t);
+	bool RemoveTimer(Mob* mob, const std::string& timer_name);
+	void RemoveTimers(Mob* mob);
+
+	// timers by mob then name, QTimerQueue orders them by due time
+	std::unordered_map<Mob*, std::unordered_map<std::string, QuestTimer>> QTimers;
+	std::priority_queue<ScheduledTimer, std::vector<ScheduledTimer>, std::greater<>> QTimerQueue;
+	std::priority_queue<ScheduledSignal, std::vector<ScheduledSignal>, std::greater<>> STimerQueue;
+
+	size_t timer_count      = 0;
+	uint64 timer_generation = 0;
+	uint64 signal_sequence  = 0;
+	uint64 timer_clock      = 0;
+	uint32 timer_clock_last = 0;
 	std::list<PausedTimer>	PTimerList;
 };
 
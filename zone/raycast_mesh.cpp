@@ -1,6 +1,9 @@
 #include "raycast_mesh.h"
 #include "../common/memory/ksm.hpp"
 #include "../common/eqemu_logsys.h"
+#ifdef USE_MAP_MMFS
+#include "../common/read_only_mapped_file.h"
+#endif /*USE_MAP_MMFS*/
 #include <math.h>
 #include <assert.h>
 #include <stdlib.h>
@@ -950,8 +953,7 @@ public:
 	TriVector		mLeafTriangles;
 
 #ifdef USE_MAP_MMFS
-	MyRaycastMesh(std::vector<char>& rm_buffer);
-	void serialize(std::vector<char>& rm_buffer);
+	void bake(std::vector<char>& buffer);
 #endif /*USE_MAP_MMFS*/
 };
 
@@ -999,252 +1001,354 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 }
 
 #ifdef USE_MAP_MMFS
-RaycastMesh* loadRaycastMesh(std::vector<char>& rm_buffer, bool& load_success)
+namespace RAYCAST_MESH
 {
-	if (rm_buffer.empty())
-		return nullptr;
 
-	auto m = new MyRaycastMesh(rm_buffer);
-	load_success = (m->mNodes != nullptr);
+#define MAPPED_MESH_MAGIC "EQBVHMAP"
+#define MAPPED_MESH_VERSION 1
+#define MAPPED_MESH_ALIGNMENT 64
 
-	return static_cast<RaycastMesh*>(m);
-}
+// Every field is fixed width and every reference is an index, so the image is valid wherever it is mapped.
+struct MappedMeshHeader
+{
+	char		mMagic[8];
+	RmUint32	mVersion;
+	RmUint32	mHeaderSize;
+	RmUint32	mNodeSize;
+	RmUint32	mVcount;
+	RmUint32	mTcount;
+	RmUint32	mNodeCount;
+	RmUint32	mLeafCount;
+	RmUint32	mReserved;
+	uint64_t	mVerticesOffset;
+	uint64_t	mIndicesOffset;
+	uint64_t	mNormalsOffset;
+	uint64_t	mNodesOffset;
+	uint64_t	mLeavesOffset;
+	uint64_t	mFileSize;
+};
 
-void serializeRaycastMesh(RaycastMesh* rm, std::vector<char>& rm_buffer)
+struct MappedMeshNode
 {
-	if (!rm) {
-		rm_buffer.clear();
-		return;
-	}
+	RmReal		mMin[3];
+	RmReal		mMax[3];
+	RmUint32	mLeafTriangleIndex;
+	RmUint32	mLeft;		// node index or TRI_EOF
+	RmUint32	mRight;		// node index or TRI_EOF
+};
 
-	static_cast<MyRaycastMesh*>(rm)->serialize(rm_buffer);
+static uint64_t alignMappedOffset(uint64_t offset)
+{
+	return (offset + (MAPPED_MESH_ALIGNMENT - 1)) & ~(uint64_t)(MAPPED_MESH_ALIGNMENT - 1);
 }
 
-MyRaycastMesh::MyRaycastMesh(std::vector<char>& rm_buffer)
+static bool mappedSectionFits(uint64_t offset, uint64_t size, uint64_t file_size)
 {
-	mVcount = 0;
-	mVertices = nullptr;
-	mTcount = 0;
-	mIndices = nullptr;
-	mRaycastTriangles = nullptr;
-	mFaceNormals = nullptr;
-	mRaycastFrame = 0;
-	mMaxNodeCount = 0;
-	mNodeCount = 0;
-	mNodes = nullptr;
-	mRoot = nullptr;
-
-	size_t chunk_size = 0;
-	size_t bytes_read = 0;
-	size_t rm_buffer_size_ = rm_buffer.size();
-	if (!rm_buffer_size_)
-		return;
+	return (offset % sizeof(RmUint32)) == 0 && offset <= file_size && size <= file_size - offset;
+}
 
-	char* buf = rm_buffer.data();
-
-	chunk_size = sizeof(RmUint32);
-	memcpy(&mVcount, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = (sizeof(RmReal) * (3 * mVcount));
-	mVertices = (RmReal *)::malloc(chunk_size);
-	memcpy(mVertices, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = sizeof(RmUint32);
-	memcpy(&mTcount, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = (sizeof(RmUint32) * (3 * mTcount));
-	mIndices = (RmUint32 *)::malloc(chunk_size);
-	memcpy(mIndices, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = (sizeof(RmUint32) * mTcount);
-	mRaycastTriangles = (RmUint32 *)::malloc(chunk_size);
-	memcpy(mRaycastTriangles, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = (sizeof(RmReal) * (3 * mTcount));
-	mFaceNormals = (RmReal *)::malloc(chunk_size);
-	memcpy(mFaceNormals, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	chunk_size = sizeof(RmUint32);
-	memcpy(&mRaycastFrame, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	RmUint32 lt_size;
-	chunk_size = sizeof(RmUint32);
-	memcpy(&lt_size, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
-
-	if (lt_size) {
-		mLeafTriangles.resize(lt_size);
-		chunk_size = (sizeof(RmUint32) * lt_size);
-		memcpy(&mLeafTriangles[0], buf, chunk_size);
-		buf += chunk_size;
-		bytes_read += chunk_size;
-	}
+class MappedRaycastMesh : public RaycastMesh
+{
+public:
+	MappedRaycastMesh(std::unique_ptr<EQ::ReadOnlyMappedFile> file) : mFile(std::move(file))
+	{
+		mRaycastFrame = 0;
 
-	chunk_size = sizeof(RmUint32);
-	memcpy(&mNodeCount, buf, chunk_size);
-	buf += chunk_size;
-	bytes_read += chunk_size;
+		auto data = mFile->Data();
+		auto header = reinterpret_cast<const MappedMeshHeader *>(data);
 
-	mMaxNodeCount = mNodeCount;
+		mTcount = header->mTcount;
+		mVertices = reinterpret_cast<const RmReal *>(data + header->mVerticesOffset);
+		mIndices = reinterpret_cast<const RmUint32 *>(data + header->mIndicesOffset);
+		mFaceNormals = reinterpret_cast<const RmReal *>(data + header->mNormalsOffset);
+		mNodes = reinterpret_cast<const MappedMeshNode *>(data + header->mNodesOffset);
+		mLeafTriangles = reinterpret_cast<const RmUint32 *>(data + header->mLeavesOffset);
 
-	mNodes = new NodeAABB[mMaxNodeCount];
-	mRoot = &mNodes[0];
+		// the only per process state; everything else stays in the shared mapping
+		mRaycastTriangles.assign(mTcount, 0);
+	}
 
-	for (RmUint32 index = 0; index < mNodeCount; ++index) {
-		chunk_size = (sizeof(RmReal) * 3);
-		memcpy(&mNodes[index].mBounds.mMin, buf, chunk_size);
-		buf += chunk_size;
-		bytes_read += chunk_size;
-
-		chunk_size = (sizeof(RmReal) * 3);
-		memcpy(&mNodes[index].mBounds.mMax, buf, chunk_size);
-		buf += chunk_size;
-		bytes_read += chunk_size;
-
-		chunk_size = sizeof(RmUint32);
-		memcpy(&mNodes[index].mLeafTriangleIndex, buf, chunk_size);
-		buf += chunk_size;
-		bytes_read += chunk_size;
-
-		RmUint32 lNodeIndex;
-		chunk_size = sizeof(RmUint32);
-		memcpy(&lNodeIndex, buf, chunk_size);
-		if (lNodeIndex != TRI_EOF)
-			mNodes[index].mLeft = &mNodes[lNodeIndex];
-		buf += chunk_size;
-		bytes_read += chunk_size;
-
-		RmUint32 rNodeIndex;
-		chunk_size = sizeof(RmUint32);
-		memcpy(&rNodeIndex, buf, chunk_size);
-		if (rNodeIndex != TRI_EOF)
-			mNodes[index].mRight = &mNodes[rNodeIndex];
-		buf += chunk_size;
-		bytes_read += chunk_size;
+	virtual bool raycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
+	{
+		bool ret = false;
+
+		RmReal dir[3];
+		dir[0] = to[0] - from[0];
+		dir[1] = to[1] - from[1];
+		dir[2] = to[2] - from[2];
+		RmReal distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+		if ( distance < 0.0000000001f ) return false;
+		RmReal recipDistance = 1.0f / distance;
+		dir[0]*=recipDistance;
+		dir[1]*=recipDistance;
+		dir[2]*=recipDistance;
+		mRaycastFrame++;
+		RmUint32 nearestTriIndex=TRI_EOF;
+		raycastNode(0,ret,from,dir,hitLocation,hitNormal,hitDistance,distance,nearestTriIndex);
+		return ret;
 	}
 
-	if (bytes_read != rm_buffer_size_) {
-		delete[] mNodes;
-		::free(mVertices);
-		::free(mIndices);
-		::free(mFaceNormals);
-		::free(mRaycastTriangles);
-
-		mVcount = 0;
-		mVertices = nullptr;
-		mTcount = 0;
-		mIndices = nullptr;
-		mRaycastTriangles = nullptr;
-		mFaceNormals = nullptr;
-		mRaycastFrame = 0;
-		mLeafTriangles.clear();
-		mMaxNodeCount = 0;
-		mNodeCount = 0;
-		mNodes = nullptr;
-		mRoot = nullptr;
+	virtual bool bruteForceRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
+	{
+		bool ret = false;
+
+		RmReal dir[3];
+		dir[0] = to[0] - from[0];
+		dir[1] = to[1] - from[1];
+		dir[2] = to[2] - from[2];
+		RmReal distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+		if ( distance < 0.0000000001f ) return false;
+		RmReal recipDistance = 1.0f / distance;
+		dir[0]*=recipDistance;
+		dir[1]*=recipDistance;
+		dir[2]*=recipDistance;
+		RmReal nearestDistance = distance;
+
+		for (RmUint32 tri=0; tri<mTcount; tri++)
+		{
+			RmReal t;
+			if ( intersectTriangle(tri,from,dir,t) && t < nearestDistance )
+			{
+				nearestDistance = t;
+				reportHit(tri,t,from,dir,hitLocation,hitNormal,hitDistance);
+				ret = true;
+			}
+		}
+		return ret;
 	}
-}
 
-void MyRaycastMesh::serialize(std::vector<char>& rm_buffer)
-{
-	rm_buffer.clear();
+	virtual const RmReal * getBoundMin(void) const
+	{
+		return mNodes[0].mMin;
+	}
 
-	size_t rm_buffer_size_ = 0;
+	virtual const RmReal * getBoundMax(void) const
+	{
+		return mNodes[0].mMax;
+	}
 
-	rm_buffer_size_ += sizeof(RmUint32); // mVcount
-	rm_buffer_size_ += (sizeof(RmReal) * (3 * mVcount)); // mVertices
-	rm_buffer_size_ += sizeof(RmUint32); // mTcount
-	rm_buffer_size_ += (sizeof(RmUint32) * (3 * mTcount)); // mIndices
-	rm_buffer_size_ += (sizeof(RmUint32) * mTcount); // mRaycastTriangles
-	rm_buffer_size_ += (sizeof(RmReal) * (3 * mTcount)); // mFaceNormals
-	rm_buffer_size_ += sizeof(RmUint32); // mRaycastFrame
-	rm_buffer_size_ += sizeof(RmUint32); // mLeafTriangles.size()
-	rm_buffer_size_ += (sizeof(RmUint32) * (RmUint32)mLeafTriangles.size()); // mLeafTriangles
-	rm_buffer_size_ += sizeof(RmUint32); // mNodeCount
-	rm_buffer_size_ += (sizeof(RmReal) * (3 * mNodeCount)); // mNodes.mBounds.mMin
-	rm_buffer_size_ += (sizeof(RmReal) * (3 * mNodeCount)); // mNodes.mBounds.mMax
-	rm_buffer_size_ += (sizeof(RmUint32) * mNodeCount); // mNodes.mLeafTriangleIndex
-	rm_buffer_size_ += (sizeof(RmUint32) * mNodeCount); // mNodes.mLeft[Index]
-	rm_buffer_size_ += (sizeof(RmUint32) * mNodeCount); // mNodes.mRight[Index]
+	virtual void release(void)
+	{
+		delete this;
+	}
 
-	rm_buffer.resize(rm_buffer_size_);
+private:
+	bool intersectTriangle(RmUint32 tri,const RmReal *from,const RmReal *dir,RmReal &t) const
+	{
+		const RmReal *p1 = &mVertices[mIndices[tri*3+0]*3];
+		const RmReal *p2 = &mVertices[mIndices[tri*3+1]*3];
+		const RmReal *p3 = &mVertices[mIndices[tri*3+2]*3];
+		return rayIntersectsTriangle(from,dir,p1,p2,p3,t);
+	}
 
-	char* buf = rm_buffer.data();
+	void reportHit(RmUint32 tri,RmReal t,const RmReal *from,const RmReal *dir,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) const
+	{
+		if ( hitLocation )
+		{
+			hitLocation[0] = from[0]+dir[0]*t;
+			hitLocation[1] = from[1]+dir[1]*t;
+			hitLocation[2] = from[2]+dir[2]*t;
+		}
+		if ( hitNormal )
+		{
+			hitNormal[0] = mFaceNormals[tri*3+0];
+			hitNormal[1] = mFaceNormals[tri*3+1];
+			hitNormal[2] = mFaceNormals[tri*3+2];
+		}
+		if ( hitDistance )
+		{
+			*hitDistance = t;
+		}
+	}
 
-	memcpy(buf, &mVcount, sizeof(RmUint32));
-	buf += sizeof(RmUint32);
+	// mirrors NodeAABB::raycast, walking child indices instead of pointers
+	void raycastNode(RmUint32 index,bool &hit,const RmReal *from,const RmReal *dir,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance,RmReal &nearestDistance,RmUint32 &nearestTriIndex)
+	{
+		const MappedMeshNode &node = mNodes[index];
 
-	memcpy(buf, mVertices, (sizeof(RmReal) * (3 * mVcount)));
-	buf += (sizeof(RmReal) * (3 * mVcount));
+		RmReal sect[3];
+		RmReal nd = nearestDistance;
+		if ( !intersectLineSegmentAABB(node.mMin,node.mMax,from,dir,nd,sect) )
+		{
+			return;
+		}
 
-	memcpy(buf, &mTcount, sizeof(RmUint32));
-	buf += sizeof(RmUint32);
+		if ( node.mLeafTriangleIndex != TRI_EOF )
+		{
+			const RmUint32 *scan = &mLeafTriangles[node.mLeafTriangleIndex];
+			RmUint32 count = *scan++;
+			for (RmUint32 i=0; i<count; i++)
+			{
+				RmUint32 tri = *scan++;
+				if ( mRaycastTriangles[tri] != mRaycastFrame )
+				{
+					mRaycastTriangles[tri] = mRaycastFrame;
+					RmReal t;
+					if ( intersectTriangle(tri,from,dir,t) )
+					{
+						bool accept = ( t == nearestDistance && tri < nearestTriIndex );
+						if ( t < nearestDistance || accept )
+						{
+							nearestDistance = t;
+							reportHit(tri,t,from,dir,hitLocation,hitNormal,hitDistance);
+							nearestTriIndex = tri;
+							hit = true;
+						}
+					}
+				}
+			}
+		}
+		else
+		{
+			if ( node.mLeft != TRI_EOF )
+			{
+				raycastNode(node.mLeft,hit,from,dir,hitLocation,hitNormal,hitDistance,nearestDistance,nearestTriIndex);
+			}
+			if ( node.mRight != TRI_EOF )
+			{
+				raycastNode(node.mRight,hit,from,dir,hitLocation,hitNormal,hitDistance,nearestDistance,nearestTriIndex);
+			}
+		}
+	}
 
-	memcpy(buf, mIndices, (sizeof(RmUint32) * (3 * mTcount)));
-	buf += (sizeof(RmUint32) * (3 * mTcount));
+	std::unique_ptr<EQ::ReadOnlyMappedFile>	mFile;
+	RmUint32				mTcount;
+	const RmReal			*mVertices;
+	const RmUint32			*mIndices;
+	const RmReal			*mFaceNormals;
+	const MappedMeshNode	*mNodes;
+	const RmUint32			*mLeafTriangles;
+	RmUint32				mRaycastFrame;
+	std::vector<RmUint32>	mRaycastTriangles;
+};
 
-	memcpy(buf, mRaycastTriangles, (sizeof(RmUint32) * mTcount));
-	buf += (sizeof(RmUint32) * mTcount);
+};
 
+void MyRaycastMesh::bake(std::vector<char>& buffer)
+{
 	if (!mFaceNormals) {
 		RmReal save_face[3];
 		getFaceNormal(0, &save_face[0]);
 	}
 
-	memcpy(buf, mFaceNormals, (sizeof(RmReal) * (3 * mTcount)));
-	buf += (sizeof(RmReal) * (3 * mTcount));
+	MappedMeshHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.mMagic, MAPPED_MESH_MAGIC, sizeof(header.mMagic));
+	header.mVersion = MAPPED_MESH_VERSION;
+	header.mHeaderSize = sizeof(MappedMeshHeader);
+	header.mNodeSize = sizeof(MappedMeshNode);
+	header.mVcount = mVcount;
+	header.mTcount = mTcount;
+	header.mNodeCount = mNodeCount;
+	header.mLeafCount = (RmUint32)mLeafTriangles.size();
+
+	header.mVerticesOffset = alignMappedOffset(sizeof(MappedMeshHeader));
+	header.mIndicesOffset = alignMappedOffset(header.mVerticesOffset + sizeof(RmReal) * 3 * (uint64_t)mVcount);
+	header.mNormalsOffset = alignMappedOffset(header.mIndicesOffset + sizeof(RmUint32) * 3 * (uint64_t)mTcount);
+	header.mNodesOffset = alignMappedOffset(header.mNormalsOffset + sizeof(RmReal) * 3 * (uint64_t)mTcount);
+	header.mLeavesOffset = alignMappedOffset(header.mNodesOffset + sizeof(MappedMeshNode) * (uint64_t)mNodeCount);
+	header.mFileSize = header.mLeavesOffset + sizeof(RmUint32) * (uint64_t)header.mLeafCount;
+
+	buffer.assign(header.mFileSize, 0);
+	char *data = buffer.data();
+
+	memcpy(data, &header, sizeof(header));
+	memcpy(data + header.mVerticesOffset, mVertices, sizeof(RmReal) * 3 * mVcount);
+	memcpy(data + header.mIndicesOffset, mIndices, sizeof(RmUint32) * 3 * mTcount);
+	memcpy(data + header.mNormalsOffset, mFaceNormals, sizeof(RmReal) * 3 * mTcount);
+	if (header.mLeafCount) {
+		memcpy(data + header.mLeavesOffset, mLeafTriangles.data(), sizeof(RmUint32) * header.mLeafCount);
+	}
 
-	memcpy(buf, &mRaycastFrame, sizeof(RmUint32));
-	buf += sizeof(RmUint32);
+	auto nodes = reinterpret_cast<MappedMeshNode *>(data + header.mNodesOffset);
+	for (RmUint32 index = 0; index < mNodeCount; ++index) {
+		const NodeAABB &src = mNodes[index];
+		MappedMeshNode &dst = nodes[index];
+
+		memcpy(dst.mMin, src.mBounds.mMin, sizeof(dst.mMin));
+		memcpy(dst.mMax, src.mBounds.mMax, sizeof(dst.mMax));
+		dst.mLeafTriangleIndex = src.mLeafTriangleIndex;
+		dst.mLeft = src.mLeft ? (RmUint32)(src.mLeft - mNodes) : TRI_EOF;
+		dst.mRight = src.mRight ? (RmUint32)(src.mRight - mNodes) : TRI_EOF;
+	}
+}
+
+void bakeRaycastMesh(RaycastMesh* rm, std::vector<char>& buffer)
+{
+	if (!rm) {
+		buffer.clear();
+		return;
+	}
 
-	RmUint32 lt_size = (RmUint32)mLeafTriangles.size();
-	memcpy(buf, &lt_size, sizeof(RmUint32));
-	buf += sizeof(RmUint32);
+	static_cast<MyRaycastMesh*>(rm)->bake(buffer);
+}
 
-	if (lt_size) {
-		memcpy(buf, &mLeafTriangles[0], (sizeof(RmUint32) * lt_size));
-		buf += (sizeof(RmUint32) * lt_size);
+RaycastMesh* mapRaycastMesh(std::unique_ptr<EQ::ReadOnlyMappedFile> file)
+{
+	if (!file || !file->IsOpen() || file->Size() < sizeof(MappedMeshHeader)) {
+		return nullptr;
 	}
 
-	memcpy(buf, &mNodeCount, sizeof(RmUint32));
-	buf += sizeof(RmUint32);
+	auto data = file->Data();
+	const uint64_t file_size = file->Size();
+	auto header = reinterpret_cast<const MappedMeshHeader *>(data);
 
-	for (RmUint32 index = 0; index < mNodeCount; ++index) {
-		memcpy(buf, &mNodes[index].mBounds.mMin, (sizeof(RmReal) * 3));
-		buf += (sizeof(RmReal) * 3);
-
-		memcpy(buf, &mNodes[index].mBounds.mMax, (sizeof(RmReal) * 3));
-		buf += (sizeof(RmReal) * 3);
-
-		memcpy(buf, &mNodes[index].mLeafTriangleIndex, sizeof(RmUint32));
-		buf += sizeof(RmUint32);
-
-		RmUint32 lNodeIndex = TRI_EOF;
-		if (mNodes[index].mLeft)
-			lNodeIndex = ((uintptr_t)mNodes[index].mLeft - (uintptr_t)mNodes) / sizeof(NodeAABB);
-		memcpy(buf, &lNodeIndex, sizeof(RmUint32));
-		buf += sizeof(RmUint32);
-
-		RmUint32 rNodeIndex = TRI_EOF;
-		if (mNodes[index].mRight)
-			rNodeIndex = ((uintptr_t)mNodes[index].mRight - (uintptr_t)mNodes) / sizeof(NodeAABB);
-		memcpy(buf, &rNodeIndex, sizeof(RmUint32));
-		buf += sizeof(RmUint32);
+	if (memcmp(header->mMagic, MAPPED_MESH_MAGIC, sizeof(header->mMagic)) != 0 ||
+		header->mVersion != MAPPED_MESH_VERSION ||
+		header->mHeaderSize != sizeof(MappedMeshHeader) ||
+		header->mNodeSize != sizeof(MappedMeshNode) ||
+		header->mFileSize != file_size ||
+		header->mNodeCount == 0) {
+		return nullptr;
 	}
+
+	if (!mappedSectionFits(header->mVerticesOffset, sizeof(RmReal) * 3 * (uint64_t)header->mVcount, file_size) ||
+		!mappedSectionFits(header->mIndicesOffset, sizeof(RmUint32) * 3 * (uint64_t)header->mTcount, file_size) ||
+		!mappedSectionFits(header->mNormalsOffset, sizeof(RmReal) * 3 * (uint64_t)header->mTcount, file_size) ||
+		!mappedSectionFits(header->mNodesOffset, sizeof(MappedMeshNode) * (uint64_t)header->mNodeCount, file_size) ||
+		!mappedSectionFits(header->mLeavesOffset, sizeof(RmUint32) * (uint64_t)header->mLeafCount, file_size)) {
+		return nullptr;
+	}
+
+	// the raycast trusts every index below, so a damaged file is refused here and rebuilt from source
+	auto indices = reinterpret_cast<const RmUint32 *>(data + header->mIndicesOffset);
+	for (uint64_t i = 0; i < 3 * (uint64_t)header->mTcount; ++i) {
+		if (indices[i] >= header->mVcount) {
+			return nullptr;
+		}
+	}
+
+	// children are always allocated after their parent, a link back up would recurse forever
+	auto nodes  = reinterpret_cast<const MappedMeshNode *>(data + header->mNodesOffset);
+	auto leaves = reinterpret_cast<const RmUint32 *>(data + header->mLeavesOffset);
+	for (RmUint32 index = 0; index < header->mNodeCount; ++index) {
+		const MappedMeshNode &node = nodes[index];
+		if ((node.mLeft != TRI_EOF && (node.mLeft <= index || node.mLeft >= header->mNodeCount)) ||
+			(node.mRight != TRI_EOF && (node.mRight <= index || node.mRight >= header->mNodeCount))) {
+			return nullptr;
+		}
+
+		if (node.mLeafTriangleIndex == TRI_EOF) {
+			continue;
+		}
+
+		if (node.mLeafTriangleIndex >= header->mLeafCount) {
+			return nullptr;
+		}
+
+		const uint64_t start = node.mLeafTriangleIndex;
+		const uint64_t count = leaves[start];
+		if (start + 1 + count > header->mLeafCount) {
+			return nullptr;
+		}
+
+		for (uint64_t i = start + 1; i <= start + count; ++i) {
+			if (leaves[i] >= header->mTcount) {
+				return nullptr;
+			}
+		}
+	}
+
+	return static_cast<RaycastMesh*>(new MappedRaycastMesh(std::move(file)));
 }
 #endif /*USE_MAP_MMFS*/
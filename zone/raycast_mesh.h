@@ -57,10 +57,15 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 								);
 
 #ifdef USE_MAP_MMFS
+#include <memory>
 #include <vector>
 
-RaycastMesh* loadRaycastMesh(std::vector<char>& rm_buffer, bool& load_success);
-void serializeRaycastMesh(RaycastMesh* rm, std::vector<char>& rm_buffer);
+namespace EQ { class ReadOnlyMappedFile; }
+
+// Baked meshes are a position independent image of the vertices, indices, face normals and BVH; a mapped
+// mesh raycasts straight out of the file mapping so zone processes using the same map share its pages.
+void bakeRaycastMesh(RaycastMesh* rm, std::vector<char>& buffer);
+RaycastMesh* mapRaycastMesh(std::unique_ptr<EQ::ReadOnlyMappedFile> file);
 #endif /*USE_MAP_MMFS*/
 
 #endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "region_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+bool RegionGrid::Contains(const Box &b, const glm::vec3 &p)
+{
+	return !(
+		p.x < b.min_x || p.x > b.max_x ||
+		p.y < b.min_y || p.y > b.max_y ||
+		p.z < b.min_z || p.z > b.max_z
+	);
+}
+
+int64 RegionGrid::CellKey(int32 x, int32 y)
+{
+	return (static_cast<int64>(x) << 32) | static_cast<uint32>(y);
+}
+
+int32 RegionGrid::CellCoordinate(float v)
+{
+	// clamped so out of world and non finite coordinates land in an edge cell instead of overflowing
+	const double c = std::floor(static_cast<double>(v) / CELL_SIZE);
+	if (!(c > -1000000.0)) {
+		return -1000000;
+	}
+
+	return c < 1000000.0 ? static_cast<int32>(c) : 1000000;
+}
+
+void RegionGrid::Clear()
+{
+	m_cells.clear();
+	m_oversized.clear();
+	m_size = 0;
+}
+
+void RegionGrid::Build(const std::vector<Box> &boxes)
+{
+	Clear();
+
+	m_size = boxes.size();
+
+	for (uint32 i = 0; i < boxes.size(); ++i) {
+		const auto &b = boxes[i];
+
+		const int32 x0 = CellCoordinate(b.min_x);
+		const int32 x1 = CellCoordinate(b.max_x);
+		const int32 y0 = CellCoordinate(b.min_y);
+		const int32 y1 = CellCoordinate(b.max_y);
+
+		// inverted boxes never contain anything, nothing to index
+		if (x1 < x0 || y1 < y0) {
+			continue;
+		}
+
+		const int64 span = (static_cast<int64>(x1) - x0 + 1) * (static_cast<int64>(y1) - y0 + 1);
+		if (span > MAX_CELLS_SPAN) {
+			m_oversized.push_back(i);
+			continue;
+		}
+
+		for (int32 x = x0; x <= x1; ++x) {
+			for (int32 y = y0; y <= y1; ++y) {
+				m_cells[CellKey(x, y)].push_back(i);
+			}
+		}
+	}
+}
+
+void RegionGrid::Append(const glm::vec3 &p, std::vector<uint32> &out) const
+{
+	auto it = m_cells.find(CellKey(CellCoordinate(p.x), CellCoordinate(p.y)));
+	if (it != m_cells.end()) {
+		out.insert(out.end(), it->second.begin(), it->second.end());
+	}
+}
+
+void RegionGrid::Query(const glm::vec3 &a, const glm::vec3 &b, std::vector<uint32> &out) const
+{
+	out.clear();
+
+	if (m_size == 0) {
+		return;
+	}
+
+	out.insert(out.end(), m_oversized.begin(), m_oversized.end());
+	Append(a, out);
+	Append(b, out);
+
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+void RegionGrid::Query(const glm::vec3 &p, std::vector<uint32> &out) const
+{
+	Query(p, p, out);
+}
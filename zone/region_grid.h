@@ -0,0 +1,52 @@
+#ifndef EQEMU_REGION_GRID_H
+#define EQEMU_REGION_GRID_H
+
+#include "../common/types.h"
+
+#include <glm/vec3.hpp>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Uniform x/y grid over axis aligned boxes (npc proximities, quest areas, explore activities)
+ *
+ * Boxes are identified by their position in the vector passed to Build. A query returns, in
+ * ascending order, the boxes whose cells hold the queried points; callers still run their exact
+ * containment test on those. Boxes spanning too many cells (zone wide areas) are kept on a
+ * separate list every query returns, the grid is rebuilt wholesale rather than updated in place
+ */
+class RegionGrid {
+public:
+	struct Box {
+		float min_x, max_x;
+		float min_y, max_y;
+		float min_z, max_z;
+	};
+
+	static bool Contains(const Box &b, const glm::vec3 &p);
+
+	void Build(const std::vector<Box> &boxes);
+	void Clear();
+
+	// boxes that may contain either point, a move only enters or leaves boxes holding one of its ends
+	void Query(const glm::vec3 &a, const glm::vec3 &b, std::vector<uint32> &out) const;
+	void Query(const glm::vec3 &p, std::vector<uint32> &out) const;
+
+	bool Empty() const { return m_size == 0; }
+	size_t Size() const { return m_size; }
+
+private:
+	static constexpr float  CELL_SIZE       = 128.0f;
+	static constexpr uint32 MAX_CELLS_SPAN  = 256; // per box, larger ones go to m_oversized
+
+	static int64 CellKey(int32 x, int32 y);
+	static int32 CellCoordinate(float v);
+
+	void Append(const glm::vec3 &p, std::vector<uint32> &out) const;
+
+	std::unordered_map<int64, std::vector<uint32>> m_cells;
+	std::vector<uint32>                            m_oversized;
+	size_t                                         m_size = 0;
+};
+
+#endif //EQEMU_REGION_GRID_H
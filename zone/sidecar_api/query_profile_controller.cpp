@@ -0,0 +1,34 @@
+#include "sidecar_api.h"
+#include "../../common/json/json.hpp"
+#include "../../common/query_profiler.h"
+#include "../../common/strings.h"
+
+// ?limit=N caps the fingerprints returned (by total time), ?reset=1 clears the counters after reading
+void SidecarApi::QueryProfileController(const httplib::Request &req, httplib::Response &res)
+{
+	auto profiler = QueryProfiler::Instance();
+	auto limit    = req.has_param("limit") ? Strings::ToUnsignedInt(req.get_param_value("limit")) : 0;
+
+	nlohmann::json j;
+
+	j["data"]["enabled"] = profiler->IsEnabled();
+	j["data"]["queries"] = nlohmann::json::array();
+
+	for (auto &e: profiler->Snapshot(limit)) {
+		nlohmann::json q;
+		q["fingerprint"] = e.fingerprint;
+		q["count"]       = e.stats.count;
+		q["total_us"]    = e.stats.total_us;
+		q["max_us"]      = e.stats.max_us;
+		q["rows"]        = e.stats.rows;
+		q["bytes"]       = e.stats.bytes;
+		q["bytes_count"] = e.stats.bytes_count;
+		j["data"]["queries"].push_back(q);
+	}
+
+	if (req.has_param("reset") && Strings::ToBool(req.get_param_value("reset"))) {
+		profiler->Reset();
+	}
+
+	res.set_content(j.dump(), "application/json");
+}
@@ -0,0 +1,113 @@
+#include "sidecar_api.h"
+#include "../../common/json/json.hpp"
+#include "../../common/path_manager.h"
+#include "../../common/rulesys.h"
+#include "../../common/strings.h"
+
+#include <algorithm>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// the sidecar runs in its own process, so this reads the snapshots the profiled zones write to logs/quest_profile
+// ?limit=N caps the entries returned, ?sort=total|count|max|avg|alloc|errors, ?zone=short_name only reads that zone,
+// ?stacks=1 returns the sampled Lua stacks in collapsed (flamegraph) format instead
+// counters are reset per zone with #questprofile reset
+void SidecarApi::QuestProfileController(const httplib::Request &req, httplib::Response &res)
+{
+	auto limit  = req.has_param("limit") ? Strings::ToUnsignedInt(req.get_param_value("limit")) : 0;
+	auto sort   = req.has_param("sort") ? Strings::ToLower(req.get_param_value("sort")) : "total";
+	auto zone   = req.has_param("zone") ? Strings::ToLower(req.get_param_value("zone")) : "";
+	bool stacks = req.has_param("stacks") && Strings::ToBool(req.get_param_value("stacks"));
+
+	// snapshots from zones that shut down or stopped profiling are ignored
+	const int64 max_age = std::max(600, RuleI(Logging, QuestProfilerSnapshotIntervalS) * 3);
+
+	nlohmann::json j;
+
+	j["data"]["enabled"] = RuleB(Logging, QuestProfiler);
+	j["data"]["zones"]   = nlohmann::json::array();
+	j["data"]["events"]  = nlohmann::json::array();
+
+	std::string collapsed;
+	std::vector<nlohmann::json> events;
+
+	const auto directory = fmt::format("{}/quest_profile", path.GetLogPath());
+
+	std::error_code ec;
+	if (std::filesystem::is_directory(directory, ec)) {
+		for (const auto &f: std::filesystem::directory_iterator(directory, ec)) {
+			if (f.path().extension() != ".json") {
+				continue;
+			}
+
+			std::ifstream ifs(f.path());
+
+			auto root = nlohmann::json::parse(ifs, nullptr, false);
+			if (root.is_discarded() || !root.is_object()) {
+				continue;
+			}
+
+			const auto zone_name   = root.value("zone", std::string());
+			const auto instance_id = root.value("instance_id", 0);
+
+			if (!zone.empty() && Strings::ToLower(zone_name) != zone) {
+				continue;
+			}
+
+			if (std::time(nullptr) - root.value("updated_at", static_cast<int64>(0)) > max_age) {
+				continue;
+			}
+
+			nlohmann::json z;
+			z["zone"]        = zone_name;
+			z["instance_id"] = instance_id;
+			z["pid"]         = root.value("pid", 0);
+			z["updated_at"]  = root.value("updated_at", static_cast<int64>(0));
+			j["data"]["zones"].push_back(z);
+
+			collapsed += root.value("stacks", std::string());
+
+			if (root.contains("events") && root["events"].is_array()) {
+				for (auto &e: root["events"]) {
+					e["zone"]        = zone_name;
+					e["instance_id"] = instance_id;
+					events.push_back(std::move(e));
+				}
+			}
+		}
+	}
+
+	if (stacks) {
+		res.set_content(collapsed, "text/plain");
+		return;
+	}
+
+	auto key = [&sort](const nlohmann::json &e) -> double {
+		const double count = e.value("count", 0.0);
+
+		if (sort == "count") { return count; }
+		if (sort == "max") { return e.value("max_us", 0.0); }
+		if (sort == "avg") { return count > 0 ? e.value("total_us", 0.0) / count : 0; }
+		if (sort == "alloc") { return e.value("alloc_bytes", 0.0); }
+		if (sort == "errors") { return e.value("errors", 0.0); }
+		return e.value("total_us", 0.0);
+	};
+
+	std::sort(
+		events.begin(), events.end(), [&key](const nlohmann::json &a, const nlohmann::json &b) {
+			return key(a) > key(b);
+		}
+	);
+
+	if (limit > 0 && events.size() > limit) {
+		events.resize(limit);
+	}
+
+	for (auto &e: events) {
+		j["data"]["events"].push_back(std::move(e));
+	}
+
+	res.set_content(j.dump(), "application/json");
+}
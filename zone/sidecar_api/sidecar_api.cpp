@@ -7,6 +7,8 @@
 #include "../zone.h"
 #include "../client.h"
 #include "../../common/json/json.hpp"
+#include "../../common/query_profiler.h"
+#include "../quest_profiler.h"
 #include <csignal>
 
 void CatchSidecarSignal(int sig_num)
@@ -61,6 +63,10 @@ void SidecarApi::BootWebserver(int port, const std::string &key)
 	Zone::Bootup(ZoneID("qrg"), 0, false);
 	zone->StopShutdownTimer();
 
+	// the sidecar has no main loop to apply the rule from
+	QueryProfiler::Instance()->SetEnabled(RuleB(Logging, QueryProfiler));
+	QuestProfiler::Instance()->Process();
+
 	httplib::Server api;
 
 	api.set_logger(SidecarApi::RequestLogHandler);
@@ -105,6 +111,8 @@ void SidecarApi::BootWebserver(int port, const std::string &key)
 	);
 	api.Get("/api/v1/test-controller", SidecarApi::TestController);
 	api.Get("/api/v1/loot-simulate", SidecarApi::LootSimulatorController);
+	api.Get("/api/v1/query-profile", SidecarApi::QueryProfileController);
+	api.Get("/api/v1/quest-profile", SidecarApi::QuestProfileController);
 
 	LogInfo("Webserver API now listening on port [{0}]", web_api_port);
 
@@ -11,6 +11,8 @@ public:
 	static void TestController(const httplib::Request &req, httplib::Response &res);
 	static void LootSimulatorController(const httplib::Request &req, httplib::Response &res);
 	static void MapBestZController(const httplib::Request &req, httplib::Response &res);
+	static void QueryProfileController(const httplib::Request &req, httplib::Response &res);
+	static void QuestProfileController(const httplib::Request &req, httplib::Response &res);
 };
 
 
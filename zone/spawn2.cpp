@@ -34,6 +34,8 @@
 #include "../common/repositories/spawn2_disabled_repository.h"
 #include "../common/repositories/respawn_times_repository.h"
 
+#include <algorithm>
+
 extern EntityList entity_list;
 extern Zone* zone;
 
@@ -107,10 +109,36 @@ Spawn2::Spawn2(uint32 in_spawn2_id, uint32 spawngroup_id,
 		timer.Start(resetTimer());
 		timer.Trigger();
 	}
+
+	if (zone) {
+		zone->spawn_timer_queue.Register(this);
+	}
 }
 
 Spawn2::~Spawn2()
 {
+	if (zone) {
+		zone->spawn_timer_queue.Unregister(this);
+	}
+}
+
+void Spawn2::QueueTimer()
+{
+	if (zone) {
+		zone->spawn_timer_queue.Schedule(this);
+	}
+}
+
+void Spawn2::Enable()
+{
+	enabled = true;
+	QueueTimer();
+}
+
+void Spawn2::SetTimer(uint32 duration)
+{
+	timer.Start(duration);
+	QueueTimer();
 }
 
 uint32 Spawn2::resetTimer()
@@ -350,12 +378,14 @@ void Spawn2::LoadGrid(int start_wp) {
 */
 void Spawn2::Reset() {
 	timer.Start(resetTimer());
+	QueueTimer();
 	npcthis = nullptr;
 	LogSpawns("Spawn2 [{}]: Spawn reset, repop in [{}] ms", spawn2_id, timer.GetRemainingTime());
 }
 
 void Spawn2::Depop() {
 	timer.Disable();
+	QueueTimer();
 	LogSpawns("Spawn2 [{}]: Spawn reset, repop disabled", spawn2_id);
 	npcthis = nullptr;
 }
@@ -368,6 +398,7 @@ void Spawn2::Repop(uint32 delay) {
 		LogSpawns("Spawn2 [{}]: Spawn reset for repop, repop in [{}] ms", spawn2_id, delay);
 		timer.Start(delay);
 	}
+	QueueTimer();
 	npcthis = nullptr;
 }
 
@@ -412,6 +443,7 @@ void Spawn2::ForceDespawn()
 
 	LogSpawns("Spawn2 [{}]: Spawn group [{}] set despawn timer to [{}] ms", spawn2_id, spawngroup_id_, cur);
 	timer.Start(cur);
+	QueueTimer();
 }
 
 //resets our spawn as if we just died
@@ -421,6 +453,7 @@ void Spawn2::DeathReset(bool realdeath)
 	uint32 cur = resetTimer();
 	//set our timer to our reset local
 	timer.Start(cur);
+	QueueTimer();
 
 	//zero out our NPC since he is now gone
 	npcthis = nullptr;
@@ -655,16 +688,10 @@ void Spawn2::SpawnConditionChanged(const SpawnCondition &c, int16 old_value) {
 }
 
 void Zone::SpawnConditionChanged(const SpawnCondition &c, int16 old_value) {
-	LogSpawns("Zone notified that spawn condition [{}] has changed from [{}] to [{}]. Notifying all spawn points", c.condition_id, old_value, c.value);
-
-	LinkedListIterator<Spawn2*> iterator(spawn2_list);
+	LogSpawns("Zone notified that spawn condition [{}] has changed from [{}] to [{}]. Notifying dependent spawn points", c.condition_id, old_value, c.value);
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		Spawn2 *cur = iterator.GetData();
-		if(cur->GetSpawnCondition() == c.condition_id)
-			cur->SpawnConditionChanged(c, old_value);
-		iterator.Advance();
+	for (auto cur : spawn_timer_queue.GetByCondition(c.condition_id)) {
+		cur->SpawnConditionChanged(c, old_value);
 	}
 }
 
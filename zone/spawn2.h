@@ -20,6 +20,7 @@
 
 #include "../common/timer.h"
 #include "npc.h"
+#include "spawn_timer_queue.h"
 
 #define SC_AlwaysEnabled 0
 
@@ -37,7 +38,7 @@ public:
 	~Spawn2();
 
 	void	LoadGrid(int start_wp = 0);
-	void	Enable() { enabled = true; }
+	void	Enable();
 	void	Disable();
 	bool	Enabled() { return enabled; }
 	bool	Process();
@@ -68,16 +69,18 @@ public:
 	void	SetNPCPointer(NPC* n) { npcthis = n; }
 	void	SetNPCPointerNull() { npcthis = nullptr; }
 	Timer	GetTimer() { return timer; }
-	void	SetTimer(uint32 duration) { timer.Start(duration); }
+	void	SetTimer(uint32 duration);
 	uint32  GetKillCount() { return killcount; }
 protected:
 	friend class Zone;
+	template<typename> friend class BasicSpawnTimerQueue;
 	Timer	timer;
 private:
 	uint32	spawn2_id;
 	uint32	respawn_;
 	uint32	resetTimer();
 	uint32	despawnTimer(uint32 despawn_timer);
+	void	QueueTimer();
 
 	uint32	spawngroup_id_;
 	uint32	currentnpcid;
@@ -97,6 +100,8 @@ private:
 	uint32  killcount;
 };
 
+using SpawnTimerQueue = BasicSpawnTimerQueue<Spawn2>;
+
 class SpawnCondition {
 public:
 	typedef enum {
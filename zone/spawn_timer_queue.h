@@ -0,0 +1,114 @@
+#ifndef EQEMU_SPAWN_TIMER_QUEUE_H
+#define EQEMU_SPAWN_TIMER_QUEUE_H
+
+#include "../common/timer.h"
+
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Pending spawn point timers ordered by due time, so the zone only visits
+ * spawn points whose timer can actually fire instead of polling all of them.
+ *
+ * Entries are never removed from the heap in place; rescheduling a spawn point
+ * hands out a new ticket and any older heap entries for it are skipped when popped.
+ *
+ * T is the spawn point, it needs GetSpawnCondition(), Enabled() and a Timer named timer
+ */
+template<typename T>
+class BasicSpawnTimerQueue {
+public:
+	void Register(T *spawn)
+	{
+		m_tickets[spawn] = 0;
+
+		// condition 0 (SC_AlwaysEnabled) is never looked up
+		if (spawn->GetSpawnCondition() != 0) {
+			m_by_condition[spawn->GetSpawnCondition()].push_back(spawn);
+		}
+
+		Schedule(spawn);
+	}
+
+	void Unregister(T *spawn)
+	{
+		m_tickets.erase(spawn);
+
+		auto c = m_by_condition.find(spawn->GetSpawnCondition());
+		if (c != m_by_condition.end()) {
+			auto &v = c->second;
+			v.erase(std::remove(v.begin(), v.end(), spawn), v.end());
+			if (v.empty()) {
+				m_by_condition.erase(c);
+			}
+		}
+	}
+
+	void Schedule(T *spawn)
+	{
+		auto t = m_tickets.find(spawn);
+		if (t == m_tickets.end()) {
+			return;
+		}
+
+		// any entry already in the heap for this spawn point is now stale
+		t->second = ++m_next_ticket;
+
+		if (!spawn->Enabled() || !spawn->timer.Enabled()) {
+			return;
+		}
+
+		// Timer::Check fires once strictly more than the duration has elapsed
+		const uint32 due = Timer::GetCurrentTime() + spawn->timer.GetRemainingTime() + 1;
+
+		m_queue.push(Entry{due, t->second, spawn});
+	}
+
+	void PopDue(uint32 now, std::vector<std::pair<T *, uint64>> &out)
+	{
+		while (!m_queue.empty() && m_queue.top().due <= now) {
+			const auto e = m_queue.top();
+			m_queue.pop();
+
+			if (IsCurrent(e.spawn, e.ticket)) {
+				out.emplace_back(e.spawn, e.ticket);
+			}
+		}
+	}
+
+	bool IsCurrent(T *spawn, uint64 ticket) const
+	{
+		auto t = m_tickets.find(spawn);
+		return t != m_tickets.end() && t->second == ticket;
+	}
+
+	std::vector<T *> GetByCondition(uint16 condition_id) const
+	{
+		auto c = m_by_condition.find(condition_id);
+		if (c == m_by_condition.end()) {
+			return {};
+		}
+
+		return c->second;
+	}
+
+	size_t GetQueuedCount() const { return m_queue.size(); }
+
+private:
+	struct Entry {
+		uint32  due;
+		uint64  ticket;
+		T      *spawn;
+
+		bool operator>(const Entry &o) const { return due > o.due || (due == o.due && ticket > o.ticket); }
+	};
+
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_queue;
+	std::unordered_map<T *, uint64>                                     m_tickets;
+	std::unordered_map<uint16, std::vector<T *>>                        m_by_condition;
+	uint64                                                              m_next_ticket = 0;
+};
+
+#endif //EQEMU_SPAWN_TIMER_QUEUE_H
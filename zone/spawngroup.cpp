@@ -165,6 +165,92 @@ void SpawnGroupList::ClearSpawnGroups()
 
 bool ZoneDatabase::LoadSpawnGroups(const char *zone_name, uint16 version, SpawnGroupList *spawn_group_list)
 {
+	// groups baked into shared memory are copied, only groups missing from the segment are queried
+	std::string group_filter;
+
+	if (RuleB(NPC, UseSharedMemorySpawnContent) && HasSharedSpawnGroups()) {
+		auto results = QueryDatabase(
+			fmt::format(
+				"SELECT DISTINCT spawngroupID FROM spawn2 WHERE (version = {} OR version = -1) AND zone = '{}' {}",
+				version,
+				zone_name,
+				ContentFilterCriteria::apply()
+			)
+		);
+		if (!results.Success()) {
+			return false;
+		}
+
+		std::vector<uint32> missing;
+		uint32              entries = 0;
+
+		for (auto row: results) {
+			const uint32 spawn_group_id = Strings::ToUnsignedInt(row[0]);
+
+			auto g = GetSharedSpawnGroup(spawn_group_id);
+			if (!g) {
+				missing.emplace_back(spawn_group_id);
+				continue;
+			}
+
+			auto new_spawn_group = std::make_unique<SpawnGroup>(
+				g->id,
+				const_cast<char *>(g->name),
+				g->spawn_limit,
+				g->dist,
+				g->max_x,
+				g->min_x,
+				g->max_y,
+				g->min_y,
+				g->delay,
+				g->despawn,
+				g->despawn_timer,
+				g->min_delay,
+				g->wp_spawns
+			);
+
+			for (uint32 i = 0; i < g->entry_count; ++i) {
+				const auto &e = g->Entries()[i];
+				if (!content_service.DoesPassContentFiltering(
+					ContentFlags{
+						.min_expansion = e.min_expansion,
+						.max_expansion = e.max_expansion,
+						.content_flags = e.content_flags,
+						.content_flags_disabled = e.content_flags_disabled
+					}
+				)) {
+					continue;
+				}
+
+				auto new_spawn_entry = std::make_unique<SpawnEntry>(
+					e.npc_id,
+					e.chance,
+					e.condition_value_filter,
+					e.npc_spawn_limit,
+					e.min_time,
+					e.max_time
+				);
+
+				new_spawn_group->AddSpawnEntry(new_spawn_entry);
+				entries++;
+			}
+
+			spawn_group_list->AddSpawnGroup(new_spawn_group);
+		}
+
+		LogInfo(
+			"Loaded [{}] spawn group(s) [{}] spawn entries via shared memory",
+			Strings::Commify(results.RowCount() - missing.size()),
+			Strings::Commify(entries)
+		);
+
+		if (missing.empty()) {
+			return true;
+		}
+
+		group_filter = fmt::format("AND spawn2.spawngroupID IN ({})", Strings::Join(missing, ", "));
+	}
+
 	std::string query = fmt::format(
 		SQL(
 			SELECT
@@ -190,10 +276,12 @@ bool ZoneDatabase::LoadSpawnGroups(const char *zone_name, uint16 version, SpawnG
 				(spawn2.version = {} OR version = -1)
 				AND zone = '{}'
 				{}
+				{}
 		),
 		version,
 		zone_name,
-		ContentFilterCriteria::apply()
+		ContentFilterCriteria::apply(),
+		group_filter
 	);
 
 	auto results = QueryDatabase(query);
@@ -245,10 +333,12 @@ bool ZoneDatabase::LoadSpawnGroups(const char *zone_name, uint16 version, SpawnG
 				spawnentry.spawngroupID = spawn2.spawngroupID
 				AND
 				zone = '{}'
+				{}
 				{}
 					),
 		zone_name,
-		ContentFilterCriteria::apply("spawnentry")
+		ContentFilterCriteria::apply("spawnentry"),
+		group_filter
 	);
 
 	results = QueryDatabase(query);
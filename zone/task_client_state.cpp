@@ -456,7 +456,17 @@ const TaskInformation* ClientTaskState::GetTaskData(const ClientTaskInformation&
 	return task_manager->GetTaskData(client_task.task_id);
 }
 
-bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter, int task_id,
+static TaskMatchNames GetTaskMatchNames(const TaskUpdateFilter& filter)
+{
+	if (!filter.mob)
+	{
+		return {};
+	}
+
+	return { Strings::ToLower(filter.mob->GetName()), Strings::ToLower(filter.mob->GetCleanName()) };
+}
+
+bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter, const TaskMatchNames& names, int task_id,
 	const ActivityInformation& activity, const ClientActivityInformation& client_activity) const
 {
 	if (activity.goal_method == METHODQUEST && activity.goal_method != filter.method)
@@ -500,7 +510,7 @@ bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter,
 
 	// item is only checked for updates that provide an item to check (unlike npc which may be null for non-npcs)
 	if (!activity.item_id_list.empty() && filter.item_id != 0 &&
-	    !Tasks::IsInMatchList(activity.item_id_list, std::to_string(filter.item_id)))
+	    !activity.item_matcher.HasId(filter.item_id))
 	{
 		LogTasks("client [{}] task [{}]-[{}] failed item match filter", client->GetName(), task_id, client_activity.activity_id);
 		return false;
@@ -508,9 +518,9 @@ bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter,
 
 	// npc filter supports both npc names and ids in match lists
 	if (!activity.npc_match_list.empty() && (!filter.mob ||
-	    (!Tasks::IsInMatchListPartial(activity.npc_match_list, filter.mob->GetName()) &&
-	     !Tasks::IsInMatchListPartial(activity.npc_match_list, filter.mob->GetCleanName()) &&
-	     !Tasks::IsInMatchList(activity.npc_match_list, std::to_string(filter.mob->GetNPCTypeID())))))
+	    (!activity.npc_matcher.MatchesName(names.name) &&
+	     !activity.npc_matcher.MatchesName(names.clean_name) &&
+	     !activity.npc_matcher.HasId(filter.mob->GetNPCTypeID()))))
 	{
 		LogTasks("client [{}] task [{}]-[{}] failed npc match filter", client->GetName(), task_id, client_activity.activity_id);
 		return false;
@@ -528,6 +538,8 @@ int ClientTaskState::UpdateTasks(Client* client, const TaskUpdateFilter& filter,
 
 	int max_updated = 0;
 
+	const TaskMatchNames names = GetTaskMatchNames(filter);
+
 	for (const auto& client_task : m_active_tasks)
 	{
 		const auto task = GetTaskData(client_task);
@@ -547,7 +559,7 @@ int ClientTaskState::UpdateTasks(Client* client, const TaskUpdateFilter& filter,
 		{
 			const ActivityInformation& activity = task->activity_information[client_activity.activity_id];
 
-			if (CanUpdate(client, filter, client_task.task_id, activity, client_activity))
+			if (CanUpdate(client, filter, names, client_task.task_id, activity, client_activity))
 			{
 				if (parse->PlayerHasQuestSub(EVENT_TASK_BEFORE_UPDATE)) {
 					const auto& export_string = fmt::format(
@@ -598,6 +610,8 @@ std::pair<int, int> ClientTaskState::FindTask(Client* client, const TaskUpdateFi
 		return std::make_pair(0, 0);
 	}
 
+	const TaskMatchNames names = GetTaskMatchNames(filter);
+
 	for (const auto& client_task : m_active_tasks)
 	{
 		const auto task = GetTaskData(client_task);
@@ -609,7 +623,7 @@ std::pair<int, int> ClientTaskState::FindTask(Client* client, const TaskUpdateFi
 		for (const ClientActivityInformation& client_activity : client_task.activity)
 		{
 			const ActivityInformation& activity = task->activity_information[client_activity.activity_id];
-			if (CanUpdate(client, filter, client_task.task_id, activity, client_activity))
+			if (CanUpdate(client, filter, names, client_task.task_id, activity, client_activity))
 			{
 				return std::make_pair(client_task.task_id, client_activity.activity_id);
 			}
@@ -698,6 +712,11 @@ void ClientTaskState::UpdateTasksForItem(Client* client, TaskActivityType type,
 
 void ClientTaskState::UpdateTasksOnLoot(Client* client, Corpse* corpse, int item_id, int count)
 {
+	if (task_manager && !task_manager->CanItemUpdateTasks(TaskActivityType::Loot, item_id))
+	{
+		return;
+	}
+
 	LogTasks("corpse [{}] item_id [{}] count [{}]", corpse->GetName(), item_id, count);
 
 	TaskUpdateFilter filter{};
@@ -710,6 +729,12 @@ void ClientTaskState::UpdateTasksOnLoot(Client* client, Corpse* corpse, int item
 
 void ClientTaskState::UpdateTasksOnExplore(Client* client, const glm::vec4& pos)
 {
+	// most moves are nowhere near an explore area of this zone
+	if (task_manager && !task_manager->CanPositionUpdateTasks(TaskActivityType::Explore, glm::vec3(pos)))
+	{
+		return;
+	}
+
 	LogTasksDetail("client [{}]", client->GetName());
 
 	TaskUpdateFilter filter{};
@@ -750,6 +775,11 @@ bool ClientTaskState::UpdateTasksOnDeliver(Client* client, std::vector<EQ::ItemI
 			continue;
 		}
 
+		if (task_manager && !task_manager->CanItemUpdateTasks(TaskActivityType::Deliver, item->GetID()))
+		{
+			continue;
+		}
+
 		filter.item_id = item->GetID();
 
 		int count = item->IsStackable() ? item->GetCharges() : 1;
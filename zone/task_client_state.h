@@ -30,6 +30,13 @@ struct TaskUpdateFilter
 	TaskMethodType method = TaskMethodType::METHODSINGLEID;
 };
 
+// lower cased names of the filter mob, built once per update for the activity npc match lists
+struct TaskMatchNames
+{
+	std::string name;
+	std::string clean_name;
+};
+
 class ClientTaskState {
 
 public:
@@ -108,7 +115,7 @@ private:
 
 	void AddOffer(int task_id, uint16_t npc_entity_id) { m_last_offers.push_back({task_id, npc_entity_id}); };
 	void AddReplayTimer(Client *client, ClientTaskInformation& client_task, const TaskInformation& task);
-	bool CanUpdate(Client* client, const TaskUpdateFilter& filter, int task_id,
+	bool CanUpdate(Client* client, const TaskUpdateFilter& filter, const TaskMatchNames& names, int task_id,
 		const ActivityInformation& activity, const ClientActivityInformation& client_activity) const;
 	int DispatchEventTaskComplete(Client* client, ClientTaskInformation& client_task, int activity_id);
 	std::pair<int, int> FindTask(Client* client, const TaskUpdateFilter& filter) const;
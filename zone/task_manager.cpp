@@ -204,6 +204,8 @@ bool TaskManager::LoadTasks(int single_task)
 		ad->description_override = a.description_override;
 		ad->npc_match_list       = a.npc_match_list;
 		ad->item_id_list         = a.item_id_list;
+		ad->npc_matcher.Compile(a.npc_match_list);
+		ad->item_matcher.Compile(a.item_id_list);
 		ad->dz_switch_id         = a.dz_switch_id;
 		ad->goal_method          = (TaskMethodType) a.goalmethod;
 		ad->goal_count           = a.goalcount;
@@ -271,6 +273,8 @@ bool TaskManager::LoadTasks(int single_task)
 
 	LogInfo("Loaded [{}] task activities", task_activities.size());
 
+	m_activity_index_built = false;
+
 	return true;
 }
 
@@ -1828,8 +1832,143 @@ void TaskManager::SyncClientSharedTaskStateToLocal(
 	}
 }
 
+const TaskManager::ActivityMatchIndex* TaskManager::GetActivityIndex(TaskActivityType type)
+{
+	if (!zone) {
+		return nullptr;
+	}
+
+	if (!m_activity_index_built ||
+		m_activity_index_zone_id != zone->GetZoneID() ||
+		m_activity_index_zone_version != zone->GetInstanceVersion()) {
+		m_activity_index.clear();
+		m_activity_index_zone_id      = zone->GetZoneID();
+		m_activity_index_zone_version = zone->GetInstanceVersion();
+		m_activity_index_built        = true;
+
+		std::unordered_map<int, std::unordered_set<std::string>> names;
+
+		for (const auto &[task_id, task]: m_task_data) {
+			for (int i = 0; i < task.activity_count; ++i) {
+				const auto &a = task.activity_information[i];
+
+				// quest goals are only updated by scripts, other zones never match
+				if (a.goal_method == METHODQUEST || !a.CheckZone(m_activity_index_zone_id, m_activity_index_zone_version)) {
+					continue;
+				}
+
+				auto &index = m_activity_index[static_cast<int>(a.activity_type)];
+
+				if (a.npc_match_list.empty()) {
+					index.any_npc = true;
+				}
+				else {
+					index.npc_ids.insert(a.npc_matcher.ids.begin(), a.npc_matcher.ids.end());
+					names[static_cast<int>(a.activity_type)].insert(a.npc_matcher.names.begin(), a.npc_matcher.names.end());
+				}
+
+				if (a.item_id_list.empty()) {
+					index.any_item = true;
+				}
+				else {
+					index.item_ids.insert(a.item_matcher.ids.begin(), a.item_matcher.ids.end());
+				}
+
+				if (a.has_area) {
+					index.area_boxes.push_back({ a.min_x, a.max_x, a.min_y, a.max_y, a.min_z, a.max_z });
+				}
+				else {
+					index.any_area = true;
+				}
+			}
+		}
+
+		for (auto &[type, n]: names) {
+			m_activity_index[type].npc_names.assign(n.begin(), n.end());
+		}
+
+		for (auto &[type, index]: m_activity_index) {
+			index.areas.Build(index.area_boxes);
+		}
+
+		LogTasksDetail(
+			"Indexed activities of [{}] activity type(s) for zone [{}] version [{}]",
+			m_activity_index.size(),
+			m_activity_index_zone_id,
+			m_activity_index_zone_version
+		);
+	}
+
+	auto it = m_activity_index.find(static_cast<int>(type));
+	return it != m_activity_index.end() ? &it->second : nullptr;
+}
+
+bool TaskManager::CanNPCUpdateTasks(TaskActivityType type, Mob* npc)
+{
+	auto index = GetActivityIndex(type);
+	if (!index) {
+		return false;
+	}
+
+	if (!npc) {
+		return index->any_npc;
+	}
+
+	if (index->any_npc || index->npc_ids.find(npc->GetNPCTypeID()) != index->npc_ids.end()) {
+		return true;
+	}
+
+	if (index->npc_names.empty()) {
+		return false;
+	}
+
+	const std::string name       = Strings::ToLower(npc->GetName());
+	const std::string clean_name = Strings::ToLower(npc->GetCleanName());
+
+	return std::any_of(
+		index->npc_names.begin(), index->npc_names.end(), [&](const std::string &n) {
+			return name.find(n) != std::string::npos || clean_name.find(n) != std::string::npos;
+		}
+	);
+}
+
+bool TaskManager::CanItemUpdateTasks(TaskActivityType type, uint32 item_id)
+{
+	auto index = GetActivityIndex(type);
+	if (!index) {
+		return false;
+	}
+
+	return item_id == 0 || index->any_item || index->item_ids.find(item_id) != index->item_ids.end();
+}
+
+bool TaskManager::CanPositionUpdateTasks(TaskActivityType type, const glm::vec3& pos)
+{
+	auto index = GetActivityIndex(type);
+	if (!index) {
+		return false;
+	}
+
+	if (index->any_area || !RuleB(TaskSystem, EnableTaskProximity)) {
+		return true;
+	}
+
+	std::vector<uint32> candidates;
+	index->areas.Query(pos, candidates);
+
+	return std::any_of(
+		candidates.begin(), candidates.end(), [&](uint32 i) {
+			return RegionGrid::Contains(index->area_boxes[i], pos);
+		}
+	);
+}
+
 void TaskManager::HandleUpdateTasksOnKill(Client* client, NPC* npc)
 {
+	if (!CanNPCUpdateTasks(TaskActivityType::Kill, npc)) {
+		return;
+	}
+
 	for (auto &c: client->GetPartyMembers()) {
 		if (!c->ClientDataLoaded() || !c->HasTaskState()) {
 			continue;
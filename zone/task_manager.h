@@ -3,9 +3,11 @@
 
 #include "tasks.h"
 #include "task_client_state.h"
+#include "region_grid.h"
 #include "../common/types.h"
 #include "../common/repositories/character_tasks_repository.h"
 #include <list>
+#include <unordered_set>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -63,6 +65,12 @@ public:
 
 	void HandleUpdateTasksOnKill(Client* client, NPC* npc);
 
+	// false when no activity of the type that can update in this zone could match the npc or item,
+	// lets callers skip walking every client's tasks
+	bool CanNPCUpdateTasks(TaskActivityType type, Mob* npc);
+	bool CanItemUpdateTasks(TaskActivityType type, uint32 item_id);
+	bool CanPositionUpdateTasks(TaskActivityType type, const glm::vec3& pos);
+
 	const std::unordered_map<uint32_t, TaskInformation>& GetTaskData() const { return m_task_data; }
 	TaskInformation* GetTaskData(int task_id)
 	{
@@ -73,6 +81,26 @@ public:
 private:
 	std::vector<int>                              m_task_sets[MAXTASKSETS];
 	std::unordered_map<uint32_t, TaskInformation> m_task_data;
+
+	// match lists of the activities that can update in the zone the index was built for
+	struct ActivityMatchIndex {
+		bool                         any_npc  = false; // an activity without an npc match list
+		bool                         any_item = false; // an activity without an item id list
+		std::unordered_set<uint32_t> npc_ids;
+		std::unordered_set<uint32_t> item_ids;
+		std::vector<std::string>     npc_names;
+		bool                         any_area = false; // an activity without an area
+		std::vector<RegionGrid::Box> area_boxes;
+		RegionGrid                   areas;
+	};
+
+	std::unordered_map<int, ActivityMatchIndex> m_activity_index;
+	bool                                        m_activity_index_built        = false;
+	int                                         m_activity_index_zone_id      = 0;
+	int                                         m_activity_index_zone_version = 0;
+
+	const ActivityMatchIndex* GetActivityIndex(TaskActivityType type);
+
 	void SendActiveTaskDescription(
 		Client *client,
 		int task_id,
@@ -1006,8 +1006,10 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		}
 		ServerChangeWID_Struct* scw = (ServerChangeWID_Struct*)pack->pBuffer;
 		Client* client = entity_list.GetClientByCharID(scw->charid);
-		if (client)
+		if (client) {
 			client->SetWID(scw->newwid);
+			entity_list.IndexMob(client);
+		}
 		break;
 	}
 	case ServerOP_OOCMute: {
@@ -3588,6 +3590,20 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		if (!content_db.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
 			LogError("Loading spells failed!");
 		}
+
+		// types already in the zone npc cache are kept until the cache is cleared
+		if (RuleB(NPC, UseSharedMemoryNPCTypes)) {
+			LogInfo("Loading npc types");
+			content_db.LoadNPCTypes(hotfix_name);
+		}
+
+		// spawn groups, merchant lists and factions already loaded into the zone are kept until reloaded
+		if (RuleB(NPC, UseSharedMemorySpawnContent)) {
+			LogInfo("Loading npc factions, spawn groups and merchants");
+			content_db.LoadNPCFactionLists(hotfix_name);
+			content_db.LoadSharedSpawnGroups(hotfix_name);
+			content_db.LoadMerchantLists(hotfix_name);
+		}
 		break;
 	}
 	case ServerOP_CZClientMessageString:
@@ -17,6 +17,7 @@
 */
 
 #include <float.h>
+#include <future>
 #include <iostream>
 #include <stdlib.h>
 #include <string.h>
@@ -636,8 +637,57 @@ void Zone::LoadTempMerchantData()
 	}
 }
 
+bool Zone::LoadSharedMerchantList(uint32 merchant_id)
+{
+	auto l = content_db.GetSharedMerchantList(merchant_id);
+	if (!l) {
+		return false;
+	}
+
+	auto &merchant_list = merchanttable[merchant_id];
+	merchant_list.clear();
+
+	for (uint32 i = 0; i < l->item_count; ++i) {
+		const auto &e = l->Items()[i];
+		if (!content_service.DoesPassContentFiltering(
+			ContentFlags{
+				.min_expansion = e.min_expansion,
+				.max_expansion = e.max_expansion,
+				.content_flags = e.content_flags,
+				.content_flags_disabled = e.content_flags_disabled
+			}
+		)) {
+			continue;
+		}
+
+		merchant_list.push_back(
+			MerchantList{
+				.id = merchant_id,
+				.slot = e.slot,
+				.item = e.item,
+				.faction_required = e.faction_required,
+				.level_required = e.level_required,
+				.min_status = e.min_status,
+				.max_status = e.max_status,
+				.alt_currency_cost = e.alt_currency_cost,
+				.classes_required = e.classes_required,
+				.probability = e.probability,
+				.bucket_name = e.bucket_name,
+				.bucket_value = e.bucket_value,
+				.bucket_comparison = e.bucket_comparison
+			}
+		);
+	}
+
+	return true;
+}
+
 void Zone::LoadNewMerchantData(uint32 merchantid) {
 
+	if (RuleB(NPC, UseSharedMemorySpawnContent) && LoadSharedMerchantList(merchantid)) {
+		return;
+	}
+
 	std::list<MerchantList> merchant_list;
 
 	const auto& l = MerchantlistRepository::GetWhere(
@@ -676,22 +726,57 @@ void Zone::LoadNewMerchantData(uint32 merchantid) {
 
 void Zone::LoadMerchants()
 {
+	std::string merchant_filter = fmt::format(
+		SQL(
+			SELECT `merchant_id` FROM `npc_types` WHERE `id` IN (
+				SELECT `npcID` FROM `spawnentry` WHERE `spawngroupID` IN (
+					SELECT `spawngroupID` FROM `spawn2` WHERE `zone` = '{}' AND (`version` = {} OR `version` = -1)
+				)
+			)
+		),
+		GetShortName(),
+		GetInstanceVersion()
+	);
+
+	// lists baked into shared memory are copied, only lists missing from the segment are queried
+	if (RuleB(NPC, UseSharedMemorySpawnContent) && content_db.HasSharedMerchantLists()) {
+		auto results = content_db.QueryDatabase(fmt::format("SELECT DISTINCT m.merchant_id FROM ({}) AS m", merchant_filter));
+
+		std::vector<uint32> missing;
+		uint32              loaded = 0;
+
+		for (auto row: results) {
+			const uint32 merchant_id = Strings::ToUnsignedInt(row[0]);
+			if (!merchant_id) {
+				continue;
+			}
+
+			if (LoadSharedMerchantList(merchant_id)) {
+				loaded++;
+			}
+			else {
+				missing.emplace_back(merchant_id);
+			}
+		}
+
+		LogInfo("Loaded [{}] merchant lists via shared memory", Strings::Commify(loaded));
+
+		if (missing.empty()) {
+			return;
+		}
+
+		merchant_filter = Strings::Join(missing, ", ");
+	}
+
 	const auto& l = MerchantlistRepository::GetWhere(
 		content_db,
 		fmt::format(
 			SQL(
-				`merchantid` IN (
-					SELECT `merchant_id` FROM `npc_types` WHERE `id` IN (
-						SELECT `npcID` FROM `spawnentry` WHERE `spawngroupID` IN (
-							SELECT `spawngroupID` FROM `spawn2` WHERE `zone` = '{}' AND (`version` = {} OR `version` = -1)
-						)
-					)
-				)
+				`merchantid` IN ({})
 				{}
 				ORDER BY `merchantlist`.`slot`
 			),
-			GetShortName(),
-			GetInstanceVersion(),
+			merchant_filter,
 			ContentFilterCriteria::apply()
 		)
 	);
@@ -1125,6 +1210,48 @@ Zone::~Zone() {
 	safe_delete(GuildBanks);
 }
 
+/**
+ * Runs one zone boot stage and logs how long it took
+ */
+template<typename F>
+static auto TimedBootStage(const char *stage, F &&f) -> decltype(f())
+{
+	BenchTimer bench;
+
+	if constexpr (std::is_void_v<decltype(f())>) {
+		f();
+		LogZoningDetail("Boot stage [{}] took [{}s]", stage, bench.elapsed());
+	}
+	else {
+		auto r = f();
+		LogZoningDetail("Boot stage [{}] took [{}s]", stage, bench.elapsed());
+		return r;
+	}
+}
+
+/**
+ * Runs a geometry load and returns it with how long it took, logging nothing itself. Off the main
+ * thread the loader's own logs are deferred, they are written out once the boot joins the loads
+ */
+template<typename F>
+static auto TimedGeometryLoad(bool off_main_thread, F &&f) -> std::pair<decltype(f()), double>
+{
+	if (off_main_thread) {
+		EQEmuLogSys::DeferLogsOnThisThread();
+	}
+
+	BenchTimer bench;
+	auto r = f();
+	const double elapsed = bench.elapsed();
+
+	// async may hand out pooled threads, leave this one as it was found
+	if (off_main_thread) {
+		EQEmuLogSys::DeferLogsOnThisThread(false);
+	}
+
+	return {r, elapsed};
+}
+
 //Modified for timezones.
 bool Zone::Init(bool is_static) {
 	SetStaticZone(is_static);
@@ -1149,76 +1276,122 @@ bool Zone::Init(bool is_static) {
 		return false;
 	}
 
-	zonemap  = Map::LoadMapFile(map_name);
-	watermap = WaterMap::LoadWaterMapfile(map_name);
-	pathing  = IPathfinder::Load(map_name);
+	BenchTimer boot_timer;
 
-	LogInfo("Loading timezone data");
-	zone_time.setEQTimeZone(content_db.GetZoneTimezone(zoneid, GetInstanceVersion()));
+	// map, water map and navmesh are plain file parses that share nothing with the database stages,
+	// so they load on worker threads and are joined before the first stage that queries geometry
+	const bool        parallel_geometry = RuleB(Zone, ParallelGeometryLoad);
+	const auto        geometry_policy   = parallel_geometry ? std::launch::async : std::launch::deferred;
+	const std::string geometry_name     = map_name;
 
-	LoadLDoNTraps();
-	LoadLDoNTrapEntries();
+	auto map_future = std::async(geometry_policy, [geometry_name, parallel_geometry]() {
+		return TimedGeometryLoad(parallel_geometry, [&]() { return Map::LoadMapFile(geometry_name); });
+	});
+	auto water_map_future = std::async(geometry_policy, [geometry_name, parallel_geometry]() {
+		return TimedGeometryLoad(parallel_geometry, [&]() { return WaterMap::LoadWaterMapfile(geometry_name); });
+	});
+	auto pathing_future = std::async(geometry_policy, [geometry_name, parallel_geometry]() {
+		return TimedGeometryLoad(parallel_geometry, [&]() { return IPathfinder::Load(geometry_name); });
+	});
 
-	LoadDynamicZoneTemplates();
-	DynamicZone::CacheAllFromDatabase();
-	Expedition::CacheAllFromDatabase();
+	// logging stays on the main thread, EQEmuLogSys outputs are not thread safe
+	auto join_geometry = [&]() {
+		if (!map_future.valid()) {
+			return;
+		}
 
-	content_db.LoadGlobalLoot();
+		const auto [map, map_seconds]             = map_future.get();
+		const auto [water_map, water_map_seconds] = water_map_future.get();
+		const auto [path, pathing_seconds]        = pathing_future.get();
 
-	npc_scale_manager->LoadScaleData();
+		zonemap  = map;
+		watermap = water_map;
+		pathing  = path;
 
-	LoadGrids();
+		LogSys.ProcessDeferredLogs();
+
+		LogZoningDetail("Boot stage [map] took [{}s]", map_seconds);
+		LogZoningDetail("Boot stage [water map] took [{}s]", water_map_seconds);
+		LogZoningDetail("Boot stage [navmesh] took [{}s]", pathing_seconds);
+	};
+
+	LogInfo("Loading timezone data");
+	TimedBootStage("timezone", [&]() { zone_time.setEQTimeZone(content_db.GetZoneTimezone(zoneid, GetInstanceVersion())); });
+
+	TimedBootStage("ldon traps", [&]() {
+		LoadLDoNTraps();
+		LoadLDoNTrapEntries();
+	});
+
+	TimedBootStage("dynamic zones", [&]() {
+		LoadDynamicZoneTemplates();
+		DynamicZone::CacheAllFromDatabase();
+		Expedition::CacheAllFromDatabase();
+	});
+
+	TimedBootStage("global loot", [&]() { content_db.LoadGlobalLoot(); });
+	TimedBootStage("npc scaling", [&]() { npc_scale_manager->LoadScaleData(); });
+	TimedBootStage("grids", [&]() { LoadGrids(); });
 
 	if (RuleB(Zone, LevelBasedEXPMods)) {
-		LoadLevelEXPMods();
+		TimedBootStage("level exp mods", [&]() { LoadLevelEXPMods(); });
 	}
 
-	RespawnTimesRepository::ClearExpiredRespawnTimers(database);
+	TimedBootStage("expired respawn timers", [&]() { RespawnTimesRepository::ClearExpiredRespawnTimers(database); });
 
 	// make sure that anything that needs to be loaded prior to scripts is loaded before here
 	// this is to ensure that the scripts have access to the data they need
-	parse->ReloadQuests(true);
-
-	spawn_conditions.LoadSpawnConditions(short_name, instanceid);
+	TimedBootStage("quests", [&]() { parse->ReloadQuests(true); });
 
-	content_db.LoadStaticZonePoints(&zone_point_list, short_name, GetInstanceVersion());
+	TimedBootStage("spawn conditions", [&]() { spawn_conditions.LoadSpawnConditions(short_name, instanceid); });
+	TimedBootStage("zone points", [&]() { content_db.LoadStaticZonePoints(&zone_point_list, short_name, GetInstanceVersion()); });
 
-	if (!content_db.LoadSpawnGroups(short_name, GetInstanceVersion(), &spawn_group_list)) {
+	if (!TimedBootStage("spawn groups", [&]() { return content_db.LoadSpawnGroups(short_name, GetInstanceVersion(), &spawn_group_list); })) {
 		LogError("Loading spawn groups failed");
+		join_geometry();
 		return false;
 	}
 
-	content_db.PopulateZoneSpawnList(zoneid, spawn2_list, GetInstanceVersion());
-	database.LoadCharacterCorpses(zoneid, instanceid);
-
-	content_db.LoadTraps(short_name, GetInstanceVersion());
+	TimedBootStage("spawn points", [&]() { content_db.PopulateZoneSpawnList(zoneid, spawn2_list, GetInstanceVersion()); });
+	TimedBootStage("corpses", [&]() { database.LoadCharacterCorpses(zoneid, instanceid); });
+	TimedBootStage("traps", [&]() { content_db.LoadTraps(short_name, GetInstanceVersion()); });
 
 	LogInfo("Loading adventure flavor text");
-	LoadAdventureFlavor();
-	LoadGroundSpawns();
-	LoadZoneObjects();
-	LoadZoneDoors();
-	LoadZoneBlockedSpells();
-	LoadVeteranRewards();
-	LoadAlternateCurrencies();
-	LoadNPCEmotes(&npc_emote_list);
-	LoadAlternateAdvancement();
-	LoadBaseData();
-	LoadMerchants();
-	LoadTempMerchantData();
+	TimedBootStage("adventure flavor", [&]() { LoadAdventureFlavor(); });
+
+	// ground spawns snap to the map, everything from here on may use geometry
+	TimedBootStage("geometry join", [&]() { join_geometry(); });
+
+	TimedBootStage("ground spawns", [&]() { LoadGroundSpawns(); });
+	TimedBootStage("objects", [&]() { LoadZoneObjects(); });
+	TimedBootStage("doors", [&]() { LoadZoneDoors(); });
+	TimedBootStage("blocked spells", [&]() { LoadZoneBlockedSpells(); });
+	TimedBootStage("veteran rewards", [&]() { LoadVeteranRewards(); });
+	TimedBootStage("alternate currencies", [&]() { LoadAlternateCurrencies(); });
+	TimedBootStage("npc emotes", [&]() { LoadNPCEmotes(&npc_emote_list); });
+	TimedBootStage("alternate advancement", [&]() { LoadAlternateAdvancement(); });
+	TimedBootStage("base data", [&]() { LoadBaseData(); });
+	TimedBootStage("merchants", [&]() {
+		LoadMerchants();
+		LoadTempMerchantData();
+	});
 
 	// Merc data
 	if (RuleB(Mercs, AllowMercs)) {
-		LoadMercenaryTemplates();
-		LoadMercenarySpells();
+		TimedBootStage("mercenaries", [&]() {
+			LoadMercenaryTemplates();
+			LoadMercenarySpells();
+		});
 	}
 
-	petition_list.ClearPetitions();
-	petition_list.ReadDatabase();
+	TimedBootStage("petitions", [&]() {
+		petition_list.ClearPetitions();
+		petition_list.ReadDatabase();
+	});
 
-	guild_mgr.LoadGuilds();
+	TimedBootStage("guilds", [&]() { guild_mgr.LoadGuilds(); });
 
-	LogInfo("Zone booted successfully zone_id [{}] time_offset [{}]", zoneid, zone_time.getEQTimeZone());
+	LogInfo("Zone booted successfully zone_id [{}] time_offset [{}] took [{}s]", zoneid, zone_time.getEQTimeZone(), boot_timer.elapsed());
 
 	// logging origination information
 	LogSys.origination_info.zone_short_name = zone->short_name;
@@ -1520,17 +1693,33 @@ bool Zone::Process() {
 
 	if (spawn2_timer.Check()) {
 
-		LinkedListIterator<Spawn2 *> iterator(spawn2_list);
-
 		EQ::InventoryProfile::CleanDirty();
 
-		iterator.Reset();
-		while (iterator.MoreElements()) {
-			if (iterator.GetData()->Process()) {
-				iterator.Advance();
+		std::vector<std::pair<Spawn2 *, uint64>> due;
+		spawn_timer_queue.PopDue(Timer::GetCurrentTime(), due);
+
+		for (auto &e: due) {
+			// an earlier spawn point this tick may have rescheduled or removed this one
+			if (!spawn_timer_queue.IsCurrent(e.first, e.second)) {
+				continue;
 			}
-			else {
-				iterator.RemoveCurrent();
+
+			if (e.first->Process()) {
+				// Process did not restart the timer if it is still pending; keep polling it like before
+				if (spawn_timer_queue.IsCurrent(e.first, e.second)) {
+					spawn_timer_queue.Schedule(e.first);
+				}
+				continue;
+			}
+
+			LinkedListIterator<Spawn2 *> iterator(spawn2_list);
+			iterator.Reset();
+			while (iterator.MoreElements()) {
+				if (iterator.GetData() == e.first) {
+					iterator.RemoveCurrent();
+					break;
+				}
+				iterator.Advance();
 			}
 		}
 
@@ -1539,6 +1728,8 @@ bool Zone::Process() {
 		}
 	}
 
+	parse->ProcessQuestFileChanges();
+
 	if (hot_reload_timer.Check() && IsQuestHotReloadQueued()) {
 
 		LogHotReloadDetail("Hot reload timer check...");
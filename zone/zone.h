@@ -212,6 +212,7 @@ public:
 	QGlobalCache *GetQGlobals() { return qGlobals; }
 	SpawnConditionManager spawn_conditions;
 	SpawnGroupList        spawn_group_list;
+	SpawnTimerQueue       spawn_timer_queue;
 
 	std::list<AltCurrencyDefinition_Struct>          AlternateCurrencies;
 	std::list<InternalVeteranReward>                 VeteranRewards;
@@ -292,6 +293,7 @@ public:
 	void DoAdventureAssassinationCountIncrease();
 	void DoAdventureCountIncrease();
 	void LoadMerchants();
+	bool LoadSharedMerchantList(uint32 merchant_id);
 	void GetTimeSync();
 	void LoadAdventureFlavor();
 	void LoadAlternateAdvancement();
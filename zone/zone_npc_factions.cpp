@@ -1,5 +1,6 @@
 #include <vector>
 #include "zone.h"
+#include "../common/faction.h"
 #include "../common/repositories/npc_faction_repository.h"
 #include "../common/repositories/npc_faction_entries_repository.h"
 
@@ -42,6 +43,45 @@ void Zone::LoadNPCFactions(const std::vector<uint32> &npc_faction_ids)
 		return;
 	}
 
+	// lists baked into shared memory are copied, only lists missing from the segment are queried
+	if (RuleB(NPC, UseSharedMemorySpawnContent) && content_db.HasSharedNPCFactionLists()) {
+		std::vector<uint32> missing_npc_faction_ids = { };
+
+		for (const auto& id : new_npc_faction_ids) {
+			auto l = content_db.GetSharedNPCFactionList(id);
+			if (!l) {
+				missing_npc_faction_ids.emplace_back(id);
+				continue;
+			}
+
+			m_npc_factions.emplace_back(
+				NpcFactionRepository::NpcFaction{
+					.id = static_cast<int32_t>(l->id),
+					.name = "",
+					.primaryfaction = static_cast<int32_t>(l->primaryfaction),
+					.ignore_primary_assist = static_cast<int8_t>(!l->assistprimaryfaction)
+				}
+			);
+
+			for (int i = 0; i < MAX_NPC_FACTIONS && l->factionid[i]; ++i) {
+				m_npc_faction_entries.emplace_back(
+					NpcFactionEntriesRepository::NpcFactionEntries{
+						.npc_faction_id = l->id,
+						.faction_id = l->factionid[i],
+						.value = l->factionvalue[i],
+						.npc_value = l->factionnpcvalue[i],
+						.temp = static_cast<int8_t>(l->factiontemp[i])
+					}
+				);
+			}
+		}
+
+		new_npc_faction_ids = missing_npc_faction_ids;
+		if (new_npc_faction_ids.empty()) {
+			return;
+		}
+	}
+
 	auto npc_factions = NpcFactionRepository::GetWhere(
 		content_db,
 		fmt::format(
@@ -53,10 +53,14 @@
 
 #include "../common/repositories/trader_repository.h"
 #include "../common/repositories/character_evolving_items_repository.h"
+#include "../common/repositories/inventory_repository.h"
+#include "../common/repositories/inventory_snapshots_repository.h"
 
 #include <ctime>
 #include <iostream>
 #include <fmt/format.h>
+#include <map>
+#include <set>
 
 extern Zone* zone;
 
@@ -1313,6 +1317,22 @@ bool ZoneDatabase::NoRentExpired(const std::string& name)
 
 bool ZoneDatabase::SaveCharacterInvSnapshot(uint32 character_id) {
 	uint32 time_index = time(nullptr);
+
+	// snapshots after the first in a chain only hold the slots that changed since the previous one
+	const int max_deltas = RuleI(Character, InvSnapshotMaxDeltas);
+	if (max_deltas > 0) {
+		const uint32 latest          = InventorySnapshotsRepository::GetLatestTimeIndex(*this, character_id);
+		const uint32 base_time_index = latest ? InventorySnapshotsRepository::GetBaseTimeIndex(*this, character_id, latest) : 0;
+
+		if (
+			base_time_index &&
+			latest < time_index &&
+			InventorySnapshotsRepository::CountDeltas(*this, character_id, base_time_index) < max_deltas
+		) {
+			return SaveCharacterInvSnapshotDelta(character_id, time_index, base_time_index, latest);
+		}
+	}
+
 	std::string query = StringFormat(
 		"INSERT "
 		"INTO"
@@ -1367,6 +1387,81 @@ bool ZoneDatabase::SaveCharacterInvSnapshot(uint32 character_id) {
 	return results.Success();
 }
 
+bool ZoneDatabase::SaveCharacterInvSnapshotDelta(uint32 character_id, uint32 time_index, uint32 base_time_index, uint32 previous_time_index) {
+	auto previous = InventorySnapshotsRepository::GetInventoryAt(*this, character_id, previous_time_index);
+
+	const auto inventory = InventoryRepository::GetWhere(
+		*this,
+		fmt::format(
+			"`character_id` = {}",
+			character_id
+		)
+	);
+
+	std::vector<InventorySnapshotsRepository::InventorySnapshots> v;
+
+	for (const auto& i : inventory) {
+		auto e = InventorySnapshotsRepository::NewEntity();
+
+		e.time_index          = time_index;
+		e.charid              = character_id;
+		e.slotid              = i.slot_id;
+		e.itemid              = i.item_id;
+		e.charges             = i.charges;
+		e.color               = i.color;
+		e.augslot1            = i.augment_one;
+		e.augslot2            = i.augment_two;
+		e.augslot3            = i.augment_three;
+		e.augslot4            = i.augment_four;
+		e.augslot5            = i.augment_five;
+		e.augslot6            = i.augment_six;
+		e.instnodrop          = i.instnodrop;
+		e.custom_data         = i.custom_data;
+		e.ornamenticon        = i.ornament_icon;
+		e.ornamentidfile      = i.ornament_idfile;
+		e.ornament_hero_model = i.ornament_hero_model;
+		e.guid                = i.guid;
+		e.base_time_index     = base_time_index;
+
+		auto p = previous.find(e.slotid);
+		if (p != previous.end()) {
+			const bool unchanged = InventorySnapshotsRepository::IsSameItem(p->second, e);
+
+			previous.erase(p);
+
+			if (unchanged) {
+				continue;
+			}
+		}
+
+		v.emplace_back(e);
+	}
+
+	// whatever is left was emptied since the previous snapshot
+	for (const auto& [slot_id, p] : previous) {
+		auto e = InventorySnapshotsRepository::NewEntity();
+
+		e.time_index      = time_index;
+		e.charid          = character_id;
+		e.slotid          = slot_id;
+		e.removed         = 1;
+		e.base_time_index = base_time_index;
+
+		v.emplace_back(e);
+	}
+
+	if (v.empty()) {
+		LogInventory("[{}] (unchanged since [{}])", character_id, previous_time_index);
+		return true;
+	}
+
+	const bool success = InventorySnapshotsRepository::InsertMany(*this, v) == static_cast<int>(v.size());
+
+	LogInventory("[{}] delta of [{}] slot(s) on [{}] ([{}])", character_id, v.size(), base_time_index, (success ? "pass" : "fail"));
+
+	return success;
+}
+
 int ZoneDatabase::CountCharacterInvSnapshots(uint32 character_id) {
 	std::string query = StringFormat(
 		"SELECT"
@@ -1402,6 +1497,9 @@ void ZoneDatabase::ClearCharacterInvSnapshots(uint32 character_id, bool from_now
 	uint32 del_time = time(nullptr);
 	if (!from_now) { del_time -= RuleI(Character, InvSnapshotHistoryD) * 86400; }
 
+	// deltas that outlive their base are rewritten as full snapshots first
+	InventorySnapshotsRepository::RebaseInventorySnapshots(*this, del_time, character_id);
+
 	std::string query = StringFormat(
 		"DELETE "
 		"FROM"
@@ -1420,16 +1518,15 @@ void ZoneDatabase::ListCharacterInvSnapshots(uint32 character_id, std::list<std:
 	std::string query = StringFormat(
 		"SELECT"
 		" `time_index`,"
-		" COUNT(*) "
+		" `slotid`,"
+		" `removed`,"
+		" `base_time_index` "
 		"FROM"
 		" `inventory_snapshots` "
 		"WHERE"
 		" `charid` = %u "
-		"GROUP BY"
-		" `time_index` "
 		"ORDER BY"
-		" `time_index` "
-		"DESC",
+		" `time_index`",
 		character_id
 	);
 	auto results = QueryDatabase(query);
@@ -1437,8 +1534,30 @@ void ZoneDatabase::ListCharacterInvSnapshots(uint32 character_id, std::list<std:
 	if (!results.Success())
 		return;
 
-	for (auto row : results)
-		is_list.emplace_back(std::pair<uint32, int>(Strings::ToUnsignedInt(row[0]), Strings::ToInt(row[1])));
+	// replay the chains so deltas report the item count of the inventory they represent
+	std::set<uint32> slots;
+	uint32 chain_base_time_index = 0;
+
+	for (auto row = results.begin(); row != results.end();) {
+		const uint32 time_index = Strings::ToUnsignedInt(row[0]);
+		const uint32 base_time_index = Strings::ToUnsignedInt(row[3]);
+
+		if ((base_time_index ? base_time_index : time_index) != chain_base_time_index) {
+			chain_base_time_index = (base_time_index ? base_time_index : time_index);
+			slots.clear();
+		}
+
+		for (; row != results.end() && Strings::ToUnsignedInt(row[0]) == time_index; ++row) {
+			if (Strings::ToInt(row[2])) {
+				slots.erase(Strings::ToUnsignedInt(row[1]));
+			}
+			else {
+				slots.insert(Strings::ToUnsignedInt(row[1]));
+			}
+		}
+
+		is_list.emplace_front(std::pair<uint32, int>(time_index, slots.size()));
+	}
 }
 
 bool ZoneDatabase::ValidateCharacterInvSnapshotTimestamp(uint32 character_id, uint32 timestamp) {
@@ -1467,113 +1586,40 @@ bool ZoneDatabase::ValidateCharacterInvSnapshotTimestamp(uint32 character_id, ui
 }
 
 void ZoneDatabase::ParseCharacterInvSnapshot(uint32 character_id, uint32 timestamp, std::list<std::pair<int16, uint32>> &parse_list) {
-	std::string query = StringFormat(
-		"SELECT"
-		" `slotid`,"
-		" `itemid` "
-		"FROM"
-		" `inventory_snapshots` "
-		"WHERE"
-		" `charid` = %u "
-		"AND"
-		" `time_index` = %u "
-		"ORDER BY"
-		" `slotid`",
-		character_id,
-		timestamp
-	);
-	auto results = QueryDatabase(query);
-
-	if (!results.Success())
-		return;
-
-	for (auto row : results)
-		parse_list.emplace_back(std::pair<int16, uint32>(Strings::ToInt(row[0]), Strings::ToUnsignedInt(row[1])));
+	for (const auto& [slot_id, e] : InventorySnapshotsRepository::GetInventoryAt(*this, character_id, timestamp))
+		parse_list.emplace_back(std::pair<int16, uint32>(slot_id, e.itemid));
 }
 
 void ZoneDatabase::DivergeCharacterInvSnapshotFromInventory(uint32 character_id, uint32 timestamp, std::list<std::pair<int16, uint32>> &compare_list) {
-	std::string query = StringFormat(
-		"SELECT"
-		" slotid,"
-		" itemid "
-		"FROM"
-		" `inventory_snapshots` "
-		"WHERE"
-		" `time_index` = %u "
-		"AND"
-		" `charid` = %u "
-		"AND"
-		" `slotid` NOT IN "
-		"("
-		"SELECT"
-		" a.`slotid` "
-		"FROM"
-		" `inventory_snapshots` a "
-		"JOIN"
-		" `inventory` b "
-		"USING"
-		" (`slot_id`, `item_id`) "
-		"WHERE"
-		" a.`time_index` = %u "
-		"AND"
-		" a.`charid` = %u "
-		"AND"
-		" b.`character_id` = %u"
-		")",
-		timestamp,
-		character_id,
-		timestamp,
-		character_id,
-		character_id
-	);
-	auto results = QueryDatabase(query);
+	const auto snapshot = InventorySnapshotsRepository::GetInventoryAt(*this, character_id, timestamp);
 
-	if (!results.Success())
-		return;
+	std::map<uint32, uint32> inventory;
+	for (const auto& e : InventoryRepository::GetWhere(*this, fmt::format("`character_id` = {}", character_id)))
+		inventory[e.slot_id] = e.item_id;
 
-	for (auto row : results)
-		compare_list.emplace_back(std::pair<int16, uint32>(Strings::ToInt(row[0]), Strings::ToUnsignedInt(row[1])));
+	for (const auto& [slot_id, e] : snapshot) {
+		auto i = inventory.find(slot_id);
+		if (i == inventory.end() || i->second != e.itemid)
+			compare_list.emplace_back(std::pair<int16, uint32>(slot_id, e.itemid));
+	}
 }
 
 void ZoneDatabase::DivergeCharacterInventoryFromInvSnapshot(uint32 character_id, uint32 timestamp, std::list<std::pair<int16, uint32>> &compare_list) {
-	std::string query = StringFormat(
-		"SELECT"
-		" `slotid`,"
-		" `itemid` "
-		"FROM"
-		" `inventory` "
-		"WHERE"
-		" `character_id` = %u "
-		"AND"
-		" `slotid` NOT IN "
-		"("
-		"SELECT"
-		" a.`slotid` "
-		"FROM"
-		" `inventory` a "
-		"JOIN"
-		" `inventory_snapshots` b "
-		"USING"
-		" (`slotid`, `itemid`) "
-		"WHERE"
-		" b.`time_index` = %u "
-		"AND"
-		" b.`charid` = %u "
-		"AND"
-		" a.`character_id` = %u"
-		")",
-		character_id,
-		timestamp,
-		character_id,
-		character_id
-	);
-	auto results = QueryDatabase(query);
+	const auto snapshot = InventorySnapshotsRepository::GetInventoryAt(*this, character_id, timestamp);
 
-	if (!results.Success())
-		return;
+	const auto inventory = InventoryRepository::GetWhere(
+		*this,
+		fmt::format(
+			"`character_id` = {} ORDER BY `slot_id`",
+			character_id
+		)
+	);
 
-	for (auto row : results)
-		compare_list.emplace_back(std::pair<int16, uint32>(Strings::ToInt(row[0]), Strings::ToUnsignedInt(row[1])));
+	for (const auto& e : inventory) {
+		auto s = snapshot.find(e.slot_id);
+		if (s == snapshot.end() || s->second.itemid != e.item_id)
+			compare_list.emplace_back(std::pair<int16, uint32>(e.slot_id, e.item_id));
+	}
 }
 
 bool ZoneDatabase::RestoreCharacterInvSnapshot(uint32 character_id, uint32 timestamp) {
@@ -1584,6 +1630,34 @@ bool ZoneDatabase::RestoreCharacterInvSnapshot(uint32 character_id, uint32 times
 		return false;
 	}
 
+	std::vector<InventoryRepository::Inventory> v;
+
+	for (const auto& [slot_id, e] : InventorySnapshotsRepository::GetInventoryAt(*this, character_id, timestamp)) {
+		auto i = InventoryRepository::NewEntity();
+
+		i.character_id        = character_id;
+		i.slot_id             = slot_id;
+		i.item_id             = e.itemid;
+		i.charges             = e.charges;
+		i.color               = e.color;
+		i.augment_one         = e.augslot1;
+		i.augment_two         = e.augslot2;
+		i.augment_three       = e.augslot3;
+		i.augment_four        = e.augslot4;
+		i.augment_five        = e.augslot5;
+		i.augment_six         = e.augslot6;
+		i.instnodrop          = e.instnodrop;
+		i.custom_data         = e.custom_data;
+		i.ornament_icon       = e.ornamenticon;
+		i.ornament_idfile     = e.ornamentidfile;
+		i.ornament_hero_model = e.ornament_hero_model;
+		i.guid                = e.guid;
+
+		v.emplace_back(i);
+	}
+
+	TransactionBegin();
+
 	std::string query = StringFormat(
 		"DELETE "
 		"FROM"
@@ -1593,64 +1667,19 @@ bool ZoneDatabase::RestoreCharacterInvSnapshot(uint32 character_id, uint32 times
 		character_id
 	);
 	auto results = database.QueryDatabase(query);
-	if (!results.Success())
-		return false;
 
-	query = StringFormat(
-		"INSERT "
-		"INTO"
-		" `inventory` "
-		"(`character_id`,"
-		" `slot_id`,"
-		" `item_id`,"
-		" `charges`,"
-		" `color`,"
-		" `augment_one`,"
-		" `augment_two`,"
-		" `augment_three`,"
-		" `augment_four`,"
-		" `augment_five`,"
-		" `augment_six`,"
-		" `instnodrop`,"
-		" `custom_data`,"
-		" `ornament_icon`,"
-		" `ornament_idfile`,"
-		" `ornament_hero_model`,"
-		" `guid` "
-		") "
-		"SELECT"
-		" `charid`,"
-		" `slotid`,"
-		" `itemid`,"
-		" `charges`,"
-		" `color`,"
-		" `augslot1`,"
-		" `augslot2`,"
-		" `augslot3`,"
-		" `augslot4`,"
-		" `augslot5`,"
-		" `augslot6`,"
-		" `instnodrop`,"
-		" `custom_data`,"
-		" `ornamenticon`,"
-		" `ornamentidfile`,"
-		" `ornament_hero_model`, "
-		" `guid` "
-		"FROM"
-		" `inventory_snapshots` "
-		"WHERE"
-		" `charid` = %u "
-		"AND"
-		" `time_index` = %u",
-		character_id,
-		timestamp
-	);
-	results = database.QueryDatabase(query);
+	bool success = results.Success() && (v.empty() || InventoryRepository::InsertMany(*this, v) == static_cast<int>(v.size()));
+	if (success) {
+		TransactionCommit();
+	}
+	else {
+		TransactionRollback();
+	}
 
 	LogInventory("[{}] snapshot for [{}] @ [{}]",
-		(results.Success() ? "restored" : "failed to restore"), character_id, timestamp);
+		(success ? "restored" : "failed to restore"), character_id, timestamp);
 
-	return results.Success();
+	return success;
 }
 
 const NPCType *ZoneDatabase::LoadNPCTypesData(uint32 npc_type_id, bool bulk_load /*= false*/)
@@ -1663,134 +1692,56 @@ const NPCType *ZoneDatabase::LoadNPCTypesData(uint32 npc_type_id, bool bulk_load
 		return itr->second;
 	}
 
+	const std::string spawn_npc_ids = fmt::format(
+		SQL(
+			select npcID from spawnentry where spawngroupID IN (
+				select spawngroupID from spawn2 where `zone` = '{}' and (`version` = {} OR `version` = -1)
+			)
+		),
+		zone->GetShortName(),
+		zone->GetInstanceVersion()
+	);
+
 	std::string filter = fmt::format("id = {}", npc_type_id);
 
 	if (bulk_load) {
 		LogDebug("Performing bulk NPC Types load");
 
-		filter = fmt::format(
-			SQL(
-				id IN (
-					select npcID from spawnentry where spawngroupID IN (
-						select spawngroupID from spawn2 where `zone` = '{}' and (`version` = {} OR `version` = -1)
-					)
-				)
-			),
-			zone->GetShortName(),
-			zone->GetInstanceVersion()
-		);
+		filter = fmt::format("id IN ({})", spawn_npc_ids);
 	}
 
 	std::vector<uint32> npc_ids;
 	std::vector<uint32> npc_faction_ids;
 	std::vector<uint32> loottable_ids;
 
-	for (NpcTypesRepository::NpcTypes &n : NpcTypesRepository::GetWhere((Database &) content_db, filter)) {
-		NPCType *t;
-		t = new NPCType;
-		memset(t, 0, sizeof *t);
-
-		t->npc_id = n.id;
-
-		strn0cpy(t->name, n.name.c_str(), 50);
-
-		t->level              = n.level;
-		t->race               = n.race;
-		t->class_             = n.class_;
-		t->max_hp             = n.hp;
-		t->current_hp         = n.hp;
-		t->Mana               = n.mana;
-		t->gender             = n.gender;
-		t->texture            = n.texture;
-		t->helmtexture        = n.helmtexture;
-		t->herosforgemodel    = n.herosforgemodel;
-		t->size               = n.size;
-		t->loottable_id       = n.loottable_id;
-		t->merchanttype       = n.merchant_id;
-		t->alt_currency_type  = n.alt_currency_id;
-		t->adventure_template = n.adventure_template_id;
-		t->trap_template      = n.trap_template;
-		t->attack_speed       = n.attack_speed;
-		t->STR                = n.STR;
-		t->STA                = n.STA;
-		t->DEX                = n.DEX;
-		t->AGI                = n.AGI;
-		t->INT                = n._INT;
-		t->WIS                = n.WIS;
-		t->CHA                = n.CHA;
-		t->MR                 = n.MR;
-		t->CR                 = n.CR;
-		t->DR                 = n.DR;
-		t->FR                 = n.FR;
-		t->PR                 = n.PR;
-		t->Corrup             = n.Corrup;
-		t->PhR                = n.PhR;
-		t->min_dmg            = n.mindmg;
-		t->max_dmg            = n.maxdmg;
-		t->attack_count       = n.attack_count;
-		t->is_parcel_merchant = n.is_parcel_merchant ? true : false;
-		t->greed              = n.greed;
-
-		if (!n.special_abilities.empty()) {
-			strn0cpy(t->special_abilities, n.special_abilities.c_str(), 512);
-		}
-		else {
-			t->special_abilities[0] = '\0';
+	auto add_npc_type = [&](NPCType *t) -> bool {
+		// If NPC with duplicate NPC id already in table,
+		// free item we attempted to add.
+		if (zone->npctable.find(t->npc_id) != zone->npctable.end()) {
+			std::cerr << "Error loading duplicate NPC " << t->npc_id << std::endl;
+			delete t;
+			return false;
 		}
 
-		if (n.loottable_id > 0) {
-			// check if we already have this loottable_id before inserting it
-			if (std::find(loottable_ids.begin(), loottable_ids.end(), n.loottable_id) == loottable_ids.end()) {
-				loottable_ids.emplace_back(n.loottable_id);
-			}
+		if (RuleB(NPC, DisableLastNames)) {
+			t->lastname[0] = '\0';
 		}
 
-		t->npc_spells_id         = n.npc_spells_id;
-		t->npc_spells_effects_id = n.npc_spells_effects_id;
-		t->d_melee_texture1      = n.d_melee_texture1;
-		t->d_melee_texture2      = n.d_melee_texture2;
-		strn0cpy(t->ammo_idfile, n.ammo_idfile.c_str(), 30);
-		t->prim_melee_type = n.prim_melee_type;
-		t->sec_melee_type  = n.sec_melee_type;
-		t->ranged_type     = n.ranged_type;
-		t->runspeed        = n.runspeed;
-		t->findable        = n.findable != 0;
-		t->is_quest_npc    = n.isquest != 0;
-		t->trackable       = n.trackable != 0;
-		t->hp_regen        = n.hp_regen_rate;
-		t->mana_regen      = n.mana_regen_rate;
-
-		// set default value for aggroradius
-		t->aggroradius = (int32) n.aggroradius;
-		if (t->aggroradius <= 0) {
-			t->aggroradius = 70;
-		}
+		zone->npctable[t->npc_id] = t;
+		npc = t;
 
-		t->assistradius = (int32) n.assistradius;
-		if (t->assistradius <= 0) {
-			t->assistradius = t->aggroradius;
+		// If NPC ID is not in npc_ids, add to vector
+		if (!std::count(npc_ids.begin(), npc_ids.end(), t->npc_id)) {
+			npc_ids.emplace_back(t->npc_id);
 		}
 
-		if (n.bodytype > 0) {
-			t->bodytype = n.bodytype;
-		}
-		else {
-			t->bodytype = 0;
+		if (t->loottable_id > 0) {
+			// check if we already have this loottable_id before inserting it
+			if (std::find(loottable_ids.begin(), loottable_ids.end(), t->loottable_id) == loottable_ids.end()) {
+				loottable_ids.emplace_back(t->loottable_id);
+			}
 		}
 
-		// facial features
-		t->npc_faction_id   = n.npc_faction_id;
-		t->luclinface       = n.face;
-		t->hairstyle        = n.luclin_hairstyle;
-		t->haircolor        = n.luclin_haircolor;
-		t->eyecolor1        = n.luclin_eyecolor;
-		t->eyecolor2        = n.luclin_eyecolor2;
-		t->beardcolor       = n.luclin_beardcolor;
-		t->beard            = n.luclin_beard;
-		t->drakkin_heritage = n.drakkin_heritage;
-		t->drakkin_tattoo   = n.drakkin_tattoo;
-		t->drakkin_details  = n.drakkin_details;
-
 		if (t->npc_faction_id > 0) {
 			if (
 				std::find(
@@ -1803,124 +1754,55 @@ const NPCType *ZoneDatabase::LoadNPCTypesData(uint32 npc_type_id, bool bulk_load
 			}
 		}
 
-		// armor tint
-		uint32 armor_tint_id = n.armortint_id;
-		t->armor_tint.Head.Color = (n.armortint_red & 0xFF) << 16;
-		t->armor_tint.Head.Color |= (n.armortint_green & 0xFF) << 8;
-		t->armor_tint.Head.Color |= (n.armortint_blue & 0xFF);
-		t->armor_tint.Head.Color |= (t->armor_tint.Head.Color) ? (0xFF << 24) : 0;
-
-		if (armor_tint_id != 0) {
-
-			std::string armortint_query = StringFormat(
-				"SELECT red1h, grn1h, blu1h, "
-				"red2c, grn2c, blu2c, "
-				"red3a, grn3a, blu3a, "
-				"red4b, grn4b, blu4b, "
-				"red5g, grn5g, blu5g, "
-				"red6l, grn6l, blu6l, "
-				"red7f, grn7f, blu7f, "
-				"red8x, grn8x, blu8x, "
-				"red9x, grn9x, blu9x "
-				"FROM npc_types_tint WHERE id = %d",
-				armor_tint_id
-			);
+		return true;
+	};
 
-			auto armortint_results = QueryDatabase(armortint_query);
-			if (!armortint_results.Success() || armortint_results.RowCount() == 0) {
-				armor_tint_id = 0;
-			}
-			else {
-				auto& armorTint_row = armortint_results.begin();
-
-				for (int index = EQ::textures::textureBegin; index <= EQ::textures::LastTexture; index++) {
-					t->armor_tint.Slot[index].Color = Strings::ToInt(armorTint_row[index * 3]) << 16;
-					t->armor_tint.Slot[index].Color |= Strings::ToInt(armorTint_row[index * 3 + 1]) << 8;
-					t->armor_tint.Slot[index].Color |= Strings::ToInt(armorTint_row[index * 3 + 2]);
-					t->armor_tint.Slot[index].Color |= (t->armor_tint.Slot[index].Color)
-						? (0xFF << 24) : 0;
-				}
-			}
-		}
-		// Try loading npc_types tint fields if armor tint is 0 or query failed to get results
-		if (armor_tint_id == 0) {
-			for (int index = EQ::textures::armorChest; index < EQ::textures::materialCount; index++) {
-				t->armor_tint.Slot[index].Color = t->armor_tint.Slot[0].Color; // odd way to 'zero-out' the array...
+	// copy what the shared memory segment has, the zone owns (and may edit) its copies
+	// so a hotfix swapping the segment never touches a live npc, only types missing from
+	// the segment (added after the last bake) are read from the database
+	if (RuleB(NPC, UseSharedMemoryNPCTypes) && HasSharedNPCTypes()) {
+		std::vector<uint32> ids = {npc_type_id};
+
+		if (bulk_load) {
+			ids.clear();
+
+			auto results = QueryDatabase(fmt::format("SELECT DISTINCT npcID FROM ({}) AS n", spawn_npc_ids));
+			for (auto row: results) {
+				ids.emplace_back(Strings::ToUnsignedInt(row[0]));
 			}
 		}
 
-		t->see_invis        = n.see_invis;
-		t->see_invis_undead = n.see_invis_undead != 0;    // Set see_invis_undead flag
+		std::vector<std::string> missing;
+		for (const auto &id: ids) {
+			auto shared = GetSharedNPCType(id);
+			if (!shared) {
+				missing.emplace_back(std::to_string(id));
+				continue;
+			}
 
-		if (!RuleB(NPC, DisableLastNames) && !n.lastname.empty()) {
-			strn0cpy(t->lastname, n.lastname.c_str(), sizeof(t->lastname));
+			if (!add_npc_type(new NPCType(*shared))) {
+				return nullptr;
+			}
 		}
 
-		t->qglobal                = n.qglobal != 0;    // qglobal
-		t->AC                     = n.AC;
-		t->npc_aggro              = n.npc_aggro != 0;
-		t->spawn_limit            = n.spawn_limit;
-		t->see_hide               = n.see_hide != 0;
-		t->see_improved_hide      = n.see_improved_hide != 0;
-		t->ATK                    = n.ATK;
-		t->accuracy_rating        = n.Accuracy;
-		t->avoidance_rating       = n.Avoidance;
-		t->slow_mitigation        = n.slow_mitigation;
-		t->maxlevel               = n.maxlevel;
-		t->scalerate              = n.scalerate;
-		t->private_corpse         = n.private_corpse != 0;
-		t->unique_spawn_by_name   = n.unique_spawn_by_name != 0;
-		t->underwater             = n.underwater != 0;
-		t->emoteid                = n.emoteid;
-		t->spellscale             = n.spellscale;
-		t->healscale              = n.healscale;
-		t->no_target_hotkey       = n.no_target_hotkey != 0;
-		t->raid_target            = n.raid_target != 0;
-		t->attack_delay           = n.attack_delay * 100; // TODO: fix DB
-		t->light                  = (n.light & 0x0F);
-		t->armtexture             = n.armtexture;
-		t->bracertexture          = n.bracertexture;
-		t->handtexture            = n.handtexture;
-		t->legtexture             = n.legtexture;
-		t->feettexture            = n.feettexture;
-		t->ignore_despawn         = n.ignore_despawn != 0;
-		t->show_name              = n.show_name != 0;
-		t->untargetable           = n.untargetable != 0;
-		t->charm_ac               = n.charm_ac;
-		t->charm_min_dmg          = n.charm_min_dmg;
-		t->charm_max_dmg          = n.charm_max_dmg;
-		t->charm_attack_delay     = n.charm_attack_delay * 100; // TODO: fix DB
-		t->charm_accuracy_rating  = n.charm_accuracy_rating;
-		t->charm_avoidance_rating = n.charm_avoidance_rating;
-		t->charm_atk              = n.charm_atk;
-		t->skip_global_loot       = n.skip_global_loot != 0;
-		t->rare_spawn             = n.rare_spawn != 0;
-		t->stuck_behavior         = n.stuck_behavior;
-		t->use_model              = n.model;
-		t->flymode                = n.flymode;
-		t->always_aggro           = n.always_aggro != 0;
-		t->exp_mod                = n.exp_mod;
-		t->skip_auto_scale        = false; // hardcoded here for now
-		t->hp_regen_per_second    = n.hp_regen_per_second;
-		t->heroic_strikethrough   = n.heroic_strikethrough;
-		t->faction_amount         = n.faction_amount;
-		t->keeps_sold_items       = n.keeps_sold_items;
-		t->multiquest_enabled     = n.multiquest_enabled != 0;
+		filter = missing.empty() ? "" : fmt::format("id IN ({})", Strings::Implode(", ", missing));
+	}
+
+	if (!filter.empty()) {
+		for (NpcTypesRepository::NpcTypes &n : NpcTypesRepository::GetWhere((Database &) content_db, filter)) {
+			auto t = new NPCType;
+			memset(t, 0, sizeof *t);
 
-		// If NPC with duplicate NPC id already in table,
-		// free item we attempted to add.
-		if (zone->npctable.find(t->npc_id) != zone->npctable.end()) {
-			std::cerr << "Error loading duplicate NPC " << t->npc_id << std::endl;
-			delete t;
-			return nullptr;
-		}
+			NpcTypesTintRepository::NpcTypesTint tint{};
+			if (n.armortint_id != 0) {
+				tint = NpcTypesTintRepository::FindOne(content_db, n.armortint_id);
+			}
 
-		zone->npctable[t->npc_id] = t;
-		npc = t;
+			FillNPCType(t, n, tint.id ? &tint : nullptr);
 
-		// If NPC ID is not in npc_ids, add to vector
-		if (!std::count(npc_ids.begin(), npc_ids.end(), t->npc_id)) {
-			npc_ids.emplace_back(t->npc_id);
+			if (!add_npc_type(t)) {
+				return nullptr;
+			}
 		}
 	}
 
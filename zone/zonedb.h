@@ -656,6 +656,9 @@ public:
 protected:
 	void ZDBInitVars();
 
+	// writes the slots that changed since previous_time_index as a delta on base_time_index
+	bool SaveCharacterInvSnapshotDelta(uint32 character_id, uint32 time_index, uint32 base_time_index, uint32 previous_time_index);
+
 	uint32				max_faction;
 	Faction**			faction_array;
 	uint32 npc_spellseffects_maxid;